@@ -0,0 +1,33 @@
+﻿#include <iostream>
+
+#include "benchmark.h"
+
+#define MAIN_BENCHMARK(NAME) { Benchmark::NAME##Benchmark Benchmark##NAME; if (Benchmark::InternalRun(#NAME, &Benchmark##NAME) == false) { return 1; } }
+
+int main(const int argc, const char* const argv[])
+{
+	if (Benchmark::ParseOptions(argc, argv) == false)
+	{
+		std::cout << "usage: benchmark [--size <bytes>] [--shape <SHAPE>] [--json <path>] [--label <text>]" << std::endl;
+		return 1;
+	}
+
+	// lexer benchmark
+	MAIN_BENCHMARK(Lexer);
+
+	// parser benchmark
+	MAIN_BENCHMARK(Parser);
+
+	// evaluator benchmark
+	MAIN_BENCHMARK(Evaluator);
+
+	const std::string& jsonPath = Benchmark::GetOptions().JsonPath;
+	if (jsonPath.empty() == false && Benchmark::WriteJson(jsonPath) == false)
+	{
+		std::cout << "failed to write json: " << jsonPath << std::endl;
+		return 1;
+	}
+
+	std::cout << "All Benchmarks Finished" << std::endl;
+	return 0;
+}
@@ -0,0 +1,164 @@
+﻿#pragma once
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <common.h>
+#include <lexer.h>
+#include <parser.h>
+#include <evaluator.h>
+
+// Windows 에서는 benchmark.vcxproj 로 빌드합니다. 리눅스에서는 SAL 주석과 __debugbreak 를 msvc_compat.h 가 정의하므로 저장소 루트에서 아래 명령을 한 줄로 실행합니다.
+//   g++ -std=c++17 -O2 -DNDEBUG -Wall -Wextra -Wno-ignored-qualifiers -Wno-unused-value -Wno-reorder -Wno-type-limits -Wno-unused-parameter -Wno-unused-but-set-variable -Wno-unused-function
+//       -pthread -include benchmark/msvc_compat.h -Icompiler/internals -Icompiler/includes compiler/sources/*.cpp benchmark/benchmark.cpp benchmark/sources/*.cpp -o benchmark_bin
+// 끄는 경고는 MSVC 빌드에서 문제가 되지 않는 항목입니다.
+//   ignored-qualifiers, unused-value : const 반환 타입과 case 레이블 뒤의 __COUNTER__; 를 저장소 전체에서 사용합니다.
+//   reorder, type-limits, unused-parameter, unused-but-set-variable : object.h 생성자 초기화 순서, object.cpp 의 offset < 0 검사 등 기존 코드에서 나오는 경고입니다.
+//   unused-function : object.cpp 의 IsSizeMatching 은 MCF_DEBUG_ASSERT 에서만 사용하므로 NDEBUG 빌드에서는 호출되지 않습니다.
+// 커밋마다 같은 옵션으로 --json 과 --label 을 주어 실행하면 결과를 비교할 수 있습니다.
+namespace Benchmark
+{
+	// 측정 시간이 짧으면 오차가 커지므로 최소 반복 시간을 보장합니다.
+	constexpr const double MINIMUM_MEASURE_SECONDS = 0.5;
+
+	// 명령줄로 바꿀 수 있는 설정입니다. 사용법: benchmark [--size <bytes>] [--shape <SHAPE>] [--json <path>] [--label <text>]
+	struct Options final
+	{
+		size_t CorpusBytes = 4 * 1024 * 1024;
+		std::string ShapeFilter;	// 비어 있으면 모든 모양의 코퍼스를 측정합니다.
+		std::string JsonPath;		// 비어 있으면 JSON 을 출력하지 않습니다.
+		std::string Label;			// JSON 에 그대로 기록됩니다. 커밋 해시 등을 넣어 결과를 구분합니다.
+	};
+	Benchmark::Options& GetOptions(void) noexcept;
+	const bool ParseOptions(const int argc, const char* const argv[]) noexcept;
+
+	// 이 프로세스에서 전역 operator new 가 호출된 횟수입니다.
+	const size_t GetAllocationCount(void) noexcept;
+
+	// JSON 으로 출력할 측정 결과 하나입니다.
+	struct Result final
+	{
+		std::string Benchmark;
+		std::string Case;
+		size_t Bytes = 0;
+		size_t Tokens = 0;
+		double Seconds = 0.0;
+		size_t Allocations = 0; // 한번 실행하는 동안의 할당 횟수입니다.
+	};
+	void AddResult(const Benchmark::Result& result) noexcept;
+	// 지금까지 추가된 결과를 path 에 JSON 으로 씁니다.
+	const bool WriteJson(const std::string& path) noexcept;
+
+	namespace Corpus
+	{
+		// 합성 mcf 프로그램의 모양입니다. 모든 모양은 파서가 읽을 수 있는 프로그램을 만듭니다.
+		enum class Shape : unsigned char
+		{
+			INVALID = 0,
+
+			SMALL_FUNCTIONS,		// 짧은 함수가 아주 많은 파일
+			NESTED_WHILE,			// 깊게 중첩된 while 문
+			LARGE_LET_INITIALIZER,	// 원소가 많은 let 초기화 리스트
+			LONG_STRING_LITERAL,	// 긴 문자열 리터럴
+			COMMENT_HEAVY,			// 주석이 대부분인 파일
+
+			// 이 밑으로는 수정하면 안됩니다.
+			COUNT,
+		};
+
+		constexpr const char* SHAPE_STRING_ARRAY[] =
+		{
+			"INVALID",
+
+			"SMALL_FUNCTIONS",
+			"NESTED_WHILE",
+			"LARGE_LET_INITIALIZER",
+			"LONG_STRING_LITERAL",
+			"COMMENT_HEAVY",
+		};
+		constexpr const size_t SHAPE_STRING_ARRAY_SIZE = MCF_ARRAY_SIZE(SHAPE_STRING_ARRAY);
+		static_assert(mcf::ENUM_COUNT<Shape>() == SHAPE_STRING_ARRAY_SIZE, "corpus shape count not matching!");
+
+		constexpr const char* CONVERT_SHAPE_TO_STRING(const Shape value)
+		{
+			return SHAPE_STRING_ARRAY[mcf::ENUM_INDEX(value)];
+		}
+
+		// shape 모양의 선언을 이어 붙여 targetBytes 이상인 mcf 프로그램을 만듭니다. 같은 인자는 항상 같은 결과를 만듭니다.
+		const std::string Generate(const Shape shape, const size_t targetBytes) noexcept;
+	}
+
+	class BaseBenchmark
+	{
+	public:
+		virtual inline ~BaseBenchmark(void) noexcept {}
+		const bool Run(void) const noexcept;
+
+	protected:
+		std::vector<std::string>			_names;
+		std::vector<std::function<bool()>>	_benchmarks;
+	};
+
+	class LexerBenchmark final : public BaseBenchmark
+	{
+	public:
+		explicit LexerBenchmark(void) noexcept;
+	};
+
+	class ParserBenchmark final : public BaseBenchmark
+	{
+	public:
+		explicit ParserBenchmark(void) noexcept;
+	};
+
+	class EvaluatorBenchmark final : public BaseBenchmark
+	{
+	public:
+		explicit EvaluatorBenchmark(void) noexcept;
+	};
+
+	// function 을 MINIMUM_MEASURE_SECONDS 이상 반복 실행하고 한번 실행하는데 걸린 가장 짧은 시간(초)을 반환합니다.
+	inline static const double MeasureBestSeconds(const std::function<void()>& function) noexcept
+	{
+		double bestSeconds = 0.0;
+		double totalSeconds = 0.0;
+		for (size_t i = 0; i == 0 || totalSeconds < MINIMUM_MEASURE_SECONDS; ++i)
+		{
+			const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+			function();
+			const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+			bestSeconds = (i == 0 || seconds < bestSeconds) ? seconds : bestSeconds;
+			totalSeconds += seconds;
+		}
+		return bestSeconds;
+	}
+
+	inline static const char* const CONVERT_SCANNER_TO_STRING(const mcf::Lexer::Scanner scanner) noexcept
+	{
+		constexpr const char* SCANNER_NAMES[] =
+		{
+			"INVALID",
+			"SCALAR",
+			"SSE2",
+			"AVX2",
+		};
+		constexpr const size_t SCANNER_NAMES_SIZE = MCF_ARRAY_SIZE(SCANNER_NAMES);
+		static_assert(mcf::ENUM_COUNT<mcf::Lexer::Scanner>() == SCANNER_NAMES_SIZE, "scanner count not matching!");
+		return SCANNER_NAMES[mcf::ENUM_INDEX(scanner)];
+	}
+
+	inline static bool InternalRun(const char* const name, const Benchmark::BaseBenchmark* const benchmark)
+	{
+		std::cout << "`" << name << ".Run()` Begin" << std::endl;
+		if (benchmark->Run() == false)
+		{
+			std::cout << "\t`" << name << ".Run()` Failed" << std::endl;
+			return false;
+		}
+		std::cout << "`" << name << ".Run()` End" << std::endl;
+		return true;
+	}
+}
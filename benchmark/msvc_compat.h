@@ -0,0 +1,26 @@
+﻿#pragma once
+// MSVC 가 아닌 컴파일러(g++, clang++)로 벤치마크를 빌드할 때 모든 소스보다 먼저 포함하는 호환 헤더입니다. MSVC 빌드에서는 사용하지 않습니다.
+// 컴파일러 소스는 정수 타입으로 <cstdint> 를 사용하므로 여기서는 MSVC 의 sal.h 가 정의하는 SAL 주석과 __debugbreak 만 제공합니다.
+#if !defined(_MSC_VER)
+#include <csignal>
+#include <cstdio>
+
+// sal.h 와 같이 분석 도구를 위한 주석이므로 아무것도 하지 않습니다.
+#define _In_
+#define _In_opt_
+#define _Inout_
+#define _Notnull_
+#define _Out_
+#define _Out_opt_
+#define _Outptr_
+#define _Outptr_opt_
+
+// MSVC 의 내장 함수를 대신합니다. 디버그 빌드에서만 SIGTRAP 으로 멈추고 릴리즈 빌드에서는 아무것도 하지 않습니다.
+inline void __debugbreak(void) noexcept
+{
+#if defined(_DEBUG)
+	fflush(stdout);
+	raise(SIGTRAP);
+#endif
+}
+#endif
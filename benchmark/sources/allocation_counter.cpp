@@ -0,0 +1,41 @@
+﻿#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "../benchmark.h"
+
+// 할당 횟수를 세기 위해 전역 operator new/delete 를 교체합니다. 배열 버전은 기본 구현이 이 함수들을 호출합니다.
+namespace Benchmark
+{
+	namespace Internal
+	{
+		static std::atomic<size_t> AllocationCount(0);
+	}
+}
+
+void* operator new(const size_t size)
+{
+	Benchmark::Internal::AllocationCount.fetch_add(1, std::memory_order_relaxed);
+	void* const memory = std::malloc(size == 0 ? 1 : size);
+	if (memory == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+	return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, const size_t size) noexcept
+{
+	MCF_UNUSED(size);
+	std::free(memory);
+}
+
+const size_t Benchmark::GetAllocationCount(void) noexcept
+{
+	return Internal::AllocationCount.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,17 @@
+﻿#include "../benchmark.h"
+
+const bool Benchmark::BaseBenchmark::Run(void) const noexcept
+{
+	const size_t benchmarkCount = _benchmarks.size();
+	std::cout << "Benchmark Count: " << benchmarkCount << std::endl;
+	for (size_t i = 0; i < benchmarkCount; i++)
+	{
+		std::cout << "\tBenchmark[#" << i << "] `" << _names[i] << "`:" << std::endl;
+		if (_benchmarks[i]() == false)
+		{
+			std::cout << "\t\tFailed" << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,127 @@
+﻿#include <cstdio>
+
+#include "../benchmark.h"
+
+namespace Benchmark
+{
+	namespace Corpus
+	{
+		namespace Internal
+		{
+			constexpr const size_t NESTED_WHILE_DEPTH = 16;
+			constexpr const size_t LET_INITIALIZER_ELEMENT_COUNT = 1024;
+			constexpr const size_t STRING_LITERAL_LENGTH = 4096;
+
+			static void AppendSmallFunction(std::string& source, const size_t index) noexcept
+			{
+				char buffer[256];
+				snprintf(buffer, sizeof(buffer), "func function%zu(value: int32) -> int32\n{\n\tlet local: int32 = value + %zu;\n\treturn local;\n}\n\n", index, index);
+				source += buffer;
+			}
+
+			static void AppendNestedWhile(std::string& source, const size_t index) noexcept
+			{
+				char buffer[256];
+				snprintf(buffer, sizeof(buffer), "func loop%zu(void) -> void\n{\n\tlet counter: dword = 0;\n", index);
+				source += buffer;
+				for (size_t depth = 1; depth <= NESTED_WHILE_DEPTH; ++depth)
+				{
+					source += std::string(depth, '\t');
+					snprintf(buffer, sizeof(buffer), "while (counter < %zu)\n", depth * 10);
+					source += buffer;
+					source += std::string(depth, '\t') + "{\n";
+				}
+				source += std::string(NESTED_WHILE_DEPTH + 1, '\t') + "counter = counter + 1;\n";
+				for (size_t depth = NESTED_WHILE_DEPTH; depth >= 1; --depth)
+				{
+					source += std::string(depth, '\t') + "}\n";
+				}
+				source += "}\n\n";
+			}
+
+			static void AppendLargeLetInitializer(std::string& source, const size_t index) noexcept
+			{
+				char buffer[64];
+				snprintf(buffer, sizeof(buffer), "let table%zu: dword[] =\n{", index);
+				source += buffer;
+				for (size_t i = 0; i < LET_INITIALIZER_ELEMENT_COUNT; ++i)
+				{
+					snprintf(buffer, sizeof(buffer), "%s%zu", (i % 16 == 0) ? "\n\t" : " ", (i * 7919 + index) % 100000);
+					source += buffer;
+					source += (i + 1 < LET_INITIALIZER_ELEMENT_COUNT) ? "," : "";
+				}
+				source += "\n};\n\n";
+			}
+
+			static void AppendLongStringLiteral(std::string& source, const size_t index) noexcept
+			{
+				char buffer[64];
+				snprintf(buffer, sizeof(buffer), "let text%zu: byte[] = \"", index);
+				source += buffer;
+				constexpr const char WORDS[] = "The quick brown fox jumps over the lazy dog. %d 0123456789 ";
+				for (size_t i = 0; i < STRING_LITERAL_LENGTH; ++i)
+				{
+					source += WORDS[(i + index) % (MCF_ARRAY_SIZE(WORDS) - 1)];
+				}
+				source += "\";\n\n";
+			}
+
+			static void AppendCommentHeavy(std::string& source, const size_t index) noexcept
+			{
+				char buffer[256];
+				source += "/*\n";
+				for (size_t i = 0; i < 8; ++i)
+				{
+					source += " * Licensed under the MIT License. Permission is hereby granted, free of charge, to any person obtaining a copy.\n";
+				}
+				source += " */\n";
+				snprintf(buffer, sizeof(buffer), "// value%zu 는 생성된 전역 변수입니다.\n// 주석이 코드보다 훨씬 많은 파일을 흉내냅니다.\nlet value%zu: int32 = %zu; // 끝 주석\n\n", index, index, index);
+				source += buffer;
+			}
+		}
+	}
+}
+
+const std::string Benchmark::Corpus::Generate(const Shape shape, const size_t targetBytes) noexcept
+{
+	std::string source;
+	source.reserve(targetBytes + 64 * 1024);
+	source += "typedef int32: dword;\n\n";
+
+	void (*appendDeclaration)(std::string&, const size_t) = nullptr;
+	constexpr const size_t SHAPE_COUNT_BEGIN = __COUNTER__;
+	switch (shape)
+	{
+	case Shape::SMALL_FUNCTIONS: __COUNTER__;
+		appendDeclaration = Internal::AppendSmallFunction;
+		break;
+
+	case Shape::NESTED_WHILE: __COUNTER__;
+		appendDeclaration = Internal::AppendNestedWhile;
+		break;
+
+	case Shape::LARGE_LET_INITIALIZER: __COUNTER__;
+		appendDeclaration = Internal::AppendLargeLetInitializer;
+		break;
+
+	case Shape::LONG_STRING_LITERAL: __COUNTER__;
+		appendDeclaration = Internal::AppendLongStringLiteral;
+		break;
+
+	case Shape::COMMENT_HEAVY: __COUNTER__;
+		appendDeclaration = Internal::AppendCommentHeavy;
+		break;
+
+	default:
+		std::cout << "unexpected corpus shape: " << mcf::ENUM_INDEX(shape) << std::endl;
+		return source;
+	}
+	constexpr const size_t SHAPE_COUNT = __COUNTER__ - SHAPE_COUNT_BEGIN; // INVALID 를 포함합니다.
+	static_assert(mcf::ENUM_COUNT<Shape>() == SHAPE_COUNT, "corpus shape count is changed. this SWITCH need to be changed as well.");
+
+	for (size_t i = 0; source.size() < targetBytes; ++i)
+	{
+		appendDeclaration(source, i);
+	}
+	return source;
+}
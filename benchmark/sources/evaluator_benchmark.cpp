@@ -0,0 +1,109 @@
+﻿#include "../benchmark.h"
+
+namespace Benchmark
+{
+	namespace Internal
+	{
+		static void DefinePrimitiveTypes(mcf::Object::ScopeTree& scopeTree) noexcept
+		{
+			scopeTree.Global.DefineType("byte", scopeTree.Types.MakePrimitive(false, "byte", 1));
+			scopeTree.Global.DefineType("word", scopeTree.Types.MakePrimitive(false, "word", 2));
+			scopeTree.Global.DefineType("dword", scopeTree.Types.MakePrimitive(false, "dword", 4));
+			scopeTree.Global.DefineType("qword", scopeTree.Types.MakePrimitive(false, "qword", 8));
+		}
+
+		// 평가는 scope 에 정의를 추가하므로 매번 새 ScopeTree 로 평가합니다. threadCount 가 0 이면 하드웨어 스레드 수로 함수 본문을 평가하고 코드를 생성합니다.
+		// 평가 결과의 IR 은 ScopeTree 의 타입과 함수 정보를 가리키므로 ScopeTree 가 살아 있는 동안 Inspect 한 문자열을 반환합니다.
+		template <class ProgramType>
+		static std::string Evaluate(const ProgramType& program, const size_t threadCount = 1, const bool isInspected = true) noexcept
+		{
+			mcf::Object::ScopeTree scopeTree;
+			DefinePrimitiveTypes(scopeTree);
+			mcf::Evaluator::Object evaluator;
+			const mcf::IR::Program::Pointer object = evaluator.EvalProgramParallel(&program, &scopeTree.Global, threadCount);
+			return isInspected ? object->Inspect() : std::string();
+		}
+
+		struct EvaluationCase final
+		{
+			const char* Name;
+			bool IsFlat;
+			size_t ThreadCount;
+		};
+
+		// PARALLEL 은 포인터 AST 의 함수 본문을 주어진 수의 스레드로 나누어 평가하고 코드를 생성합니다. HW 는 하드웨어 스레드 수를 사용합니다.
+		constexpr const EvaluationCase EVALUATION_CASES[] =
+		{
+			{ "POINTER", false, 1 },
+			{ "FLAT", true, 1 },
+			{ "PARALLEL_2", false, 2 },
+			{ "PARALLEL_4", false, 4 },
+			{ "PARALLEL_HW", false, 0 },
+		};
+	}
+}
+
+Benchmark::EvaluatorBenchmark::EvaluatorBenchmark(void) noexcept
+{
+	_names.emplace_back(u8"포인터 AST 와 평면 AST 평가 속도 비교");
+	_benchmarks.emplace_back
+	(
+		[&]() -> bool
+		{
+			const Options& options = GetOptions();
+			for (size_t i = mcf::ENUM_INDEX(Corpus::Shape::SMALL_FUNCTIONS); i < mcf::ENUM_COUNT<Corpus::Shape>(); ++i)
+			{
+				const Corpus::Shape shape = mcf::ENUM_AT<Corpus::Shape>(i);
+				if (options.ShapeFilter.empty() == false && options.ShapeFilter != Corpus::CONVERT_SHAPE_TO_STRING(shape))
+				{
+					continue;
+				}
+
+				const std::string source = Corpus::Generate(shape, options.CorpusBytes);
+				mcf::Parser::Object parser(source, false);
+				mcf::AST::Program program;
+				parser.ParseProgram(program);
+				if (parser.GetErrorCount() != 0)
+				{
+					std::cout << "\t\t" << Corpus::CONVERT_SHAPE_TO_STRING(shape) << ": parse failed" << std::endl;
+					return false;
+				}
+
+				const double convertSeconds = MeasureBestSeconds([&]() { const mcf::AST::Flat::Program converted(program); });
+				const mcf::AST::Flat::Program flatProgram(program);
+
+				// 모든 경우의 평가 결과가 같아야 비교할 의미가 있습니다.
+				const std::string expected = Internal::Evaluate(program);
+				for (const Internal::EvaluationCase& evaluationCase : Internal::EVALUATION_CASES)
+				{
+					const std::string evaluated = evaluationCase.IsFlat ? Internal::Evaluate(flatProgram, evaluationCase.ThreadCount) : Internal::Evaluate(program, evaluationCase.ThreadCount);
+					if (evaluated != expected)
+					{
+						std::cout << "\t\t" << Corpus::CONVERT_SHAPE_TO_STRING(shape) << ": " << evaluationCase.Name << " evaluation result mismatch" << std::endl;
+						return false;
+					}
+				}
+
+				// Tokens 항목에는 평면 AST 의 노드 갯수를 기록합니다. 속도 향상은 한 스레드로 포인터 AST 를 평가한 POINTER 와 비교합니다.
+				const size_t nodeCount = flatProgram.GetNodeCount();
+				double pointerSeconds = 0.0;
+				for (const Internal::EvaluationCase& evaluationCase : Internal::EVALUATION_CASES)
+				{
+					const auto evaluate = [&]() { evaluationCase.IsFlat ? Internal::Evaluate(flatProgram, evaluationCase.ThreadCount, false) : Internal::Evaluate(program, evaluationCase.ThreadCount, false); };
+					const double seconds = MeasureBestSeconds(evaluate);
+
+					const size_t allocationCountBegin = GetAllocationCount();
+					evaluate();
+					const size_t allocationCount = GetAllocationCount() - allocationCountBegin;
+
+					AddResult(Result{ "Evaluator", std::string("EvalProgram/") + Corpus::CONVERT_SHAPE_TO_STRING(shape) + "/" + evaluationCase.Name, source.size(), nodeCount, seconds, allocationCount });
+					pointerSeconds = (&evaluationCase == &Internal::EVALUATION_CASES[0]) ? seconds : pointerSeconds;
+					std::cout << "\t\t" << Corpus::CONVERT_SHAPE_TO_STRING(shape) << " " << evaluationCase.Name << ": " << static_cast<double>(nodeCount) / seconds << " nodes/s, "
+						<< allocationCount << " allocs, x" << pointerSeconds / seconds << " (vs POINTER)" << std::endl;
+				}
+				std::cout << "\t\t" << Corpus::CONVERT_SHAPE_TO_STRING(shape) << " conversion: " << static_cast<double>(nodeCount) / convertSeconds << " nodes/s" << std::endl;
+			}
+			return true;
+		}
+	);
+}
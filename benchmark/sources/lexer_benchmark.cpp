@@ -0,0 +1,168 @@
+﻿#include <cstdio>
+
+#include "../benchmark.h"
+
+namespace Benchmark
+{
+	namespace Internal
+	{
+		// 라이선스 헤더와 들여쓰기가 깊은 블록이 많은 생성 코드와 비슷한 입력을 만듭니다.
+		static const std::string GenerateWhitespaceHeavySource(const size_t functionCount) noexcept
+		{
+			std::string source;
+			source += "/*\n";
+			for (size_t i = 0; i < 24; ++i)
+			{
+				source += " * Licensed under the MIT License. Permission is hereby granted, free of charge, to any person obtaining a copy.\n";
+			}
+			source += " */\n\n";
+
+			char buffer[256];
+			for (size_t i = 0; i < functionCount; ++i)
+			{
+				snprintf(buffer, sizeof(buffer), "// generated function #%zu\nfunc Generated%zu(value: dword) -> dword\n{\n", i, i);
+				source += buffer;
+				for (size_t depth = 1; depth <= 8; ++depth)
+				{
+					source += std::string(depth, '\t');
+					snprintf(buffer, sizeof(buffer), "let local%zu: dword = value + %zu;                    // depth %zu\n", depth, depth, depth);
+					source += buffer;
+					source += std::string(depth * 4, ' ');
+					source += "\r\n";
+				}
+				source += "\treturn value;\n}\n\n";
+			}
+			return source;
+		}
+
+		static const size_t LexAll(const std::string& source) noexcept
+		{
+			mcf::Lexer::Object lexer(source, false);
+			size_t tokenCount = 0;
+			for (mcf::Token::Data token = lexer.ReadNextToken(); token.Type != mcf::Token::Type::END_OF_FILE; token = lexer.ReadNextToken())
+			{
+				++tokenCount;
+			}
+			return tokenCount;
+		}
+
+		// 할당자의 영향을 줄이기 위해 호출하는 쪽에서 tokenBuffer 를 재사용합니다.
+		static const size_t TokenizeAll(const std::string& source, const bool isSkippingComments, mcf::Lexer::TokenBuffer& tokenBuffer) noexcept
+		{
+			mcf::Lexer::Object lexer(source, false);
+			lexer.SetCommentSkipping(isSkippingComments, nullptr);
+			lexer.TokenizeAll(tokenBuffer);
+			return tokenBuffer.GetCount();
+		}
+	}
+}
+
+Benchmark::LexerBenchmark::LexerBenchmark(void) noexcept
+{
+	_names.emplace_back(u8"공백/주석 스캐너 처리량");
+	_benchmarks.emplace_back
+	(
+		[&]() -> bool
+		{
+			const std::string source = Internal::GenerateWhitespaceHeavySource(8192);
+			const mcf::Lexer::Scanner detectedScanner = mcf::Lexer::GetScanner();
+			const double megaBytes = static_cast<double>(source.size()) / (1024.0 * 1024.0);
+			std::cout << "\t\tinput: " << megaBytes << " MB, detected scanner: " << CONVERT_SCANNER_TO_STRING(detectedScanner) << std::endl;
+
+			size_t expectedTokenCount = 0;
+			double scalarBytesPerSecond = 0.0;
+			for (size_t i = mcf::ENUM_INDEX(mcf::Lexer::Scanner::SCALAR); i < mcf::ENUM_COUNT<mcf::Lexer::Scanner>(); ++i)
+			{
+				const mcf::Lexer::Scanner scanner = mcf::ENUM_AT<mcf::Lexer::Scanner>(i);
+				if (mcf::Lexer::SetScanner(scanner) == false)
+				{
+					std::cout << "\t\t" << CONVERT_SCANNER_TO_STRING(scanner) << ": not supported" << std::endl;
+					continue;
+				}
+
+				size_t tokenCount = 0;
+				const double seconds = MeasureBestSeconds([&]() { tokenCount = Internal::LexAll(source); });
+				if (scanner == mcf::Lexer::Scanner::SCALAR)
+				{
+					expectedTokenCount = tokenCount;
+				}
+				else if (tokenCount != expectedTokenCount)
+				{
+					std::cout << "\t\t" << CONVERT_SCANNER_TO_STRING(scanner) << ": token count mismatch. expected=" << expectedTokenCount << ", actual=" << tokenCount << std::endl;
+					mcf::Lexer::SetScanner(detectedScanner);
+					return false;
+				}
+
+				const size_t allocationCountBegin = GetAllocationCount();
+				Internal::LexAll(source);
+				AddResult(Result{ "Lexer", std::string("Scanner/") + CONVERT_SCANNER_TO_STRING(scanner), source.size(), tokenCount, seconds, GetAllocationCount() - allocationCountBegin });
+
+				const double bytesPerSecond = static_cast<double>(source.size()) / seconds;
+				scalarBytesPerSecond = (scanner == mcf::Lexer::Scanner::SCALAR) ? bytesPerSecond : scalarBytesPerSecond;
+				std::cout << "\t\t" << CONVERT_SCANNER_TO_STRING(scanner) << ": " << bytesPerSecond / (1024.0 * 1024.0) << " MB/s, "
+					<< static_cast<double>(tokenCount) / seconds << " tokens/s, x" << bytesPerSecond / scalarBytesPerSecond << " (vs SCALAR)" << std::endl;
+			}
+
+			mcf::Lexer::SetScanner(detectedScanner);
+			return true;
+		}
+	);
+
+	_names.emplace_back(u8"합성 코퍼스 ReadNextToken 처리량");
+	_benchmarks.emplace_back
+	(
+		[&]() -> bool
+		{
+			const Options& options = GetOptions();
+			for (size_t i = mcf::ENUM_INDEX(Corpus::Shape::SMALL_FUNCTIONS); i < mcf::ENUM_COUNT<Corpus::Shape>(); ++i)
+			{
+				const Corpus::Shape shape = mcf::ENUM_AT<Corpus::Shape>(i);
+				if (options.ShapeFilter.empty() == false && options.ShapeFilter != Corpus::CONVERT_SHAPE_TO_STRING(shape))
+				{
+					continue;
+				}
+
+				const std::string source = Corpus::Generate(shape, options.CorpusBytes);
+				size_t tokenCount = 0;
+				const double seconds = MeasureBestSeconds([&]() { tokenCount = Internal::LexAll(source); });
+
+				// 할당 횟수는 측정 반복과 별도로 한번 실행하여 셉니다.
+				const size_t allocationCountBegin = GetAllocationCount();
+				Internal::LexAll(source);
+				const size_t allocationCount = GetAllocationCount() - allocationCountBegin;
+
+				AddResult(Result{ "Lexer", std::string("ReadNextToken/") + Corpus::CONVERT_SHAPE_TO_STRING(shape), source.size(), tokenCount, seconds, allocationCount });
+				std::cout << "\t\t" << Corpus::CONVERT_SHAPE_TO_STRING(shape) << ": " << static_cast<double>(source.size()) / (1024.0 * 1024.0) / seconds << " MB/s, "
+					<< static_cast<double>(tokenCount) / seconds << " tokens/s, " << static_cast<double>(allocationCount) / static_cast<double>(tokenCount) << " allocs/token" << std::endl;
+			}
+			return true;
+		}
+	);
+
+	_names.emplace_back(u8"주석 건너뛰기 TokenizeAll 처리량");
+	_benchmarks.emplace_back
+	(
+		[&]() -> bool
+		{
+			const std::string source = Corpus::Generate(Corpus::Shape::COMMENT_HEAVY, GetOptions().CorpusBytes);
+			double tokenBytesPerSecond = 0.0;
+			for (size_t i = 0; i < 2; ++i)
+			{
+				const bool isSkippingComments = (i == 1);
+				const char* const caseName = isSkippingComments ? "SKIP_COMMENTS" : "COMMENT_TOKENS";
+				mcf::Lexer::TokenBuffer tokenBuffer;
+				size_t tokenCount = 0;
+				const double seconds = MeasureBestSeconds([&]() { tokenCount = Internal::TokenizeAll(source, isSkippingComments, tokenBuffer); });
+
+				const size_t allocationCountBegin = GetAllocationCount();
+				Internal::TokenizeAll(source, isSkippingComments, tokenBuffer);
+				AddResult(Result{ "Lexer", std::string("TokenizeAll/COMMENT_HEAVY/") + caseName, source.size(), tokenCount, seconds, GetAllocationCount() - allocationCountBegin });
+
+				const double bytesPerSecond = static_cast<double>(source.size()) / seconds;
+				tokenBytesPerSecond = isSkippingComments ? tokenBytesPerSecond : bytesPerSecond;
+				std::cout << "\t\t" << caseName << ": " << bytesPerSecond / (1024.0 * 1024.0) << " MB/s, " << tokenCount << " tokens, x" << bytesPerSecond / tokenBytesPerSecond << " (vs COMMENT_TOKENS)" << std::endl;
+			}
+			return true;
+		}
+	);
+}
@@ -0,0 +1,295 @@
+﻿#include <cstdio>
+#include <filesystem>
+#include <thread>
+
+#include "../benchmark.h"
+
+namespace Benchmark
+{
+	namespace Internal
+	{
+		// 연산자 우선순위가 섞인 긴 식이 대부분인 입력을 만듭니다. 파서가 식 파싱(프랫 파서)에 쓰는 시간을 측정하기 위해 사용합니다.
+		static const std::string GenerateExpressionHeavySource(const size_t targetBytes) noexcept
+		{
+			std::string source;
+			source.reserve(targetBytes + 1024);
+			source += "typedef int32: dword;\n\n";
+
+			char buffer[512];
+			for (size_t i = 0; source.size() < targetBytes; ++i)
+			{
+				snprintf(buffer, sizeof(buffer), "func expression%zu(a: int32, b: int32, values: int32[]) -> int32\n{\n", i);
+				source += buffer;
+				snprintf(buffer, sizeof(buffer), "\tlet sum: int32 = (a + %zu) * (b - 3) / 2 + -a * b - (a - b) * 7 + values[a + 1] * values[b / 2 - 1];\n", i);
+				source += buffer;
+				source += "\tlet compare: int32 = a * 2 + 1 < b - 4 == b * 3 - 2 > a + 5 != (a - b) * (b - a) < values[0];\n";
+				source += "\tlet call: int32 = max(a + b * 2, min(a - 1, b + 1) * 4, values[a * b + 1] - 8) + (sum as int32) * compare;\n";
+				source += "\treturn sum + compare * call - (sum - call) / (compare + 1) + values[sum + call * 2];\n}\n\n";
+			}
+			return source;
+		}
+
+		// threadCount 가 1 이면 ParseProgram 으로 순차 파싱합니다. 토큰화 시간을 빼기 위해 호출하는 쪽에서 파서를 미리 만들어 둡니다.
+		static const size_t ParseAll(mcf::Parser::Object& parser, const size_t threadCount, const bool isLazyFunctionBody) noexcept
+		{
+			mcf::AST::Program program;
+			parser.SetLazyFunctionBody(isLazyFunctionBody);
+			if (threadCount == 1)
+			{
+				parser.ParseProgram(program);
+			}
+			else
+			{
+				parser.ParseProgramParallel(program, threadCount, 0);
+			}
+			return parser.GetErrorCount() == 0 ? program.GetStatementCount() : 0;
+		}
+
+		// 파서는 한번만 파싱할 수 있으므로 반복마다 새로 만들고, 만드는 시간(토큰화)은 측정에서 뺍니다.
+		static const double MeasureBestParseSeconds(const std::string& source, const size_t threadCount, const bool isLazyFunctionBody, _Out_ size_t& outStatementCount) noexcept
+		{
+			double bestSeconds = 0.0;
+			double totalSeconds = 0.0;
+			for (size_t i = 0; i == 0 || totalSeconds < MINIMUM_MEASURE_SECONDS; ++i)
+			{
+				mcf::Parser::Object parser(source, false);
+				const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+				outStatementCount = ParseAll(parser, threadCount, isLazyFunctionBody);
+				const double parseSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+				bestSeconds = (i == 0 || parseSeconds < bestSeconds) ? parseSeconds : bestSeconds;
+				totalSeconds += parseSeconds;
+			}
+			return bestSeconds;
+		}
+	}
+}
+
+Benchmark::ParserBenchmark::ParserBenchmark(void) noexcept
+{
+	_names.emplace_back(u8"최상위 문장 병렬 파싱 확장성");
+	_benchmarks.emplace_back
+	(
+		[&]() -> bool
+		{
+			const Options& options = GetOptions();
+			const size_t hardwareThreadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+			for (size_t i = mcf::ENUM_INDEX(Corpus::Shape::SMALL_FUNCTIONS); i < mcf::ENUM_COUNT<Corpus::Shape>(); ++i)
+			{
+				const Corpus::Shape shape = mcf::ENUM_AT<Corpus::Shape>(i);
+				if (options.ShapeFilter.empty() == false && options.ShapeFilter != Corpus::CONVERT_SHAPE_TO_STRING(shape))
+				{
+					continue;
+				}
+
+				const std::string source = Corpus::Generate(shape, options.CorpusBytes);
+				double sequentialSeconds = 0.0;
+				size_t expectedStatementCount = 0;
+				for (size_t threadCount = 1; threadCount <= hardwareThreadCount; threadCount *= 2)
+				{
+					size_t statementCount = 0;
+					const double bestSeconds = Internal::MeasureBestParseSeconds(source, threadCount, false, statementCount);
+
+					if (statementCount == 0 || (threadCount != 1 && statementCount != expectedStatementCount))
+					{
+						std::cout << "\t\t" << Corpus::CONVERT_SHAPE_TO_STRING(shape) << ": parse failed with " << threadCount << " threads" << std::endl;
+						return false;
+					}
+					expectedStatementCount = statementCount;
+					sequentialSeconds = (threadCount == 1) ? bestSeconds : sequentialSeconds;
+
+					// Tokens 항목에는 최상위 문장의 갯수를 기록합니다.
+					mcf::Parser::Object parser(source, false);
+					const size_t allocationCountBegin = GetAllocationCount();
+					Internal::ParseAll(parser, threadCount, false);
+					AddResult(Result{ "Parser", std::string("ParseProgram/") + Corpus::CONVERT_SHAPE_TO_STRING(shape) + "/THREADS_" + std::to_string(threadCount), source.size(), statementCount, bestSeconds, GetAllocationCount() - allocationCountBegin });
+					std::cout << "\t\t" << Corpus::CONVERT_SHAPE_TO_STRING(shape) << " threads=" << threadCount << ": " << static_cast<double>(source.size()) / (1024.0 * 1024.0) / bestSeconds << " MB/s, x"
+						<< sequentialSeconds / bestSeconds << " (vs 1 thread)" << std::endl;
+				}
+			}
+			return true;
+		}
+	);
+
+	_names.emplace_back(u8"함수 본문 지연 파싱");
+	_benchmarks.emplace_back
+	(
+		[&]() -> bool
+		{
+			const Options& options = GetOptions();
+			for (size_t i = mcf::ENUM_INDEX(Corpus::Shape::SMALL_FUNCTIONS); i < mcf::ENUM_COUNT<Corpus::Shape>(); ++i)
+			{
+				const Corpus::Shape shape = mcf::ENUM_AT<Corpus::Shape>(i);
+				if (options.ShapeFilter.empty() == false && options.ShapeFilter != Corpus::CONVERT_SHAPE_TO_STRING(shape))
+				{
+					continue;
+				}
+
+				const std::string source = Corpus::Generate(shape, options.CorpusBytes);
+				double eagerSeconds = 0.0;
+				size_t expectedStatementCount = 0;
+				for (size_t j = 0; j < 2; ++j)
+				{
+					const bool isLazy = (j == 1);
+					const char* const caseName = isLazy ? "LAZY" : "EAGER";
+					size_t statementCount = 0;
+					const double seconds = Internal::MeasureBestParseSeconds(source, 1, isLazy, statementCount);
+					if (statementCount == 0 || (isLazy && statementCount != expectedStatementCount))
+					{
+						std::cout << "\t\t" << Corpus::CONVERT_SHAPE_TO_STRING(shape) << " " << caseName << ": parse failed" << std::endl;
+						return false;
+					}
+					expectedStatementCount = statementCount;
+					eagerSeconds = isLazy ? eagerSeconds : seconds;
+
+					mcf::Parser::Object parser(source, false);
+					const size_t allocationCountBegin = GetAllocationCount();
+					Internal::ParseAll(parser, 1, isLazy);
+					AddResult(Result{ "Parser", std::string("ParseProgram/") + Corpus::CONVERT_SHAPE_TO_STRING(shape) + "/" + caseName, source.size(), statementCount, seconds, GetAllocationCount() - allocationCountBegin });
+					std::cout << "\t\t" << Corpus::CONVERT_SHAPE_TO_STRING(shape) << " " << caseName << ": " << static_cast<double>(source.size()) / (1024.0 * 1024.0) / seconds << " MB/s, x"
+						<< eagerSeconds / seconds << " (vs EAGER)" << std::endl;
+				}
+			}
+			return true;
+		}
+	);
+
+	_names.emplace_back(u8"세션 증분 재파싱");
+	_benchmarks.emplace_back
+	(
+		[&]() -> bool
+		{
+			const Options& options = GetOptions();
+			for (size_t i = mcf::ENUM_INDEX(Corpus::Shape::SMALL_FUNCTIONS); i < mcf::ENUM_COUNT<Corpus::Shape>(); ++i)
+			{
+				const Corpus::Shape shape = mcf::ENUM_AT<Corpus::Shape>(i);
+				if (options.ShapeFilter.empty() == false && options.ShapeFilter != Corpus::CONVERT_SHAPE_TO_STRING(shape))
+				{
+					continue;
+				}
+
+				// 맨 앞 한 줄만 다른 두 입력을 번갈아 파싱하여 매번 한 문장만 수정된 핫 리로드 상황을 만듭니다. 두 경우 모두 토큰화 시간을 포함합니다.
+				const std::string body = Corpus::Generate(shape, options.CorpusBytes);
+				const std::string sources[2] = { "let hotReloadValue: byte = 0;\n" + body, "let hotReloadValue: byte = 1;\n" + body };
+				size_t sourceIndex = 0;
+
+				size_t statementCount = 0;
+				const double fullSeconds = MeasureBestSeconds([&]()
+					{
+						mcf::Parser::Object parser(sources[sourceIndex], false);
+						statementCount = Internal::ParseAll(parser, 1, false);
+						sourceIndex = 1 - sourceIndex;
+					});
+
+				mcf::Parser::Session session;
+				mcf::AST::Program program;
+				session.Parse(sources[sourceIndex], false, program);
+				const double sessionSeconds = MeasureBestSeconds([&]()
+					{
+						sourceIndex = 1 - sourceIndex;
+						session.Parse(sources[sourceIndex], false, program);
+					});
+				if (statementCount == 0 || session.GetErrorCount() != 0 || session.GetReparsedStatementCount() != 1 || program.GetStatementCount() != statementCount)
+				{
+					std::cout << "\t\t" << Corpus::CONVERT_SHAPE_TO_STRING(shape) << ": session reparse failed. reparsed=" << session.GetReparsedStatementCount() << std::endl;
+					return false;
+				}
+
+				const size_t allocationCountBegin = GetAllocationCount();
+				sourceIndex = 1 - sourceIndex;
+				session.Parse(sources[sourceIndex], false, program);
+				AddResult(Result{ "Parser", std::string("Session/") + Corpus::CONVERT_SHAPE_TO_STRING(shape), sources[sourceIndex].size(), statementCount, sessionSeconds, GetAllocationCount() - allocationCountBegin });
+				std::cout << "\t\t" << Corpus::CONVERT_SHAPE_TO_STRING(shape) << ": reused=" << session.GetReusedStatementCount() << ", reparsed=" << session.GetReparsedStatementCount()
+					<< ", " << static_cast<double>(sources[sourceIndex].size()) / (1024.0 * 1024.0) / sessionSeconds << " MB/s, x" << fullSeconds / sessionSeconds << " (vs full ParseProgram)" << std::endl;
+			}
+			return true;
+		}
+	);
+
+	_names.emplace_back(u8"평면 AST 캐시 읽기");
+	_benchmarks.emplace_back
+	(
+		[&]() -> bool
+		{
+			const Options& options = GetOptions();
+			const std::string cacheDirectory = (std::filesystem::temp_directory_path() / "mcf_benchmark_ast_cache").string();
+			for (size_t i = mcf::ENUM_INDEX(Corpus::Shape::SMALL_FUNCTIONS); i < mcf::ENUM_COUNT<Corpus::Shape>(); ++i)
+			{
+				const Corpus::Shape shape = mcf::ENUM_AT<Corpus::Shape>(i);
+				if (options.ShapeFilter.empty() == false && options.ShapeFilter != Corpus::CONVERT_SHAPE_TO_STRING(shape))
+				{
+					continue;
+				}
+
+				// 캐시를 읽을 때도 소스의 해시는 계산해야 하므로 두 경우 모두 토큰화부터 평면 AST 를 만들 때까지를 측정합니다.
+				const std::string source = Corpus::Generate(shape, options.CorpusBytes);
+				mcf::Parser::Object parser(source, false);
+				mcf::AST::Program program;
+				parser.ParseProgram(program);
+				const mcf::AST::Flat::Program expectedProgram(program);
+				if (parser.GetErrorCount() != 0 || mcf::AST::Cache::Store(expectedProgram, cacheDirectory) == false)
+				{
+					std::cout << "\t\t" << Corpus::CONVERT_SHAPE_TO_STRING(shape) << ": cache store failed" << std::endl;
+					return false;
+				}
+
+				const double parseSeconds = MeasureBestSeconds([&]()
+					{
+						mcf::Parser::Object parser(source, false);
+						mcf::AST::Program program;
+						parser.ParseProgram(program);
+						const mcf::AST::Flat::Program flatProgram(program);
+					});
+
+				const mcf::Lexer::Source sourceBuffer = expectedProgram.GetSource();
+				mcf::AST::Flat::Program loadedProgram;
+				bool isLoaded = false;
+				const double loadSeconds = MeasureBestSeconds([&]() { isLoaded = mcf::AST::Cache::Load(loadedProgram, cacheDirectory, sourceBuffer, std::make_shared<mcf::Symbol::Table>()); });
+				if (isLoaded == false || loadedProgram.GetNodeCount() != expectedProgram.GetNodeCount())
+				{
+					std::cout << "\t\t" << Corpus::CONVERT_SHAPE_TO_STRING(shape) << ": cache load failed" << std::endl;
+					return false;
+				}
+
+				const size_t allocationCountBegin = GetAllocationCount();
+				mcf::AST::Cache::Load(loadedProgram, cacheDirectory, sourceBuffer, std::make_shared<mcf::Symbol::Table>());
+				AddResult(Result{ "Parser", std::string("CacheLoad/") + Corpus::CONVERT_SHAPE_TO_STRING(shape), source.size(), loadedProgram.GetNodeCount(), loadSeconds, GetAllocationCount() - allocationCountBegin });
+				std::cout << "\t\t" << Corpus::CONVERT_SHAPE_TO_STRING(shape) << ": parse " << parseSeconds * 1000.0 << " ms, cache load " << loadSeconds * 1000.0 << " ms, x"
+					<< parseSeconds / loadSeconds << " (vs parse)" << std::endl;
+			}
+
+			std::error_code error;
+			std::filesystem::remove_all(cacheDirectory, error);
+			return true;
+		}
+	);
+
+	_names.emplace_back(u8"식 위주 입력 파싱 처리량");
+	_benchmarks.emplace_back
+	(
+		[&]() -> bool
+		{
+			const std::string source = Internal::GenerateExpressionHeavySource(GetOptions().CorpusBytes);
+			mcf::Lexer::TokenBuffer tokenBuffer;
+			mcf::Lexer::Object lexer(source, false);
+			lexer.SetCommentSkipping(true, nullptr);
+			lexer.TokenizeAll(tokenBuffer);
+			const size_t tokenCount = tokenBuffer.GetCount();
+
+			size_t statementCount = 0;
+			const double seconds = Internal::MeasureBestParseSeconds(source, 1, false, statementCount);
+			if (statementCount == 0)
+			{
+				std::cout << "\t\tEXPRESSION_HEAVY: parse failed" << std::endl;
+				return false;
+			}
+
+			mcf::Parser::Object parser(source, false);
+			const size_t allocationCountBegin = GetAllocationCount();
+			Internal::ParseAll(parser, 1, false);
+			AddResult(Result{ "Parser", "ParseProgram/EXPRESSION_HEAVY", source.size(), tokenCount, seconds, GetAllocationCount() - allocationCountBegin });
+			std::cout << "\t\tEXPRESSION_HEAVY: " << static_cast<double>(source.size()) / (1024.0 * 1024.0) / seconds << " MB/s, "
+				<< static_cast<double>(tokenCount) / seconds << " tokens/s" << std::endl;
+			return true;
+		}
+	);
+}
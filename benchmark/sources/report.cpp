@@ -0,0 +1,141 @@
+﻿#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+#include "../benchmark.h"
+
+namespace Benchmark
+{
+	namespace Internal
+	{
+		static std::vector<Benchmark::Result>& GetResults(void) noexcept
+		{
+			static std::vector<Benchmark::Result> results;
+			return results;
+		}
+
+		static const std::string EscapeJsonString(const std::string& value) noexcept
+		{
+			std::string escaped;
+			escaped.reserve(value.size() + 2);
+			escaped += '"';
+			for (const char character : value)
+			{
+				switch (character)
+				{
+				case '"': escaped += "\\\""; break;
+				case '\\': escaped += "\\\\"; break;
+				case '\n': escaped += "\\n"; break;
+				case '\r': escaped += "\\r"; break;
+				case '\t': escaped += "\\t"; break;
+				default:
+					if (static_cast<unsigned char>(character) < 0x20)
+					{
+						char buffer[8];
+						snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned int>(character));
+						escaped += buffer;
+						break;
+					}
+					escaped += character;
+					break;
+				}
+			}
+			escaped += '"';
+			return escaped;
+		}
+
+		static const std::string FormatDouble(const double value) noexcept
+		{
+			char buffer[64];
+			snprintf(buffer, sizeof(buffer), "%.6g", value);
+			return buffer;
+		}
+	}
+}
+
+Benchmark::Options& Benchmark::GetOptions(void) noexcept
+{
+	static Benchmark::Options options;
+	return options;
+}
+
+const bool Benchmark::ParseOptions(const int argc, const char* const argv[]) noexcept
+{
+	Benchmark::Options& options = GetOptions();
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string argument = argv[i];
+		if (i + 1 >= argc)
+		{
+			std::cout << "missing value for option: " << argument << std::endl;
+			return false;
+		}
+
+		const std::string value = argv[++i];
+		if (argument == "--size")
+		{
+			options.CorpusBytes = std::strtoull(value.c_str(), nullptr, 10);
+			if (options.CorpusBytes == 0)
+			{
+				std::cout << "invalid corpus size: " << value << std::endl;
+				return false;
+			}
+		}
+		else if (argument == "--shape")
+		{
+			options.ShapeFilter = value;
+		}
+		else if (argument == "--json")
+		{
+			options.JsonPath = value;
+		}
+		else if (argument == "--label")
+		{
+			options.Label = value;
+		}
+		else
+		{
+			std::cout << "unknown option: " << argument << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+void Benchmark::AddResult(const Benchmark::Result& result) noexcept
+{
+	Internal::GetResults().emplace_back(result);
+}
+
+const bool Benchmark::WriteJson(const std::string& path) noexcept
+{
+	std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (file.is_open() == false)
+	{
+		return false;
+	}
+
+	const std::vector<Benchmark::Result>& results = Internal::GetResults();
+	file << "{\n";
+	file << "\t\"label\": " << Internal::EscapeJsonString(GetOptions().Label) << ",\n";
+	file << "\t\"corpus_bytes\": " << GetOptions().CorpusBytes << ",\n";
+	file << "\t\"results\": [";
+	const size_t resultCount = results.size();
+	for (size_t i = 0; i < resultCount; ++i)
+	{
+		const Benchmark::Result& result = results[i];
+		const double tokens = static_cast<double>(result.Tokens);
+		file << ((i == 0) ? "\n" : ",\n") << "\t\t{ ";
+		file << "\"benchmark\": " << Internal::EscapeJsonString(result.Benchmark) << ", ";
+		file << "\"case\": " << Internal::EscapeJsonString(result.Case) << ", ";
+		file << "\"bytes\": " << result.Bytes << ", ";
+		file << "\"tokens\": " << result.Tokens << ", ";
+		file << "\"seconds\": " << Internal::FormatDouble(result.Seconds) << ", ";
+		file << "\"mb_per_second\": " << Internal::FormatDouble(static_cast<double>(result.Bytes) / (1024.0 * 1024.0) / result.Seconds) << ", ";
+		file << "\"tokens_per_second\": " << Internal::FormatDouble(tokens / result.Seconds) << ", ";
+		file << "\"allocations\": " << result.Allocations << ", ";
+		file << "\"allocations_per_token\": " << Internal::FormatDouble(result.Tokens == 0 ? 0.0 : static_cast<double>(result.Allocations) / tokens) << " }";
+	}
+	file << "\n\t]\n}\n";
+	return file.good();
+}
@@ -1,7 +1,11 @@
 ﻿#pragma once
 #include <functional>
 #include <memory>
+#include <new>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <lexer.h>
@@ -10,6 +14,82 @@ namespace mcf
 {
 	namespace AST
 	{
+		class Program;
+
+		// 아레나에 복사된 배열입니다. 메모리는 아레나가 소유하므로 아레나가 살아있는 동안에만 유효합니다.
+		template <class T>
+		class NodeArray final
+		{
+		public:
+			explicit NodeArray(void) noexcept = default;
+			explicit NodeArray(T* const data, const size_t size) noexcept : _data(data), _size(size) {}
+
+			inline const size_t GetSize(void) const noexcept { return _size; }
+			inline T& operator[](const size_t index) noexcept { return _data[index]; }
+			inline const T& operator[](const size_t index) const noexcept { return _data[index]; }
+
+		private:
+			T* _data = nullptr;
+			size_t _size = 0;
+		};
+
+		// AST 노드를 위한 bump-pointer 할당자입니다. 노드는 블록 안에 placement new 로 만들어지며 소멸자는 호출되지 않습니다.
+		// 아레나가 소멸될 때 블록 단위로 한번에 해제되므로 아레나에 만드는 타입은 trivially destructible 이어야 합니다.
+		// 주의: thread-safe 하지 않은 클래스입니다.
+		class Arena final
+		{
+		public:
+			constexpr static const size_t BLOCK_SIZE = 64 * 1024;
+
+			explicit Arena(void) noexcept = default;
+			explicit Arena(const Arena& other) noexcept = delete;
+			Arena& operator=(const Arena& other) noexcept = delete;
+
+			// 인자로 받은 std::vector 는 아레나에 복사하여 NodeArray 로 전달합니다.
+			template <class T, class... Variadic>
+			inline T* Make(Variadic&& ...args) noexcept
+			{
+				static_assert(std::is_trivially_destructible<T>::value, "arena never calls destructors. T must be trivially destructible.");
+				return new(Allocate(sizeof(T), alignof(T))) T(ConvertArgument(std::forward<Variadic>(args))...);
+			}
+
+			template <class T>
+			inline const mcf::AST::NodeArray<T> MakeArray(const std::vector<T>& values) noexcept
+			{
+				static_assert(std::is_trivially_copyable<T>::value && std::is_trivially_destructible<T>::value, "arena array element must be trivially copyable.");
+				if (values.empty())
+				{
+					return mcf::AST::NodeArray<T>();
+				}
+				T* const data = static_cast<T*>(Allocate(sizeof(T) * values.size(), alignof(T)));
+				std::uninitialized_copy(values.begin(), values.end(), data);
+				return mcf::AST::NodeArray<T>(data, values.size());
+			}
+
+			// alignment 는 2의 거듭제곱이어야 합니다. BLOCK_SIZE 보다 큰 요청은 전용 블록을 만듭니다.
+			void* Allocate(const size_t size, const size_t alignment) noexcept;
+			// other 의 블록을 모두 넘겨 받습니다. other 에서 할당된 노드는 이 아레나와 함께 해제되며 other 는 빈 아레나가 됩니다.
+			void Adopt(Arena&& other) noexcept;
+			inline const size_t GetAllocatedBytes(void) const noexcept { return _allocatedBytes; }
+			inline const size_t GetBlockCount(void) const noexcept { return _blocks.size(); }
+
+		private:
+			template <class T>
+			inline T&& ConvertArgument(T&& argument) noexcept { return std::forward<T>(argument); }
+			template <class T>
+			inline const mcf::AST::NodeArray<T> ConvertArgument(std::vector<T>& values) noexcept { return MakeArray(values); }
+			template <class T>
+			inline const mcf::AST::NodeArray<T> ConvertArgument(const std::vector<T>& values) noexcept { return MakeArray(values); }
+			template <class T>
+			inline const mcf::AST::NodeArray<T> ConvertArgument(std::vector<T>&& values) noexcept { return MakeArray(values); }
+
+		private:
+			std::vector<std::unique_ptr<unsigned char[]>> _blocks;
+			unsigned char* _current = nullptr;
+			size_t _remainingSize = 0;
+			size_t _allocatedBytes = 0;
+		};
+
 		namespace Node
 		{
 			enum class Type : unsigned char
@@ -25,15 +105,19 @@ namespace mcf
 				COUNT,
 			};
 
+			// 노드는 Arena 가 소유하며 소멸자를 호출하지 않으므로 가상 소멸자를 두지 않습니다.
 			class Interface
 			{
 			public:
-				virtual ~Interface(void) noexcept = default;
 				virtual const mcf::AST::Node::Type	GetNodeType(void) const noexcept = 0;
 				virtual const std::string ConvertToString(void) const noexcept = 0;
+
+			protected:
+				~Interface(void) noexcept = default;
 			};
 
-			using Pointer = std::unique_ptr<Interface>;
+			// 노드 사이의 연결은 소유하지 않는 포인터입니다.
+			using Pointer = Interface*;
 			using PointerVector = std::vector<Pointer>;
 		}
 
@@ -83,24 +167,42 @@ namespace mcf
 				return TYPE_STRING_ARRAY[mcf::ENUM_INDEX(value)];
 			}
 
+			// 구체 타입을 가상 함수 대신 멤버로 저장하여 GetExpressionType 와 VISIT 가 가상 호출 없이 타입을 읽습니다.
 			class Interface : public mcf::AST::Node::Interface
 			{
 			public:
-				virtual const Type GetExpressionType(void) const noexcept = 0;
+				inline const Type GetExpressionType(void) const noexcept { return _expressionType; }
 				inline virtual const mcf::AST::Node::Type GetNodeType(void) const noexcept override final
 				{
 					return mcf::AST::Node::Type::EXPRESSION;
 				}
+
+			protected:
+				explicit Interface(const Type expressionType) noexcept : _expressionType(expressionType) {}
+
+			private:
+				Type _expressionType;
 			};
 
-			using Pointer = std::unique_ptr<Interface>;
+			// 식 노드(AST::Expression)의 구체 클래스들이 상속합니다.
+			template <Type TYPE_VALUE>
+			class TypedInterface : public Interface
+			{
+			public:
+				static constexpr const Type TYPE = TYPE_VALUE;
+
+			protected:
+				explicit TypedInterface(void) noexcept : Interface(TYPE_VALUE) {}
+			};
+
+			using Pointer = Interface*;
 			using PointerVector = std::vector<Pointer>;
+			using PointerArray = mcf::AST::NodeArray<Pointer>;
 
-			class Invalid : public Interface
+			class Invalid : public TypedInterface<Type::INVALID>
 			{
 			public:
-				inline static Pointer Make(void) noexcept { return std::make_unique<Invalid>(); }
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::INVALID; }
+				inline static Pointer Make(mcf::AST::Arena& arena) noexcept { return arena.Make<Invalid>(); }
 				inline virtual const std::string ConvertToString(void) const noexcept override final { return "<Invalid>"; }
 			};
 		}
@@ -132,13 +234,14 @@ namespace mcf
 				}
 			};
 
-			using Pointer = std::unique_ptr<Interface>;
+			using Pointer = Interface*;
 			using PointerVector = std::vector<Pointer>;
+			using PointerArray = mcf::AST::NodeArray<Pointer>;
 
 			class Invalid : public Interface
 			{
 			public:
-				inline static Pointer Make(void) { return std::make_unique<Invalid>(); }
+				inline static Pointer Make(mcf::AST::Arena& arena) noexcept { return arena.Make<Invalid>(); }
 				inline virtual const Type GetIntermediateType(void) const noexcept override final { return Type::INVALID; }
 				inline virtual const std::string ConvertToString(void) const noexcept override final { return "<Invalid>"; }
 			};
@@ -146,21 +249,21 @@ namespace mcf
 			class TypeSignature : public Interface
 			{
 			public:
-				using Pointer = std::unique_ptr<TypeSignature>;
+				using Pointer = TypeSignature*;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<TypeSignature>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<TypeSignature>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit TypeSignature(void) noexcept = default;
-				explicit TypeSignature(const bool isUnsigned, mcf::AST::Expression::Pointer&& signature) noexcept;
+				explicit TypeSignature(const bool isUnsigned, mcf::AST::Expression::Pointer signature) noexcept;
 
 				inline const bool IsUnsigned(void) const noexcept { return _isUnsigned; }
 				const mcf::AST::Expression::Interface* GetUnsafeSignaturePointer(void) const noexcept;
 
 				inline const mcf::AST::Expression::Type GetSignatureExpressionType(void) const noexcept { return _signature->GetExpressionType(); }
 				inline const std::string ConvertToString(std::function<const std::string(const bool isUnsigned, const mcf::AST::Expression::Interface* signature)> function) 
-					const noexcept { return function(_isUnsigned, _signature.get()); }
+					const noexcept { return function(_isUnsigned, _signature); }
 
 				inline virtual const Type GetIntermediateType(void) const noexcept override final { return Type::TYPE_SIGNATURE; }
 				virtual const std::string ConvertToString(void) const noexcept override final;
@@ -173,83 +276,87 @@ namespace mcf
 
 		namespace Expression
 		{
-			class Identifier : public Interface
+			class Identifier : public TypedInterface<Type::IDENTIFIER>
 			{
 			public:
-				using Pointer = std::unique_ptr<Identifier>;
+				using Pointer = Identifier*;
 				using PointerVector = std::vector<Pointer>;
+				using PointerArray = mcf::AST::NodeArray<Pointer>;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<Identifier>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<Identifier>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit Identifier(void) noexcept = default;
 				explicit Identifier(const mcf::Token::Data& token) noexcept : _token(token) {}
 
-				inline const std::string& GetTokenLiteral(void) const noexcept { return _token.Literal; }
+				inline const mcf::Token::Data& GetToken(void) const noexcept { return _token; }
+				inline const std::string_view GetTokenLiteral(void) const noexcept { return _token.Literal; }
+				inline const mcf::Symbol::ID GetSymbol(void) const noexcept { return _token.Symbol; }
 
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::IDENTIFIER; }
-				inline virtual const std::string ConvertToString(void) const noexcept override final { return "<Identifier: " + _token.Literal + ">"; }
+				inline virtual const std::string ConvertToString(void) const noexcept override final { return "<Identifier: " + std::string(_token.Literal) + ">"; }
 
 			private:
 				mcf::Token::Data _token;
 			};
 
-			class Integer : public Interface
+			class Integer : public TypedInterface<Type::INTEGER>
 			{
 			public:
-				using Pointer = std::unique_ptr<Integer>;
+				using Pointer = Integer*;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<Integer>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<Integer>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit Integer(void) noexcept = default;
 				explicit Integer(const mcf::Token::Data& token) noexcept : _token(token) {}
 
-				inline const std::string& GetTokenLiteral(void) const noexcept { return _token.Literal; }
+				inline const mcf::Token::Data& GetToken(void) const noexcept { return _token; }
+				inline const std::string_view GetTokenLiteral(void) const noexcept { return _token.Literal; }
 
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::INTEGER; }
-				inline virtual const std::string ConvertToString(void) const noexcept override final { return "<Integer: " + _token.Literal + ">"; }
+				inline virtual const std::string ConvertToString(void) const noexcept override final { return "<Integer: " + std::string(_token.Literal) + ">"; }
 
 			private:
 				mcf::Token::Data _token;
 			};
 
-			class String : public Interface
+			class String : public TypedInterface<Type::STRING>
 			{
 			public:
-				using Pointer = std::unique_ptr<String>;
+				using Pointer = String*;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<String>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<String>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit String(void) noexcept = default;
 				explicit String(const mcf::Token::Data& token) noexcept : _token(token) {}
 
-				inline const std::string& GetTokenLiteral(void) const noexcept { return _token.Literal; }
+				inline const mcf::Token::Data& GetToken(void) const noexcept { return _token; }
+				inline const std::string_view GetTokenLiteral(void) const noexcept { return _token.Literal; }
 
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::STRING; }
-				inline virtual const std::string ConvertToString(void) const noexcept override final { return "<String: " + _token.Literal + ">"; }
+				inline virtual const std::string ConvertToString(void) const noexcept override final { return "<String: " + std::string(_token.Literal) + ">"; }
 
 			private:
 				mcf::Token::Data _token;
 			};
 
-			class Prefix : public Interface
+			class Prefix : public TypedInterface<Type::PREFIX>
 			{
 			public:
-				using Pointer = std::unique_ptr<Prefix>;
+				using Pointer = Prefix*;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<Prefix>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<Prefix>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit Prefix(void) noexcept = default;
-				explicit Prefix(const mcf::Token::Data& prefixOperator, mcf::AST::Expression::Pointer&& right) noexcept;
+				explicit Prefix(const mcf::Token::Data& prefixOperator, mcf::AST::Expression::Pointer right) noexcept;
+
+				inline const mcf::Token::Data& GetPrefixOperator(void) const noexcept { return _prefixOperator; }
+				const mcf::AST::Expression::Interface* GetUnsafeRightExpressionPointer(void) const noexcept { return _right; }
 
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::PREFIX; }
 				virtual const std::string ConvertToString(void) const noexcept override final;
 
 			private:
@@ -257,43 +364,43 @@ namespace mcf
 				mcf::AST::Expression::Pointer _right;
 			};
 
-			class Group : public Interface
+			class Group : public TypedInterface<Type::GROUP>
 			{
 			public:
-				using Pointer = std::unique_ptr<Group>;
+				using Pointer = Group*;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<Group>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<Group>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit Group(void) noexcept = default;
-				explicit Group(mcf::AST::Expression::Pointer&& expression ) noexcept;
+				explicit Group(mcf::AST::Expression::Pointer expression ) noexcept;
+
+				const mcf::AST::Expression::Interface* GetUnsafeExpressionPointer(void) const noexcept { return _expression; }
 
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::GROUP; }
 				virtual const std::string ConvertToString(void) const noexcept override final;
 
 			private:
 				mcf::AST::Expression::Pointer _expression;
 			};
 
-			class Infix : public Interface
+			class Infix : public TypedInterface<Type::INFIX>
 			{
 			public:
-				using Pointer = std::unique_ptr<Infix>;
+				using Pointer = Infix*;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<Infix>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<Infix>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit Infix(void) noexcept = default;
-				explicit Infix(mcf::AST::Expression::Pointer&& left, const mcf::Token::Data& infixOperator, mcf::AST::Expression::Pointer&& right) noexcept;
+				explicit Infix(mcf::AST::Expression::Pointer left, const mcf::Token::Data& infixOperator, mcf::AST::Expression::Pointer right) noexcept;
 
 				inline mcf::Token::Data GetInfixOperator(void) noexcept { return _infixOperator; }
 				inline const mcf::Token::Data& GetInfixOperator(void) const noexcept { return _infixOperator; }
-				const mcf::AST::Expression::Interface* GetUnsafeLeftExpressionPointer(void) const noexcept { return _left.get(); }
-				const mcf::AST::Expression::Interface* GetUnsafeRightExpressionPointer(void) const noexcept { return _right.get(); }
+				const mcf::AST::Expression::Interface* GetUnsafeLeftExpressionPointer(void) const noexcept { return _left; }
+				const mcf::AST::Expression::Interface* GetUnsafeRightExpressionPointer(void) const noexcept { return _right; }
 
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::INFIX; }
 				virtual const std::string ConvertToString(void) const noexcept override final;
 
 			private:
@@ -302,53 +409,51 @@ namespace mcf
 				mcf::AST::Expression::Pointer _right;
 			};
 
-			class Call : public Interface
+			class Call : public TypedInterface<Type::CALL>
 			{
 			public:
-				using Pointer = std::unique_ptr<Call>;
+				using Pointer = Call*;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<Call>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<Call>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit Call(void) noexcept = default;
-				explicit Call(mcf::AST::Expression::Pointer&& left, mcf::AST::Expression::PointerVector&& params) noexcept;
+				explicit Call(mcf::AST::Expression::Pointer left, mcf::AST::Expression::PointerArray params) noexcept;
 
-				const mcf::AST::Expression::Interface* GetUnsafeLeftExpressionPointer(void) const noexcept { return _left.get(); }
-				inline const size_t GetParamExpressionsCount(void) const noexcept { return _params.size(); }
+				const mcf::AST::Expression::Interface* GetUnsafeLeftExpressionPointer(void) const noexcept { return _left; }
+				inline const size_t GetParamExpressionsCount(void) const noexcept { return _params.GetSize(); }
 				inline mcf::AST::Expression::Interface* GetUnsafeParamExpressionPointerAt(const size_t index) noexcept
 				{
-					return _params[index].get();
+					return _params[index];
 				}
 				inline const mcf::AST::Expression::Interface* GetUnsafeParamExpressionPointerAt(const size_t index) const noexcept
 				{
-					return _params[index].get();
+					return _params[index];
 				}
 
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::CALL; }
 				virtual const std::string ConvertToString(void) const noexcept override final;
 
 			private:
 				mcf::AST::Expression::Pointer _left;
-				mcf::AST::Expression::PointerVector _params;
+				mcf::AST::Expression::PointerArray _params;
 			};
 
-			class Index : public Interface
+			class Index : public TypedInterface<Type::INDEX>
 			{
 			public:
-				using Pointer = std::unique_ptr<Index>;
+				using Pointer = Index*;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<Index>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<Index>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit Index(void) noexcept = default;
-				explicit Index(mcf::AST::Expression::Pointer&& left, mcf::AST::Expression::Pointer&& index) noexcept;
+				explicit Index(mcf::AST::Expression::Pointer left, mcf::AST::Expression::Pointer index) noexcept;
 
-				const mcf::AST::Expression::Interface* GetUnsafeLeftExpressionPointer(void) const noexcept { return _left.get(); }
-				const mcf::AST::Expression::Interface* GetUnsafeIndexExpressionPointer(void) const noexcept { return _index.get(); }
+				const mcf::AST::Expression::Interface* GetUnsafeLeftExpressionPointer(void) const noexcept { return _left; }
+				const mcf::AST::Expression::Interface* GetUnsafeIndexExpressionPointer(void) const noexcept { return _index; }
 
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::INDEX; }
 				virtual const std::string ConvertToString(void) const noexcept override final;
 
 			private:
@@ -356,22 +461,21 @@ namespace mcf
 				mcf::AST::Expression::Pointer _index;
 			};
 
-			class As : public Interface
+			class As : public TypedInterface<Type::AS>
 			{
 			public:
-				using Pointer = std::unique_ptr<As>;
+				using Pointer = As*;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<As>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<As>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit As(void) noexcept = default;
-				explicit As(mcf::AST::Expression::Pointer&& left, mcf::AST::Intermediate::TypeSignature::Pointer&& typeSignature) noexcept;
+				explicit As(mcf::AST::Expression::Pointer left, mcf::AST::Intermediate::TypeSignature::Pointer typeSignature) noexcept;
 
-				const mcf::AST::Expression::Interface* GetUnsafeLeftExpressionPointer(void) const noexcept { return _left.get(); }
-				const mcf::AST::Intermediate::TypeSignature* GetUnsafeTypeSignatureIntermediatePointer(void) const noexcept { return _typeSignature.get(); }
+				const mcf::AST::Expression::Interface* GetUnsafeLeftExpressionPointer(void) const noexcept { return _left; }
+				const mcf::AST::Intermediate::TypeSignature* GetUnsafeTypeSignatureIntermediatePointer(void) const noexcept { return _typeSignature; }
 
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::AS; }
 				virtual const std::string ConvertToString(void) const noexcept override final;
 
 			private:
@@ -382,60 +486,76 @@ namespace mcf
 			class Initializer : public Interface
 			{
 			public:
-				using Pointer = std::unique_ptr<Initializer>;
+				using Pointer = Initializer*;
+				static constexpr const Type TYPE = Type::INITIALIZER;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<Initializer>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<Initializer>(std::forward<Variadic>(args)...); }
 
 			public:
-				explicit Initializer(void) noexcept = default;
-				explicit Initializer(PointerVector&& keyList) noexcept;
+				explicit Initializer(void) noexcept : Interface(TYPE) {}
+				explicit Initializer(PointerArray keyList) noexcept : Initializer(TYPE, keyList) {}
 
-				inline virtual const size_t GetKeyExpressionCount(void) const noexcept final { return _keyList.size(); }
+				inline virtual const size_t GetKeyExpressionCount(void) const noexcept final { return _keyList.GetSize(); }
 				inline virtual mcf::AST::Expression::Interface* GetUnsafeKeyExpressionPointerAt(const size_t index) noexcept final
 				{
-					return _keyList[index].get();
+					return _keyList[index];
 				}
 				inline virtual const mcf::AST::Expression::Interface* GetUnsafeKeyExpressionPointerAt(const size_t index) const noexcept final
 				{
-					return _keyList[index].get();
+					return _keyList[index];
 				}
 
-				inline virtual const Type GetExpressionType(void) const noexcept override { return Type::INITIALIZER; }
 				virtual const std::string ConvertToString(void) const noexcept override;
 
 			protected:
-				PointerVector _keyList;
+				// MapInitializer 가 자신의 타입을 저장할 때 사용합니다.
+				explicit Initializer(const Type type) noexcept : Interface(type) {}
+				explicit Initializer(const Type type, PointerArray keyList) noexcept;
+
+			protected:
+				PointerArray _keyList;
 			};
 
 			class MapInitializer : public Initializer
 			{
 			public:
-				using Pointer = std::unique_ptr<MapInitializer>;
+				using Pointer = MapInitializer*;
+				static constexpr const Type TYPE = Type::MAP_INITIALIZER;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<MapInitializer>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<MapInitializer>(std::forward<Variadic>(args)...); }
 
 			public:
-				explicit MapInitializer(void) noexcept = default;
-				explicit MapInitializer(PointerVector&& keyist, PointerVector&& valueList) noexcept;
+				explicit MapInitializer(void) noexcept : Initializer(TYPE) {}
+				explicit MapInitializer(PointerArray keyList, PointerArray valueList) noexcept;
 
-				inline const size_t GetValueExpressionCount(void) const noexcept { return _valueList.size(); }
+				inline const size_t GetValueExpressionCount(void) const noexcept { return _valueList.GetSize(); }
 				inline mcf::AST::Expression::Interface* GetUnsafeValueExpressionPointerAt(const size_t index) noexcept
 				{
-					return _valueList[index].get();
+					return _valueList[index];
 				}
 				inline const mcf::AST::Expression::Interface* GetUnsafeValueExpressionPointerAt(const size_t index) const noexcept
 				{
-					return _valueList[index].get();
+					return _valueList[index];
 				}
 
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::MAP_INITIALIZER; }
 				virtual const std::string ConvertToString(void) const noexcept override final;
 
 			private:
-				PointerVector _valueList;
+				PointerArray _valueList;
 			};
+
+			// 클래스 순서는 Type 과 같아야 합니다.
+			using NodeList = mcf::NodeList<Type, Invalid, Identifier, Integer, String, Prefix, Group, Infix, Call, As, Index, Initializer, MapInitializer>;
+			static_assert(NodeList::IS_MATCHING() == true, "expression node list not matching!");
+
+			// expression 의 구체 클래스를 받는 visitor 의 오버로드를 호출합니다. 자세한 내용은 mcf::NodeList::Visit 를 참고 해 주세요.
+			template <class NodePointer, class Visitor>
+			inline decltype(auto) VISIT(NodePointer expression, Visitor&& visitor) noexcept
+			{
+				return NodeList::Visit(expression->GetExpressionType(), expression, std::forward<Visitor>(visitor));
+			}
 		}
 
 		namespace Intermediate
@@ -443,16 +563,17 @@ namespace mcf
 			class Variadic : public Interface
 			{
 			public:
-				using Pointer = std::unique_ptr<Variadic>;
+				using Pointer = Variadic*;
 
 				template <class... VariadicTemplateClass>
-				inline static Pointer Make(VariadicTemplateClass&& ...args) { return std::make_unique<Variadic>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, VariadicTemplateClass&& ...args) noexcept { return arena.Make<Variadic>(std::forward<VariadicTemplateClass>(args)...); }
 
 			public:
 				explicit Variadic(void) noexcept = default;
-				explicit Variadic(mcf::AST::Expression::Identifier::Pointer&& name) noexcept;
+				explicit Variadic(mcf::AST::Expression::Identifier::Pointer name) noexcept;
 
-				inline const std::string& GetIdentifier(void) const noexcept { return _name->GetTokenLiteral(); }
+				inline const std::string_view GetIdentifier(void) const noexcept { return _name->GetTokenLiteral(); }
+				inline const mcf::AST::Expression::Identifier* GetUnsafeNamePointer(void) const noexcept { return _name; }
 
 				inline virtual const Type GetIntermediateType(void) const noexcept override final { return Type::VARIADIC; }
 				virtual const std::string ConvertToString(void) const noexcept override final;
@@ -464,17 +585,19 @@ namespace mcf
 			class VariableSignature : public Interface
 			{
 			public:
-				using Pointer = std::unique_ptr<VariableSignature>;
+				using Pointer = VariableSignature*;
 				using PointerVector = std::vector<Pointer>;
+				using PointerArray = mcf::AST::NodeArray<Pointer>;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<VariableSignature>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<VariableSignature>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit VariableSignature(void) noexcept = default;
-				explicit VariableSignature(mcf::AST::Expression::Identifier::Pointer&& name, TypeSignature::Pointer&& typeSignature) noexcept;
+				explicit VariableSignature(mcf::AST::Expression::Identifier::Pointer name, TypeSignature::Pointer typeSignature) noexcept;
 				
-				inline const std::string& GetName(void) const noexcept { return _name->GetTokenLiteral(); }
+				inline const std::string_view GetName(void) const noexcept { return _name->GetTokenLiteral(); }
+				inline const mcf::AST::Expression::Identifier* GetUnsafeNamePointer(void) const noexcept { return _name; }
 				const mcf::AST::Intermediate::TypeSignature* GetUnsafeTypeSignaturePointer(void) const noexcept;
 
 				inline virtual const Type GetIntermediateType(void) const noexcept override final { return Type::VARIABLE_SIGNATURE; }
@@ -488,20 +611,20 @@ namespace mcf
 			class FunctionParams : public Interface
 			{
 			public:
-				using Pointer = std::unique_ptr<FunctionParams>;
+				using Pointer = FunctionParams*;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<FunctionParams>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<FunctionParams>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit FunctionParams(void) noexcept = default;
-				explicit FunctionParams(std::vector<VariableSignature::Pointer>&& params, Variadic::Pointer&& variadic) noexcept
-					: _params(std::move(params)), _variadic(std::move(variadic)) {}
+				explicit FunctionParams(VariableSignature::PointerArray params, Variadic::Pointer variadic) noexcept
+					: _params(params), _variadic(variadic) {}
 
 				inline const bool IsVoid(void) const noexcept { return HasParams() == false && HasVariadic() == false; }
-				inline const bool HasParams(void) const noexcept { return _params.size() != 0; }
-				inline const bool HasVariadic(void) const noexcept { return _variadic.get() != nullptr; }
-				inline const size_t GetParamCount(void) const noexcept { return _params.size(); }
+				inline const bool HasParams(void) const noexcept { return _params.GetSize() != 0; }
+				inline const bool HasVariadic(void) const noexcept { return _variadic != nullptr; }
+				inline const size_t GetParamCount(void) const noexcept { return _params.GetSize(); }
 				const mcf::AST::Intermediate::VariableSignature* GetUnsafeParamPointerAt(size_t index) const noexcept;
 				const mcf::AST::Intermediate::Variadic* GetUnsafeVariadic(void) const noexcept;
 
@@ -509,25 +632,26 @@ namespace mcf
 				virtual const std::string ConvertToString(void) const noexcept override final;
 
 			private:
-				VariableSignature::PointerVector _params;
+				VariableSignature::PointerArray _params;
 				Variadic::Pointer _variadic;
 			};
 
 			class FunctionSignature : public Interface
 			{
 			public:
-				using Pointer = std::unique_ptr<FunctionSignature>;
+				using Pointer = FunctionSignature*;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<FunctionSignature>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<FunctionSignature>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit FunctionSignature(void) noexcept = default;
 				explicit FunctionSignature(mcf::AST::Expression::Identifier::Pointer name, FunctionParams::Pointer params, TypeSignature::Pointer returnType) noexcept;
 
-				inline const bool IsReturnTypeVoid(void) const noexcept { return _returnType.get() == nullptr; }
+				inline const bool IsReturnTypeVoid(void) const noexcept { return _returnType == nullptr; }
 
-				inline const std::string& GetName(void) const noexcept { return _name->GetTokenLiteral(); }
+				inline const std::string_view GetName(void) const noexcept { return _name->GetTokenLiteral(); }
+				inline const mcf::AST::Expression::Identifier* GetUnsafeNamePointer(void) const noexcept { return _name; }
 				const mcf::AST::Intermediate::TypeSignature* GetUnsafeReturnTypePointer(void) const noexcept;
 				const mcf::AST::Intermediate::FunctionParams* GetUnsafeFunctionParamsPointer(void) const noexcept;
 
@@ -591,41 +715,59 @@ namespace mcf
 				return TYPE_STRING_ARRAY[mcf::ENUM_INDEX(value)];
 			}
 
+			// 구체 타입을 가상 함수 대신 멤버로 저장하여 GetStatementType 와 VISIT 가 가상 호출 없이 타입을 읽습니다.
 			class Interface : public mcf::AST::Node::Interface
 			{
 			public:
-				virtual const Type GetStatementType(void) const noexcept = 0;
+				inline const Type GetStatementType(void) const noexcept { return _statementType; }
 				inline virtual const mcf::AST::Node::Type GetNodeType(void) const noexcept override final 
 				{ 
 					return mcf::AST::Node::Type::STATEMENT;
 				}
+
+			protected:
+				explicit Interface(const Type statementType) noexcept : _statementType(statementType) {}
+
+			private:
+				Type _statementType;
 			};
-			using Pointer = std::unique_ptr<Interface>;
+
+			// 문장 노드(AST::Statement)의 구체 클래스들이 상속합니다.
+			template <Type TYPE_VALUE>
+			class TypedInterface : public Interface
+			{
+			public:
+				static constexpr const Type TYPE = TYPE_VALUE;
+
+			protected:
+				explicit TypedInterface(void) noexcept : Interface(TYPE_VALUE) {}
+			};
+			using Pointer = Interface*;
 			using PointerVector = std::vector<Pointer>;
+			using PointerArray = mcf::AST::NodeArray<Pointer>;
 
-			class Invalid : public Interface
+			class Invalid : public TypedInterface<Type::INVALID>
 			{
 			public:
-				inline static Pointer Make(void) noexcept { return std::make_unique<Invalid>(); }
-				inline virtual const Type GetStatementType(void) const noexcept override final { return Type::INVALID; }
+				inline static Pointer Make(mcf::AST::Arena& arena) noexcept { return arena.Make<Invalid>(); }
 				inline virtual const std::string ConvertToString(void) const noexcept override final { return "<Invalid>"; }
 			};
 
-			class IncludeLibrary : public Interface
+			class IncludeLibrary : public TypedInterface<Type::INCLUDE_LIBRARY>
 			{
 			public:
-				using Pointer = std::unique_ptr<IncludeLibrary>;
+				using Pointer = IncludeLibrary*;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<IncludeLibrary>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<IncludeLibrary>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit IncludeLibrary(void) noexcept = default;
 				explicit IncludeLibrary(mcf::Token::Data libPath) noexcept : _libPath(libPath) {}
 
-				inline const std::string GetLibPath(void) const noexcept { return _libPath.Literal; }
+				inline const std::string GetLibPath(void) const noexcept { return std::string(_libPath.Literal); }
+				inline const mcf::Token::Data& GetLibPathToken(void) const noexcept { return _libPath; }
 
-				inline virtual const Type GetStatementType(void) const noexcept override final { return Type::INCLUDE_LIBRARY; }
 				virtual const std::string ConvertToString(void) const noexcept override final;
 
 			private:
@@ -633,65 +775,62 @@ namespace mcf
 				const bool _hasHeader = false;
 			};
 
-			class Typedef : public Interface
+			class Typedef : public TypedInterface<Type::TYPEDEF>
 			{
 			public:
-				using Pointer = std::unique_ptr<Typedef>;
+				using Pointer = Typedef*;
 				using SignaturePointer = mcf::AST::Intermediate::VariableSignature::Pointer;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<Typedef>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<Typedef>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit Typedef(void) noexcept = default;
-				explicit Typedef(SignaturePointer&& signature) noexcept;
+				explicit Typedef(SignaturePointer signature) noexcept;
 
-				inline const mcf::AST::Intermediate::VariableSignature* GetUnsafeSignaturePointer(void) const noexcept { return _signature.get(); }
+				inline const mcf::AST::Intermediate::VariableSignature* GetUnsafeSignaturePointer(void) const noexcept { return _signature; }
 
-				inline virtual const Type GetStatementType(void) const noexcept override final { return Type::TYPEDEF; }
 				virtual const std::string ConvertToString(void) const noexcept override final;
 
 			private:
 				SignaturePointer _signature;
 			};
 
-			class Extern : public Interface
+			class Extern : public TypedInterface<Type::EXTERN>
 			{
 			public:
-				using Pointer = std::unique_ptr<Extern>;
+				using Pointer = Extern*;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<Extern>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<Extern>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit Extern(void) noexcept = default;
-				explicit Extern(mcf::AST::Intermediate::FunctionSignature::Pointer&& signature) noexcept;
+				explicit Extern(mcf::AST::Intermediate::FunctionSignature::Pointer signature) noexcept;
 
-				inline const mcf::AST::Intermediate::FunctionSignature* GetUnsafeSignaturePointer(void) const noexcept { return _signature.get(); }
+				inline const mcf::AST::Intermediate::FunctionSignature* GetUnsafeSignaturePointer(void) const noexcept { return _signature; }
 
-				inline virtual const Type GetStatementType(void) const noexcept override final { return Type::EXTERN; }
 				virtual const std::string ConvertToString(void) const noexcept override final;
 
 			private:
 				mcf::AST::Intermediate::FunctionSignature::Pointer _signature;
 			};
 
-			class Let : public Interface
+			class Let : public TypedInterface<Type::LET>
 			{
 			public:
-				using Pointer = std::unique_ptr<Let>;
+				using Pointer = Let*;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<Let>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<Let>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit Let(void) noexcept = default;
-				explicit Let(mcf::AST::Intermediate::VariableSignature::Pointer&& signature, mcf::AST::Expression::Pointer&& expression) noexcept;
+				explicit Let(mcf::AST::Intermediate::VariableSignature::Pointer signature, mcf::AST::Expression::Pointer expression) noexcept;
 
-				inline const mcf::AST::Intermediate::VariableSignature* GetUnsafeSignaturePointer(void) const noexcept { return _signature.get(); }
-				inline const mcf::AST::Expression::Interface* GetUnsafeExpressionPointer(void) const noexcept { return _expression.get(); }
+				inline const mcf::AST::Intermediate::VariableSignature* GetUnsafeSignaturePointer(void) const noexcept { return _signature; }
+				inline const mcf::AST::Expression::Interface* GetUnsafeExpressionPointer(void) const noexcept { return _expression; }
 
-				inline virtual const Type GetStatementType(void) const noexcept override final { return Type::LET; }
 				virtual const std::string ConvertToString(void) const noexcept override final;
 
 			private:
@@ -699,99 +838,106 @@ namespace mcf
 				mcf::AST::Expression::Pointer _expression;
 			};
 
-			class Block : public Interface
+			class Block : public TypedInterface<Type::BLOCK>
 			{
 			public:
-				using Pointer = std::unique_ptr<Block>;
+				using Pointer = Block*;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<Block>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<Block>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit Block(void) noexcept = default;
-				explicit Block(Statement::PointerVector&& statements) noexcept;
+				explicit Block(Statement::PointerArray statements) noexcept;
 
-				inline const size_t GetStatementCount(void) const noexcept { return _statements.size(); }
+				inline const size_t GetStatementCount(void) const noexcept { return _statements.GetSize(); }
 				inline mcf::AST::Statement::Interface* GetUnsafeStatementPointerAt(const size_t index) noexcept
 				{
-					return _statements[index].get();
+					return _statements[index];
 				}
 				inline const mcf::AST::Statement::Interface* GetUnsafeStatementPointerAt(const size_t index) const noexcept 
 				{
-					return _statements[index].get(); 
+					return _statements[index]; 
 				}
 
-				inline virtual const Type GetStatementType(void) const noexcept override final { return Type::BLOCK; }
 				virtual const std::string ConvertToString(void) const noexcept override final;
 
 			private:
-				Statement::PointerVector _statements;
+				Statement::PointerArray _statements;
 			};
 
-			class Return : public Interface
+			class Return : public TypedInterface<Type::RETURN>
 			{
 			public:
-				using Pointer = std::unique_ptr<Return>;
+				using Pointer = Return*;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<Return>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<Return>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit Return(void) noexcept = default;
-				explicit Return(mcf::AST::Expression::Pointer&& returnValue) noexcept;
+				explicit Return(mcf::AST::Expression::Pointer returnValue) noexcept;
 
-				inline const mcf::AST::Expression::Interface* GetUnsafeReturnValueExpressionPointer(void) const noexcept { return _returnValue.get(); }
+				inline const mcf::AST::Expression::Interface* GetUnsafeReturnValueExpressionPointer(void) const noexcept { return _returnValue; }
 
-				inline virtual const Type GetStatementType(void) const noexcept override final { return Type::RETURN; }
 				virtual const std::string ConvertToString(void) const noexcept override final;
 
 			private:
 				mcf::AST::Expression::Pointer _returnValue;
 			};
 
-			class Func : public Interface
+			class Func : public TypedInterface<Type::FUNC>
 			{
 			public:
-				using Pointer = std::unique_ptr<Func>;
+				using Pointer = Func*;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<Func>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<Func>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit Func(void) noexcept = default;
-				explicit Func(mcf::AST::Intermediate::FunctionSignature::Pointer&& signature, mcf::AST::Statement::Block::Pointer&& block) noexcept;
+				explicit Func(mcf::AST::Intermediate::FunctionSignature::Pointer signature, mcf::AST::Statement::Block::Pointer block) noexcept;
+				// 본문을 지연 파싱하는 함수입니다. 본문은 토큰 버퍼의 [bodyBeginTokenIndex, bodyEndTokenIndex) 범위이며 Program::MaterializeFunctionBody 로 파싱합니다.
+				explicit Func(mcf::AST::Intermediate::FunctionSignature::Pointer signature, const std::uint32_t bodyBeginTokenIndex, const std::uint32_t bodyEndTokenIndex) noexcept;
 
-				inline const mcf::AST::Intermediate::FunctionSignature* GetUnsafeSignaturePointer(void) const noexcept { return _signature.get(); }
-				inline const mcf::AST::Statement::Block* GetUnsafeBlockPointer(void) const noexcept { return _block.get(); }
+				inline const mcf::AST::Intermediate::FunctionSignature* GetUnsafeSignaturePointer(void) const noexcept { return _signature; }
+				// 본문이 아직 파싱되지 않았으면 nullptr 입니다.
+				inline const mcf::AST::Statement::Block* GetUnsafeBlockPointer(void) const noexcept { return _block; }
+				inline const bool IsBodyParsed(void) const noexcept { return _block != nullptr; }
+				inline const std::uint32_t GetBodyBeginTokenIndex(void) const noexcept { return _bodyBeginTokenIndex; }
+				inline const std::uint32_t GetBodyEndTokenIndex(void) const noexcept { return _bodyEndTokenIndex; }
 
-				inline virtual const Type GetStatementType(void) const noexcept override final { return Type::FUNC; }
 				virtual const std::string ConvertToString(void) const noexcept override final;
 
 			private:
+				friend mcf::AST::Program;
+
 				mcf::AST::Intermediate::FunctionSignature::Pointer _signature;;
-				mcf::AST::Statement::Block::Pointer _block;
+				// 지연 파싱된 본문은 처음 사용될 때 Program::MaterializeFunctionBody 에서 채워집니다.
+				mutable mcf::AST::Statement::Block::Pointer _block = nullptr;
+				std::uint32_t _bodyBeginTokenIndex = 0;
+				std::uint32_t _bodyEndTokenIndex = 0;
 			};
 
-			class Main : public Interface
+			class Main : public TypedInterface<Type::MAIN>
 			{
 			public:
 				static std::string NAME;
 
-				using Pointer = std::unique_ptr<Main>;
+				using Pointer = Main*;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<Main>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<Main>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit Main(void) noexcept = default;
-				explicit Main(mcf::AST::Intermediate::FunctionParams::Pointer&& params, mcf::AST::Intermediate::TypeSignature::Pointer&& returnType, Block::Pointer&& block) noexcept;
+				explicit Main(mcf::AST::Intermediate::FunctionParams::Pointer params, mcf::AST::Intermediate::TypeSignature::Pointer returnType, Block::Pointer block) noexcept;
 
-				inline const bool IsReturnVoid(void) const noexcept { return _returnType.get() == nullptr; }
+				inline const bool IsReturnVoid(void) const noexcept { return _returnType == nullptr; }
 				const mcf::AST::Intermediate::TypeSignature* GetUnsafeReturnTypePointer(void) const noexcept;
 				const mcf::AST::Intermediate::FunctionParams* GetUnsafeFunctionParamsPointer(void) const noexcept;
 				const mcf::AST::Statement::Block* GetUnsafeBlockPointer(void) const noexcept;
 
-				inline virtual const Type GetStatementType(void) const noexcept override final { return Type::MAIN; }
 				virtual const std::string ConvertToString(void) const noexcept override final;
 
 			private:
@@ -800,46 +946,44 @@ namespace mcf
 				Block::Pointer _block;
 			};
 
-			class Expression : public Interface
+			class Expression : public TypedInterface<Type::EXPRESSION>
 			{
 			public:
-				using Pointer = std::unique_ptr<Expression>;
+				using Pointer = Expression*;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<Expression>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<Expression>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit Expression(void) noexcept = default;
-				explicit Expression(mcf::AST::Expression::Pointer&& expression) noexcept;
+				explicit Expression(mcf::AST::Expression::Pointer expression) noexcept;
 
-				inline mcf::AST::Expression::Interface* GetUnsafeExpression(void) noexcept { return _expression.get(); }
-				inline const mcf::AST::Expression::Interface* GetUnsafeExpression(void) const noexcept { return _expression.get(); }
+				inline mcf::AST::Expression::Interface* GetUnsafeExpression(void) noexcept { return _expression; }
+				inline const mcf::AST::Expression::Interface* GetUnsafeExpression(void) const noexcept { return _expression; }
 
-				inline virtual const Type GetStatementType(void) const noexcept override final { return Type::EXPRESSION; }
 				virtual const std::string ConvertToString(void) const noexcept override final;
 
 			private:
 				mcf::AST::Expression::Pointer _expression;
 			};
 
-			class AssignExpression : public Interface
+			class AssignExpression : public TypedInterface<Type::ASSIGN_EXPRESSION>
 			{
 			public:
-				using Pointer = std::unique_ptr<AssignExpression>;
+				using Pointer = AssignExpression*;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<AssignExpression>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<AssignExpression>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit AssignExpression(void) noexcept = default;
-				explicit AssignExpression(mcf::AST::Expression::Pointer&& left, mcf::AST::Expression::Pointer&& right) noexcept;
+				explicit AssignExpression(mcf::AST::Expression::Pointer left, mcf::AST::Expression::Pointer right) noexcept;
 
-				inline mcf::AST::Expression::Interface* GetUnsafeLeftExpression(void) noexcept { return _left.get(); }
-				inline const mcf::AST::Expression::Interface* GetUnsafeLeftExpression(void) const noexcept { return _left.get(); }
-				inline mcf::AST::Expression::Interface* GetUnsafeRightExpression(void) noexcept { return _right.get(); }
-				inline const mcf::AST::Expression::Interface* GetUnsafeRightExpression(void) const noexcept { return _right.get(); }
+				inline mcf::AST::Expression::Interface* GetUnsafeLeftExpression(void) noexcept { return _left; }
+				inline const mcf::AST::Expression::Interface* GetUnsafeLeftExpression(void) const noexcept { return _left; }
+				inline mcf::AST::Expression::Interface* GetUnsafeRightExpression(void) noexcept { return _right; }
+				inline const mcf::AST::Expression::Interface* GetUnsafeRightExpression(void) const noexcept { return _right; }
 
-				inline virtual const Type GetStatementType(void) const noexcept override final { return Type::ASSIGN_EXPRESSION; }
 				virtual const std::string ConvertToString(void) const noexcept override final;
 
 			private:
@@ -847,51 +991,49 @@ namespace mcf
 				mcf::AST::Expression::Pointer _right;
 			};
 
-			class Unused : public Interface
+			class Unused : public TypedInterface<Type::UNUSED>
 			{
 			public:
-				using Pointer = std::unique_ptr<Unused>;
+				using Pointer = Unused*;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<Unused>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<Unused>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit Unused(void) noexcept = default;
-				explicit Unused(mcf::AST::Expression::Identifier::PointerVector&& identifiers) noexcept;
+				explicit Unused(mcf::AST::Expression::Identifier::PointerArray identifiers) noexcept;
 
-				inline const size_t GetIdentifiersCount(void) const noexcept { return _identifiers.size(); }
+				inline const size_t GetIdentifiersCount(void) const noexcept { return _identifiers.GetSize(); }
 				inline mcf::AST::Expression::Identifier* GetUnsafeIdentifierPointerAt(const size_t index) noexcept
 				{
-					return _identifiers[index].get();
+					return _identifiers[index];
 				}
 				inline const mcf::AST::Expression::Identifier* GetUnsafeIdentifierPointerAt(const size_t index) const noexcept
 				{
-					return _identifiers[index].get();
+					return _identifiers[index];
 				}
 
-				inline virtual const Type GetStatementType(void) const noexcept override final { return Type::UNUSED; }
 				virtual const std::string ConvertToString(void) const noexcept override final;
 
 			private:
-				mcf::AST::Expression::Identifier::PointerVector _identifiers;
+				mcf::AST::Expression::Identifier::PointerArray _identifiers;
 			};
 
-			class While : public Interface
+			class While : public TypedInterface<Type::WHILE>
 			{
 			public:
-				using Pointer = std::unique_ptr<While>;
+				using Pointer = While*;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<While>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<While>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit While(void) noexcept = default;
-				explicit While(mcf::AST::Expression::Pointer&& condition, mcf::AST::Statement::Block::Pointer&& block) noexcept;
+				explicit While(mcf::AST::Expression::Pointer condition, mcf::AST::Statement::Block::Pointer block) noexcept;
 
-				inline const mcf::AST::Expression::Interface* GetUnsafeConditionPointer(void) const noexcept { return _condition.get(); }
-				inline const mcf::AST::Statement::Block* GetUnsafeBlockPointer(void) const noexcept { return _block.get(); }
+				inline const mcf::AST::Expression::Interface* GetUnsafeConditionPointer(void) const noexcept { return _condition; }
+				inline const mcf::AST::Statement::Block* GetUnsafeBlockPointer(void) const noexcept { return _block; }
 
-				inline virtual const Type GetStatementType(void) const noexcept override final { return Type::WHILE; }
 				virtual const std::string ConvertToString(void) const noexcept override final;
 
 			private:
@@ -899,49 +1041,266 @@ namespace mcf
 				mcf::AST::Statement::Block::Pointer _block;
 			};
 
-			class Break : public Interface
+			class Break : public TypedInterface<Type::BREAK>
 			{
 			public:
-				using Pointer = std::unique_ptr<Break>;
+				using Pointer = Break*;
 
 				template <class... Variadic>
-				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<Break>(std::move(args)...); }
+				inline static Pointer Make(mcf::AST::Arena& arena, Variadic&& ...args) noexcept { return arena.Make<Break>(std::forward<Variadic>(args)...); }
 
 			public:
 				explicit Break(void) noexcept = default;
 				explicit Break(const mcf::Token::Data token) noexcept : _token(token) {}
 
-				inline const std::string GetLibPath(void) const noexcept { return _token.Literal; }
+				inline const std::string GetLibPath(void) const noexcept { return std::string(_token.Literal); }
+				inline const mcf::Token::Data& GetToken(void) const noexcept { return _token; }
 
-				inline virtual const Type GetStatementType(void) const noexcept override final { return Type::BREAK; }
 				inline virtual const std::string ConvertToString(void) const noexcept override final { return "[Break: SEMICOLON]"; }
 
 			private:
 				mcf::Token::Data _token;
 			};
+
+			// 클래스 순서는 Type 과 같아야 합니다.
+			using NodeList = mcf::NodeList<Type, Invalid, IncludeLibrary, Typedef, Extern, Let, Block, Return, Func, Main, Expression, AssignExpression, Unused, While, Break>;
+			static_assert(NodeList::IS_MATCHING() == true, "statement node list not matching!");
+
+			// statement 의 구체 클래스를 받는 visitor 의 오버로드를 호출합니다. 자세한 내용은 mcf::NodeList::Visit 를 참고 해 주세요.
+			template <class NodePointer, class Visitor>
+			inline decltype(auto) VISIT(NodePointer statement, Visitor&& visitor) noexcept
+			{
+				return NodeList::Visit(statement->GetStatementType(), statement, std::forward<Visitor>(visitor));
+			}
 		}
 
+		// 지연 파싱된 함수 본문을 파싱합니다. 파서가 구현하며 프로그램이 소유합니다.
+		class BodyParser
+		{
+		public:
+			virtual inline ~BodyParser(void) noexcept {}
+			// 토큰 버퍼의 [beginTokenIndex, endTokenIndex) 범위를 블록으로 파싱하여 arena 에 할당합니다. 실패하면 nullptr 을 반환합니다.
+			virtual mcf::AST::Statement::Block::Pointer ParseBody(mcf::AST::Arena& arena, const size_t beginTokenIndex, const size_t endTokenIndex) noexcept = 0;
+		};
+
 		class Program final : public Node::Interface
 		{
 		public:
 			explicit Program(void) noexcept = default;
-			explicit Program(mcf::AST::Statement::PointerVector&& statements) noexcept;
+			explicit Program(std::unique_ptr<mcf::AST::Arena>&& arena, mcf::AST::Statement::PointerVector&& statements) noexcept;
+			explicit Program(std::unique_ptr<mcf::AST::Arena>&& arena, mcf::AST::Statement::PointerVector&& statements, const mcf::Lexer::Source& source, const std::shared_ptr<mcf::Symbol::Table>& symbols) noexcept;
+			// 본문을 지연 파싱한 함수가 있는 프로그램입니다. bodyParser 는 MaterializeFunctionBody 에서 사용합니다.
+			explicit Program(std::unique_ptr<mcf::AST::Arena>&& arena, mcf::AST::Statement::PointerVector&& statements, const mcf::Lexer::Source& source, const std::shared_ptr<mcf::Symbol::Table>& symbols,
+				std::unique_ptr<mcf::AST::BodyParser>&& bodyParser) noexcept;
+			// 여러 아레나에 나뉘어 할당된 문장들로 만든 프로그램입니다. 문장들이 할당된 아레나와 토큰 문자열이 가리키는 소스 버퍼들을 함께 소유하여 프로그램이 살아있는 동안 유지합니다.
+			explicit Program(std::vector<std::shared_ptr<const mcf::AST::Arena>>&& sharedArenas, std::vector<mcf::Lexer::Source>&& sharedSources, mcf::AST::Statement::PointerVector&& statements,
+				const mcf::Lexer::Source& source, const std::shared_ptr<mcf::Symbol::Table>& symbols) noexcept;
+
+			// 지연 파싱된 함수의 본문을 파싱하여 func 에 기록합니다. 이미 파싱된 본문이면 아무것도 하지 않습니다.
+			// 트리의 내용은 바뀌지 않고 지연되었던 노드가 채워질 뿐이므로 const 입니다. 주의: thread-safe 하지 않습니다.
+			const bool MaterializeFunctionBody(_Notnull_ const mcf::AST::Statement::Func* func) const noexcept;
 
 			inline const size_t GetStatementCount(void) const noexcept { return _statements.size(); }
+			// 노드들이 할당된 아레나입니다. 기본 생성된 프로그램이면 nullptr 입니다.
+			inline const mcf::AST::Arena* GetArena(void) const noexcept { return _arena.get(); }
+			// 식별자 노드의 심볼 ID 를 만든 테이블입니다. 파서 없이 만든 프로그램이면 nullptr 입니다.
+			inline const mcf::Symbol::Table* GetSymbolTable(void) const noexcept { return _symbols.get(); }
+			inline const std::shared_ptr<mcf::Symbol::Table>& GetSharedSymbolTable(void) const noexcept { return _symbols; }
+			inline const mcf::Lexer::Source& GetSource(void) const noexcept { return _source; }
+			// GetSource() 외에 토큰 문자열이 가리킬 수 있는 소스 버퍼들입니다.
+			inline const std::vector<mcf::Lexer::Source>& GetSharedSources(void) const noexcept { return _sharedSources; }
 			inline mcf::AST::Statement::Interface* GetUnsafeStatementPointerAt(const size_t index) noexcept
 			{
-				return _statements[index].get();
+				return _statements[index];
 			}
 			inline const mcf::AST::Statement::Interface* GetUnsafeStatementPointerAt(const size_t index) const noexcept 
 			{
-				return _statements[index].get(); 
+				return _statements[index]; 
 			}
 
 			inline virtual const Node::Type GetNodeType(void) const noexcept override final { return Node::Type::PROGRAM; }
 			virtual const std::string ConvertToString(void) const noexcept override final;
 
 		private:
+			// 모든 노드를 소유합니다. 프로그램이 소멸될 때 트리 전체가 블록 단위로 한번에 해제됩니다.
+			std::unique_ptr<mcf::AST::Arena> _arena;
 			mcf::AST::Statement::PointerVector _statements;
+			// 노드들이 들고 있는 토큰 리터럴이 가리키는 소스 버퍼를 프로그램이 살아있는 동안 유지합니다.
+			mcf::Lexer::Source _source;
+			std::shared_ptr<mcf::Symbol::Table> _symbols;
+			std::unique_ptr<mcf::AST::BodyParser> _bodyParser;
+			// 다른 프로그램과 공유하는 아레나와 소스 버퍼입니다. 세션이 재사용한 문장처럼 _arena 밖에 할당된 노드를 가진 프로그램만 사용합니다.
+			std::vector<std::shared_ptr<const mcf::AST::Arena>> _sharedArenas;
+			std::vector<mcf::Lexer::Source> _sharedSources;
 		};
+
+		// 포인터 대신 32비트 인덱스로 자식을 가리키는 평면 AST 입니다.
+		// 노드 종류는 1바이트 배열에, 노드 내용은 같은 크기의 레코드 배열에 연속으로 저장하여 순회할 때 가상 함수 호출과 포인터 추적이 없습니다.
+		namespace Flat
+		{
+			using Index = std::uint32_t;
+			constexpr const Index INVALID_INDEX = 0xffffffff;
+
+			enum class Kind : unsigned char
+			{
+				INVALID = 0,
+
+				// 표현식
+				IDENTIFIER,			// Token
+				INTEGER,			// Token
+				STRING,				// Token
+				PREFIX,				// Token: 연산자, Left: 피연산자
+				GROUP,				// Left: 표현식
+				INFIX,				// Token: 연산자, Left, Right: 피연산자
+				CALL,				// Left: 함수 표현식, Right: 인자 리스트
+				AS,					// Left: 표현식, Right: TYPE_SIGNATURE
+				INDEX,				// Left: 표현식, Right: 인덱스 표현식 또는 INVALID_INDEX
+				INITIALIZER,		// Left: 키 리스트
+				MAP_INITIALIZER,	// Left: 키 리스트, Right: 값 리스트
+
+				// 중간 노드
+				VARIADIC,			// Left: IDENTIFIER
+				TYPE_SIGNATURE,		// Left: 타입 표현식, Right: unsigned 이면 1 아니면 0
+				VARIABLE_SIGNATURE,	// Left: IDENTIFIER, Right: TYPE_SIGNATURE
+				FUNCTION_PARAMS,	// Left: VARIABLE_SIGNATURE 리스트, Right: VARIADIC 또는 INVALID_INDEX
+				FUNCTION_SIGNATURE,	// Left: IDENTIFIER, Right: [FUNCTION_PARAMS, 반환 TYPE_SIGNATURE 또는 INVALID_INDEX] 리스트
+
+				// 명령문
+				INCLUDE_LIBRARY,	// Token: 라이브러리 경로
+				TYPEDEF,			// Left: VARIABLE_SIGNATURE
+				EXTERN,				// Left: FUNCTION_SIGNATURE
+				LET,				// Left: VARIABLE_SIGNATURE, Right: 표현식 또는 INVALID_INDEX
+				BLOCK,				// Left: 명령문 리스트
+				RETURN,				// Left: 표현식
+				FUNC,				// Left: FUNCTION_SIGNATURE, Right: BLOCK
+				MAIN,				// Left: [FUNCTION_PARAMS, 반환 TYPE_SIGNATURE 또는 INVALID_INDEX, BLOCK] 리스트
+				EXPRESSION,			// Left: 표현식
+				ASSIGN_EXPRESSION,	// Left, Right: 표현식
+				UNUSED,				// Left: IDENTIFIER 리스트
+				WHILE,				// Left: 조건 표현식, Right: BLOCK
+				BREAK,				// Token
+
+				// 이 밑으로는 수정하면 안됩니다.
+				COUNT,
+			};
+
+			constexpr const char* KIND_STRING_ARRAY[] =
+			{
+				"INVALID",
+
+				"IDENTIFIER",
+				"INTEGER",
+				"STRING",
+				"PREFIX",
+				"GROUP",
+				"INFIX",
+				"CALL",
+				"AS",
+				"INDEX",
+				"INITIALIZER",
+				"MAP_INITIALIZER",
+
+				"VARIADIC",
+				"TYPE_SIGNATURE",
+				"VARIABLE_SIGNATURE",
+				"FUNCTION_PARAMS",
+				"FUNCTION_SIGNATURE",
+
+				"INCLUDE_LIBRARY",
+				"TYPEDEF",
+				"EXTERN",
+				"LET",
+				"BLOCK",
+				"RETURN",
+				"FUNC",
+				"MAIN",
+				"EXPRESSION",
+				"ASSIGN_EXPRESSION",
+				"UNUSED",
+				"WHILE",
+				"BREAK",
+			};
+			constexpr const size_t KIND_STRING_ARRAY_SIZE = MCF_ARRAY_SIZE(KIND_STRING_ARRAY);
+			static_assert(static_cast<size_t>(Kind::COUNT) == KIND_STRING_ARRAY_SIZE, "flat node kind count not matching!");
+
+			constexpr const char* CONVERT_KIND_TO_STRING(const Kind value)
+			{
+				return KIND_STRING_ARRAY[mcf::ENUM_INDEX(value)];
+			}
+
+			// 모든 종류의 노드가 같은 크기의 레코드를 사용합니다. 각 필드의 의미는 Kind 의 주석을 참고하세요.
+			// 리스트는 리스트 배열의 시작 인덱스이며 [갯수, 원소...] 순서로 저장됩니다.
+			struct Node final
+			{
+				Index Token = INVALID_INDEX;	// 토큰 배열의 인덱스입니다.
+				Index Left = INVALID_INDEX;
+				Index Right = INVALID_INDEX;
+			};
+			static_assert(sizeof(Node) == 12, "flat node must be 12 bytes.");
+
+			class Program final
+			{
+			public:
+				explicit Program(void) noexcept = default;
+				// 포인터 AST 를 평면 AST 로 변환합니다. 토큰 리터럴이 가리키는 소스 버퍼와 심볼 테이블은 공유합니다.
+				explicit Program(const mcf::AST::Program& program) noexcept;
+
+				inline const size_t GetNodeCount(void) const noexcept { return _kinds.size(); }
+				inline const Kind GetKind(const Index node) const noexcept { return _kinds[node]; }
+				inline const Node& GetNode(const Index node) const noexcept { return _nodes[node]; }
+				inline const mcf::Token::Data& GetToken(const Index node) const noexcept { return _tokens[_nodes[node].Token]; }
+
+				inline const size_t GetListCount(const Index list) const noexcept { return _lists[list]; }
+				inline const Index GetListItem(const Index list, const size_t index) const noexcept { return _lists[list + 1 + index]; }
+
+				inline const size_t GetStatementCount(void) const noexcept { return _statements.size(); }
+				inline const Index GetStatementAt(const size_t index) const noexcept { return _statements[index]; }
+				inline const mcf::Symbol::Table* GetSymbolTable(void) const noexcept { return _symbols.get(); }
+				inline const mcf::Lexer::Source& GetSource(void) const noexcept { return _source; }
+
+				// 바이너리 캐시 형식으로 저장합니다. 토큰은 문자열 대신 소스 버퍼의 위치만 저장하므로 모든 토큰의 Literal 이 GetSource() 를 가리켜야 하며, 그렇지 않으면 false 를 반환합니다.
+				// sourceHash 는 Cache::HashSource(GetSource()->GetView()) 여야 합니다.
+				const bool Serialize(_Out_ std::string& outBinary, const std::uint64_t sourceHash) const noexcept;
+				// Serialize 로 만든 binary 를 읽습니다. source 의 길이와 sourceHash 가 저장할 때와 같아야 하며, 식별자 토큰은 symbols 에 다시 등록합니다.
+				// 버전이나 형식, 내용의 해시가 맞지 않거나 범위를 벗어난 인덱스, Kind 의 주석과 다른 종류의 자식이 있으면 false 를 반환하고 프로그램은 바뀌지 않습니다. 렉서와 파서는 사용하지 않습니다.
+				const bool Deserialize(const std::string_view binary, const mcf::Lexer::Source& source, const std::uint64_t sourceHash, const std::shared_ptr<mcf::Symbol::Table>& symbols) noexcept;
+
+			private:
+				const Index ConvertStatement(const mcf::AST::Statement::Interface* statement) noexcept;
+				const Index ConvertIntermediate(const mcf::AST::Intermediate::Interface* intermediate) noexcept;
+				const Index ConvertExpression(const mcf::AST::Expression::Interface* expression) noexcept;
+
+				const Index AddNode(const Kind kind, const Index left, const Index right) noexcept;
+				const Index AddNode(const Kind kind, const mcf::Token::Data& token, const Index left, const Index right) noexcept;
+				const Index AddList(const std::vector<Index>& items) noexcept;
+
+			private:
+				std::vector<Kind> _kinds;
+				std::vector<Node> _nodes;
+				std::vector<mcf::Token::Data> _tokens;
+				std::vector<Index> _lists;
+				std::vector<Index> _statements;
+				mcf::Lexer::Source _source;
+				std::vector<mcf::Lexer::Source> _sharedSources;	// 원본 프로그램의 GetSharedSources() 입니다.
+				std::shared_ptr<mcf::Symbol::Table> _symbols;
+			};
+		}
+
+		// 평면 AST 를 소스 내용의 해시로 찾는 캐시 파일입니다. 파일 이름은 해시의 16진수 문자열에 FILE_EXTENSION 을 붙인 것입니다.
+		namespace Cache
+		{
+			// Flat::Program::Serialize 의 형식이나 Flat::Kind, Flat::Node 가 바뀌면 올려야 합니다. 다른 버전의 캐시 파일은 읽지 않습니다.
+			constexpr const std::uint32_t VERSION = 2;
+			static_assert(mcf::ENUM_COUNT<mcf::AST::Flat::Kind>() == 30 && sizeof(mcf::AST::Flat::Node) == 12, "flat AST changed. update the count here and bump Cache::VERSION.");
+			constexpr const char* const FILE_EXTENSION = ".mcfast";
+
+			// 8바이트씩 섞는 FNV-1a 변형입니다. 실행할 때마다 같은 값을 가져야 하므로 std::hash 를 사용하지 않습니다.
+			const std::uint64_t HashSource(const std::string_view source) noexcept;
+			const std::string MakeFilePath(const std::string& cacheDirectory, const std::uint64_t sourceHash) noexcept;
+			// source 와 내용이 같은 소스로 만든 캐시 파일을 메모리 매핑하여 읽습니다. 캐시 파일이 없거나 손상되어 읽을 수 없으면 false 를 반환합니다.
+			const bool Load(_Out_ mcf::AST::Flat::Program& outProgram, const std::string& cacheDirectory, const mcf::Lexer::Source& source, const std::shared_ptr<mcf::Symbol::Table>& symbols) noexcept;
+			// program 의 소스 해시로 캐시 파일을 씁니다. cacheDirectory 가 없으면 만듭니다. 여러 프로세스가 동시에 써도 되도록 고유한 임시 파일에 쓴 뒤 이름을 바꿉니다.
+			const bool Store(const mcf::AST::Flat::Program& program, const std::string& cacheDirectory) noexcept;
+		}
 	}
 }
\ No newline at end of file
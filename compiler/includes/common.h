@@ -1,5 +1,8 @@
 ﻿#pragma once
+#include <cstdint>
 #include <string>
+#include <tuple>
+#include <type_traits>
 
 #if defined(UNUSED)
 #undef MCF_UNUSED
@@ -49,4 +52,65 @@ namespace mcf
 		array;
 		return sizeof(T);
 	}
+
+	// 여러 람다를 하나의 visitor 로 묶습니다. 예: mcf::Visitor{ [&](const Identifier* node) { ... }, [&](const Integer* node) { ... } }
+	template <class... Functions>
+	struct Visitor final : Functions...
+	{
+		using Functions::operator()...;
+	};
+	template <class... Functions>
+	Visitor(Functions...) -> Visitor<Functions...>;
+
+	// 노드 계층의 구체 클래스 목록입니다. N 번째 클래스의 TYPE 은 EnumType 의 N 번째 값이어야 합니다.
+	// 각 노드 계층은 TypedInterface<TYPE> 템플릿을 두어 구체 클래스가 자신의 TYPE 을 정적 멤버로 갖게 하며, IS_MATCHING 은 이 값으로 클래스 순서를 검사합니다.
+	template <class EnumType, class... NodeClasses>
+	struct NodeList final
+	{
+		static_assert(std::is_enum_v<EnumType> == true, u8"only enum type is required for this struct");
+
+		static constexpr const bool IS_MATCHING(void) noexcept
+		{
+			size_t index = 0;
+			const bool isMatching = ((NodeClasses::TYPE == mcf::ENUM_AT<EnumType>(index++)) && ...);
+			return isMatching && index == mcf::ENUM_COUNT<EnumType>();
+		}
+
+		// node 를 type 에 해당하는 구체 클래스로 캐스팅하여 visitor 를 호출합니다. 범위를 벗어난 type 은 MCF_DEBUG_BREAK 로 알리고,
+		// node 를 어떤 클래스로도 캐스팅하지 않고 visitor 도 호출하지 않은 채 Result() 를 반환합니다. 따라서 visitor 의 반환 타입은 값이나 void 여야 합니다.
+		// 디스패치는 함수 테이블을 type 으로 한번 인덱싱하는 것이 전부이며, 각 클래스의 처리 함수는 테이블 항목 안에 인라인됩니다.
+		// visitor 에 어떤 구체 클래스를 받는 오버로드가 없거나 반환 타입이 다르면 컴파일 에러가 나므로 노드 타입이 추가되면 모든 visitor 를 고쳐야 합니다.
+		// 단, 파생 클래스(예: MapInitializer)는 오버로드가 없으면 부모 클래스의 오버로드로 암시적 변환되므로 주의 해야 합니다.
+		template <class NodePointer, class Function>
+		inline static decltype(auto) Visit(const EnumType type, NodePointer node, Function&& visitor) noexcept
+		{
+			static_assert(std::is_pointer_v<NodePointer> == true, u8"only raw pointer is required for this function");
+			static_assert(sizeof...(NodeClasses) == mcf::ENUM_COUNT<EnumType>(), u8"every enum value must have a node class");
+			using VisitorType = std::remove_reference_t<Function>;
+			using Result = decltype(VisitAs<std::tuple_element_t<0, std::tuple<NodeClasses...>>>(node, visitor));
+			static_assert((std::is_same_v<Result, decltype(VisitAs<NodeClasses>(node, visitor))> && ...), "every visitor overload must return the same type.");
+
+			using VisitFunction = Result(*)(NodePointer, VisitorType&) noexcept;
+			constexpr const VisitFunction VISIT_FUNCTIONS[] = { &VisitAs<NodeClasses, NodePointer, VisitorType>... };
+			// 잘못된 메모리에서 읽은 type 으로 테이블 밖을 읽지 않습니다. INVALID 의 처리 함수로 보내면 INVALID 가 아닌 노드를 INVALID 클래스로 캐스팅하게 되므로 따로 처리합니다.
+			const size_t index = static_cast<size_t>(type);
+			if (index >= sizeof...(NodeClasses))
+			{
+				// 공개 헤더이므로 framework.h 를 포함하지 않습니다. 컴파일러 소스는 pch.h 에서 이 헤더보다 먼저 framework.h 를 포함합니다.
+#if defined(MCF_DEBUG_BREAK)
+				MCF_DEBUG_BREAK(u8"범위를 벗어난 노드 타입입니다. type=%zu", index);
+#endif
+				return Result();
+			}
+			return VISIT_FUNCTIONS[index](node, visitor);
+		}
+
+	private:
+		template <class NodeClass, class NodePointer, class VisitorType>
+		inline static decltype(auto) VisitAs(NodePointer node, VisitorType& visitor) noexcept
+		{
+			using TargetClass = std::conditional_t<std::is_const_v<std::remove_pointer_t<NodePointer>>, const NodeClass, NodeClass>;
+			return visitor(static_cast<TargetClass*>(node));
+		}
+	};
 }
\ No newline at end of file
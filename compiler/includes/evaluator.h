@@ -57,7 +57,8 @@ namespace mcf
 
 
 		private:
-			const mcf::Object::FunctionInfo _info;
+			// 호출하는 함수의 정보는 스코프의 함수 테이블 항목을 참조합니다.
+			const mcf::Object::FunctionInfo& _info;
 			MemoryAllocator _localMemory;
 			mcf::IR::ASM::PointerVector _localCodes;
 			size_t _currParamIndex = 0;
@@ -84,7 +85,7 @@ namespace mcf
 
 		private:
 			const mcf::IR::ASM::Register EvaluateExpressionAndGetRegisterForMoving(
-				const mcf::IR::ASM::Register availableRegisters[sizeof(__int64)], 
+				const mcf::IR::ASM::Register availableRegisters[sizeof(std::int64_t)], 
 				_Notnull_ const mcf::IR::Expression::Interface* expression) noexcept;
 			mcf::IR::ASM::Pointer MoveExpressionToRegister(const mcf::IR::ASM::Register targetRegister, _Notnull_ const mcf::IR::Expression::Interface* expression) noexcept;
 
@@ -143,9 +144,18 @@ namespace mcf
 			static const bool ValidateVariableTypeAndValue(const mcf::Object::Variable& variable, _Notnull_ const mcf::IR::Expression::Interface* value) noexcept;
 			static const bool ValidateExpressionTypes(_Notnull_ const mcf::IR::Expression::Interface* left, _Notnull_ const mcf::IR::Expression::Interface* right) noexcept;
 
+			// 전역 문장과 함수 시그니처를 먼저 등록한 뒤 함수 본문을 평가하고, 평가된 본문마다 코드를 생성합니다.
+			// 함수 본문에서는 함수보다 앞에 선언된 전역 이름만 보이므로 결과는 선언 순서대로 평가한 것과 같습니다.
 			mcf::IR::Program::Pointer EvalProgram(_Notnull_ const mcf::AST::Program* program, _Notnull_ mcf::Object::Scope* scope) noexcept;
+			// 평면 AST 를 평가합니다. 결과는 같은 프로그램을 mcf::AST::Program 으로 평가한 것과 같습니다.
+			mcf::IR::Program::Pointer EvalProgram(_Notnull_ const mcf::AST::Flat::Program* program, _Notnull_ mcf::Object::Scope* scope) noexcept;
+			// 함수 본문의 평가와 코드 생성을 threadCount 개의 스레드가 작업을 훔쳐가며 나누어 실행합니다.
+			// threadCount 가 0 이면 하드웨어 스레드 수를 사용하며 결과와 리터럴 인덱스는 스레드 수와 상관없이 EvalProgram 과 같습니다.
+			mcf::IR::Program::Pointer EvalProgramParallel(_Notnull_ const mcf::AST::Program* program, _Notnull_ mcf::Object::Scope* scope, const size_t threadCount) noexcept;
+			mcf::IR::Program::Pointer EvalProgramParallel(_Notnull_ const mcf::AST::Flat::Program* program, _Notnull_ mcf::Object::Scope* scope, const size_t threadCount) noexcept;
 
 		private:
+			static const bool ValidateConditionObject(_Notnull_ const mcf::IR::Expression::Interface* conditionObject) noexcept;
 
 			mcf::IR::Pointer EvalStatement(_Notnull_ const mcf::AST::Statement::Interface* statement, _Notnull_ mcf::Object::Scope* scope, const bool isBreakAllowed) noexcept;
 			mcf::IR::Pointer EvalTypedefStatement(_Notnull_ const mcf::AST::Statement::Typedef* statement, _Notnull_ mcf::Object::Scope* scope) noexcept;
@@ -154,13 +164,19 @@ namespace mcf
 			mcf::IR::Pointer EvalUnusedStatement(_Notnull_ const mcf::AST::Statement::Unused* statement, _Notnull_ mcf::Object::Scope* scope) noexcept;
 			mcf::IR::Pointer EvalReturnStatement(_Notnull_ const mcf::AST::Statement::Return* statement, _Notnull_ mcf::Object::Scope* scope) noexcept;
 			mcf::IR::Pointer EvalFuncStatement(_Notnull_ const mcf::AST::Statement::Func* statement, _Notnull_ mcf::Object::Scope* scope) noexcept;
+			// 본문이 지연 파싱된 함수의 시그니처만 평가하여 정의하고 본문은 _lazyFunctions 에 기록합니다. 성공하면 nullptr 을 반환합니다.
+			mcf::IR::Pointer EvalLazyFuncStatement(_Notnull_ const mcf::AST::Statement::Func* statement, const size_t objectIndex, _Notnull_ mcf::Object::Scope* scope) noexcept;
+			mcf::IR::Pointer EvalFuncBody(const mcf::Object::FunctionInfo& info, _Notnull_ const mcf::AST::Statement::Block* block) noexcept;
 			mcf::IR::Pointer EvalMainStatement(_Notnull_ const mcf::AST::Statement::Main* statement, _Notnull_ mcf::Object::Scope* scope) noexcept;
+			// 함수의 시그니처만 평가하여 정의합니다. 정의된 함수 테이블 항목을 반환하며 실패하면 nullptr 을 반환합니다.
+			const mcf::Object::FunctionInfo* DefineFuncStatement(_Notnull_ const mcf::AST::Statement::Func* statement, _Notnull_ mcf::Object::Scope* scope) noexcept;
+			const mcf::Object::FunctionInfo* DefineMainStatement(_Notnull_ const mcf::AST::Statement::Main* statement, _Notnull_ mcf::Object::Scope* scope) noexcept;
 			mcf::IR::Pointer EvalAssignExpressionStatement(_Notnull_ const mcf::AST::Statement::AssignExpression* statement, _Notnull_ mcf::Object::Scope* scope) noexcept;
 			mcf::IR::Pointer EvalWhileStatement(_Notnull_ const mcf::AST::Statement::While* statement, _Notnull_ mcf::Object::Scope* scope) noexcept;
 			mcf::IR::Pointer EvalBreakStatement(_Notnull_ const mcf::AST::Statement::Break* statement, _Notnull_ mcf::Object::Scope* scope, const bool isBreakAllowed) noexcept;
 
 			mcf::IR::PointerVector EvalBlockStatement(_Notnull_ const mcf::AST::Statement::Block* statement, _Notnull_ mcf::Object::Scope* scope, const bool isBreakAllowed) noexcept;
-			mcf::IR::ASM::PointerVector EvalFunctionBlockStatement(const mcf::Object::FunctionInfo& info, _Notnull_ const mcf::AST::Statement::Block* statement) noexcept;
+			const bool EvalFunctionBlockStatement(_Out_ mcf::IR::PointerVector& outObjects, const mcf::Object::FunctionInfo& info, _Notnull_ const mcf::AST::Statement::Block* statement) noexcept;
 
 			mcf::Object::FunctionInfo EvalFunctionSignatureIntermediate(_Notnull_ const mcf::AST::Intermediate::FunctionSignature* intermediate, _Notnull_ mcf::Object::Scope* scope) const noexcept;
 			const bool EvalFunctionParamsIntermediate(_Out_ mcf::Object::FunctionParams& outParams, _Notnull_ const mcf::AST::Intermediate::FunctionParams* intermediate, _Notnull_ mcf::Object::Scope* scope) const noexcept;
@@ -179,9 +195,81 @@ namespace mcf
 
 			mcf::Object::FunctionInfo BuildFunctionInfo(const std::string& name, _Notnull_ const mcf::AST::Intermediate::FunctionParams* functionParams, const mcf::AST::Intermediate::TypeSignature* returnType, _Notnull_ mcf::Object::Scope* scope) const noexcept;
 
+			// 평면 AST 를 위한 함수들입니다. 노드의 종류를 switch 로 분기하고 자식은 _flatProgram 의 인덱스로 따라갑니다.
+			mcf::IR::Pointer EvalFlatStatement(const mcf::AST::Flat::Index statement, _Notnull_ mcf::Object::Scope* scope, const bool isBreakAllowed) noexcept;
+			mcf::IR::PointerVector EvalFlatBlockStatement(const mcf::AST::Flat::Index block, _Notnull_ mcf::Object::Scope* scope, const bool isBreakAllowed) noexcept;
+			const bool EvalFlatFunctionBlockStatement(_Out_ mcf::IR::PointerVector& outObjects, const mcf::Object::FunctionInfo& info, const mcf::AST::Flat::Index block) noexcept;
+			const mcf::Object::FunctionInfo* DefineFlatFuncStatement(const mcf::AST::Flat::Index statement, _Notnull_ mcf::Object::Scope* scope) noexcept;
+			const mcf::Object::FunctionInfo* DefineFlatMainStatement(const mcf::AST::Flat::Index statement, _Notnull_ mcf::Object::Scope* scope) noexcept;
+			mcf::Object::FunctionInfo EvalFlatFunctionSignature(const mcf::AST::Flat::Index signature, _Notnull_ mcf::Object::Scope* scope) const noexcept;
+			mcf::Object::FunctionInfo BuildFlatFunctionInfo(const std::string& name, const mcf::AST::Flat::Index functionParams, const mcf::AST::Flat::Index returnType, _Notnull_ mcf::Object::Scope* scope) const noexcept;
+			mcf::Object::Variable EvalFlatVariableSignature(const mcf::AST::Flat::Index signature, _Notnull_ mcf::Object::Scope* scope) const noexcept;
+			mcf::Object::TypeInfo EvalFlatTypeSignature(const mcf::AST::Flat::Index signature, _Notnull_ mcf::Object::Scope* scope) const noexcept;
+			mcf::IR::Expression::Pointer EvalFlatExpression(const mcf::AST::Flat::Index expression, _Notnull_ mcf::Object::Scope* scope) const noexcept;
+			mcf::IR::Expression::Pointer EvalFlatCallExpression(const mcf::AST::Flat::Index expression, _Notnull_ mcf::Object::Scope* scope) const noexcept;
+
+			// 두 AST 표현이 함께 사용하는 함수들입니다. AST 를 보지 않고 이미 평가된 값과 scope 만 사용합니다.
+			mcf::IR::Pointer MakeTypedefObject(const mcf::Object::Variable& variable, _Notnull_ mcf::Object::Scope* scope) noexcept;
+			mcf::IR::Pointer MakeExternObject(_Inout_ mcf::Object::FunctionInfo& functionInfo, _Notnull_ mcf::Object::Scope* scope) noexcept;
+			mcf::IR::Pointer MakeLetObject(_Inout_ mcf::Object::VariableInfo& info, mcf::IR::Expression::Pointer&& expressionObject, _Notnull_ mcf::Object::Scope* scope) noexcept;
+			const bool DefineFunctionInfo(_Inout_ mcf::Object::FunctionInfo& functionInfo, _Notnull_ mcf::Object::Scope* scope) noexcept;
+			// 평가된 함수 본문으로 코드를 생성합니다. scope 를 읽기만 하므로 서로 다른 함수의 본문은 여러 스레드에서 동시에 생성할 수 있습니다.
+			static mcf::IR::ASM::PointerVector GenerateFunctionASM(const mcf::Object::FunctionInfo& info, mcf::IR::PointerVector& objects) noexcept;
+			static mcf::IR::Pointer MakeFuncObject(mcf::IR::ASM::PointerVector&& codes) noexcept;
+			struct FunctionBody;
+			// _functionBodies 의 본문을 평가하고 코드를 생성하여 outObjects 의 ObjectIndex 위치에 넣습니다. 지연 파싱된 함수는 참조된 경우에만 평가합니다.
+			void EvalFunctionBodies(_Inout_ mcf::IR::PointerVector& outObjects, const mcf::AST::Program* program, _Notnull_ mcf::Object::Scope* scope, const size_t threadCount) noexcept;
+			// 본문마다 따로 만든 평가기로 평가하므로 여러 스레드에서 서로 다른 본문을 동시에 평가할 수 있습니다. 본문에서 처음 나온 리터럴은 body.Literals 에 기록합니다.
+			// 본문의 스코프는 평가하는 스레드의 bindingStack 에 엽니다.
+			const bool EvalFunctionBody(_Inout_ FunctionBody& body, _Inout_ mcf::Object::BindingStack& bindingStack) const noexcept;
+			mcf::Object::TypeInfo MakeTypeInfo(_Notnull_ const mcf::IR::Expression::Interface* expressionObject, const bool isUnsigned) const noexcept;
+			mcf::IR::Expression::Pointer EvalIdentifierSymbol(const mcf::Symbol::ID symbol, _Notnull_ mcf::Object::Scope* scope) const noexcept;
+			mcf::IR::Expression::Pointer EvalIntegerLiteral(const std::string_view literal) const noexcept;
+			mcf::IR::Expression::Pointer EvalStringLiteral(const std::string_view literal, _Notnull_ mcf::Object::Scope* scope) const noexcept;
+			const mcf::Object::FunctionInfo& FindCalleeFunctionInfo(_Notnull_ const mcf::IR::Expression::Interface* leftObject) const noexcept;
+			mcf::IR::Expression::Pointer MakeStaticCastObject(mcf::IR::Expression::Pointer&& leftObject, const mcf::Object::TypeInfo& targetType) const noexcept;
+			mcf::IR::Expression::Pointer MakeIndexObject(_Notnull_ const mcf::IR::Expression::Interface* leftObject, const mcf::IR::Expression::Interface* indexObject) const noexcept;
+			mcf::IR::Expression::Pointer MakeInfixObject(mcf::IR::Expression::Pointer&& leftObject, const mcf::Token::Data& token, mcf::IR::Expression::Pointer&& rightObject) const noexcept;
+
 			mcf::Object::TypeInfo MakeArrayTypeInfo(_In_ mcf::Object::TypeInfo info, _Notnull_ const mcf::IR::Expression::Interface* index) const noexcept;
 			void DetermineUnknownArrayIndex(_Inout_ mcf::Object::Variable& variable, _Notnull_ const mcf::IR::Expression::Interface* expression, _Notnull_ mcf::Object::Scope* scope) const noexcept;
 			const std::vector<size_t> CalculateMaximumArrayIndex(_Notnull_ const mcf::IR::Expression::Interface* expression) const noexcept;
+
+			// 식별자를 scope 가 속한 ScopeTree::Symbols 의 ID 로 바꿉니다. 프로그램이 같은 테이블로 파싱되었다면 토큰의 ID 를 그대로 사용합니다.
+			const mcf::Symbol::ID ResolveSymbol(_Notnull_ const mcf::AST::Expression::Identifier* identifier, _Notnull_ const mcf::Object::Scope* scope) const noexcept;
+			const mcf::Symbol::ID ResolveSymbol(const mcf::Token::Data& token, _Notnull_ const mcf::Object::Scope* scope) const noexcept;
+
+		private:
+			// 본문 평가가 미뤄진 함수입니다. 함수가 참조되면 EvalProgram 의 ObjectIndex 위치에 본문을 평가하여 넣습니다.
+			struct LazyFunction final
+			{
+				const mcf::AST::Statement::Func* Statement;
+				const mcf::Object::FunctionInfo* Info;
+				size_t ObjectIndex;
+			};
+
+			// 시그니처가 등록된 함수의 본문입니다. Block 이 nullptr 이면 평면 AST 의 FlatBlock 을 평가합니다.
+			// 평가가 끝나면 Objects 에 본문을, Literals 에 본문에서 사용한 리터럴을 담고, 코드 생성이 끝나면 Codes 에 결과를 담습니다.
+			struct FunctionBody final
+			{
+				const mcf::AST::Statement::Block* Block = nullptr;
+				mcf::AST::Flat::Index FlatBlock = mcf::AST::Flat::INVALID_INDEX;
+				const mcf::Object::FunctionInfo* Info = nullptr;
+				size_t ObjectIndex = 0;
+				mcf::IR::PointerVector Objects = {};
+				std::vector<std::pair<size_t, mcf::Object::Data>*> Literals = {};
+				mcf::IR::ASM::PointerVector Codes = {};
+			};
+
+		private:
+			const mcf::Symbol::Table* _programSymbols = nullptr;
+			const mcf::AST::Flat::Program* _flatProgram = nullptr;
+			// 함수 본문을 평가하는 평가기에서만 설정합니다. nullptr 이 아니면 리터럴의 인덱스를 정하지 않고 이 목록에 기록합니다.
+			std::vector<std::pair<size_t, mcf::Object::Data>*>* _bodyLiterals = nullptr;
+			// 함수 본문과 블록의 스코프를 여는 섀도 스택입니다. EvalProgram 은 스코프 트리의 스택을, 함수 본문을 평가하는 평가기는 스레드의 스택을 사용합니다.
+			mcf::Object::BindingStack* _bindingStack = nullptr;
+			std::vector<LazyFunction> _lazyFunctions;
+			std::vector<FunctionBody> _functionBodies;
 		};
 	}
 }
\ No newline at end of file
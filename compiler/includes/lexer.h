@@ -1,10 +1,48 @@
 ﻿#pragma once
+#include <deque>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <stack>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 #include <common.h>
 
 namespace mcf
 {
+	namespace Symbol
+	{
+		// 식별자 문자열을 대신하는 32비트 값입니다. 같은 Table 에서 같은 문자열은 항상 같은 ID 를 받습니다.
+		using ID = std::uint32_t;
+		constexpr const ID INVALID_ID = 0;
+
+		// 컴파일 단위마다 하나씩 사용하는 식별자 인터너입니다. 렉서가 식별자를 등록하고 이후 단계는 문자열 대신 ID 를 해시하고 비교합니다.
+		// 함수 본문을 병렬로 평가하는 동안에도 지역 변수의 이름을 등록하므로 thread-safe 합니다. 이미 등록된 이름은 공유 잠금으로 찾습니다.
+		class Table final
+		{
+		public:
+			explicit Table(void) noexcept = default;
+			explicit Table(const Table& other) noexcept = delete;
+			Table& operator=(const Table& other) noexcept = delete;
+
+			const mcf::Symbol::ID Intern(const std::string_view name) noexcept;
+			// 등록되지 않은 문자열이면 INVALID_ID 를 반환합니다.
+			const mcf::Symbol::ID Find(const std::string_view name) const noexcept;
+			const std::string_view GetName(const mcf::Symbol::ID id) const noexcept;
+			const size_t GetCount(void) const noexcept;
+
+		private:
+			mutable std::shared_mutex _mutex;
+			// std::deque 는 뒤에 추가하여도 기존 원소를 옮기지 않으므로 _ids 의 키가 _names 의 문자열을 가리킬 수 있습니다.
+			std::deque<std::string> _names = { std::string() }; // INVALID_ID 자리
+			std::unordered_map<std::string_view, mcf::Symbol::ID> _ids;
+		};
+	}
+
 	namespace Token
 	{
 		enum class Type : unsigned char
@@ -151,19 +189,83 @@ namespace mcf
 			return TYPE_STRING_ARRAY[mcf::ENUM_INDEX(value)];
 		}
 
+		// Literal 은 렉서가 소유한 소스 버퍼(Lexer::Object::GetSource())를 가리키는 view 입니다.
+		// 토큰을 복사해도 문자열은 복사되지 않으며, 소스 버퍼가 살아있는 동안에만 유효합니다.
+		// 토큰의 위치는 소스 버퍼(SourceBuffer::GetView) 기준 시작 오프셋 하나로 보관합니다. 줄 번호와 인덱스는 에러를 보고할 때만
+		// SourceBuffer::GetLine / GetIndex 로 계산합니다.
 		struct Data final
 		{
-			Type Type = Type::INVALID;
-			std::string Literal;
-			size_t Line = 0;
-			size_t Index = 0;
+			mcf::Token::Type Type = mcf::Token::Type::INVALID;
+			std::string_view Literal;
+			std::uint32_t Offset = 0;
+			mcf::Symbol::ID Symbol = mcf::Symbol::INVALID_ID; // 심볼 테이블을 가진 렉서가 만든 IDENTIFIER 토큰에만 지정됩니다.
 		};
 		inline bool operator==(const Data& lhs, const Data& rhs) { return (lhs.Type == rhs.Type) && (lhs.Literal == rhs.Literal); }
-		static const Data FindPredefinedKeyword(const std::string& tokenLiteral) noexcept;
+		// 식별자 키워드가 아니라면 Type::INVALID 를 반환합니다.
+		const Type FindPredefinedKeyword(const std::string_view tokenLiteral) noexcept;
 	}
 
 	namespace Lexer
 	{
+		// 렉서가 읽는 원본 버퍼입니다. 토큰의 Literal 은 이 버퍼를 가리킵니다.
+		// 파일 입력은 읽기 전용으로 매핑되며 복사되지 않습니다. 매핑할 수 없는 입력(파이프, 표준 입력)은 한 번에 읽어 보관합니다.
+		class SourceBuffer final
+		{
+		public:
+			explicit SourceBuffer(const SourceBuffer& other) noexcept = delete;
+			SourceBuffer& operator=(const SourceBuffer& other) noexcept = delete;
+			~SourceBuffer(void) noexcept;
+
+			static std::shared_ptr<const SourceBuffer> MakeFromString(const std::string& input) noexcept;
+			static std::shared_ptr<const SourceBuffer> MakeFromString(std::string&& input) noexcept;
+			// 파일을 열 수 없으면 nullptr 를 반환합니다. path 가 "-" 이면 표준 입력을 읽습니다.
+			static std::shared_ptr<const SourceBuffer> MakeFromFile(const std::string& path) noexcept;
+			// source 의 [offset, offset + removedLength) 범위를 insertedText 로 바꾼 새 버퍼를 만듭니다. BOM 은 다시 검사하지 않습니다.
+			static std::shared_ptr<const SourceBuffer> MakeFromEdit(const std::shared_ptr<const SourceBuffer>& source, const size_t offset, const size_t removedLength, const std::string_view insertedText) noexcept;
+
+			// UTF-8 BOM 을 제외한 입력 전체입니다. 줄바꿈(CRLF 포함)은 변환하지 않습니다.
+			inline const std::string_view GetView(void) const noexcept { return _view; }
+
+			// offset 위치의 줄 번호(1 부터)와 인덱스(줄바꿈 다음 바이트가 1, 첫 줄은 오프셋 그대로)를 계산합니다.
+			// 처음 호출할 때 줄바꿈 테이블을 한번 만들며, 여러 스레드에서 동시에 호출하여도 안전합니다.
+			const size_t GetLine(const std::uint32_t offset) const noexcept;
+			const size_t GetIndex(const std::uint32_t offset) const noexcept;
+
+		private:
+			explicit SourceBuffer(void) noexcept = default;
+
+			void SetViewSkippingBOM(const char* data, const size_t size) noexcept;
+			const std::vector<std::uint32_t>& GetNewLineOffsets(void) const noexcept;
+
+		private:
+			std::string _bufferedInput;
+			void* _mappedAddress = nullptr;
+			size_t _mappedSize = 0;
+			std::string_view _view;
+			mutable std::once_flag _newLineOffsetsFlag;
+			mutable std::vector<std::uint32_t> _newLineOffsets; // 줄바꿈('\n')의 오프셋입니다. GetNewLineOffsets 에서 처음 사용할 때 만듭니다.
+		};
+		using Source = std::shared_ptr<const SourceBuffer>;
+
+		// 공백과 주석을 건너뛸 때 사용하는 스캐너입니다. 기본값은 실행 중인 CPU 가 지원하는 가장 빠른 스캐너입니다.
+		enum class Scanner : unsigned char
+		{
+			INVALID = 0,
+
+			SCALAR,
+			SSE2,
+			AVX2,
+
+			// 이 밑으로는 수정하면 안됩니다.
+			COUNT,
+		};
+
+		const mcf::Lexer::Scanner GetScanner(void) noexcept;
+		// CPU 가 지원하지 않는 스캐너라면 false 를 반환하고 변경하지 않습니다. 벤치마크 비교용이며 렉싱 중에 호출하면 안됩니다.
+		const bool SetScanner(const mcf::Lexer::Scanner scanner) noexcept;
+
+		// 파일 전체를 문자열로 읽습니다. CRLF 는 LF 로 바뀌고 마지막 줄바꿈은 제거됩니다. 렉서 입력에는 SourceBuffer 를 사용합니다.
+
 		const std::string ReadFile(const std::string& path) noexcept;
 
 		enum class Error : unsigned char
@@ -173,48 +275,202 @@ namespace mcf
 			SUCCESS,
 			INVALID_INPUT_LENGTH,
 			FAIL_READ_FILE,
+			INVALID_EDIT_RANGE,
 
 			COUNT,
 		};
 
+		// 소스의 한 범위를 다른 문자열로 바꾸는 편집입니다. Offset 과 RemovedLength 는 편집 전 소스(GetView) 기준입니다.
+		struct Edit final
+		{
+			size_t Offset = 0;
+			size_t RemovedLength = 0;
+			std::string_view InsertedText;
+		};
+
+		// 주석 건너뛰기 모드에서 건너뛴 주석의 범위입니다. 오프셋은 소스 버퍼(SourceBuffer::GetView) 기준입니다.
+		struct CommentRange final
+		{
+			std::uint32_t Offset = 0;
+			std::uint32_t Length = 0;
+		};
+
+		// 번역 단위 전체의 토큰을 SoA(structure of arrays) 형태로 보관합니다.
+		// 토큰의 줄 번호와 인덱스는 저장하지 않고 토큰의 시작 위치와 소스 버퍼의 줄바꿈 테이블로 계산합니다.
+		class TokenBuffer final
+		{
+		public:
+			explicit TokenBuffer(void) noexcept = default;
+
+			inline const size_t GetCount(void) const noexcept { return _types.size(); }
+			inline const mcf::Token::Type GetType(const size_t index) const noexcept { return _types[index]; }
+			inline const std::uint32_t GetOffset(const size_t index) const noexcept { return _offsets[index]; }
+			inline const std::uint32_t GetLength(const size_t index) const noexcept { return _lengths[index]; }
+			inline const std::string_view GetLiteral(const size_t index) const noexcept { return _source == nullptr ? std::string_view() : _source->GetView().substr(_offsets[index], _lengths[index]); }
+			inline const mcf::Symbol::ID GetSymbol(const size_t index) const noexcept { return _symbols[index]; }
+			inline const mcf::Lexer::Source& GetSource(void) const noexcept { return _source; }
+
+			// SourceBuffer::GetLine / GetIndex 와 같이 토큰의 시작 위치로 계산합니다.
+			inline const size_t GetLine(const size_t index) const noexcept { return _source->GetLine(_offsets[index]); }
+			inline const size_t GetIndex(const size_t index) const noexcept { return _source->GetIndex(_offsets[index]); }
+			const mcf::Token::Data GetToken(const size_t index) const noexcept;
+
+			// 이전 내용을 모두 지웁니다.
+			// symbols 와 isSkippingComments 는 ApplyEdit 에서 다시 렉싱할 때 사용합니다. 주석을 건너뛰는 버퍼는 ApplyEdit 에서도 주석 토큰을 만들지 않습니다.
+			void Reset(const mcf::Lexer::Source& source, mcf::Symbol::Table* symbols = nullptr, const bool isSkippingComments = false) noexcept;
+			void Reserve(const size_t tokenCount) noexcept;
+			// token 의 Literal 과 Offset 은 반드시 Reset 에 전달한 source 를 가리켜야 합니다.
+			void PushBack(const mcf::Token::Data& token) noexcept;
+			// other 의 토큰들을 뒤에 붙입니다. other 는 같은 source 로 만들어진 버퍼여야 합니다.
+			void Append(const mcf::Lexer::TokenBuffer& other) noexcept;
+			// 소스에 edit 을 적용하고 토큰을 갱신합니다. 편집 위치 앞의 마지막 토큰 경계부터 이전 토큰과 다시 맞춰질 때까지만 렉싱하고
+			// 나머지 토큰은 오프셋만 옮겨 재사용합니다. 실패하면 버퍼는 바뀌지 않습니다. optionalOutRelexedCount 에는 새로 렉싱한 토큰 수가 기록됩니다.
+			const mcf::Lexer::Error ApplyEdit(const mcf::Lexer::Edit& edit, _Out_opt_ size_t* optionalOutRelexedCount) noexcept;
+
+		private:
+			mcf::Lexer::Source _source;
+			std::vector<mcf::Token::Type> _types;
+			std::vector<std::uint32_t> _offsets;
+			std::vector<std::uint32_t> _lengths;
+			std::vector<mcf::Symbol::ID> _symbols;
+			mcf::Symbol::Table* _symbolTable = nullptr;
+			bool _isSkippingComments = false;
+		};
+
+		// 입력 전체를 토큰 버퍼로 만듭니다. 마지막 토큰은 항상 END_OF_FILE 입니다.
+		const mcf::Lexer::Error TokenizeAll(const std::string& input, const bool isFile, mcf::Lexer::TokenBuffer& outBuffer) noexcept;
+
+		constexpr const size_t DEFAULT_PARALLEL_CHUNK_SIZE = 1024 * 1024;
+		// TokenizeAll 과 같은 결과를 만들되 입력을 문자열과 블록 주석 밖의 줄바꿈에서 나누어 여러 스레드에서 렉싱합니다. 심볼은 지정되지 않습니다.
+		// threadCount 가 0 이면 하드웨어 스레드 수를, chunkSize 가 0 이면 DEFAULT_PARALLEL_CHUNK_SIZE 를 사용합니다.
+		const mcf::Lexer::Error TokenizeAllParallel(const std::string& input, const bool isFile, const size_t threadCount, const size_t chunkSize, mcf::Lexer::TokenBuffer& outBuffer) noexcept;
+
 		// 주의: thread-safe 하지 않은 클래스입니다.
 		class Object final 
 		{
 		public:
 			explicit Object(void) noexcept = delete;
 			explicit Object(const std::string& input, const bool isFIle) noexcept;
+			explicit Object(const std::string& name, const mcf::Lexer::Source& source) noexcept;
+			// source 의 [begin, begin + length) 범위만 렉싱합니다. 토큰의 Literal 은 source 전체 버퍼를 가리킵니다.
+			explicit Object(const std::string& name, const mcf::Lexer::Source& source, const size_t begin, const size_t length) noexcept;
 
 			const Error GetLastErrorToken(void) noexcept;
 			const std::string GetName(void) const noexcept { return _name; }
+			// 토큰의 Literal 이 가리키는 버퍼입니다. 토큰(또는 AST)을 렉서보다 오래 사용하려면 이 값을 함께 보관하여야 합니다.
+			inline const mcf::Lexer::Source& GetSource(void) const noexcept { return _source; }
+			// 지정하면 IDENTIFIER 토큰의 Symbol 을 symbols 에 등록된 ID 로 채웁니다. symbols 는 렉서보다 오래 살아있어야 합니다.
+			inline void SetSymbolTable(mcf::Symbol::Table* symbols) noexcept { _symbols = symbols; }
+			// isSkippingComments 가 true 이면 주석을 토큰으로 만들지 않고 공백과 같이 건너뜁니다. 끝나지 않은 블록 주석은 INVALID 토큰으로 반환합니다.
+			// optionalCommentRanges 를 지정하면 건너뛴 주석의 범위를 뒤에 추가합니다. optionalCommentRanges 는 렉서보다 오래 살아있어야 합니다.
+			inline void SetCommentSkipping(const bool isSkippingComments, _Out_opt_ std::vector<mcf::Lexer::CommentRange>* optionalCommentRanges) noexcept
+			{
+				_isSkippingComments = isSkippingComments;
+				_commentRanges = optionalCommentRanges;
+			}
 
 			const mcf::Token::Data ReadNextToken(void) noexcept;
+			// 남은 입력을 모두 읽어 outBuffer 를 채웁니다.
+			void TokenizeAll(mcf::Lexer::TokenBuffer& outBuffer) noexcept;
 
 		private:
 			inline const char GetNextByte(void) const noexcept;
 
 			inline void ReadNextByte(void) noexcept;
-			inline const bool ReadLineIfStartWith(_Outptr_opt_ std::string* optionalOut, _In_opt_ const char* startWith) noexcept;
-			inline const bool ReadAndValidate(_Outptr_opt_ std::string* optionalOut, _In_opt_ const char* stringToCompare) noexcept;
-			inline const bool ReadAndValidate(_Outptr_opt_ std::string* optionalOut, _In_opt_ const char* startWith, _In_opt_ const char* endWith, _In_opt_ const char* invalidCharList) noexcept;
-			inline const std::string ReadKeywordOrIdentifier(void) noexcept;
-			inline const std::string ReadNumber(void) noexcept;
+			inline void SkipWhitespace(void) noexcept;
+			// position 까지 한번에 이동합니다.
+			inline void ReadBytesUntil(const size_t position) noexcept;
+			// _input 의 position 을 소스 버퍼 기준 오프셋으로 바꿉니다.
+			inline const std::uint32_t GetSourceOffset(const size_t position) const noexcept;
+			inline const bool ReadAndValidate(_Outptr_opt_ std::string_view* optionalOut, _In_opt_ const char* stringToCompare) noexcept;
+			inline const bool ReadAndValidate(_Outptr_opt_ std::string_view* optionalOut, _In_opt_ const char* startWith, _In_opt_ const char* endWith, _In_opt_ const char* invalidCharList) noexcept;
+			inline const std::string_view ReadKeywordOrIdentifier(void) noexcept;
+			inline const std::string_view ReadNumber(void) noexcept;
 			inline const mcf::Token::Data ReadStringUtf8(void) noexcept;
 			inline const mcf::Token::Data ReadSlashStartingToken(void) noexcept;
 			inline const mcf::Token::Data ReadDotStartingToken(void) noexcept;
 			inline const mcf::Token::Data ReadMacroToken(void) noexcept;
 			inline const mcf::Token::Data ReadNumeric(void) noexcept;
 
-			inline const mcf::Token::Type DetermineKeywordOrIdentifier(const std::string& tokenLiteral) noexcept;
+			inline const mcf::Token::Type DetermineKeywordOrIdentifier(const std::string_view tokenLiteral) noexcept;
 
 		private:
 			std::stack<Error> _tokens;
-			const std::string _input;
+			const mcf::Lexer::Source _source;
+			const std::string_view _input;
+			const size_t _inputOffset = 0; // 소스 버퍼에서 _input 이 시작하는 위치입니다.
 			const std::string _name;
+			mcf::Symbol::Table* _symbols = nullptr;
+			std::vector<mcf::Lexer::CommentRange>* _commentRanges = nullptr;
+			bool _isSkippingComments = false;
 			size_t _currentPosition = 0;
 			size_t _nextPosition = 0;
-			size_t _currentLine = 1; // 코드 명령줄은 항상 1부터 시작합니다.
-			size_t _currentIndex = 0;
 			char _currentByte = 0;
 		};
+
+		// 스트림 입력을 채우는 함수입니다. buffer 에 최대 size 바이트를 쓰고 쓴 바이트 수를 반환합니다.
+		// 0 을 반환하면 입력이 끝난 것으로, STREAM_READ_ERROR 를 반환하면 읽기에 실패한 것으로 봅니다.
+		using StreamReader = std::function<size_t(char* const buffer, const size_t size)>;
+		constexpr const size_t STREAM_READ_ERROR = static_cast<size_t>(-1);
+		// stream 은 반환된 StreamReader 보다 오래 살아있어야 합니다.
+		const mcf::Lexer::StreamReader MakeStreamReader(std::istream& stream) noexcept;
+		// 파이프와 표준 입력(0)도 사용할 수 있습니다. fileDescriptor 는 호출자가 닫아야 합니다.
+		const mcf::Lexer::StreamReader MakeFileDescriptorReader(const int fileDescriptor) noexcept;
+
+		constexpr const size_t DEFAULT_STREAM_CHUNK_SIZE = 64 * 1024;
+
+		// 입력 전체를 메모리에 올리지 않고 StreamReader 로 chunkSize 씩 읽으면서 렉싱합니다. 도구가 파이프로 넘기는 입력처럼
+		// 생산자가 쓰기를 끝내기 전에 렉싱을 시작하여야 하는 경우에 사용합니다.
+		// 읽은 입력은 문자열과 주석 밖의 토큰 경계에서 세그먼트로 잘라 Object 로 렉싱하므로 토큰은 Object 와 같습니다.
+		// 토큰의 Offset 은 세그먼트가 아니라 스트림 전체 기준인 32비트 값입니다. 4GB 를 넘는 스트림은 넘기 전의 세그먼트까지만 렉싱하고 INVALID_INPUT_LENGTH 에러로 끝납니다.
+		// 보관하는 입력의 크기는 파일 크기가 아니라 chunkSize 와 나눌 수 없는 가장 긴 범위(블록 주석, 문자열, 공백 없이 이어진 토큰)에 비례합니다.
+		// 토큰의 Literal 은 현재 세그먼트(GetSource())를 가리키므로 다음 세그먼트로 넘어간 뒤에도 사용하려면 그 버퍼를 함께 보관하여야 합니다.
+		// 주의: thread-safe 하지 않은 클래스입니다.
+		class StreamObject final
+		{
+		public:
+			explicit StreamObject(void) noexcept = delete;
+			explicit StreamObject(const std::string& name, const mcf::Lexer::StreamReader& reader, const size_t chunkSize = mcf::Lexer::DEFAULT_STREAM_CHUNK_SIZE) noexcept;
+
+			// 입력을 읽는 중에 생긴 에러는 ReadNextToken 이 END_OF_FILE 을 반환한 뒤에 확인할 수 있습니다.
+			const Error GetLastErrorToken(void) noexcept;
+			inline const std::string GetName(void) const noexcept { return _name; }
+			// 마지막으로 반환한 토큰의 Literal 이 가리키는 세그먼트 버퍼입니다.
+			inline const mcf::Lexer::Source& GetSource(void) const noexcept { return _segmentSource; }
+			// 렉서가 지금 보관하고 있는 입력(현재 세그먼트와 아직 세그먼트로 만들지 않은 입력)의 크기입니다.
+			const size_t GetBufferedSize(void) const noexcept;
+			// 현재 세그먼트 안의 offset(마지막으로 반환한 토큰의 Offset)에 대해 SourceBuffer::GetLine / GetIndex 와 같은 값을 계산합니다.
+			// 지나간 세그먼트의 줄바꿈은 줄 수와 마지막 줄바꿈의 위치만 남기므로 보관하는 메모리는 입력 전체가 아니라 세그먼트 크기에 비례합니다.
+			const size_t GetLine(const std::uint32_t offset) const noexcept;
+			const size_t GetIndex(const std::uint32_t offset) const noexcept;
+			inline void SetSymbolTable(mcf::Symbol::Table* symbols) noexcept { _symbols = symbols; }
+
+			const mcf::Token::Data ReadNextToken(void) noexcept;
+
+		private:
+			// 최대 size 바이트를 읽습니다. 입력이 끝나거나 에러가 나지 않으면 minimumSize 바이트 이상을 읽을 때까지 reader 를 반복해서 호출합니다.
+			void ReadChunk(const size_t size, const size_t minimumSize) noexcept;
+			const bool LoadNextSegment(void) noexcept;
+			inline const std::string_view GetPendingInput(void) const noexcept { return std::string_view(_pendingBuffer).substr(_pendingBegin); }
+
+		private:
+			std::stack<Error> _tokens;
+			const std::string _name;
+			const mcf::Lexer::StreamReader _reader;
+			const size_t _chunkSize;
+			mcf::Symbol::Table* _symbols = nullptr;
+			// 읽었지만 아직 세그먼트로 만들지 않은 입력은 _pendingBuffer 의 _pendingBegin 부터입니다. 세그먼트로 만든 앞쪽 입력은
+			// _pendingBegin 만 옮기고, 다음에 읽을 때 남은 입력을 버퍼의 앞으로 한번 옮긴 뒤 같은 버퍼에 이어서 읽습니다.
+			std::string _pendingBuffer;
+			size_t _pendingBegin = 0;
+			bool _isBOMChecked = false;
+			bool _isEndOfStream = false;
+			mcf::Lexer::Source _segmentSource;
+			std::unique_ptr<mcf::Lexer::Object> _segmentLexer;
+			std::uint32_t _segmentOffset = 0;	// 스트림에서 세그먼트 첫 바이트의 위치입니다.
+			std::vector<std::uint32_t> _newLineOffsets;	// 현재 세그먼트 안의 줄바꿈 위치입니다.
+			size_t _previousNewLineCount = 0;	// 현재 세그먼트보다 앞에 있는 줄바꿈의 갯수입니다.
+			std::uint32_t _previousNewLineOffset = 0;	// 현재 세그먼트보다 앞에 있는 마지막 줄바꿈의 위치입니다.
+		};
 	}
 }
\ No newline at end of file
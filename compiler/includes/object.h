@@ -1,9 +1,12 @@
 ﻿#pragma once
+#include <atomic>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 #include <unordered_map>
-#include <unordered_set>
 
 #include <common.h>
 #include <lexer.h>
@@ -12,10 +15,17 @@ namespace mcf
 {
 	namespace Object
 	{
-		using Data = std::pair<unsigned __int8, std::vector<unsigned __int64>>;
+		using Data = std::pair<std::uint8_t, std::vector<std::uint64_t>>;
 
+		// 타입을 대신하는 32비트 값입니다. 같은 구성의 타입은 항상 같은 ID 를 받습니다.
+		using TypeID = std::uint32_t;
+		constexpr const TypeID VOID_TYPE_ID = 0;
+		constexpr const TypeID VARIADIC_TYPE_ID = 1;
+
+		class TypeTable;
+		// 타입 테이블에 한번씩만 등록되는 타입의 구성입니다. 등록된 항목은 테이블이 사라질때까지 옮겨지거나 수정되지 않습니다.
 		// if any item in ArraySizeList has the value as 0, it means it's unknown
-		struct TypeInfo final
+		struct TypeEntry final
 		{
 			std::vector<size_t> ArraySizeList;
 			std::string Name;
@@ -24,49 +34,96 @@ namespace mcf
 			bool IsUnsigned = false;
 			bool IsVariadic = false;
 
-			static const mcf::Object::TypeInfo GetVoidTypeInfo(void) { return mcf::Object::TypeInfo(); }
-			static const mcf::Object::TypeInfo MakePrimitive(const bool isUnsigned, const std::string& name, const size_t size, const std::vector<size_t> arraySizeList = std::vector<size_t>())
-			{ 
-				return 
-				{ 
-					arraySizeList,			// ArraySizeList
-					name,					// Name
-					size, 					// IntrinsicSize
-					false, 					// IsStruct
-					isUnsigned, 			// IsUnsigned
-					false 					// IsVariadic
-				};
-			}
-
-			inline const bool IsValid(void) const noexcept { return (Name.empty() == false && (IsUnsigned == false || IsStruct == false)) || IsVariadic; }
-			inline const bool IsIntegerType(void) const noexcept { return IsArrayType() == false && IsStruct == false && IsVariadic == false; }
-			inline const bool IsCompatibleAddressType(void) const noexcept { return IsUnsigned && IsIntegerType() && IntrinsicSize == sizeof(size_t); }
+			// 아래 값은 테이블에 등록될 때 채워집니다. void 와 variadic 은 모든 테이블이 함께 쓰는 상수 항목이며 Table 이 nullptr 입니다.
+			TypeID ID = VOID_TYPE_ID;
+			size_t Size = 0;
+			TypeTable* Table = nullptr;
+		};
 
-			inline const bool IsArrayType(void) const noexcept { return ArraySizeList.empty() == false; }
-			inline const bool IsArraySizeUnknown(const size_t arrayIndex) const noexcept { return IsArrayType() && ArraySizeList[arrayIndex] == 0; }
-			inline const bool IsLastArrayDimensionSizeUnknown() const noexcept { return IsArrayType() && ArraySizeList[ArraySizeList.size() - 1] == 0; }
-			inline const bool IsStringCompatibleType(void) const noexcept { return ArraySizeList.size() == 1 && IntrinsicSize == 1; }
+		// 타입 테이블의 항목을 가리키는 핸들입니다. 복사는 포인터 복사이고 비교는 TypeID 비교이므로 같은 테이블의 타입끼리만 비교해야 합니다.
+		// 타입을 바꾸려면 항목을 수정하지 않고 Make...Type 함수로 같은 테이블에 새로 등록된 타입을 받아야 합니다.
+		class TypeInfo final
+		{
+		public:
+			TypeInfo(void) noexcept;
+
+			static const mcf::Object::TypeInfo GetVoidTypeInfo(void) noexcept { return mcf::Object::TypeInfo(); }
+			static const mcf::Object::TypeInfo GetVariadicTypeInfo(void) noexcept;
+
+			const mcf::Object::TypeInfo MakeArrayType(const size_t arraySize) const noexcept;
+			const mcf::Object::TypeInfo MakeArrayItemType(void) const noexcept;
+			const mcf::Object::TypeInfo MakeUnsignedType(void) const noexcept;
+			const mcf::Object::TypeInfo MakeNamedType(const std::string& name) const noexcept;
+			const mcf::Object::TypeInfo MakeResizedArrayType(const std::vector<size_t>& arraySizeList) const noexcept;
+
+			inline const mcf::Object::TypeID GetID(void) const noexcept { return _entry->ID; }
+			inline const mcf::Object::TypeTable* GetTable(void) const noexcept { return _entry->Table; }
+			inline const std::string& GetName(void) const noexcept { return _entry->Name; }
+			inline const std::vector<size_t>& GetArraySizeList(void) const noexcept { return _entry->ArraySizeList; }
+			inline const size_t GetIntrinsicSize(void) const noexcept { return _entry->IntrinsicSize; }
+			inline const bool IsStruct(void) const noexcept { return _entry->IsStruct; }
+			inline const bool IsUnsigned(void) const noexcept { return _entry->IsUnsigned; }
+			inline const bool IsVariadic(void) const noexcept { return _entry->IsVariadic; }
+
+			inline const bool IsValid(void) const noexcept { return (_entry->Name.empty() == false && (IsUnsigned() == false || IsStruct() == false)) || IsVariadic(); }
+			inline const bool IsIntegerType(void) const noexcept { return IsArrayType() == false && IsStruct() == false && IsVariadic() == false; }
+			inline const bool IsCompatibleAddressType(void) const noexcept { return IsUnsigned() && IsIntegerType() && GetIntrinsicSize() == sizeof(size_t); }
+
+			inline const bool IsArrayType(void) const noexcept { return _entry->ArraySizeList.empty() == false; }
+			inline const bool IsArraySizeUnknown(const size_t arrayIndex) const noexcept { return IsArrayType() && _entry->ArraySizeList[arrayIndex] == 0; }
+			inline const bool IsLastArrayDimensionSizeUnknown() const noexcept { return IsArrayType() && _entry->ArraySizeList.back() == 0; }
+			inline const bool IsStringCompatibleType(void) const noexcept { return _entry->ArraySizeList.size() == 1 && GetIntrinsicSize() == 1; }
 			const bool HasUnknownArrayIndex(void) const noexcept;
 
 			const bool IsStaticCastable(const TypeInfo& typeToCast) const noexcept;
 
+			// 등록할 때 미리 계산해 둔 값을 반환합니다.
 			const size_t GetSize(void) const noexcept;
 			const std::string Inspect(void) const noexcept;
+
+		private:
+			friend TypeTable;
+			explicit TypeInfo(_Notnull_ const mcf::Object::TypeEntry* entry) noexcept : _entry(entry) {}
+
+			const mcf::Object::TypeInfo Intern(const mcf::Object::TypeEntry& entry) const noexcept;
+
+		private:
+			const mcf::Object::TypeEntry* _entry;
 		};
 		inline bool operator==(const TypeInfo& lhs, const TypeInfo& rhs) 
 		{ 
-			return (lhs.ArraySizeList == rhs.ArraySizeList) &&
-				(lhs.Name == rhs.Name) &&
-				(lhs.IntrinsicSize == rhs.IntrinsicSize) &&
-				(lhs.IsStruct == rhs.IsStruct) &&
-				(lhs.IsUnsigned == rhs.IsUnsigned) &&
-				(lhs.IsVariadic == rhs.IsVariadic);
+			return lhs.GetID() == rhs.GetID();
 		}
 		inline bool operator!=(const TypeInfo& lhs, const TypeInfo& rhs) 
 		{ 
 			return (lhs == rhs) == false;
 		}
 
+		// 컴파일 단위마다 하나씩 사용하는 타입 테이블입니다. ScopeTree 가 가지며 ScopeTree 가 사라질 때 등록된 타입도 함께 해제됩니다.
+		// 등록된 항목은 옮겨지지 않으므로 TypeInfo 는 항목을 잠금 없이 읽습니다. 이미 등록된 타입은 공유 잠금으로 찾고 새 타입을 등록할 때만 배타 잠금을 사용합니다.
+		class TypeTable final
+		{
+		public:
+			explicit TypeTable(void) noexcept = default;
+			explicit TypeTable(const TypeTable& other) noexcept = delete;
+			TypeTable& operator=(const TypeTable& other) noexcept = delete;
+
+			const mcf::Object::TypeInfo MakePrimitive(const bool isUnsigned, const std::string& name, const size_t size, const std::vector<size_t>& arraySizeList = std::vector<size_t>()) noexcept;
+			// entry 의 ID, Size, Table 은 무시되며 같은 구성의 타입이 이미 등록되어 있으면 그 타입을 반환합니다. thread-safe 합니다.
+			const mcf::Object::TypeInfo Intern(const mcf::Object::TypeEntry& entry) noexcept;
+			// void 와 variadic 을 제외하고 이 테이블에 등록된 타입의 갯수입니다.
+			const size_t GetCount(void) const noexcept;
+
+		private:
+			const mcf::Object::TypeEntry* Find(const size_t hash, const mcf::Object::TypeEntry& entry) const noexcept;
+
+		private:
+			mutable std::shared_mutex _mutex;
+			// std::deque 는 뒤에 추가하여도 기존 원소를 옮기지 않으므로 TypeInfo 가 항목을 가리킬 수 있습니다.
+			std::deque<mcf::Object::TypeEntry> _entries;
+			std::unordered_multimap<size_t, const mcf::Object::TypeEntry*> _entriesByHash;
+		};
+
 		struct Variable final
 		{
 			std::string Name;
@@ -74,14 +131,14 @@ namespace mcf
 			bool IsUsed = false;
 
 			inline const bool IsValid(void) const noexcept { return Name.empty() == false && DataType.IsValid(); }
-			inline const bool IsVariadic(void) const noexcept { return DataType.IsVariadic; }
+			inline const bool IsVariadic(void) const noexcept { return DataType.IsVariadic(); }
 			const std::string Inspect(void) const noexcept;
 			const size_t GetTypeSize(void) const noexcept { return DataType.GetSize(); }
 		};
 
 		struct VariableInfo final
 		{
-			Variable Variable;
+			mcf::Object::Variable Variable;
 			bool IsGlobal = false;
 
 			inline const bool IsValid(void) const noexcept { return Variable.IsValid(); }
@@ -107,7 +164,9 @@ namespace mcf
 
 			inline const bool IsValid(void) const noexcept { return Name.empty() == false && LocalScope != nullptr; }
 			inline const bool IsReturnTypeVoid(void) const noexcept { return ReturnType.IsValid() == false; }
-			
+
+			// 찾지 못한 함수 대신 참조를 반환할 때 사용하는 유효하지 않은 함수 정보입니다.
+			static const mcf::Object::FunctionInfo& GetInvalidFunctionInfo(void) noexcept;
 		};
 
 		enum class InternalFunctionType : unsigned char
@@ -130,15 +189,21 @@ namespace mcf
 		static_assert(mcf::ENUM_COUNT<InternalFunctionType>() == INTERNAL_FUNCTION_TYPES_SIZE, "internal function type count not matching!");
 
 		struct ScopeTree;
+		class BindingTable;
+		class BindingStack;
+		// 지역 스코프에서 이름을 찾으려면 BindingStack 으로 스코프를 열어야 하며, 열린 스코프 중 가장 안쪽의 스코프에서만 찾을 수 있습니다.
 		class Scope final
 		{
 		public:
 			explicit Scope(void) noexcept = delete;
-			explicit Scope(ScopeTree* tree, Scope* parent, bool isFunctionScope) noexcept : _tree(tree), _parent(parent), _isFunctionScope(isFunctionScope) {}
+			// 부모 스코프에 지금까지 정의된 이름만 이 스코프에서 보입니다. 뒤에 정의되는 이름은 보이지 않으므로 선언 순서대로 평가한 것과 같습니다.
+			explicit Scope(ScopeTree* tree, Scope* parent, bool isFunctionScope) noexcept
+				: _parent(parent), _tree(tree), _parentVisibleCount(parent == nullptr ? 0 : parent->_bindings.size()), _isFunctionScope(isFunctionScope) {}
 
 			const bool IsGlobalScope(void) const noexcept;
 			inline const bool IsFunctionScope(void) const noexcept { return _isFunctionScope; }
 			const bool IsIdentifierRegistered(const std::string& name) const noexcept;
+			const bool IsIdentifierRegistered(const mcf::Symbol::ID symbol) const noexcept;
 
 			inline ScopeTree* GetUnsafeScopeTreePointer(void) noexcept { return _tree;}
 			inline const ScopeTree* GetUnsafeScopeTreePointer(void) const noexcept { return _tree;}
@@ -146,39 +211,200 @@ namespace mcf
 
 			const bool DefineType(const std::string& name, const mcf::Object::TypeInfo& info) noexcept;
 			const mcf::Object::TypeInfo FindTypeInfo(const std::string& name) const noexcept;
+			const mcf::Object::TypeInfo FindTypeInfo(const mcf::Symbol::ID symbol) const noexcept;
 
 			const bool IsAllVariablesUsed(void) const noexcept;
 			const mcf::Object::VariableInfo DefineVariable(const std::string& name, const mcf::Object::Variable& variable) noexcept;
 			const mcf::Object::VariableInfo FindVariableInfo(const std::string& name) const noexcept;
+			const mcf::Object::VariableInfo FindVariableInfo(const mcf::Symbol::ID symbol) const noexcept;
+			// 이 스코프에서 보이는 name 변수가 지역 변수인지 확인합니다.
+			const bool IsLocalVariable(const std::string& name) const noexcept;
 			const bool UseVariableInfo(const std::string& name) noexcept;
+			const bool UseVariableInfo(const mcf::Symbol::ID symbol) noexcept;
 			void DetermineUnknownVariableTypeSize(const std::string& name, std::vector<size_t> arraySizeList) noexcept;
 
 			const bool MakeLocalScopeToFunctionInfo(_Inout_ mcf::Object::FunctionInfo& info) noexcept;
 			const bool DefineFunction(const std::string& name, const mcf::Object::FunctionInfo& info) noexcept;
-			const mcf::Object::FunctionInfo FindFunction(const std::string& name) const noexcept;
-			const mcf::Object::FunctionInfo FindInternalFunction(const InternalFunctionType functionType) const noexcept;
-
+			// 반환된 함수 정보는 스코프의 함수 테이블 항목이므로 복사하지 않고 참조로 보관할 수 있습니다. 찾지 못하면 FunctionInfo::GetInvalidFunctionInfo() 를 반환합니다.
+			const mcf::Object::FunctionInfo& FindFunction(const std::string& name) const noexcept;
+			const mcf::Object::FunctionInfo& FindFunction(const mcf::Symbol::ID symbol) const noexcept;
+			// 함수가 참조되었음을 함수가 정의된 스코프에 기록합니다. 지연 파싱된 함수는 참조된 경우에만 본문을 평가합니다.
+			const bool UseFunction(const mcf::Symbol::ID symbol) noexcept;
+			const bool IsFunctionUsed(const std::string& name) const noexcept;
+			const bool IsFunctionUsed(const mcf::Symbol::ID symbol) const noexcept;
+			const mcf::Object::FunctionInfo& FindInternalFunction(const InternalFunctionType functionType) const noexcept;
+
+			// 함수 본문 안의 스코프는 가장 가까운 함수 스코프에 보관하므로 서로 다른 함수의 본문은 여러 스레드에서 동시에 스코프를 만들 수 있습니다.
 			const bool MakeLocalScope(_Outptr_ mcf::Object::Scope** outScopePtr, const bool isFunctionScope) noexcept;
 
 		private:
 			friend ScopeTree;
+			friend BindingTable;
+			friend BindingStack;
 			explicit Scope(ScopeTree* tree) noexcept : _tree(tree) {}
 
+			enum class BindingKind : unsigned char
+			{
+				INVALID = 0,
+
+				TYPE,
+				VARIABLE,
+				FUNCTION,
+
+				// 이 밑으로는 수정하면 안됩니다.
+				COUNT,
+			};
+
+			struct Binding final
+			{
+				mcf::Symbol::ID Symbol = mcf::Symbol::INVALID_ID;
+				BindingKind Kind = BindingKind::INVALID;
+				// 종류에 맞는 이 스코프의 엔트리 배열의 인덱스입니다.
+				size_t EntryIndex = 0;
+			};
+
+			// 함수 본문을 병렬로 평가하는 동안 여러 스레드가 같은 전역 변수와 함수를 참조할 수 있으므로 사용 여부는 atomic 으로 기록합니다.
+			struct VariableEntry final
+			{
+				explicit VariableEntry(const mcf::Object::Variable& variable) noexcept : Variable(variable), IsUsed(variable.IsUsed) {}
+				VariableEntry(VariableEntry&& other) noexcept : Variable(std::move(other.Variable)), IsUsed(other.IsUsed.load()) {}
+
+				mcf::Object::Variable Variable;
+				mutable std::atomic<bool> IsUsed;
+			};
+
+			struct FunctionEntry final
+			{
+				explicit FunctionEntry(const mcf::Object::FunctionInfo& info) noexcept : Info(info) {}
+
+				mcf::Object::FunctionInfo Info;
+				mutable std::atomic<bool> IsUsed{ false };
+			};
+
+			static constexpr const size_t INVALID_BINDING_INDEX = static_cast<size_t>(-1);
+
+			// 문자열을 받는 함수들은 스코프 트리의 심볼 테이블로 이름을 ID 로 바꾼 뒤 ID 로 찾습니다.
+			const mcf::Symbol::ID FindSymbol(const std::string& name) const noexcept;
+			const mcf::Symbol::ID InternSymbol(const std::string& name) noexcept;
+
+			// 이 스코프에서 보이는 symbol 의 바인딩 중 가장 안쪽의 것을 이 스코프를 연 BindingStack 과 전역 스코프의 BindingTable 에서 찾아 바인딩이 있는 스코프를 반환합니다.
+			// kind 가 INVALID 가 아니면 해당 종류만 찾습니다.
+			const Scope* FindOwnerScope(const mcf::Symbol::ID symbol, const BindingKind kind, _Out_ size_t& outBindingIndex) const noexcept;
+			// 이 스코프에 정의된 symbol 의 바인딩 인덱스를 반환합니다. 없으면 INVALID_BINDING_INDEX 를 반환합니다.
+			const size_t FindBindingIndex(const mcf::Symbol::ID symbol) const noexcept;
+			void AddBinding(const mcf::Symbol::ID symbol, const BindingKind kind, const size_t entryIndex) noexcept;
+
 		private:
-			std::unordered_set<std::string> _allIdentifierSet;
-			std::unordered_map<std::string, mcf::Object::TypeInfo> _typeInfoMap;
-			std::unordered_map<std::string, mcf::Object::Variable> _variables;
-			std::unordered_map<std::string, mcf::Object::FunctionInfo> _functionInfoMap;
+			// 이 스코프에 정의된 순서대로의 바인딩입니다. 같은 스코프에 같은 이름은 하나만 정의됩니다. 이름으로 찾는 것은 BindingTable 과 BindingStack 이 합니다.
+			std::vector<Binding> _bindings;
+			std::vector<mcf::Object::TypeInfo> _types;
+			std::vector<VariableEntry> _variables;
+			// std::deque 는 뒤에 추가하여도 기존 원소를 옮기지 않으므로 FindFunction 이 반환한 참조가 유지됩니다. 함수를 정의하는 스코프에서만 만듭니다.
+			std::unique_ptr<std::deque<FunctionEntry>> _functions;
+			// 함수 스코프에서만 만드는 함수 본문 안의 블록과 함수의 스코프입니다.
+			std::unique_ptr<std::deque<Scope>> _localScopes;
 			Scope* _parent = nullptr;
 			ScopeTree* _tree = nullptr;
+			// 이 스코프를 연 섀도 스택입니다. 열리지 않은 스코프는 nullptr 입니다.
+			BindingStack* _stack = nullptr;
+			// 이 스코프를 만들 때 부모 스코프에 정의되어 있던 바인딩의 갯수입니다.
+			size_t _parentVisibleCount = 0;
 			bool _isFunctionScope = false;
 		};
 
+		// 전역 스코프의 바인딩을 Symbol::ID 로 인덱싱합니다. 전역 스코프에 정의할 때만 바뀌므로 함수 본문을 병렬로 평가하는 동안에는 잠금 없이 읽으며,
+		// 그동안에는 전역 스코프에 정의하면 안됩니다.
+		class BindingTable final
+		{
+		public:
+			explicit BindingTable(void) noexcept = delete;
+			explicit BindingTable(_Notnull_ const Scope* global) noexcept : _global(global) {}
+			explicit BindingTable(const BindingTable& other) noexcept = delete;
+
+		private:
+			friend Scope;
+			// 전역 스코프의 앞쪽 visibleCount 개의 바인딩 중 symbol 의 바인딩 인덱스를 반환합니다. 없으면 Scope::INVALID_BINDING_INDEX 를 반환합니다.
+			const size_t Find(const mcf::Symbol::ID symbol, const Scope::BindingKind kind, const size_t visibleCount) const noexcept;
+			// 전역 스코프에 마지막으로 추가된 바인딩을 테이블에 넣습니다.
+			void Add(void) noexcept;
+
+		private:
+			const Scope* const _global;
+			// Symbol::ID -> 전역 스코프의 바인딩 인덱스입니다.
+			std::vector<size_t> _bindingIndices;
+		};
+
+		// 지역 스코프의 바인딩을 Symbol::ID 로 인덱싱하는 섀도 스택입니다. 스코프를 열 때 그 스코프의 바인딩을 넣고 닫을 때 빼므로
+		// symbol 의 스택 맨 위가 가장 안쪽 스코프에서 보이는 바인딩이며, 이름을 찾을 때는 스택 맨 위만 봅니다.
+		// 스택은 한 스레드에서만 사용해야 합니다. 함수 본문을 병렬로 평가할 때는 스레드마다 스택을 따로 만듭니다.
+		class BindingStack final
+		{
+		public:
+			explicit BindingStack(void) noexcept = default;
+			explicit BindingStack(const BindingStack& other) noexcept = delete;
+
+			// scope 를 가장 안쪽 스코프로 엽니다. 전역 스코프 바로 안쪽의 스코프는 빈 스택에 열고, 나머지 스코프는 부모 스코프가 가장 안쪽일 때 엽니다.
+			// 부모 스코프에 scope 를 만든 뒤 정의된 바인딩은 scope 를 닫을 때까지 스택에서 뺍니다.
+			void Enter(_Notnull_ Scope* scope) noexcept;
+			// 가장 안쪽 스코프인 scope 를 닫습니다.
+			void Leave(_Notnull_ Scope* scope) noexcept;
+			inline const bool IsEmpty(void) const noexcept { return _openScopes.empty(); }
+
+		private:
+			friend Scope;
+
+			struct Node final
+			{
+				const Scope* Owner = nullptr;
+				size_t BindingIndex = 0;
+				mcf::Symbol::ID Symbol = mcf::Symbol::INVALID_ID;
+				Scope::BindingKind Kind = Scope::BindingKind::INVALID;
+				// 같은 symbol 의 바로 아래 노드의 _nodes 인덱스 + 1 입니다. 0 이면 아래 노드가 없습니다.
+				size_t Previous = 0;
+				// 같은 symbol 과 같은 종류의 바로 아래 노드의 _nodes 인덱스 + 1 입니다.
+				size_t PreviousOfKind = 0;
+			};
+
+			struct OpenScope final
+			{
+				Scope* Owner = nullptr;
+				// Owner 의 _bindings 중 스택에 넣은 앞쪽 바인딩의 갯수입니다.
+				size_t PushedCount = 0;
+			};
+
+			inline const Scope* GetInnermostScope(void) const noexcept { return _openScopes.empty() ? nullptr : _openScopes.back().Owner; }
+			// 가장 안쪽 스코프에서 보이는 symbol 의 지역 바인딩이 있는 스코프를 반환합니다. kind 가 INVALID 면 종류와 상관없이 찾습니다.
+			const Scope* Find(const mcf::Symbol::ID symbol, const Scope::BindingKind kind, _Out_ size_t& outBindingIndex) const noexcept;
+			// 가장 안쪽 스코프의 바인딩 중 아직 넣지 않은 바인딩을 넣습니다.
+			void PushInnermost(void) noexcept;
+			void Push(_Inout_ OpenScope& openScope, const size_t pushedCount) noexcept;
+			void Pop(size_t popCount) noexcept;
+
+		private:
+			// Symbol::ID -> 맨 위 노드의 _nodes 인덱스 + 1 입니다. BindingKind::INVALID 의 자리는 종류와 상관없는 스택입니다.
+			std::vector<size_t> _heads[mcf::ENUM_COUNT<Scope::BindingKind>()];
+			std::vector<Node> _nodes;
+			// 가장 바깥쪽 스코프부터 가장 안쪽 스코프까지 연 순서대로입니다.
+			std::vector<OpenScope> _openScopes;
+			// 가장 바깥쪽 스코프에서 보이는 전역 바인딩의 갯수입니다.
+			size_t _globalVisibleCount = 0;
+		};
+
 		struct ScopeTree final
 		{
+			// 스코프의 모든 맵은 이 테이블의 ID 를 키로 사용합니다. 파서에 같은 테이블을 넘기면 렉서가 만든 ID 를 그대로 사용할 수 있습니다.
+			std::shared_ptr<mcf::Symbol::Table> Symbols = std::make_shared<mcf::Symbol::Table>();
+			// 이 스코프 트리로 평가하는 동안 만든 모든 타입입니다. 평가 결과의 IR 도 이 테이블의 타입을 가리키므로 IR 보다 오래 유지되어야 합니다.
+			TypeTable Types;
 			Scope Global = Scope(this);
-			std::vector<std::unique_ptr<Scope>> Locals;
+			BindingTable Bindings = BindingTable(&Global);
+			// 함수 본문 밖에서 지역 스코프를 열 때 사용하는 섀도 스택입니다. 함수 본문을 병렬로 평가할 때는 스레드마다 따로 만든 스택을 사용합니다.
+			BindingStack Stack;
+			// 함수 본문 밖에서 만든 스코프입니다. 블록마다 스코프를 힙에 따로 할당하지 않도록 std::deque 에 보관합니다. std::deque 는 뒤에 추가하여도 기존 스코프를 옮기지 않습니다.
+			std::deque<Scope> Locals;
+			// 문자열 리터럴과 리터럴의 인덱스입니다. 병렬로 평가하는 함수 본문은 LiteralIndexMutex 로 잠근 뒤 등록하고, 인덱스는 평가가 끝난 뒤 본문의 순서대로 정합니다.
 			std::unordered_map<std::string, std::pair<size_t, Data>> LiteralIndexMap;
+			std::mutex LiteralIndexMutex;
 			mcf::Object::FunctionInfo InternalFunctionInfosByTypes[mcf::ENUM_COUNT<InternalFunctionType>()] =
 			{
 				mcf::Object::FunctionInfo(),
@@ -187,9 +413,9 @@ namespace mcf
 					INTERNAL_FUNCTION_TYPE_STRING_ARRAY[mcf::ENUM_INDEX(InternalFunctionType::COPY_MEMORY)], 
 					std::vector<Variable>
 					({
-						Variable{"src", mcf::Object::TypeInfo::MakePrimitive(true, "qword", 8), false},
-						Variable{"dest", mcf::Object::TypeInfo::MakePrimitive(true, "qword", 8), false},
-						Variable{"size", mcf::Object::TypeInfo::MakePrimitive(true, "qword", 8), false},
+						Variable{"src", Types.MakePrimitive(true, "qword", 8), false},
+						Variable{"dest", Types.MakePrimitive(true, "qword", 8), false},
+						Variable{"size", Types.MakePrimitive(true, "qword", 8), false},
 					}),
 					mcf::Object::TypeInfo::GetVoidTypeInfo(),
 					reinterpret_cast<Scope*>(true), // Definition.IsExternal = true
@@ -250,22 +476,39 @@ namespace mcf
 			return TYPE_STRING_ARRAY[mcf::ENUM_INDEX(value)];
 		}
 
+		// 구체 타입을 가상 함수 대신 멤버로 저장하여 GetType 과 VISIT 가 가상 호출 없이 타입을 읽습니다.
 		class Interface
 		{
 		public:
 			virtual ~Interface(void) noexcept = default;
-			virtual const Type GetType(void) const noexcept = 0;
+			inline const Type GetType(void) const noexcept { return _type; }
 			virtual const std::string Inspect(void) const noexcept = 0;
+
+		protected:
+			explicit Interface(const Type type) noexcept : _type(type) {}
+
+		private:
+			Type _type;
+		};
+
+		// IR 오브젝트의 구체 클래스들이 상속합니다.
+		template <Type TYPE_VALUE>
+		class TypedInterface : public Interface
+		{
+		public:
+			static constexpr const Type TYPE = TYPE_VALUE;
+
+		protected:
+			explicit TypedInterface(void) noexcept : Interface(TYPE_VALUE) {}
 		};
 
 		using Pointer = std::unique_ptr<Interface>;
 		using PointerVector = std::vector<Pointer>;
 
-		class Invalid : public Interface
+		class Invalid : public TypedInterface<Type::INVALID>
 		{
 		public:
 			inline static Pointer Make(void) noexcept { return std::make_unique<Invalid>(); }
-			inline virtual const Type GetType(void) const noexcept override final { return Type::INVALID; }
 			inline virtual const std::string Inspect(void) const noexcept override final { return "Invalid Object"; }
 		};
 
@@ -319,25 +562,40 @@ namespace mcf
 				return TYPE_STRING_ARRAY[mcf::ENUM_INDEX(value)];
 			}
 
-			class Interface : public mcf::IR::Interface
+			class Interface : public mcf::IR::TypedInterface<mcf::IR::Type::EXPRESSION>
 			{
 			public:
-				virtual const Type GetExpressionType(void) const noexcept = 0;
+				inline const Type GetExpressionType(void) const noexcept { return _expressionType; }
 
 				static const mcf::Object::TypeInfo GetDataTypeFromExpression(const mcf::IR::Expression::Interface* expression) noexcept;
 
-				inline virtual const mcf::IR::Type GetType(void) const noexcept override final { return mcf::IR::Type::EXPRESSION; }
 				virtual const std::string Inspect(void) const noexcept override = 0;
+
+			protected:
+				explicit Interface(const Type expressionType) noexcept : _expressionType(expressionType) {}
+
+			private:
+				Type _expressionType;
+			};
+
+			// IR 식(IR::Expression)의 구체 클래스들이 상속합니다.
+			template <Type TYPE_VALUE>
+			class TypedInterface : public Interface
+			{
+			public:
+				static constexpr const Type TYPE = TYPE_VALUE;
+
+			protected:
+				explicit TypedInterface(void) noexcept : Interface(TYPE_VALUE) {}
 			};
 
 			using Pointer = std::unique_ptr<Interface>;
 			using PointerVector = std::vector<Pointer>;
 
-			class Invalid : public Interface
+			class Invalid : public TypedInterface<Type::INVALID>
 			{
 			public:
 				inline static Pointer Make(void) noexcept { return std::make_unique<Invalid>(); }
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::INVALID; }
 				inline virtual const std::string Inspect(void) const noexcept override final { return "Invalid Expression Object"; }
 			};
 		}
@@ -556,23 +814,23 @@ namespace mcf
 			constexpr const size_t REGISTER_SIZE_VALUE_ARRAY[mcf::ENUM_COUNT<RegisterSize>()] =
 			{
 				0,
-				sizeof(__int8),
-				sizeof(__int16),
-				sizeof(__int32),
-				sizeof(__int64),
+				sizeof(std::int8_t),
+				sizeof(std::int16_t),
+				sizeof(std::int32_t),
+				sizeof(std::int64_t),
 			};
 			constexpr const size_t GET_REGISTER_SIZE_VALUE(const mcf::IR::ASM::Register reg) { return REGISTER_SIZE_VALUE_ARRAY[mcf::ENUM_INDEX(GET_REGISTER_SIZE(reg))]; }
 			constexpr const mcf::IR::ASM::RegisterSize GET_REGISTER_SIZE_BY_VALUE(const size_t value)
 			{ 
 				switch (value)
 				{
-				case sizeof(__int8) :
+				case sizeof(std::int8_t) :
 					return mcf::IR::ASM::RegisterSize::BYTE;
-				case sizeof(__int16) :
+				case sizeof(std::int16_t) :
 					return mcf::IR::ASM::RegisterSize::WORD;
-				case sizeof(__int32) :
+				case sizeof(std::int32_t) :
 					return mcf::IR::ASM::RegisterSize::DWORD;
-				case sizeof(__int64) :
+				case sizeof(std::int64_t) :
 					return mcf::IR::ASM::RegisterSize::QWORD;
 				default:
 					return mcf::IR::ASM::RegisterSize::INVALID;
@@ -583,7 +841,7 @@ namespace mcf
 				constexpr const size_t REGISTER_COUNT_BEGIN = __COUNTER__;
 				switch (size)
 				{
-					case sizeof(__int8) :
+					case sizeof(std::int8_t) :
 					{
 						switch (targetRegister)
 						{
@@ -638,7 +896,7 @@ namespace mcf
 						break;
 					}
 
-					case sizeof(__int16) :
+					case sizeof(std::int16_t) :
 					{
 						switch (targetRegister)
 						{
@@ -693,7 +951,7 @@ namespace mcf
 						break;
 					}
 
-					case sizeof(__int32) :
+					case sizeof(std::int32_t) :
 					{
 						switch (targetRegister)
 						{
@@ -748,7 +1006,7 @@ namespace mcf
 						break;
 					}
 
-					case sizeof(__int64) :
+					case sizeof(std::int64_t) :
 					{
 						switch (targetRegister)
 						{
@@ -810,30 +1068,45 @@ namespace mcf
 				return mcf::IR::ASM::Register::INVALID;
 			}
 
-			class Interface : public mcf::IR::Interface
+			class Interface : public mcf::IR::TypedInterface<mcf::IR::Type::ASM>
 			{
 			public:
-				virtual const Type GetASMType( void ) const noexcept = 0;
+				inline const Type GetASMType( void ) const noexcept { return _asmType; }
 
-				inline virtual const mcf::IR::Type GetType( void ) const noexcept override final { return mcf::IR::Type::ASM; }
 				virtual const std::string Inspect( void ) const noexcept override = 0;
+
+			protected:
+				explicit Interface( const Type asmType ) noexcept : _asmType( asmType ) {}
+
+			private:
+				Type _asmType;
+			};
+
+			// 어셈블리 코드(IR::ASM)의 구체 클래스들이 상속합니다.
+			template <Type TYPE_VALUE>
+			class TypedInterface : public Interface
+			{
+			public:
+				static constexpr const Type TYPE = TYPE_VALUE;
+
+			protected:
+				explicit TypedInterface(void) noexcept : Interface(TYPE_VALUE) {}
 			};
 
 			using Pointer = std::unique_ptr<Interface>;
 			using PointerVector = std::vector<Pointer>;
 
-			class Invalid : public Interface
+			class Invalid : public TypedInterface<Type::INVALID>
 			{
 			public:
 				inline static Pointer Make( void ) noexcept { return std::make_unique<Invalid>(); }
-				inline virtual const Type GetASMType( void ) const noexcept override final { return Type::INVALID; }
 				inline virtual const std::string Inspect( void ) const noexcept override final { return "Invalid Expression Object"; }
 			};
 		}
 
 		namespace Expression
 		{
-			class TypeIdentifier final : public Interface
+			class TypeIdentifier final : public TypedInterface<Type::TYPE_IDENTIFIER>
 			{
 			public:
 				using Pointer = std::unique_ptr<TypeIdentifier>;
@@ -847,14 +1120,13 @@ namespace mcf
 
 				const mcf::Object::TypeInfo& GetInfo(void) const noexcept { return _info; }
 
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::TYPE_IDENTIFIER; }
 				inline virtual const std::string Inspect(void) const noexcept override final { return _info.Inspect(); }
 
 			private:
 				mcf::Object::TypeInfo _info;
 			};
 
-			class GlobalVariableIdentifier final : public Interface
+			class GlobalVariableIdentifier final : public TypedInterface<Type::GLOBAL_VARIABLE_IDENTIFIER>
 			{
 			public:
 				using Pointer = std::unique_ptr<GlobalVariableIdentifier>;
@@ -869,14 +1141,13 @@ namespace mcf
 				mcf::Object::Variable& GetVariable(void) noexcept { return _variable; }
 				const mcf::Object::Variable& GetVariable(void) const noexcept { return _variable;}
 
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::GLOBAL_VARIABLE_IDENTIFIER; }
 				inline virtual const std::string Inspect(void) const noexcept override final { return _variable.Inspect(); }
 
 			private:
 				mcf::Object::Variable _variable;
 			};
 
-			class LocalVariableIdentifier final : public Interface
+			class LocalVariableIdentifier final : public TypedInterface<Type::LOCAL_VARIABLE_IDENTIFIER>
 			{
 			public:
 				using Pointer = std::unique_ptr<LocalVariableIdentifier>;
@@ -891,14 +1162,13 @@ namespace mcf
 				mcf::Object::Variable& GetVariable(void) noexcept { return _variable;}
 				const mcf::Object::Variable& GetVariable(void) const noexcept { return _variable;}
 
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::LOCAL_VARIABLE_IDENTIFIER; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			private:
 				mcf::Object::Variable _variable;
 			};
 
-			class FunctionIdentifier final : public Interface
+			class FunctionIdentifier final : public TypedInterface<Type::FUNCTION_IDENTIFIER>
 			{
 			public:
 				using Pointer = std::unique_ptr<FunctionIdentifier>;
@@ -908,18 +1178,18 @@ namespace mcf
 
 			public:
 				explicit FunctionIdentifier(void) noexcept = default;
+				// info 는 스코프의 함수 테이블 항목이어야 합니다. 복사하지 않고 주소만 보관합니다.
 				explicit FunctionIdentifier(const mcf::Object::FunctionInfo& info) noexcept;
 
-				inline const mcf::Object::FunctionInfo& GetInfo(void) const noexcept { return _info;}
+				inline const mcf::Object::FunctionInfo& GetInfo(void) const noexcept { return *_info;}
 
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::FUNCTION_IDENTIFIER; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			private:
-				mcf::Object::FunctionInfo _info;
+				const mcf::Object::FunctionInfo* _info = nullptr;
 			};
 
-			class Integer final : public Interface
+			class Integer final : public TypedInterface<Type::INTEGER>
 			{
 			public:
 				using Pointer = std::unique_ptr<Integer>;
@@ -932,44 +1202,43 @@ namespace mcf
 
 			public:
 				explicit Integer(void) noexcept = default;
-				explicit Integer(const __int64 value) noexcept : _signedValue(value), _isUnsigned(false){}
-				explicit Integer(const unsigned __int64 value) noexcept : _unsignedValue(value), _isUnsigned(true){}
+				explicit Integer(const std::int64_t value) noexcept : _signedValue(value), _isUnsigned(false){}
+				explicit Integer(const std::uint64_t value) noexcept : _unsignedValue(value), _isUnsigned(true){}
 
 				inline const bool IsNaturalInteger(void) const noexcept { return _isUnsigned ? true : (_signedValue >= 0); }
 				const bool IsCompatible(const mcf::Object::TypeInfo& dataType) const noexcept;
 				const bool IsZero(void) const noexcept { return _unsignedValue == 0; }
 
 				inline const bool IsInt64(void) const noexcept { return _isUnsigned == false; }
-				const __int64 GetInt64(void) const noexcept;
+				const std::int64_t GetInt64(void) const noexcept;
 				inline const bool IsInt32(void) const noexcept { return (_isUnsigned == false && INT32_MIN <= _signedValue && _signedValue <= INT32_MAX) || (_isUnsigned == true && _unsignedValue <= INT32_MAX); }
-				const __int32 GetInt32(void) const noexcept;
+				const std::int32_t GetInt32(void) const noexcept;
 				inline const bool IsInt16(void) const noexcept { return (_isUnsigned == false && INT16_MIN <= _signedValue && _signedValue <= INT16_MAX) || (_isUnsigned == true && _unsignedValue <= INT16_MAX); }
-				const __int16 GetInt16(void) const noexcept;
+				const std::int16_t GetInt16(void) const noexcept;
 				inline const bool IsInt8(void) const noexcept { return (_isUnsigned == false && INT8_MIN <= _signedValue && _signedValue <= INT8_MAX) || (_isUnsigned == true && _unsignedValue <= INT8_MAX); }
-				const __int8 GetInt8(void) const noexcept;
+				const std::int8_t GetInt8(void) const noexcept;
 
 				inline const bool IsUInt64(void) const noexcept { return IsNaturalInteger(); }
-				const unsigned __int64 GetUInt64(void) const noexcept;
+				const std::uint64_t GetUInt64(void) const noexcept;
 				inline const bool IsUInt32(void) const noexcept { return (_isUnsigned == false && 0 <= _signedValue && _signedValue <= UINT32_MAX) || (_isUnsigned == true && _unsignedValue <= UINT32_MAX); }
-				const unsigned __int32 GetUInt32(void) const noexcept;
+				const std::uint32_t GetUInt32(void) const noexcept;
 				inline const bool IsUInt16(void) const noexcept { return (_isUnsigned == false && 0 <= _signedValue && _signedValue <= UINT16_MAX) || (_isUnsigned == true && _unsignedValue <= UINT16_MAX); }
-				const unsigned __int16 GetUInt16(void) const noexcept;
+				const std::uint16_t GetUInt16(void) const noexcept;
 				inline const bool IsUInt8(void) const noexcept { return (_isUnsigned == false && 0 <= _signedValue && _signedValue <= UINT8_MAX) || (_isUnsigned == true && _unsignedValue <= UINT8_MAX); }
-				const unsigned __int8 GetUInt8(void) const noexcept;
+				const std::uint8_t GetUInt8(void) const noexcept;
 
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::INTEGER; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			private:
 				union
 				{
-					unsigned __int64 _unsignedValue;
-					__int64 _signedValue;
+					std::uint64_t _unsignedValue;
+					std::int64_t _signedValue;
 				};
 				bool _isUnsigned = false;
 			};
 
-			class String final : public Interface
+			class String final : public TypedInterface<Type::STRING>
 			{
 			public:
 				using Pointer = std::unique_ptr<String>;
@@ -979,30 +1248,34 @@ namespace mcf
 
 			public:
 				explicit String(void) noexcept = default;
-				explicit String(const size_t index, const size_t size) noexcept : _index(index), _size(size) {}
+				// literal 은 ScopeTree::LiteralIndexMap 의 값입니다. 함수 본문을 병렬로 평가하면 인덱스는 평가가 끝난 뒤 정해지므로 값을 복사하지 않고 가리킵니다.
+				explicit String(const std::pair<size_t, mcf::Object::Data>* literal, const size_t size, const mcf::Object::TypeInfo& info) noexcept : _literal(literal), _size(size), _info(info) {}
 
-				const size_t GetIndex(void) const noexcept { return _index;}
+				const size_t GetIndex(void) const noexcept { return _literal->first;}
 				const size_t GetSize(void) const noexcept { return _size;}
+				// 문자열 리터럴의 byte 배열 타입입니다. 평가할 때 스코프 트리의 타입 테이블에서 받습니다.
+				const mcf::Object::TypeInfo& GetInfo(void) const noexcept { return _info;}
 
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::STRING; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			private:
-				const size_t _index;
+				const std::pair<size_t, mcf::Object::Data>* const _literal;
 				const size_t _size;
+				const mcf::Object::TypeInfo _info;
 			};
 
 			class Initializer : public Interface
 			{
 			public:
 				using Pointer = std::unique_ptr<Initializer>;
+				static constexpr const Type TYPE = Type::INITIALIZER;
 
 				template <class... Variadic>
 				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<Initializer>(std::move(args)...); }
 
 			public:
-				explicit Initializer(void) noexcept = default;
-				explicit Initializer(PointerVector&& keyList) noexcept;
+				explicit Initializer(void) noexcept : Interface(TYPE) {}
+				explicit Initializer(PointerVector&& keyList) noexcept : Initializer(TYPE, std::move(keyList)) {}
 
 				inline virtual const size_t GetKeyExpressionCount(void) const noexcept final { return _keyList.size(); }
 				inline virtual mcf::IR::Expression::Interface* GetUnsafeKeyExpressionPointerAt(const size_t index) noexcept final
@@ -1014,9 +1287,13 @@ namespace mcf
 					return _keyList[index].get();
 				}
 
-				inline virtual const Type GetExpressionType(void) const noexcept override { return Type::INITIALIZER; }
 				virtual const std::string Inspect(void) const noexcept override;
 
+			protected:
+				// MapInitializer 가 자신의 타입을 저장할 때 사용합니다.
+				explicit Initializer(const Type type) noexcept : Interface(type) {}
+				explicit Initializer(const Type type, PointerVector&& keyList) noexcept;
+
 			private:
 				PointerVector _keyList;
 			};
@@ -1025,12 +1302,13 @@ namespace mcf
 			{
 			public:
 				using Pointer = std::unique_ptr<MapInitializer>;
+				static constexpr const Type TYPE = Type::MAP_INITIALIZER;
 
 				template <class... Variadic>
 				inline static Pointer Make(Variadic&& ...args) noexcept { return std::make_unique<MapInitializer>(std::move(args)...); }
 
 			public:
-				explicit MapInitializer(void) noexcept = default;
+				explicit MapInitializer(void) noexcept : Initializer(TYPE) {}
 				explicit MapInitializer(PointerVector&& keyList, PointerVector&& valueList) noexcept;
 
 				inline const size_t GetValueExpressionCount(void) const noexcept { return _valueList.size(); }
@@ -1043,14 +1321,13 @@ namespace mcf
 					return _valueList[index].get();
 				}
 
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::MAP_INITIALIZER; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			private:
 				PointerVector _valueList;
 			};
 
-			class Call final : public Interface
+			class Call final : public TypedInterface<Type::CALL>
 			{
 			public:
 				using Pointer = std::unique_ptr<Call>;
@@ -1060,9 +1337,10 @@ namespace mcf
 
 			public:
 				explicit Call(void) noexcept = default;
+				// info 는 스코프의 함수 테이블 항목이어야 합니다. 복사하지 않고 주소만 보관합니다.
 				explicit Call(const mcf::Object::FunctionInfo& info, mcf::IR::Expression::PointerVector&& paramObjects) noexcept;
 
-				inline const mcf::Object::FunctionInfo& GetInfo(void) const noexcept { return _info; }
+				inline const mcf::Object::FunctionInfo& GetInfo(void) const noexcept { return *_info; }
 				inline const size_t GetParamCount(void) const noexcept { return _paramObjects.size(); }
 				inline mcf::IR::Expression::Interface* GetUnsafeParamPointerAt(const size_t index) noexcept
 				{
@@ -1073,15 +1351,14 @@ namespace mcf
 					return _paramObjects[index].get();
 				}
 
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::CALL; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			private:
-				mcf::Object::FunctionInfo _info;
+				const mcf::Object::FunctionInfo* _info = nullptr;
 				mcf::IR::Expression::PointerVector _paramObjects;
 			};
 
-			class StaticCast final : public Interface
+			class StaticCast final : public TypedInterface<Type::STATIC_CAST>
 			{
 			public:
 				using Pointer = std::unique_ptr<StaticCast>;
@@ -1097,7 +1374,6 @@ namespace mcf
 				inline const mcf::Object::TypeInfo GetCastedDatType(void) const noexcept { return _castedType; }
 				inline mcf::IR::Expression::Interface* GetUnsafeOriginalExpressionPointer(void) const noexcept { return _castingValue.get(); }
 
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::STATIC_CAST; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			private:
@@ -1105,7 +1381,7 @@ namespace mcf
 				mcf::Object::TypeInfo _castedType;
 			};
 
-			class Assign final : public Interface
+			class Assign final : public TypedInterface<Type::ASSIGN>
 			{
 			public:
 				using Pointer = std::unique_ptr<Assign>;
@@ -1122,7 +1398,6 @@ namespace mcf
 				inline mcf::IR::Expression::Interface* GetUnsafeRightExpression(void) noexcept { return _right.get(); }
 				inline const mcf::IR::Expression::Interface* GetUnsafeRightExpression(void) const noexcept { return _right.get(); }
 
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::ASSIGN; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			private:
@@ -1130,7 +1405,7 @@ namespace mcf
 				mcf::IR::Expression::Pointer _right;
 			};
 
-			class Conditional final : public Interface
+			class Conditional final : public TypedInterface<Type::CONDITIONAL>
 			{
 			public:
 				using Pointer = std::unique_ptr<Conditional>;
@@ -1152,7 +1427,6 @@ namespace mcf
 				inline mcf::IR::Expression::Interface* GetUnsafeRightExpression(void) noexcept { return _right.get(); }
 				inline const mcf::IR::Expression::Interface* GetUnsafeRightExpression(void) const noexcept { return _right.get(); }
 
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::CONDITIONAL; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			private:
@@ -1161,7 +1435,7 @@ namespace mcf
 				mcf::IR::Expression::Pointer _right;
 			};
 
-			class Arithmetic final : public Interface
+			class Arithmetic final : public TypedInterface<Type::ARITHMETIC>
 			{
 			public:
 				using Pointer = std::unique_ptr<Arithmetic>;
@@ -1182,7 +1456,6 @@ namespace mcf
 				inline mcf::IR::Expression::Interface* GetUnsafeRightExpression(void) noexcept { return _right.get(); }
 				inline const mcf::IR::Expression::Interface* GetUnsafeRightExpression(void) const noexcept { return _right.get(); }
 
-				inline virtual const Type GetExpressionType(void) const noexcept override final { return Type::ARITHMETIC; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			private:
@@ -1190,6 +1463,17 @@ namespace mcf
 				mcf::IR::Expression::Pointer _left;
 				mcf::IR::Expression::Pointer _right;
 			};
+
+			// 클래스 순서는 Type 과 같아야 합니다.
+			using NodeList = mcf::NodeList<Type, Invalid, TypeIdentifier, GlobalVariableIdentifier, LocalVariableIdentifier, FunctionIdentifier, Integer, String, Initializer, MapInitializer, Call, StaticCast, Assign, Conditional, Arithmetic>;
+			static_assert(NodeList::IS_MATCHING() == true, "expression ir node list not matching!");
+
+			// expression 의 구체 클래스를 받는 visitor 의 오버로드를 호출합니다. 자세한 내용은 mcf::NodeList::Visit 를 참고 해 주세요.
+			template <class NodePointer, class Visitor>
+			inline decltype(auto) VISIT(NodePointer expression, Visitor&& visitor) noexcept
+			{
+				return NodeList::Visit(expression->GetExpressionType(), expression, std::forward<Visitor>(visitor));
+			}
 		}
 
 		namespace ASM
@@ -1236,15 +1520,14 @@ namespace mcf
 				std::string _targetSize;
 			};
 
-			class Ret : public Interface
+			class Ret : public TypedInterface<Type::RET>
 			{
 			public:
 				inline static Pointer Make(void) noexcept { return std::make_unique<Ret>(); }
-				inline virtual const Type GetASMType(void) const noexcept override final { return Type::RET; }
 				inline virtual const std::string Inspect(void) const noexcept override final { return "\tret\n"; }
 			};
 
-			class ProcBegin : public Interface
+			class ProcBegin : public TypedInterface<Type::PROC_BEGIN>
 			{
 			public:
 				using Pointer = std::unique_ptr<ProcBegin>;
@@ -1257,14 +1540,13 @@ namespace mcf
 				explicit ProcBegin(const std::string& name) noexcept;
 
 
-				inline virtual const Type GetASMType(void) const noexcept override { return Type::PROC_BEGIN; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			protected:
 				std::string _name;
 			};
 
-			class ProcEnd : public Interface
+			class ProcEnd : public TypedInterface<Type::PROC_END>
 			{
 			public:
 				using Pointer = std::unique_ptr<ProcEnd>;
@@ -1277,14 +1559,13 @@ namespace mcf
 				explicit ProcEnd(const std::string& name) noexcept;
 
 
-				inline virtual const Type GetASMType(void) const noexcept override { return Type::PROC_END; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			protected:
 				std::string _name;
 			};
 
-			class Push : public Interface
+			class Push : public TypedInterface<Type::PUSH>
 			{
 			public:
 				using Pointer = std::unique_ptr<Push>;
@@ -1297,14 +1578,13 @@ namespace mcf
 				explicit Push(const Register address) noexcept;
 
 
-				inline virtual const Type GetASMType(void) const noexcept override { return Type::PUSH; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			protected:
 				std::string _value;
 			};
 
-			class Pop : public Interface
+			class Pop : public TypedInterface<Type::POP>
 			{
 			public:
 				using Pointer = std::unique_ptr<Pop>;
@@ -1317,14 +1597,13 @@ namespace mcf
 				explicit Pop(const Register target) noexcept;
 
 
-				inline virtual const Type GetASMType(void) const noexcept override { return Type::POP; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			protected:
 				std::string _target;
 			};
 
-			class Mov : public Interface
+			class Mov : public TypedInterface<Type::MOV>
 			{
 			public:
 				using Pointer = std::unique_ptr<Mov>;
@@ -1335,28 +1614,27 @@ namespace mcf
 			public:
 				explicit Mov(void) noexcept = default;
 				explicit Mov(const Address& target, const Register source) noexcept;
-				explicit Mov(const Address& target, const __int64 source) noexcept;
-				explicit Mov(const Address& target, const __int32 source) noexcept;
-				explicit Mov(const Address& target, const __int16 source) noexcept;
-				explicit Mov(const Address& target, const __int8 source) noexcept;
-				explicit Mov(const Address& target, const unsigned __int64 source) noexcept;
-				explicit Mov(const Address& target, const unsigned __int32 source) noexcept;
-				explicit Mov(const Address& target, const unsigned __int16 source) noexcept;
-				explicit Mov(const Address& target, const unsigned __int8 source) noexcept;
+				explicit Mov(const Address& target, const std::int64_t source) noexcept;
+				explicit Mov(const Address& target, const std::int32_t source) noexcept;
+				explicit Mov(const Address& target, const std::int16_t source) noexcept;
+				explicit Mov(const Address& target, const std::int8_t source) noexcept;
+				explicit Mov(const Address& target, const std::uint64_t source) noexcept;
+				explicit Mov(const Address& target, const std::uint32_t source) noexcept;
+				explicit Mov(const Address& target, const std::uint16_t source) noexcept;
+				explicit Mov(const Address& target, const std::uint8_t source) noexcept;
 				explicit Mov(const Register target, _In_ const mcf::IR::Expression::GlobalVariableIdentifier* globalExpression) noexcept;
 				explicit Mov(const Register target, const Address& source) noexcept;
 				explicit Mov(const Register target, const SizeOf& source) noexcept;
-				explicit Mov(const Register target, const __int64 source) noexcept;
-				explicit Mov(const Register target, const __int32 source) noexcept;
-				explicit Mov(const Register target, const __int16 source) noexcept;
-				explicit Mov(const Register target, const __int8 source) noexcept;
-				explicit Mov(const Register target, const unsigned __int64 source) noexcept;
-				explicit Mov(const Register target, const unsigned __int32 source) noexcept;
-				explicit Mov(const Register target, const unsigned __int16 source) noexcept;
-				explicit Mov(const Register target, const unsigned __int8 source) noexcept;
+				explicit Mov(const Register target, const std::int64_t source) noexcept;
+				explicit Mov(const Register target, const std::int32_t source) noexcept;
+				explicit Mov(const Register target, const std::int16_t source) noexcept;
+				explicit Mov(const Register target, const std::int8_t source) noexcept;
+				explicit Mov(const Register target, const std::uint64_t source) noexcept;
+				explicit Mov(const Register target, const std::uint32_t source) noexcept;
+				explicit Mov(const Register target, const std::uint16_t source) noexcept;
+				explicit Mov(const Register target, const std::uint8_t source) noexcept;
 
 
-				inline virtual const Type GetASMType(void) const noexcept override { return Type::MOV; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			protected:
@@ -1364,7 +1642,7 @@ namespace mcf
 				std::string _source;
 			};
 
-			class Lea : public Interface
+			class Lea : public TypedInterface<Type::LEA>
 			{
 			public:
 				using Pointer = std::unique_ptr<Lea>;
@@ -1377,7 +1655,6 @@ namespace mcf
 				explicit Lea(const Register target, const mcf::IR::ASM::UnsafePointerAddress& source) noexcept;
 
 
-				inline virtual const Type GetASMType(void) const noexcept override { return Type::LEA; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			protected:
@@ -1385,7 +1662,7 @@ namespace mcf
 				std::string _source;
 			};
 
-			class Add : public Interface
+			class Add : public TypedInterface<Type::ADD>
 			{
 			public:
 				using Pointer = std::unique_ptr<Add>;
@@ -1395,27 +1672,26 @@ namespace mcf
 
 			public:
 				explicit Add(void) noexcept = default;
-				explicit Add(const Register lhs, const __int64 rhs) noexcept;
-				explicit Add(const Register lhs, const __int32 rhs) noexcept;
-				explicit Add(const Register lhs, const __int16 rhs) noexcept;
-				explicit Add(const Register lhs, const __int8 rhs) noexcept;
-				explicit Add(const Register lhs, const unsigned __int64 rhs) noexcept;
-				explicit Add(const Register lhs, const unsigned __int32 rhs) noexcept;
-				explicit Add(const Register lhs, const unsigned __int16 rhs) noexcept;
-				explicit Add(const Register lhs, const unsigned __int8 rhs) noexcept;
+				explicit Add(const Register lhs, const std::int64_t rhs) noexcept;
+				explicit Add(const Register lhs, const std::int32_t rhs) noexcept;
+				explicit Add(const Register lhs, const std::int16_t rhs) noexcept;
+				explicit Add(const Register lhs, const std::int8_t rhs) noexcept;
+				explicit Add(const Register lhs, const std::uint64_t rhs) noexcept;
+				explicit Add(const Register lhs, const std::uint32_t rhs) noexcept;
+				explicit Add(const Register lhs, const std::uint16_t rhs) noexcept;
+				explicit Add(const Register lhs, const std::uint8_t rhs) noexcept;
 				explicit Add(const Register lhs, const Address& rhs) noexcept;
 				explicit Add(const Address& lhs, const Register rhs) noexcept;
-				explicit Add(const Address& lhs, const __int64 rhs) noexcept;
-				explicit Add(const Address& lhs, const __int32 rhs) noexcept;
-				explicit Add(const Address& lhs, const __int16 rhs) noexcept;
-				explicit Add(const Address& lhs, const __int8 rhs) noexcept;
-				explicit Add(const Address& lhs, const unsigned __int64 rhs) noexcept;
-				explicit Add(const Address& lhs, const unsigned __int32 rhs) noexcept;
-				explicit Add(const Address& lhs, const unsigned __int16 rhs) noexcept;
-				explicit Add(const Address& lhs, const unsigned __int8 rhs) noexcept;
+				explicit Add(const Address& lhs, const std::int64_t rhs) noexcept;
+				explicit Add(const Address& lhs, const std::int32_t rhs) noexcept;
+				explicit Add(const Address& lhs, const std::int16_t rhs) noexcept;
+				explicit Add(const Address& lhs, const std::int8_t rhs) noexcept;
+				explicit Add(const Address& lhs, const std::uint64_t rhs) noexcept;
+				explicit Add(const Address& lhs, const std::uint32_t rhs) noexcept;
+				explicit Add(const Address& lhs, const std::uint16_t rhs) noexcept;
+				explicit Add(const Address& lhs, const std::uint8_t rhs) noexcept;
 
 
-				inline virtual const Type GetASMType(void) const noexcept override { return Type::ADD; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			protected:
@@ -1423,7 +1699,7 @@ namespace mcf
 				std::string _rhs;
 			};
 
-			class Sub : public Interface
+			class Sub : public TypedInterface<Type::SUB>
 			{
 			public:
 				using Pointer = std::unique_ptr<Sub>;
@@ -1433,11 +1709,10 @@ namespace mcf
 
 			public:
 				explicit Sub(void) noexcept = default;
-				explicit Sub(const Register minuend, const __int64 subtrahend) noexcept;
-				explicit Sub(const Register minuend, const unsigned __int64 subtrahend) noexcept;
+				explicit Sub(const Register minuend, const std::int64_t subtrahend) noexcept;
+				explicit Sub(const Register minuend, const std::uint64_t subtrahend) noexcept;
 
 
-				inline virtual const Type GetASMType(void) const noexcept override { return Type::SUB; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			protected:
@@ -1445,7 +1720,7 @@ namespace mcf
 				std::string _subtrahend;
 			};
 
-			class Xor : public Interface
+			class Xor : public TypedInterface<Type::XOR>
 			{
 			public:
 				using Pointer = std::unique_ptr<Xor>;
@@ -1457,7 +1732,6 @@ namespace mcf
 				explicit Xor(void) noexcept = default;
 				explicit Xor(const Register& lhs, const Register rhs) noexcept;
 
-				inline virtual const Type GetASMType(void) const noexcept override { return Type::XOR; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			protected:
@@ -1465,7 +1739,7 @@ namespace mcf
 				std::string _rhs;
 			};
 
-			class Call : public Interface
+			class Call : public TypedInterface<Type::CALL>
 			{
 			public:
 				using Pointer = std::unique_ptr<Call>;
@@ -1478,14 +1752,13 @@ namespace mcf
 				explicit Call(const std::string& procName) noexcept;
 
 
-				inline virtual const Type GetASMType(void) const noexcept override { return Type::CALL; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			protected:
 				std::string _procName;
 			};
 
-			class Label : public Interface
+			class Label : public TypedInterface<Type::LABEL>
 			{
 			public:
 				using Pointer = std::unique_ptr<Label>;
@@ -1498,14 +1771,13 @@ namespace mcf
 				explicit Label(const std::string& labelName) noexcept;
 
 
-				inline virtual const Type GetASMType(void) const noexcept override { return Type::LABEL; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			protected:
 				std::string _labelName;
 			};
 
-			class Cmp : public Interface
+			class Cmp : public TypedInterface<Type::CMP>
 			{
 			public:
 				using Pointer = std::unique_ptr<Cmp>;
@@ -1516,13 +1788,12 @@ namespace mcf
 			public:
 				explicit Cmp(void) noexcept = default;
 				explicit Cmp(const mcf::IR::ASM::Register leftRegister, const mcf::IR::ASM::Register rightRegister) noexcept;
-				explicit Cmp(const mcf::IR::ASM::Register leftRegister, const __int8 rightValue) noexcept;
-				explicit Cmp(const mcf::IR::ASM::Register leftRegister, const __int16 rightValue) noexcept;
-				explicit Cmp(const mcf::IR::ASM::Register leftRegister, const __int32 rightValue) noexcept;
-				explicit Cmp(const mcf::IR::ASM::Register leftRegister, const __int64 rightValue) noexcept;
+				explicit Cmp(const mcf::IR::ASM::Register leftRegister, const std::int8_t rightValue) noexcept;
+				explicit Cmp(const mcf::IR::ASM::Register leftRegister, const std::int16_t rightValue) noexcept;
+				explicit Cmp(const mcf::IR::ASM::Register leftRegister, const std::int32_t rightValue) noexcept;
+				explicit Cmp(const mcf::IR::ASM::Register leftRegister, const std::int64_t rightValue) noexcept;
 
 
-				inline virtual const Type GetASMType(void) const noexcept override { return Type::LABEL; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			protected:
@@ -1530,7 +1801,7 @@ namespace mcf
 				std::string _rhs;
 			};
 
-			class Jmp : public Interface
+			class Jmp : public TypedInterface<Type::JMP>
 			{
 			public:
 				using Pointer = std::unique_ptr<Jmp>;
@@ -1543,14 +1814,13 @@ namespace mcf
 				explicit Jmp(const std::string& label) noexcept;
 
 
-				inline virtual const Type GetASMType(void) const noexcept override { return Type::JMP; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			protected:
 				std::string _label;
 			};
 
-			class Je : public Interface
+			class Je : public TypedInterface<Type::JE>
 			{
 			public:
 				using Pointer = std::unique_ptr<Je>;
@@ -1563,14 +1833,13 @@ namespace mcf
 				explicit Je(const std::string& label) noexcept;
 
 
-				inline virtual const Type GetASMType(void) const noexcept override { return Type::JE; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			protected:
 				std::string _label;
 			};
 
-			class Jl : public Interface
+			class Jl : public TypedInterface<Type::JL>
 			{
 			public:
 				using Pointer = std::unique_ptr<Jl>;
@@ -1583,15 +1852,25 @@ namespace mcf
 				explicit Jl(const std::string& label) noexcept;
 
 
-				inline virtual const Type GetASMType(void) const noexcept override { return Type::JL; }
 				virtual const std::string Inspect(void) const noexcept override final;
 
 			protected:
 				std::string _label;
 			};
+
+			// 클래스 순서는 Type 과 같아야 합니다.
+			using NodeList = mcf::NodeList<Type, Invalid, Ret, ProcBegin, ProcEnd, Push, Pop, Mov, Lea, Add, Sub, Xor, Call, Label, Cmp, Jmp, Je, Jl>;
+			static_assert(NodeList::IS_MATCHING() == true, "asm ir node list not matching!");
+
+			// code 의 구체 클래스를 받는 visitor 의 오버로드를 호출합니다. 자세한 내용은 mcf::NodeList::Visit 를 참고 해 주세요.
+			template <class NodePointer, class Visitor>
+			inline decltype(auto) VISIT(NodePointer code, Visitor&& visitor) noexcept
+			{
+				return NodeList::Visit(code->GetASMType(), code, std::forward<Visitor>(visitor));
+			}
 		}
 
-		class IncludeLib final : public Interface
+		class IncludeLib final : public TypedInterface<Type::INCLUDELIB>
 		{
 		public:
 			using Pointer = std::unique_ptr<IncludeLib>;
@@ -1603,14 +1882,13 @@ namespace mcf
 			explicit IncludeLib(void) noexcept = default;
 			explicit IncludeLib(const std::string& libPath) noexcept;
 
-			inline virtual const Type GetType(void) const noexcept override final { return Type::INCLUDELIB; }
 			virtual const std::string Inspect(void) const noexcept override final;
 
 		private:
 			std::string _libPath;
 		};
 
-		class Typedef final : public Interface
+		class Typedef final : public TypedInterface<Type::TYPEDEF>
 		{
 		public:
 			using Pointer = std::unique_ptr<Typedef>;
@@ -1625,7 +1903,6 @@ namespace mcf
 			const mcf::Object::TypeInfo& GetDefinedType(void) const noexcept { return _definedType; }
 			const mcf::Object::TypeInfo& GetSourceType(void) const noexcept { return _sourceType; }
 
-			inline virtual const Type GetType(void) const noexcept override final { return Type::TYPEDEF; }
 			virtual const std::string Inspect(void) const noexcept override final;
 
 		private:
@@ -1633,7 +1910,7 @@ namespace mcf
 			mcf::Object::TypeInfo _sourceType;
 		};
 
-		class Extern final : public Interface
+		class Extern final : public TypedInterface<Type::EXTERN>
 		{
 		public:
 			using Pointer = std::unique_ptr<Extern>;
@@ -1645,7 +1922,6 @@ namespace mcf
 			explicit Extern(void) noexcept = default;
 			explicit Extern(const std::string& name, const std::vector<mcf::Object::Variable>& params) noexcept;
 
-			inline virtual const Type GetType(void) const noexcept override final { return Type::EXTERN; }
 			virtual const std::string Inspect(void) const noexcept override final;
 
 		private:
@@ -1653,7 +1929,7 @@ namespace mcf
 			std::vector<mcf::Object::Variable> _params;
 		};
 
-		class Let final : public Interface
+		class Let final : public TypedInterface<Type::LET>
 		{
 		public:
 			using Pointer = std::unique_ptr<Let>;
@@ -1668,7 +1944,6 @@ namespace mcf
 			inline const mcf::Object::VariableInfo GetInfo(void) const noexcept { return _info; }
 			inline const mcf::IR::Expression::Interface* GetUnsafeAssignExpressionPointer(void) const noexcept { return _assignExpression.get(); }
 
-			inline virtual const Type GetType(void) const noexcept override final { return Type::LET; }
 			virtual const std::string Inspect(void) const noexcept override final;
 
 		private:
@@ -1676,7 +1951,7 @@ namespace mcf
 			mcf::IR::Expression::Pointer _assignExpression;
 		};
 
-		class Func final : public Interface
+		class Func final : public TypedInterface<Type::FUNC>
 		{
 		public:
 			using Pointer = std::unique_ptr<Func>;
@@ -1688,22 +1963,20 @@ namespace mcf
 			explicit Func(void) noexcept = default;
 			explicit Func(mcf::IR::ASM::PointerVector&& defines) noexcept;
 
-			inline virtual const Type GetType(void) const noexcept override final { return Type::FUNC; }
 			virtual const std::string Inspect(void) const noexcept override final;
 
 		private:
 			mcf::IR::ASM::PointerVector _defines;
 		};
 
-		class Unused final : public Interface
+		class Unused final : public TypedInterface<Type::UNUSEDIR>
 		{
 		public:
 			inline static Pointer Make(void) noexcept { return std::make_unique<Unused>(); }
-			inline virtual const Type GetType(void) const noexcept override final { return Type::UNUSEDIR; }
 			inline virtual const std::string Inspect(void) const noexcept override final { return std::string(); }
 		};
 
-		class Return final : public Interface
+		class Return final : public TypedInterface<Type::RETURN>
 		{
 		public:
 			using Pointer = std::unique_ptr<Return>;
@@ -1717,14 +1990,13 @@ namespace mcf
 
 			inline const mcf::IR::Expression::Interface* GetUnsafeReturnExpressionPointer(void) const noexcept { return _returnExpression.get(); }
 
-			inline virtual const Type GetType(void) const noexcept override final { return Type::RETURN; }
 			virtual const std::string Inspect(void) const noexcept override final;
 
 		private:
 			mcf::IR::Expression::Pointer _returnExpression;
 		};
 
-		class While final : public Interface
+		class While final : public TypedInterface<Type::WHILE>
 		{
 		public:
 			using Pointer = std::unique_ptr<While>;
@@ -1740,7 +2012,6 @@ namespace mcf
 			inline const mcf::IR::PointerVector* GetBlockPointer(void) const noexcept { return &_block; }
 			inline const mcf::Object::Scope* GetBlockScope(void) const noexcept { return _blockScope; }
 
-			inline virtual const Type GetType(void) const noexcept override final { return Type::WHILE; }
 			virtual const std::string Inspect(void) const noexcept override final;
 
 		private:
@@ -1749,7 +2020,7 @@ namespace mcf
 			const mcf::Object::Scope* const _blockScope;
 		};
 
-		class Break final : public Interface
+		class Break final : public TypedInterface<Type::BREAK>
 		{
 		public:
 			using Pointer = std::unique_ptr<Break>;
@@ -1760,11 +2031,10 @@ namespace mcf
 		public:
 			explicit Break(void) noexcept = default;
 
-			inline virtual const Type GetType(void) const noexcept override final { return Type::BREAK; }
 			virtual const std::string Inspect(void) const noexcept override final;
 		};
 
-		class Program final : public Interface
+		class Program final : public TypedInterface<Type::PROGRAM>
 		{
 		public:
 			using Pointer = std::unique_ptr<Program>;
@@ -1786,11 +2056,21 @@ namespace mcf
 				return _objects[index].get();
 			}
 
-			inline virtual const Type GetType(void) const noexcept override final { return Type::PROGRAM; }
 			virtual const std::string Inspect(void) const noexcept override final;
 
 		private:
 			PointerVector _objects;
 		};
+
+		// 클래스 순서는 Type 과 같아야 합니다.
+		using NodeList = mcf::NodeList<Type, Invalid, Expression::Interface, ASM::Interface, IncludeLib, Typedef, Extern, Let, Func, Unused, Return, While, Break, Program>;
+		static_assert(NodeList::IS_MATCHING() == true, "ir node list not matching!");
+
+		// object 의 구체 클래스를 받는 visitor 의 오버로드를 호출합니다. 자세한 내용은 mcf::NodeList::Visit 를 참고 해 주세요.
+		template <class NodePointer, class Visitor>
+		inline decltype(auto) VISIT(NodePointer object, Visitor&& visitor) noexcept
+		{
+			return NodeList::Visit(object->GetType(), object, std::forward<Visitor>(visitor));
+		}
 	}
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 ﻿#pragma once
+#include <memory>
 #include <stack>
 #include <string>
+#include <unordered_map>
 #include <lexer.h>
 #include <ast.h>
 
@@ -50,22 +52,84 @@ namespace mcf
 			mcf::Parser::ErrorID ID;
 			std::string Name;
 			std::string Message;
-			size_t Line;
-			size_t Index;
+			std::uint32_t Offset;	// 에러가 난 토큰의 소스 버퍼 기준 시작 위치입니다.
+			size_t Line = 0;			// PopLastError 에서 Offset 으로 계산합니다.
+			size_t Index = 0;
 		};
 
+		constexpr const size_t DEFAULT_PARALLEL_CHUNK_TOKEN_COUNT = 64 * 1024;
+
+		class Session;
+
 		class Object final
 		{
 		public:
 			explicit Object(void) noexcept = delete;
+			explicit Object(const Object& other) noexcept = delete;
+			Object& operator=(const Object& other) noexcept = delete;
 			explicit Object(const std::string& input, const bool isFile) noexcept;
+			// 식별자를 symbols 에 등록합니다. 평가할 ScopeTree::Symbols 를 넘기면 평가 단계에서 문자열을 다시 해시하지 않습니다.
+			explicit Object(const std::string& input, const bool isFile, const std::shared_ptr<mcf::Symbol::Table>& symbols) noexcept;
+			// 이미 읽은 소스 버퍼를 파싱합니다. name 은 에러에 표시할 이름입니다.
+			explicit Object(const std::string& name, const mcf::Lexer::Source& source, const std::shared_ptr<mcf::Symbol::Table>& symbols) noexcept;
 
 			inline const size_t GetErrorCount(void) const noexcept { return _errors.size(); }
 			const ErrorInfo PopLastError(void) noexcept;
 
+			// true 이면 함수의 시그니처만 파싱하고 본문은 토큰 범위만 기록합니다. 본문은 AST::Program::MaterializeFunctionBody 로 처음 필요할 때 파싱됩니다.
+			// 건너뛴 본문의 파싱 에러는 GetErrorCount 에 포함되지 않고 MaterializeFunctionBody 가 false 를 반환하는 것으로만 알 수 있습니다.
+			inline void SetLazyFunctionBody(const bool isLazyFunctionBody) noexcept { _isLazyFunctionBody = isLazyFunctionBody; }
+
 			void ParseProgram(mcf::AST::Program& outProgram) noexcept;
+			// ParseProgram 과 같은 프로그램을 만들되 괄호를 맞추는 사전 탐색으로 최상위 문장의 경계를 찾고, 문장들을 묶어 여러 스레드에서 파싱한 뒤 소스 순서대로 합칩니다.
+			// 경계를 찾지 못하거나 파싱 에러가 있으면 순차적으로 다시 파싱하여 ParseProgram 과 같은 에러를 남깁니다. ParseProgram 대신 한번만 호출해야 합니다.
+			// threadCount 가 0 이면 하드웨어 스레드 수를, chunkTokenCount 가 0 이면 DEFAULT_PARALLEL_CHUNK_TOKEN_COUNT 를 사용합니다.
+			void ParseProgramParallel(mcf::AST::Program& outProgram, const size_t threadCount, const size_t chunkTokenCount) noexcept;
 
 		private:
+			friend Session;
+			class LazyBodyParser;
+
+			using PrefixParseFunction = mcf::AST::Expression::Pointer (Object::*)(void) noexcept;
+			using InfixParseFunction = mcf::AST::Expression::Pointer (Object::*)(mcf::AST::Expression::Pointer&& left) noexcept;
+			// 프랫 파서의 토큰 타입별 규칙입니다. 전위/중위 함수가 nullptr 이면 해당 위치에 올 수 없는 토큰입니다.
+			struct ExpressionRule final
+			{
+				mcf::Token::Type TokenType;				// EXPRESSION_RULES 의 인덱스와 같아야 합니다.
+				mcf::Parser::Precedence InfixPrecedence;	// 중위 연산자로 쓰일 때의 우선순위입니다.
+				PrefixParseFunction Prefix;
+				InfixParseFunction Infix;
+			};
+			// mcf::Token::Type 의 값으로 인덱싱합니다. parser.cpp 에 constexpr 로 정의됩니다.
+			static const ExpressionRule EXPRESSION_RULES[];
+
+			struct ExpressionFrame;
+			// 기다리던 하위 식(operand)을 받아 프레임의 식을 이어서 파싱합니다. 식이 끝나면 outExpression 에 결과(실패시 nullptr)를 넣고 true 를,
+			// 하위 식이 더 필요하면 다음 하위 식의 첫 토큰을 현재 토큰으로 만들고 false 를 반환합니다.
+			using ResumeParseFunction = const bool (Object::*)(ExpressionFrame& frame, mcf::AST::Expression::Pointer operand, _Out_ mcf::AST::Expression::Pointer& outExpression) noexcept;
+			// 하위 식을 기다리는 식의 파싱 상태입니다. ParseExpression 은 재귀 호출 대신 이 프레임을 _expressionFrames 에 쌓으므로
+			// 연산자 체인의 길이나 괄호/초기화 리스트의 중첩 깊이와 상관없이 일정한 네이티브 스택만 사용합니다.
+			struct ExpressionFrame final
+			{
+				ResumeParseFunction Resume;
+				mcf::Parser::Precedence OuterPrecedence;	// 프레임을 만든 식의 우선순위입니다. 프레임이 끝나면 이 우선순위로 중위 연산자를 이어서 파싱합니다.
+				mcf::Parser::Precedence OperandPrecedence;	// 기다리는 하위 식을 파싱할 우선순위입니다.
+				mcf::Token::Data Token;
+				mcf::AST::Expression::Pointer Left;
+				mcf::AST::Expression::PointerVector Keys;	// Call 의 인자 또는 Initializer 의 키 목록입니다.
+				mcf::AST::Expression::PointerVector Values;	// MapInitializer 의 값 목록입니다.
+			};
+
+			// parent 의 토큰 버퍼에서 [beginTokenIndex, endTokenIndex) 범위만 읽는 파서를 만듭니다. 범위의 끝은 END_OF_FILE 로 읽힙니다.
+			explicit Object(const Object& parent, const size_t beginTokenIndex, const size_t endTokenIndex) noexcept;
+			// tokens 의 [beginTokenIndex, endTokenIndex) 범위만 읽는 파서를 만듭니다. tokens 는 파서보다 오래 살아있어야 합니다.
+			explicit Object(const std::string& name, const mcf::Lexer::Source& source, const std::shared_ptr<mcf::Symbol::Table>& symbols,
+				_Notnull_ const mcf::Lexer::TokenBuffer* tokens, const size_t beginTokenIndex, const size_t endTokenIndex) noexcept;
+
+			// END_OF_FILE 까지 문장을 파싱합니다. 실패하면 에러를 남기고 false 를 반환합니다.
+			const bool ParseStatements(_Out_ mcf::AST::Statement::PointerVector& outStatements) noexcept;
+			// 파싱한 문장과 _arena 로 프로그램을 만듭니다. 지연 파싱한 본문이 있으면 토큰 버퍼의 소유권도 프로그램으로 넘깁니다.
+			void MoveToProgram(_Out_ mcf::AST::Program& outProgram, mcf::AST::Statement::PointerVector&& statements) noexcept;
 			mcf::AST::Statement::Pointer ParseStatement(void) noexcept;
 			mcf::AST::Statement::Pointer ParseIncludeLibraryStatement(void) noexcept;
 			mcf::AST::Statement::Pointer ParseTypedefStatement(void) noexcept;
@@ -87,14 +151,31 @@ namespace mcf
 			mcf::AST::Intermediate::FunctionSignature::Pointer ParseFunctionSignatureIntermediate(void) noexcept;
 
 			mcf::AST::Expression::Pointer ParseExpression(const Precedence precedence) noexcept;
-			mcf::AST::Expression::Prefix::Pointer ParsePrefixExpression(void) noexcept;
-			mcf::AST::Expression::Group::Pointer ParseGroupExpression(void) noexcept;
-			mcf::AST::Expression::Infix::Pointer ParseInfixExpression(mcf::AST::Expression::Pointer&& left) noexcept;
-			mcf::AST::Expression::Call::Pointer ParseCallExpression(mcf::AST::Expression::Pointer&& left) noexcept;
-			mcf::AST::Expression::Index::Pointer ParseIndexExpression(mcf::AST::Expression::Pointer&& left) noexcept;
-			mcf::AST::Expression::As::Pointer ParseAsExpression(mcf::AST::Expression::Pointer&& left) noexcept;
-			mcf::AST::Expression::Initializer::Pointer ParseInitializerExpression(void) noexcept;
-			mcf::AST::Expression::MapInitializer::Pointer ParseMapInitializerExpression(mcf::AST::Expression::PointerVector&& keyList) noexcept;
+			// 아래의 전위/중위 파싱 함수들은 EXPRESSION_RULES 에 들어가므로 반환 타입을 mcf::AST::Expression::Pointer 로 맞춥니다.
+			// 하위 식이 필요한 함수는 PushExpressionFrame 으로 프레임을 쌓고 nullptr 를 반환하며, 하위 식은 ParseExpression 이 파싱하여 프레임의 Resume 에 넘깁니다.
+			mcf::AST::Expression::Pointer ParseIdentifierExpression(void) noexcept;
+			mcf::AST::Expression::Pointer ParseIntegerExpression(void) noexcept;
+			mcf::AST::Expression::Pointer ParseStringExpression(void) noexcept;
+			mcf::AST::Expression::Pointer ParseUnsignedExpression(void) noexcept;
+			mcf::AST::Expression::Pointer ParsePrefixExpression(void) noexcept;
+			mcf::AST::Expression::Pointer ParseGroupExpression(void) noexcept;
+			mcf::AST::Expression::Pointer ParseInfixExpression(mcf::AST::Expression::Pointer&& left) noexcept;
+			mcf::AST::Expression::Pointer ParseCallExpression(mcf::AST::Expression::Pointer&& left) noexcept;
+			mcf::AST::Expression::Pointer ParseIndexExpression(mcf::AST::Expression::Pointer&& left) noexcept;
+			mcf::AST::Expression::Pointer ParseAsExpression(mcf::AST::Expression::Pointer&& left) noexcept;
+			mcf::AST::Expression::Pointer ParseInitializerExpression(void) noexcept;
+
+			void PushExpressionFrame(const ResumeParseFunction resume, const mcf::Parser::Precedence operandPrecedence, const mcf::Token::Data& token, mcf::AST::Expression::Pointer left) noexcept;
+			// 식 파싱 밖에서 프레임을 쌓는 파싱 함수를 호출한 경우, frameCount 개가 남을 때까지 하위 식을 파싱하여 프레임을 끝냅니다.
+			mcf::AST::Expression::Pointer CompleteExpressionFrames(mcf::AST::Expression::Pointer expression, const size_t frameCount) noexcept;
+			const bool ResumePrefixExpression(ExpressionFrame& frame, mcf::AST::Expression::Pointer operand, _Out_ mcf::AST::Expression::Pointer& outExpression) noexcept;
+			const bool ResumeGroupExpression(ExpressionFrame& frame, mcf::AST::Expression::Pointer operand, _Out_ mcf::AST::Expression::Pointer& outExpression) noexcept;
+			const bool ResumeInfixExpression(ExpressionFrame& frame, mcf::AST::Expression::Pointer operand, _Out_ mcf::AST::Expression::Pointer& outExpression) noexcept;
+			const bool ResumeCallExpression(ExpressionFrame& frame, mcf::AST::Expression::Pointer operand, _Out_ mcf::AST::Expression::Pointer& outExpression) noexcept;
+			const bool ResumeIndexExpression(ExpressionFrame& frame, mcf::AST::Expression::Pointer operand, _Out_ mcf::AST::Expression::Pointer& outExpression) noexcept;
+			const bool ResumeInitializerExpression(ExpressionFrame& frame, mcf::AST::Expression::Pointer operand, _Out_ mcf::AST::Expression::Pointer& outExpression) noexcept;
+			const bool ResumeMapInitializerKeyExpression(ExpressionFrame& frame, mcf::AST::Expression::Pointer operand, _Out_ mcf::AST::Expression::Pointer& outExpression) noexcept;
+			const bool ResumeMapInitializerValueExpression(ExpressionFrame& frame, mcf::AST::Expression::Pointer operand, _Out_ mcf::AST::Expression::Pointer& outExpression) noexcept;
 
 			inline void ReadNextToken(void) noexcept;
 			inline const bool ReadNextTokenIf(const mcf::Token::Type tokenType) noexcept;
@@ -111,8 +192,66 @@ namespace mcf
 		private:
 			std::stack<ErrorInfo> _errors;
 			mcf::Lexer::Object _lexer;
+			std::shared_ptr<mcf::Symbol::Table> _symbols;
+			// ParseProgram 에서 만든 노드가 할당되며 파싱이 끝나면 프로그램으로 소유권이 넘어갑니다.
+			std::unique_ptr<mcf::AST::Arena> _arena;
+			mcf::Lexer::TokenBuffer _tokens;
+			const mcf::Lexer::TokenBuffer* _tokenSource = nullptr; // 읽을 토큰 버퍼입니다. 범위 파서는 부모의 _tokens 를 가리킵니다.
+			size_t _tokenEnd = 0; // 이 인덱스부터는 토큰 버퍼 대신 _endToken 을 읽습니다.
+			mcf::Token::Data _endToken;
+			size_t _nextTokenIndex = 0; // _nextToken 다음에 읽을 토큰 버퍼의 인덱스입니다.
 			mcf::Token::Data _currentToken;
 			mcf::Token::Data _nextToken;
+			std::vector<ExpressionFrame> _expressionFrames; // ParseExpression 이 재귀 호출 대신 사용하는 명시적 스택입니다. 호출 사이에 용량을 재사용합니다.
+			bool _isLazyFunctionBody = false;
 		};
+
+		// 같은 스크립트를 여러번 파싱할 때 최상위 문장의 AST 를 문장을 이루는 토큰(종류와 문자열)의 해시로 캐시합니다.
+		// 다시 파싱하면 해시와 문장의 소스 문자열이 모두 같은 문장은 이전 AST 를 재사용하고 수정되었거나 새로 생긴 문장만 파싱합니다. 앞쪽의 수정으로 위치만 바뀐 문장은
+		// 다시 파싱하지 않고 토큰 Offset 을 옮겨 복사하므로, 재사용한 문장의 토큰 Offset 도 새 입력 기준입니다.
+		// 만든 프로그램은 노드가 할당된 아레나와 소스 버퍼를 세션과 공유하여 소유하므로 다음 Parse 나 세션의 소멸과 관계없이 유효합니다. 함수 본문은 지연 파싱하지 않습니다.
+		// 주의: thread-safe 하지 않은 클래스입니다.
+		class Session final
+		{
+		public:
+			explicit Session(void) noexcept;
+			explicit Session(const Session& other) noexcept = delete;
+			Session& operator=(const Session& other) noexcept = delete;
+			// 파싱하는 모든 입력은 symbols 에 식별자를 등록합니다. 재사용한 문장의 심볼 ID 가 유지되도록 세션 동안 같은 테이블을 사용합니다.
+			explicit Session(const std::shared_ptr<mcf::Symbol::Table>& symbols) noexcept;
+
+			// 에러가 있으면 outProgram 은 바뀌지 않고 캐시도 이전 상태로 남습니다. 에러는 ParseProgram 과 같습니다.
+			void Parse(const std::string& input, const bool isFile, _Out_ mcf::AST::Program& outProgram) noexcept;
+
+			// 마지막 Parse 에서 재사용한 문장과 새로 파싱한 문장의 갯수입니다.
+			inline const size_t GetReusedStatementCount(void) const noexcept { return _reusedStatementCount; }
+			inline const size_t GetReparsedStatementCount(void) const noexcept { return _reparsedStatementCount; }
+
+			// 마지막 Parse 의 에러입니다.
+			const size_t GetErrorCount(void) const noexcept;
+			const ErrorInfo PopLastError(void) noexcept;
+
+		private:
+			struct CachedStatement final
+			{
+				mcf::AST::Statement::Pointer Statement;
+				std::shared_ptr<mcf::AST::Arena> Arena;	// Statement 가 할당된 아레나입니다.
+				mcf::Lexer::Source Source;					// Statement 의 토큰 문자열이 가리키는 소스 버퍼입니다.
+				std::uint32_t Offset;					// Statement 의 첫 토큰의 Offset 입니다.
+				std::string_view Text;						// Statement 의 첫 토큰부터 마지막 토큰까지의 소스 문자열로, Source 의 버퍼를 가리킵니다.
+			};
+
+		private:
+			std::shared_ptr<mcf::Symbol::Table> _symbols;
+			std::unique_ptr<mcf::Parser::Object> _parser;
+			std::unordered_map<std::uint64_t, CachedStatement> _cache;
+			size_t _reusedStatementCount = 0;
+			size_t _reparsedStatementCount = 0;
+		};
+
+		// path 의 파일을 평면 AST 로 만듭니다. cacheDirectory 에 내용이 같은 소스로 만든 캐시 파일이 있으면 렉서와 파서를 사용하지 않고 캐시를 읽고,
+		// 없으면 파싱한 뒤 캐시 파일을 씁니다. 파일을 읽을 수 없거나 파싱 에러가 있으면 false 를 반환하며, 에러 내용은 Object 로 다시 파싱하여 확인해야 합니다.
+		const bool ParseFileWithCache(_Out_ mcf::AST::Flat::Program& outProgram, const std::string& path, const std::string& cacheDirectory, const std::shared_ptr<mcf::Symbol::Table>& symbols,
+			_Out_opt_ bool* optionalOutIsCacheHit) noexcept;
 	}
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include <cstdint>
 #include <iostream>
 
 #define WIN32_LEAN_AND_MEAN             // Exclude rarely-used stuff from Windows headers
@@ -65,21 +66,21 @@ namespace mcf
 
 			snprintf(message.data(), messageLength + 1, format, args...);
 
+			// 만든 메시지는 파서의 에러 스택으로 호출자에게 전달되므로 디버그 빌드에서도 출력만 하고 멈추지 않습니다.
 #if defined(_DEBUG)
 			std::cout << message << std::endl;
-			__debugbreak();
 #endif
 			return message;
 		}
 
 		namespace UInt64
 		{
-			inline static unsigned __int64 Pow(unsigned __int8 base, unsigned __int8 exponent)
+			inline static std::uint64_t Pow(std::uint8_t base, std::uint8_t exponent)
 			{
-				unsigned __int64 result = 1;
-				for (unsigned __int8 i = 0; i < exponent; i++)
+				std::uint64_t result = 1;
+				for (std::uint8_t i = 0; i < exponent; i++)
 				{
-					result *= static_cast<unsigned __int64>(base);
+					result *= static_cast<std::uint64_t>(base);
 				}
 				return result;
 			}
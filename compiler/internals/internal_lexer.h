@@ -0,0 +1,23 @@
+﻿#pragma once
+#include "framework.h"
+#include "lexer.h"
+
+namespace mcf
+{
+	namespace Lexer
+	{
+		namespace Internal
+		{
+			// [begin, end) 범위에서 공백(' ', '\t', '\r', '\n')이 아닌 첫 위치를 찾습니다. 찾지 못하면 end 를 반환합니다.
+			const size_t SkipWhitespace(_Notnull_ const char* const input, const size_t begin, const size_t end) noexcept;
+			// [begin, end) 범위에서 first, second, third 중 하나가 처음 나오는 위치를 찾습니다. 찾지 못하면 end 를 반환합니다.
+			const size_t FindAnyOf(_Notnull_ const char* const input, const size_t begin, const size_t end, const char first, const char second, const char third) noexcept;
+			// [begin, end) 범위에서 한줄 주석이 끝나는 위치('\r', '\n' 또는 '\0')를 찾습니다. 찾지 못하면 end 를 반환합니다.
+			const size_t FindLineEnd(_Notnull_ const char* const input, const size_t begin, const size_t end) noexcept;
+			// [begin, end) 범위에서 "*/" 가 시작하는 위치 또는 '\0' 의 위치를 찾습니다. 찾지 못하면 end 를 반환합니다.
+			const size_t FindBlockCommentEnd(_Notnull_ const char* const input, const size_t begin, const size_t end) noexcept;
+			// [begin, end) 범위에 있는 모든 '\n' 의 위치를 outPositions 뒤에 추가합니다. end 는 32비트를 넘을 수 없습니다.
+			void FindNewLines(_Notnull_ const char* const input, const size_t begin, const size_t end, std::vector<std::uint32_t>& outPositions) noexcept;
+		}
+	}
+}
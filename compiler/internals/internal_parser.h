@@ -5,12 +5,18 @@
 inline void mcf::Parser::Object::ReadNextToken(void) noexcept
 {
 	_currentToken = _nextToken;
-	_nextToken = _lexer.ReadNextToken();
-	// 읽은 토큰이 주석이라면 주석이 아닐때까지 읽는다.
-	while (_nextToken.Type == Token::Type::COMMENT || _nextToken.Type == Token::Type::COMMENT_BLOCK)
+
+	// 범위의 끝(전체 파서는 마지막 END_OF_FILE 토큰)에 도달하면 계속 _endToken 을 읽는다.
+	if (_nextTokenIndex >= _tokenEnd)
 	{
-		_nextToken = _lexer.ReadNextToken();
+		_nextToken = _endToken;
+		return;
 	}
+
+	// 토큰 버퍼는 주석을 건너뛰는 렉서로 만들어지므로 주석 토큰이 없습니다.
+	MCF_DEBUG_ASSERT(_tokenSource->GetType(_nextTokenIndex) != Token::Type::COMMENT && _tokenSource->GetType(_nextTokenIndex) != Token::Type::COMMENT_BLOCK, u8"토큰 버퍼에 주석 토큰이 있으면 안됩니다.");
+	_nextToken = _tokenSource->GetToken(_nextTokenIndex);
+	++_nextTokenIndex;
 }
 
 inline const bool mcf::Parser::Object::ReadNextTokenIf(const mcf::Token::Type tokenType) noexcept
@@ -50,81 +56,7 @@ inline const bool mcf::Parser::Object::IsCurrentTokenAny(std::initializer_list<m
 
 inline const mcf::Parser::Precedence mcf::Parser::Object::GetTokenPrecedence(const mcf::Token::Data& token) noexcept
 {
-	constexpr const size_t PRECEDENCE_COUNT_BEGIN = __COUNTER__;
-	switch (token.Type)
-	{
-	case Token::Type::PLUS: __COUNTER__; [[fallthrough]];
-	case Token::Type::MINUS: __COUNTER__;
-		return Precedence::SUM;
-
-	case Token::Type::ASTERISK: __COUNTER__; [[fallthrough]];
-	case Token::Type::SLASH: __COUNTER__;
-		return Precedence::PRODUCT;
-
-	case Token::Type::EQUAL: __COUNTER__; [[fallthrough]];
-	case Token::Type::NOT_EQUAL: __COUNTER__;
-		return Precedence::EQUALS;
-
-	case Token::Type::LT: __COUNTER__; [[fallthrough]];
-	case Token::Type::GT: __COUNTER__;
-		return Precedence::LESSGREATER;
-
-	case Token::Type::LPAREN: __COUNTER__;
-		return Precedence::CALL;
-
-	case Token::Type::LBRACKET: __COUNTER__;
-		return Precedence::INDEX;
-
-	case Token::Type::KEYWORD_AS: __COUNTER__;
-		return Precedence::AS;
-
-	case Token::Type::END_OF_FILE: __COUNTER__; [[fallthrough]];
-	case Token::Type::ASSIGN: __COUNTER__; [[fallthrough]];
-	case Token::Type::RPAREN: __COUNTER__; [[fallthrough]];
-	case Token::Type::RBRACE: __COUNTER__; [[fallthrough]];
-	case Token::Type::RBRACKET: __COUNTER__; [[fallthrough]];
-	case Token::Type::SEMICOLON: __COUNTER__; [[fallthrough]];
-	case Token::Type::COMMA: __COUNTER__;
-		break;
-
-	case Token::Type::IDENTIFIER: __COUNTER__; [[fallthrough]];
-	case Token::Type::INTEGER: __COUNTER__; [[fallthrough]];
-	case Token::Type::STRING: __COUNTER__; [[fallthrough]];
-	case Token::Type::BANG: __COUNTER__; [[fallthrough]];
-	case Token::Type::AMPERSAND: __COUNTER__; [[fallthrough]];
-	case Token::Type::LBRACE: __COUNTER__; [[fallthrough]];
-	case Token::Type::COLON: __COUNTER__; [[fallthrough]];
-	case Token::Type::DOUBLE_COLON: __COUNTER__; [[fallthrough]];
-	case Token::Type::POINTING: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_IDENTIFIER_START: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_ASM: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_EXTERN: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_TYPEDEF: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_LET: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_FUNC: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_MAIN: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_VOID: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_UNSIGNED: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_RETURN: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_UNUSED: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_WHILE: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_BREAK: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_IDENTIFIER_END: __COUNTER__; [[fallthrough]];
-	case Token::Type::VARIADIC: __COUNTER__; [[fallthrough]];
-	case Token::Type::MACRO_START: __COUNTER__; [[fallthrough]];
-	case Token::Type::MACRO_INCLUDE: __COUNTER__; [[fallthrough]];
-	case Token::Type::MACRO_END: __COUNTER__; [[fallthrough]];
-	case Token::Type::COMMENT: __COUNTER__; [[fallthrough]];			// 주석은 파서에서 토큰을 읽으면 안됩니다.
-	case Token::Type::COMMENT_BLOCK: __COUNTER__; [[fallthrough]];	// 주석은 파서에서 토큰을 읽으면 안됩니다.
-	default:
-		MCF_DEBUG_BREAK(u8"예상치 못한 값이 들어왔습니다. 에러가 아닐 수도 있습니다. 확인 해 주세요. TokenType=%s(%zu) TokenLiteral=`%s`",
-			mcf::Token::CONVERT_TYPE_TO_STRING(token.Type), mcf::ENUM_INDEX(token.Type), token.Literal.c_str());
-		break;
-	}
-	constexpr const size_t PRECEDENCE_COUNT = __COUNTER__ - PRECEDENCE_COUNT_BEGIN;
-	static_assert(static_cast<size_t>(mcf::Token::Type::COUNT) == PRECEDENCE_COUNT, "get token precedence for infix.");
-
-	return Precedence::LOWEST;
+	return EXPRESSION_RULES[mcf::ENUM_INDEX(token.Type)].InfixPrecedence;
 }
 
 inline const mcf::Parser::Precedence mcf::Parser::Object::GetCurrentTokenPrecedence(void) noexcept
@@ -149,22 +81,24 @@ inline const bool mcf::Parser::Object::CheckErrorOnInit(void) noexcept
 
 	case mcf::Lexer::Error::INVALID_INPUT_LENGTH: __COUNTER__;
 	{
-		const std::string message = mcf::Internal::ErrorMessage(u8"input의 길이가 0입니다.");
-		_errors.push(ErrorInfo{ ErrorID::INVALID_INPUT_LENGTH, _lexer.GetName(), message, 0, 0 });
+		const std::string message = mcf::Internal::ErrorMessage(u8"input의 길이가 0이거나 4GB 이상입니다.");
+		_errors.push(ErrorInfo{ ErrorID::INVALID_INPUT_LENGTH, _lexer.GetName(), message, 0 });
 		break;
 	}
 
 	case mcf::Lexer::Error::FAIL_READ_FILE: __COUNTER__;
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"파일 읽기에 실패 하였습니다. file path=%s", _lexer.GetName().c_str());
-		_errors.push(ErrorInfo{ ErrorID::FAIL_READ_FILE, _lexer.GetName(), message, 0, 0 });
+		_errors.push(ErrorInfo{ ErrorID::FAIL_READ_FILE, _lexer.GetName(), message, 0 });
 		break;
 	}
 
+	// 편집(TokenBuffer::ApplyEdit)에서만 발생하는 에러이므로 렉서 초기화 시에는 들어올 수 없습니다.
+	case mcf::Lexer::Error::INVALID_EDIT_RANGE: __COUNTER__; [[fallthrough]];
 	default:
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"예상치 못한 값이 들어왔습니다. 확인 해 주세요. ErrorID=INVALID_LEXER_ERROR_TOKEN");
-		_errors.push(ErrorInfo{ ErrorID::INVALID_LEXER_ERROR_TOKEN, _lexer.GetName(), message, 0, 0 });
+		_errors.push(ErrorInfo{ ErrorID::INVALID_LEXER_ERROR_TOKEN, _lexer.GetName(), message, 0 });
 		break;
 	}
 	}
@@ -19,7 +19,8 @@
 #include <unordered_set>
 #include <vector>
 
-#include "common.h"
+// common.h 의 템플릿이 framework.h 의 매크로를 사용하므로 framework.h 를 먼저 포함합니다.
 #include "framework.h"
+#include "common.h"
 
 #endif //PCH_H
@@ -1,184 +1,233 @@
 ﻿#include "pch.h"
 #include "ast.h"
 
-mcf::AST::Expression::Prefix::Prefix(const mcf::Token::Data& prefixOperator, mcf::AST::Expression::Pointer&& right) noexcept
+#include <atomic>
+#include <chrono>
+#include <cstring>
+
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+void* mcf::AST::Arena::Allocate(const size_t size, const size_t alignment) noexcept
+{
+	MCF_DEBUG_ASSERT(alignment != 0 && (alignment & (alignment - 1)) == 0, u8"alignment는 2의 거듭제곱이어야 합니다. alignment=%zu", alignment);
+
+	size_t padding = (alignment - (reinterpret_cast<size_t>(_current) & (alignment - 1))) & (alignment - 1);
+	if (_current == nullptr || padding + size > _remainingSize)
+	{
+		// 블록의 시작은 operator new[] 가 보장하는 정렬을 따르므로 alignment 만큼 여유를 둡니다.
+		const size_t blockSize = (size + alignment > BLOCK_SIZE) ? size + alignment : BLOCK_SIZE;
+		_blocks.emplace_back(new unsigned char[blockSize]);
+		_current = _blocks.back().get();
+		_remainingSize = blockSize;
+		padding = (alignment - (reinterpret_cast<size_t>(_current) & (alignment - 1))) & (alignment - 1);
+	}
+
+	void* const result = _current + padding;
+	_current += padding + size;
+	_remainingSize -= padding + size;
+	_allocatedBytes += size;
+	return result;
+}
+
+void mcf::AST::Arena::Adopt(Arena&& other) noexcept
+{
+	// _current 는 이 아레나의 블록을 계속 가리키므로 넘겨 받은 블록의 남은 공간은 사용하지 않습니다.
+	_blocks.reserve(_blocks.size() + other._blocks.size());
+	for (std::unique_ptr<unsigned char[]>& block : other._blocks)
+	{
+		_blocks.emplace_back(std::move(block));
+	}
+	_allocatedBytes += other._allocatedBytes;
+
+	other._blocks.clear();
+	other._current = nullptr;
+	other._remainingSize = 0;
+	other._allocatedBytes = 0;
+}
+
+mcf::AST::Expression::Prefix::Prefix(const mcf::Token::Data& prefixOperator, mcf::AST::Expression::Pointer right) noexcept
 	: _prefixOperator(prefixOperator)
-	, _right(std::move(right))
+	, _right(right)
 {
-	MCF_DEBUG_ASSERT(_right.get() != nullptr, u8"인자로 받은 _right는 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_right != nullptr, u8"인자로 받은 _right는 nullptr 여선 안됩니다.");
 }
 
 const std::string mcf::AST::Expression::Prefix::ConvertToString(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(_right.get() != nullptr, u8"인자로 받은 _right는 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_right != nullptr, u8"인자로 받은 _right는 nullptr 여선 안됩니다.");
 	return std::string("<Prefix: ") + mcf::Token::CONVERT_TYPE_TO_STRING(_prefixOperator.Type) + " " + _right->ConvertToString() + ">";
 }
 
-mcf::AST::Expression::Group::Group(mcf::AST::Expression::Pointer && expression) noexcept
-	: _expression(std::move(expression))
+mcf::AST::Expression::Group::Group(mcf::AST::Expression::Pointer expression) noexcept
+	: _expression(expression)
 {
-	MCF_DEBUG_ASSERT( _expression.get() != nullptr, u8"인자로 받은 _expression는 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT( _expression != nullptr, u8"인자로 받은 _expression는 nullptr 여선 안됩니다.");
 }
 
 const std::string mcf::AST::Expression::Group::ConvertToString(void) const noexcept
 {
-	MCF_DEBUG_ASSERT( _expression.get() != nullptr, u8"인자로 받은 _expression는 nullptr 여선 안됩니다." );
+	MCF_DEBUG_ASSERT( _expression != nullptr, u8"인자로 받은 _expression는 nullptr 여선 안됩니다." );
 	return "<Group: " + _expression->ConvertToString() + ">";
 }
 
-mcf::AST::Expression::Infix::Infix(mcf::AST::Expression::Pointer&& left, const mcf::Token::Data& infixOperator, mcf::AST::Expression::Pointer&& right) noexcept
+mcf::AST::Expression::Infix::Infix(mcf::AST::Expression::Pointer left, const mcf::Token::Data& infixOperator, mcf::AST::Expression::Pointer right) noexcept
 	: _infixOperator(infixOperator)
-	, _left(std::move(left))
-	, _right(std::move(right))
+	, _left(left)
+	, _right(right)
 {
 	MCF_DEBUG_ASSERT(_infixOperator.Type != mcf::Token::Type::INVALID, u8"인자로 받은 _infixOperator의 타입은 INVALID여선 안됩니다.");
-	MCF_DEBUG_ASSERT(_left.get() != nullptr, u8"인자로 받은 _left는 nullptr 여선 안됩니다.");
-	MCF_DEBUG_ASSERT(_right.get() != nullptr, u8"인자로 받은 _right는 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_left != nullptr, u8"인자로 받은 _left는 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_right != nullptr, u8"인자로 받은 _right는 nullptr 여선 안됩니다.");
 }
 
 const std::string mcf::AST::Expression::Infix::ConvertToString(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(_left.get() != nullptr, u8"인자로 받은 _left는 nullptr 여선 안됩니다.");
-	MCF_DEBUG_ASSERT(_right.get() != nullptr, u8"인자로 받은 _right는 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_left != nullptr, u8"인자로 받은 _left는 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_right != nullptr, u8"인자로 받은 _right는 nullptr 여선 안됩니다.");
 	return "<Infix: " + _left->ConvertToString() + " " + mcf::Token::CONVERT_TYPE_TO_STRING(_infixOperator.Type) + " " + _right->ConvertToString() + ">";
 }
 
-mcf::AST::Expression::Call::Call(mcf::AST::Expression::Pointer&& left, mcf::AST::Expression::PointerVector&& params) noexcept
-	: _left(std::move(left))
-	, _params(std::move(params))
+mcf::AST::Expression::Call::Call(mcf::AST::Expression::Pointer left, mcf::AST::Expression::PointerArray params) noexcept
+	: _left(left)
+	, _params(params)
 {
-	MCF_DEBUG_ASSERT(_left.get() != nullptr, u8"인자로 받은 _left는 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_left != nullptr, u8"인자로 받은 _left는 nullptr 여선 안됩니다.");
 #if defined(_DEBUG)
-	const size_t paramsCount = _params.size();
+	const size_t paramsCount = _params.GetSize();
 	for (size_t i = 0; i < paramsCount; i++)
 	{
-		MCF_DEBUG_ASSERT(_params[i].get() != nullptr, u8"_keyList[%zu].key는 nullptr 여선 안됩니다.", i);
+		MCF_DEBUG_ASSERT(_params[i] != nullptr, u8"_keyList[%zu].key는 nullptr 여선 안됩니다.", i);
 	}
 #endif
 }
 
 const std::string mcf::AST::Expression::Call::ConvertToString(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(_left.get() != nullptr, u8"인자로 받은 _left는 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_left != nullptr, u8"인자로 받은 _left는 nullptr 여선 안됩니다.");
 	std::string buffer = "<Call: " + _left->ConvertToString() + " LPAREN ";
-	const size_t paramsCount = _params.size();
+	const size_t paramsCount = _params.GetSize();
 	for (size_t i = 0; i < paramsCount; i++)
 	{
-		MCF_DEBUG_ASSERT(_params[i].get() != nullptr, u8"_params[%zu]는 nullptr 여선 안됩니다.", i);
+		MCF_DEBUG_ASSERT(_params[i] != nullptr, u8"_params[%zu]는 nullptr 여선 안됩니다.", i);
 		buffer += _params[i]->ConvertToString() + " COMMA ";
 	}
 	return buffer + "RPAREN>";
 }
 
-mcf::AST::Expression::Index::Index(mcf::AST::Expression::Pointer&& left, mcf::AST::Expression::Pointer&& index) noexcept
-	: _left(std::move(left))
-	, _index(std::move(index))
+mcf::AST::Expression::Index::Index(mcf::AST::Expression::Pointer left, mcf::AST::Expression::Pointer index) noexcept
+	: _left(left)
+	, _index(index)
 {
-	MCF_DEBUG_ASSERT(_left.get() != nullptr, u8"인자로 받은 _left는 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_left != nullptr, u8"인자로 받은 _left는 nullptr 여선 안됩니다.");
 }
 
 const std::string mcf::AST::Expression::Index::ConvertToString(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(_left.get() != nullptr, u8"인자로 받은 _left는 nullptr 여선 안됩니다.");
-	return (_index.get() == nullptr) ?
+	MCF_DEBUG_ASSERT(_left != nullptr, u8"인자로 받은 _left는 nullptr 여선 안됩니다.");
+	return (_index == nullptr) ?
 		("<Index: " + _left->ConvertToString() + " LBRACKET RBRACKET>") : 
 		("<Index: " + _left->ConvertToString() + " LBRACKET " + _index->ConvertToString() + " RBRACKET>");
 }
 
-mcf::AST::Expression::As::As(mcf::AST::Expression::Pointer&& left, mcf::AST::Intermediate::TypeSignature::Pointer&& typeSignature) noexcept
-	: _left(std::move(left))
-	, _typeSignature(std::move(typeSignature))
+mcf::AST::Expression::As::As(mcf::AST::Expression::Pointer left, mcf::AST::Intermediate::TypeSignature::Pointer typeSignature) noexcept
+	: _left(left)
+	, _typeSignature(typeSignature)
 {
-	MCF_DEBUG_ASSERT(_left.get() != nullptr, u8"인자로 받은 _left는 nullptr 여선 안됩니다.");
-	MCF_DEBUG_ASSERT(_typeSignature.get() != nullptr, u8"인자로 받은 _typeSignature는 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_left != nullptr, u8"인자로 받은 _left는 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_typeSignature != nullptr, u8"인자로 받은 _typeSignature는 nullptr 여선 안됩니다.");
 }
 
 const std::string mcf::AST::Expression::As::ConvertToString(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(_left.get() != nullptr, u8"인자로 받은 _left는 nullptr 여선 안됩니다.");
-	MCF_DEBUG_ASSERT(_typeSignature.get() != nullptr, u8"인자로 받은 _typeSignature는 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_left != nullptr, u8"인자로 받은 _left는 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_typeSignature != nullptr, u8"인자로 받은 _typeSignature는 nullptr 여선 안됩니다.");
 	return "<As: " + _left->ConvertToString() + " KEYWORD_AS " + _typeSignature->ConvertToString() + ">";
 }
 
-mcf::AST::Expression::Initializer::Initializer(PointerVector&& keyList) noexcept
-	: _keyList(std::move(keyList))
+mcf::AST::Expression::Initializer::Initializer(const Type type, PointerArray keyList) noexcept
+	: Interface(type)
+	, _keyList(keyList)
 {
 #if defined(_DEBUG)
-	const size_t size = _keyList.size();
+	const size_t size = _keyList.GetSize();
 	MCF_DEBUG_ASSERT(size != 0, u8"_keyList에 값이 최소 한개 이상 있어야 합니다.");
 	for (size_t i = 0; i < size; i++)
 	{
-		MCF_DEBUG_ASSERT(_keyList[i].get() != nullptr, u8"_keyList[%zu]는 nullptr 여선 안됩니다.", i);
+		MCF_DEBUG_ASSERT(_keyList[i] != nullptr, u8"_keyList[%zu]는 nullptr 여선 안됩니다.", i);
 	}
 #endif
 }
 
 const std::string mcf::AST::Expression::Initializer::ConvertToString(void) const noexcept
 {
-	const size_t keyListCount = _keyList.size();
+	const size_t keyListCount = _keyList.GetSize();
 	MCF_DEBUG_ASSERT(keyListCount != 0, u8"_keyList에 값이 최소 한개 이상 있어야 합니다.");
 
 	std::string buffer;
 	buffer = "<Initializer: LBRACE ";
 	for (size_t i = 0; i < keyListCount; i++)
 	{
-		MCF_DEBUG_ASSERT(_keyList[i].get() != nullptr, u8"_keyList[%zu].key는 nullptr 여선 안됩니다.", i);
+		MCF_DEBUG_ASSERT(_keyList[i] != nullptr, u8"_keyList[%zu].key는 nullptr 여선 안됩니다.", i);
 		buffer += _keyList[i]->ConvertToString() + " COMMA ";
 	}
 	buffer += "RBRACE>";
 	return buffer;
 }
 
-mcf::AST::Expression::MapInitializer::MapInitializer(PointerVector&& keyist, PointerVector&& valueList) noexcept
-	: Initializer(std::move(keyist))
-	, _valueList(std::move(valueList))
+mcf::AST::Expression::MapInitializer::MapInitializer(PointerArray keyList, PointerArray valueList) noexcept
+	: Initializer(TYPE, keyList)
+	, _valueList(valueList)
 {
 #if defined(_DEBUG)
-	const size_t size = _valueList.size();
+	const size_t size = _valueList.GetSize();
 	MCF_DEBUG_ASSERT(size != 0, u8"_valueList에 값이 최소 한개 이상 있어야 합니다.");
-	MCF_DEBUG_ASSERT(_keyList.size() == size, u8"_valueList의 갯수와 _keyList의 갯수가 동일 해야 합니다.");
+	MCF_DEBUG_ASSERT(_keyList.GetSize() == size, u8"_valueList의 갯수와 _keyList의 갯수가 동일 해야 합니다.");
 	for (size_t i = 0; i < size; i++)
 	{
-		MCF_DEBUG_ASSERT(_valueList[i].get() != nullptr, u8"_valueList[%zu]는 nullptr 여선 안됩니다.", i);
+		MCF_DEBUG_ASSERT(_valueList[i] != nullptr, u8"_valueList[%zu]는 nullptr 여선 안됩니다.", i);
 	}
 #endif
 }
 
 const std::string mcf::AST::Expression::MapInitializer::ConvertToString(void) const noexcept
 {
-	const size_t keyListCount = _keyList.size();
+	const size_t keyListCount = _keyList.GetSize();
 	MCF_DEBUG_ASSERT(keyListCount != 0, u8"_keyList에 값이 최소 한개 이상 있어야 합니다.");
-	MCF_DEBUG_ASSERT(_valueList.size() == keyListCount, u8"_valueList의 갯수와 _keyList의 갯수가 동일 해야 합니다.");
+	MCF_DEBUG_ASSERT(_valueList.GetSize() == keyListCount, u8"_valueList의 갯수와 _keyList의 갯수가 동일 해야 합니다.");
 
 	std::string buffer;
 	buffer = "<MapInitializer: LBRACE ";
 	for (size_t i = 0; i < keyListCount; i++)
 	{
-		MCF_DEBUG_ASSERT(_keyList[i].get() != nullptr, u8"_keyList[%zu].key는 nullptr 여선 안됩니다.", i);
-		MCF_DEBUG_ASSERT(_valueList[i].get() != nullptr, u8"_valueList[%zu]는 nullptr 여선 안됩니다.", i);
+		MCF_DEBUG_ASSERT(_keyList[i] != nullptr, u8"_keyList[%zu].key는 nullptr 여선 안됩니다.", i);
+		MCF_DEBUG_ASSERT(_valueList[i] != nullptr, u8"_valueList[%zu]는 nullptr 여선 안됩니다.", i);
 		buffer += _keyList[i]->ConvertToString() + " ASSIGN " + _valueList[i]->ConvertToString() + " COMMA ";
 	}
 	buffer += "RBRACE>";
 	return buffer;
 }
 
-mcf::AST::Intermediate::Variadic::Variadic(mcf::AST::Expression::Identifier::Pointer&& name) noexcept
-	: _name(std::move(name))
+mcf::AST::Intermediate::Variadic::Variadic(mcf::AST::Expression::Identifier::Pointer name) noexcept
+	: _name(name)
 {
-	MCF_DEBUG_ASSERT(_name.get() != nullptr, u8"인자로 받은 _name는 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_name != nullptr, u8"인자로 받은 _name는 nullptr 여선 안됩니다.");
 }
 
 const std::string mcf::AST::Intermediate::Variadic::ConvertToString(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(_name.get() != nullptr, u8"인자로 받은 _name는 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_name != nullptr, u8"인자로 받은 _name는 nullptr 여선 안됩니다.");
 	return "<Variadic: " + _name->ConvertToString() + ">";
 }
 
-mcf::AST::Intermediate::TypeSignature::TypeSignature(const bool isUnsigned, mcf::AST::Expression::Pointer&& signature) noexcept
+mcf::AST::Intermediate::TypeSignature::TypeSignature(const bool isUnsigned, mcf::AST::Expression::Pointer signature) noexcept
 	: _isUnsigned(isUnsigned)
-	, _signature(std::move(signature))
+	, _signature(signature)
 {
-	MCF_DEBUG_ASSERT(_signature.get() != nullptr, u8"_signature는 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_signature != nullptr, u8"_signature는 nullptr 여선 안됩니다.");
 	MCF_DEBUG_ASSERT
 	(
 		_signature->GetExpressionType() == mcf::AST::Expression::Type::IDENTIFIER || _signature->GetExpressionType() == mcf::AST::Expression::Type::INDEX, 
@@ -188,48 +237,48 @@ mcf::AST::Intermediate::TypeSignature::TypeSignature(const bool isUnsigned, mcf:
 
 const mcf::AST::Expression::Interface* mcf::AST::Intermediate::TypeSignature::GetUnsafeSignaturePointer(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(_signature.get() != nullptr, u8"_signature는 nullptr 여선 안됩니다.");
-	return _signature.get();
+	MCF_DEBUG_ASSERT(_signature != nullptr, u8"_signature는 nullptr 여선 안됩니다.");
+	return _signature;
 }
 
 const std::string mcf::AST::Intermediate::TypeSignature::ConvertToString(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(_signature.get() != nullptr, u8"_signature는 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_signature != nullptr, u8"_signature는 nullptr 여선 안됩니다.");
 	return "<TypeSignature: " + std::string(_isUnsigned ? "KEYWORD_UNSIGNED " : "") + _signature->ConvertToString() + ">";
 }
 
-mcf::AST::Intermediate::VariableSignature::VariableSignature(mcf::AST::Expression::Identifier::Pointer&& name, TypeSignature::Pointer&& typeSignature) noexcept
-	: _name(std::move(name))
-	, _typeSignature(std::move(typeSignature))
+mcf::AST::Intermediate::VariableSignature::VariableSignature(mcf::AST::Expression::Identifier::Pointer name, TypeSignature::Pointer typeSignature) noexcept
+	: _name(name)
+	, _typeSignature(typeSignature)
 {
-	MCF_DEBUG_ASSERT(_name.get() != nullptr, u8"인자로 받은 _name은 nullptr 여선 안됩니다.");
-	MCF_DEBUG_ASSERT(_typeSignature.get() != nullptr, u8"인자로 받은 _typeSignature는 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_name != nullptr, u8"인자로 받은 _name은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_typeSignature != nullptr, u8"인자로 받은 _typeSignature는 nullptr 여선 안됩니다.");
 }
 
 const mcf::AST::Intermediate::TypeSignature* mcf::AST::Intermediate::VariableSignature::GetUnsafeTypeSignaturePointer(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(_typeSignature.get() != nullptr, u8"인자로 받은 _typeSignature는 nullptr 여선 안됩니다.");
-	return _typeSignature.get();
+	MCF_DEBUG_ASSERT(_typeSignature != nullptr, u8"인자로 받은 _typeSignature는 nullptr 여선 안됩니다.");
+	return _typeSignature;
 }
 
 const std::string mcf::AST::Intermediate::VariableSignature::ConvertToString(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(_name.get() != nullptr, u8"인자로 받은 _name은 nullptr 여선 안됩니다.");
-	MCF_DEBUG_ASSERT(_typeSignature.get() != nullptr, u8"인자로 받은 _typeSignature는 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_name != nullptr, u8"인자로 받은 _name은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_typeSignature != nullptr, u8"인자로 받은 _typeSignature는 nullptr 여선 안됩니다.");
 	return "<VariableSignature: " + _name->ConvertToString() + " COLON " + _typeSignature->ConvertToString() + ">";
 }
 
 const mcf::AST::Intermediate::VariableSignature* mcf::AST::Intermediate::FunctionParams::GetUnsafeParamPointerAt(size_t index) const noexcept
 {
-	MCF_DEBUG_ASSERT(index < _params.size(), u8"인자로 받은 index는 _params의 사이즈보다 작아야 합니다.");
-	MCF_DEBUG_ASSERT(_params[index].get() != nullptr, u8"인자로 받은 _params[%zu]는 nullptr 여선 안됩니다.", index);
-	return _params[index].get();
+	MCF_DEBUG_ASSERT(index < _params.GetSize(), u8"인자로 받은 index는 _params의 사이즈보다 작아야 합니다.");
+	MCF_DEBUG_ASSERT(_params[index] != nullptr, u8"인자로 받은 _params[%zu]는 nullptr 여선 안됩니다.", index);
+	return _params[index];
 }
 
 const mcf::AST::Intermediate::Variadic* mcf::AST::Intermediate::FunctionParams::GetUnsafeVariadic(void) const noexcept
 {
-	MCF_DEBUG_ASSERT( _variadic.get() != nullptr, u8"인자로 받은 _variadic은 nullptr 여선 안됩니다.");
-	return _variadic.get();
+	MCF_DEBUG_ASSERT( _variadic != nullptr, u8"인자로 받은 _variadic은 nullptr 여선 안됩니다.");
+	return _variadic;
 }
 
 const std::string mcf::AST::Intermediate::FunctionParams::ConvertToString(void) const noexcept
@@ -242,7 +291,7 @@ const std::string mcf::AST::Intermediate::FunctionParams::ConvertToString(void)
 	std::string buffer = "<FunctionParams: LPAREN ";
 	if (HasParams() == true)
 	{
-		const size_t paramsCount = _params.size();
+		const size_t paramsCount = _params.GetSize();
 		for (size_t i = 0; i < paramsCount; i++)
 		{
 			buffer += _params[i]->ConvertToString() + " COMMA ";
@@ -257,24 +306,24 @@ const std::string mcf::AST::Intermediate::FunctionParams::ConvertToString(void)
 }
 
 mcf::AST::Intermediate::FunctionSignature::FunctionSignature(mcf::AST::Expression::Identifier::Pointer name, FunctionParams::Pointer params, TypeSignature::Pointer returnType) noexcept
-	: _name(std::move(name))
-	, _params(std::move(params))
-	, _returnType(std::move(returnType))
+	: _name(name)
+	, _params(params)
+	, _returnType(returnType)
 {
-	MCF_DEBUG_ASSERT(_name.get() != nullptr, u8"인자로 받은 _name은 nullptr 여선 안됩니다.");
-	MCF_DEBUG_ASSERT(_params.get() != nullptr, u8"인자로 받은 _params은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_name != nullptr, u8"인자로 받은 _name은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_params != nullptr, u8"인자로 받은 _params은 nullptr 여선 안됩니다.");
 }
 
 const mcf::AST::Intermediate::TypeSignature* mcf::AST::Intermediate::FunctionSignature::GetUnsafeReturnTypePointer(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(_returnType.get() != nullptr, u8"리턴 타입이 void일 경우 리턴 타입을 가져올 수 없습비다.");
-	return _returnType.get();
+	MCF_DEBUG_ASSERT(_returnType != nullptr, u8"리턴 타입이 void일 경우 리턴 타입을 가져올 수 없습비다.");
+	return _returnType;
 }
 
 const mcf::AST::Intermediate::FunctionParams* mcf::AST::Intermediate::FunctionSignature::GetUnsafeFunctionParamsPointer(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(_params.get() != nullptr, u8"인자로 받은 _params은 nullptr 여선 안됩니다.");
-	return _params.get();
+	MCF_DEBUG_ASSERT(_params != nullptr, u8"인자로 받은 _params은 nullptr 여선 안됩니다.");
+	return _params;
 }
 
 const std::string mcf::AST::Intermediate::FunctionSignature::ConvertToString(void) const noexcept
@@ -289,133 +338,146 @@ const std::string mcf::AST::Statement::IncludeLibrary::ConvertToString(void) con
 {
 	std::string buffer;
 	buffer = "[IncludeLibrary: LT ";
-	buffer += "KEYWORD_ASM COMMA " + _libPath.Literal;
+	buffer += "KEYWORD_ASM COMMA ";
+	buffer += _libPath.Literal;
 	buffer += " GT]";
 	return buffer;
 }
 
-mcf::AST::Statement::Typedef::Typedef(SignaturePointer&& signature) noexcept
-	: _signature(std::move(signature))
+mcf::AST::Statement::Typedef::Typedef(SignaturePointer signature) noexcept
+	: _signature(signature)
 {
-	MCF_DEBUG_ASSERT(_signature.get() != nullptr, u8"인자로 받은 _signature은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_signature != nullptr, u8"인자로 받은 _signature은 nullptr 여선 안됩니다.");
 }
 
 const std::string mcf::AST::Statement::Typedef::ConvertToString(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(_signature.get() != nullptr, u8"인자로 받은 _signature은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_signature != nullptr, u8"인자로 받은 _signature은 nullptr 여선 안됩니다.");
 	return "[Typedef: " + _signature->ConvertToString() + " SEMICOLON]";
 }
 
-mcf::AST::Statement::Extern::Extern(mcf::AST::Intermediate::FunctionSignature::Pointer&& signature) noexcept
-	: _signature(std::move(signature))
+mcf::AST::Statement::Extern::Extern(mcf::AST::Intermediate::FunctionSignature::Pointer signature) noexcept
+	: _signature(signature)
 {
-	MCF_DEBUG_ASSERT(_signature.get() != nullptr, u8"인자로 받은 _signature은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_signature != nullptr, u8"인자로 받은 _signature은 nullptr 여선 안됩니다.");
 }
 
 const std::string mcf::AST::Statement::Extern::ConvertToString(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(_signature.get() != nullptr, u8"인자로 받은 _signature은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_signature != nullptr, u8"인자로 받은 _signature은 nullptr 여선 안됩니다.");
 	return "[Extern " + _signature->ConvertToString() + " SEMICOLON]";
 }
 
-mcf::AST::Statement::Let::Let(mcf::AST::Intermediate::VariableSignature::Pointer&& signature, mcf::AST::Expression::Pointer&& expression) noexcept
-	: _signature(std::move(signature))
-	, _expression(std::move(expression))
+mcf::AST::Statement::Let::Let(mcf::AST::Intermediate::VariableSignature::Pointer signature, mcf::AST::Expression::Pointer expression) noexcept
+	: _signature(signature)
+	, _expression(expression)
 {
-	MCF_DEBUG_ASSERT(_signature.get() != nullptr, u8"인자로 받은 _signature은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_signature != nullptr, u8"인자로 받은 _signature은 nullptr 여선 안됩니다.");
 }
 
 const std::string mcf::AST::Statement::Let::ConvertToString(void) const noexcept
 {
-	return "[Let: " + _signature->ConvertToString() + (_expression.get() == nullptr ? "" : (" ASSIGN " + _expression->ConvertToString())) + " SEMICOLON]";
+	return "[Let: " + _signature->ConvertToString() + (_expression == nullptr ? "" : (" ASSIGN " + _expression->ConvertToString())) + " SEMICOLON]";
 }
 
-mcf::AST::Statement::Block::Block(Statement::PointerVector&& statements) noexcept
-	: _statements(std::move(statements))
+mcf::AST::Statement::Block::Block(Statement::PointerArray statements) noexcept
+	: _statements(statements)
 {
 #if defined(_DEBUG)
-		const size_t size = _statements.size();
+		const size_t size = _statements.GetSize();
 		for (size_t i = 0; i < size; i++)
 		{
-			MCF_DEBUG_ASSERT(_statements[i].get() != nullptr, u8"_statements[%zu]는 nullptr 여선 안됩니다.", i);
+			MCF_DEBUG_ASSERT(_statements[i] != nullptr, u8"_statements[%zu]는 nullptr 여선 안됩니다.", i);
 		}
 #endif
 }
 
 const std::string mcf::AST::Statement::Block::ConvertToString(void) const noexcept
 {
-	const size_t size = _statements.size();
+	const size_t size = _statements.GetSize();
 	std::string buffer = "[Block: LBRACE ";
 
 	for (size_t i = 0; i < size; i++)
 	{
-		MCF_DEBUG_ASSERT(_statements[i].get() != nullptr, u8"_statements[%zu]는 nullptr 여선 안됩니다.", i);
+		MCF_DEBUG_ASSERT(_statements[i] != nullptr, u8"_statements[%zu]는 nullptr 여선 안됩니다.", i);
 		buffer += _statements[i]->ConvertToString() + " ";
 	}
 
 	return buffer + "RBRACE]";
 }
 
-mcf::AST::Statement::Return::Return(mcf::AST::Expression::Pointer&& returnValue) noexcept
-	: _returnValue(std::move(returnValue))
+mcf::AST::Statement::Return::Return(mcf::AST::Expression::Pointer returnValue) noexcept
+	: _returnValue(returnValue)
 {
-	MCF_DEBUG_ASSERT(_returnValue.get() != nullptr, u8"인자로 받은 _returnValue은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_returnValue != nullptr, u8"인자로 받은 _returnValue은 nullptr 여선 안됩니다.");
 }
 
 const std::string mcf::AST::Statement::Return::ConvertToString(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(_returnValue.get() != nullptr, u8"인자로 받은 _returnValue은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_returnValue != nullptr, u8"인자로 받은 _returnValue은 nullptr 여선 안됩니다.");
 	return "[Return: " + _returnValue->ConvertToString() + " SEMICOLON]";
 }
 
-mcf::AST::Statement::Func::Func(mcf::AST::Intermediate::FunctionSignature::Pointer&& signature, mcf::AST::Statement::Block::Pointer&& block) noexcept
-	: _signature(std::move(signature))
-	, _block(std::move(block))
+mcf::AST::Statement::Func::Func(mcf::AST::Intermediate::FunctionSignature::Pointer signature, mcf::AST::Statement::Block::Pointer block) noexcept
+	: _signature(signature)
+	, _block(block)
 {
-	MCF_DEBUG_ASSERT(_signature.get() != nullptr, u8"인자로 받은 _signature은 nullptr 여선 안됩니다.");
-	MCF_DEBUG_ASSERT(_block.get() != nullptr, u8"인자로 받은 _block은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_signature != nullptr, u8"인자로 받은 _signature은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_block != nullptr, u8"인자로 받은 _block은 nullptr 여선 안됩니다.");
+}
+
+mcf::AST::Statement::Func::Func(mcf::AST::Intermediate::FunctionSignature::Pointer signature, const std::uint32_t bodyBeginTokenIndex, const std::uint32_t bodyEndTokenIndex) noexcept
+	: _signature(signature)
+	, _bodyBeginTokenIndex(bodyBeginTokenIndex)
+	, _bodyEndTokenIndex(bodyEndTokenIndex)
+{
+	MCF_DEBUG_ASSERT(_signature != nullptr, u8"인자로 받은 _signature은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_bodyBeginTokenIndex < _bodyEndTokenIndex, u8"본문의 토큰 범위가 잘못되었습니다. begin=%u, end=%u", _bodyBeginTokenIndex, _bodyEndTokenIndex);
 }
 
 const std::string mcf::AST::Statement::Func::ConvertToString(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(_signature.get() != nullptr, u8"인자로 받은 _signature은 nullptr 여선 안됩니다.");
-	MCF_DEBUG_ASSERT(_block.get() != nullptr, u8"인자로 받은 _block은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_signature != nullptr, u8"인자로 받은 _signature은 nullptr 여선 안됩니다.");
+	if (_block == nullptr)
+	{
+		return "[Func: " + _signature->ConvertToString() + " [LazyBlock]]";
+	}
 	return "[Func: " + _signature->ConvertToString() + " " + _block->ConvertToString() + "]";
 }
 
 std::string mcf::AST::Statement::Main::NAME = std::string("main");
 
-mcf::AST::Statement::Main::Main(mcf::AST::Intermediate::FunctionParams::Pointer&& params, mcf::AST::Intermediate::TypeSignature::Pointer&& returnType, Block::Pointer&& block) noexcept
-	: _params(std::move(params))
-	, _returnType(std::move(returnType))
-	, _block(std::move(block))
+mcf::AST::Statement::Main::Main(mcf::AST::Intermediate::FunctionParams::Pointer params, mcf::AST::Intermediate::TypeSignature::Pointer returnType, Block::Pointer block) noexcept
+	: _params(params)
+	, _returnType(returnType)
+	, _block(block)
 {
-	MCF_DEBUG_ASSERT(_params.get() != nullptr, u8"인자로 받은 _params은 nullptr 여선 안됩니다.");
-	MCF_DEBUG_ASSERT(_block.get() != nullptr, u8"인자로 받은 _block은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_params != nullptr, u8"인자로 받은 _params은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_block != nullptr, u8"인자로 받은 _block은 nullptr 여선 안됩니다.");
 }
 
 const mcf::AST::Intermediate::TypeSignature* mcf::AST::Statement::Main::GetUnsafeReturnTypePointer(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(_returnType.get() != nullptr, u8"리턴 타입이 void일 경우 리턴 타입을 가져올 수 없습비다.");
-	return _returnType.get();
+	MCF_DEBUG_ASSERT(_returnType != nullptr, u8"리턴 타입이 void일 경우 리턴 타입을 가져올 수 없습비다.");
+	return _returnType;
 }
 
 const mcf::AST::Intermediate::FunctionParams* mcf::AST::Statement::Main::GetUnsafeFunctionParamsPointer(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(_params.get() != nullptr, u8"인자로 받은 _params은 nullptr 여선 안됩니다.");
-	return _params.get();
+	MCF_DEBUG_ASSERT(_params != nullptr, u8"인자로 받은 _params은 nullptr 여선 안됩니다.");
+	return _params;
 }
 
 const mcf::AST::Statement::Block* mcf::AST::Statement::Main::GetUnsafeBlockPointer(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(_block.get() != nullptr, u8"인자로 받은 _block은 nullptr 여선 안됩니다.");
-	return _block.get();
+	MCF_DEBUG_ASSERT(_block != nullptr, u8"인자로 받은 _block은 nullptr 여선 안됩니다.");
+	return _block;
 }
 
 const std::string mcf::AST::Statement::Main::ConvertToString(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(_params.get() != nullptr, u8"인자로 받은 _params은 nullptr 여선 안됩니다.");
-	MCF_DEBUG_ASSERT(_block.get() != nullptr, u8"인자로 받은 _block은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_params != nullptr, u8"인자로 받은 _params은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_block != nullptr, u8"인자로 받은 _block은 nullptr 여선 안됩니다.");
 
 	if (IsReturnVoid())
 	{
@@ -424,41 +486,41 @@ const std::string mcf::AST::Statement::Main::ConvertToString(void) const noexcep
 	return "[Main: " + _params->ConvertToString() + " POINTING " + _returnType->ConvertToString() + " " + _block->ConvertToString() + "]";
 }
 
-mcf::AST::Statement::Expression::Expression(mcf::AST::Expression::Pointer&& expression) noexcept
-	: _expression(std::move(expression))
+mcf::AST::Statement::Expression::Expression(mcf::AST::Expression::Pointer expression) noexcept
+	: _expression(expression)
 {
-	MCF_DEBUG_ASSERT(_expression.get() != nullptr, u8"인자로 받은 _expression은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_expression != nullptr, u8"인자로 받은 _expression은 nullptr 여선 안됩니다.");
 }
 
 const std::string mcf::AST::Statement::Expression::ConvertToString(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(_expression.get() != nullptr, u8"인자로 받은 _expression은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_expression != nullptr, u8"인자로 받은 _expression은 nullptr 여선 안됩니다.");
 	return "[Expression: " + _expression->ConvertToString() + " SEMICOLON]";
 }
 
-mcf::AST::Statement::AssignExpression::AssignExpression(mcf::AST::Expression::Pointer&& left, mcf::AST::Expression::Pointer&& right) noexcept
-	: _left(std::move(left))
-	, _right(std::move(right))
+mcf::AST::Statement::AssignExpression::AssignExpression(mcf::AST::Expression::Pointer left, mcf::AST::Expression::Pointer right) noexcept
+	: _left(left)
+	, _right(right)
 {
-	MCF_DEBUG_ASSERT(_left.get() != nullptr, u8"인자로 받은 _left은 nullptr 여선 안됩니다.");
-	MCF_DEBUG_ASSERT(_right.get() != nullptr, u8"인자로 받은 _right은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_left != nullptr, u8"인자로 받은 _left은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_right != nullptr, u8"인자로 받은 _right은 nullptr 여선 안됩니다.");
 }
 
 const std::string mcf::AST::Statement::AssignExpression::ConvertToString(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(_left.get() != nullptr, u8"인자로 받은 _left은 nullptr 여선 안됩니다.");
-	MCF_DEBUG_ASSERT(_right.get() != nullptr, u8"인자로 받은 _right은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_left != nullptr, u8"인자로 받은 _left은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_right != nullptr, u8"인자로 받은 _right은 nullptr 여선 안됩니다.");
 	return "[Expression: " + _left->ConvertToString() + " ASSIGN " + _right->ConvertToString() + " SEMICOLON]";
 }
 
-mcf::AST::Statement::Unused::Unused(mcf::AST::Expression::Identifier::PointerVector&& identifiers) noexcept
-	: _identifiers(std::move(identifiers))
+mcf::AST::Statement::Unused::Unused(mcf::AST::Expression::Identifier::PointerArray identifiers) noexcept
+	: _identifiers(identifiers)
 {
 #if defined(_DEBUG)
-	const size_t size = _identifiers.size();
+	const size_t size = _identifiers.GetSize();
 	for (size_t i = 0; i < size; i++)
 	{
-		MCF_DEBUG_ASSERT(_identifiers[i].get() != nullptr, u8"_identifiers[%zu]는 nullptr 여선 안됩니다.", i);
+		MCF_DEBUG_ASSERT(_identifiers[i] != nullptr, u8"_identifiers[%zu]는 nullptr 여선 안됩니다.", i);
 	}
 #endif
 }
@@ -466,43 +528,88 @@ mcf::AST::Statement::Unused::Unused(mcf::AST::Expression::Identifier::PointerVec
 const std::string mcf::AST::Statement::Unused::ConvertToString(void) const noexcept
 {
 	std::string buffer = "[Unused: LPAREN ";
-	const size_t size = _identifiers.size();
+	const size_t size = _identifiers.GetSize();
 	for (size_t i = 0; i < size; i++)
 	{
-		MCF_DEBUG_ASSERT(_identifiers[i].get() != nullptr, u8"_identifiers[%zu]는 nullptr 여선 안됩니다.", i);
+		MCF_DEBUG_ASSERT(_identifiers[i] != nullptr, u8"_identifiers[%zu]는 nullptr 여선 안됩니다.", i);
 		buffer += _identifiers[i]->ConvertToString() + " COMMA ";
 	}
 	return buffer + "RPAREN SEMICOLON]";
 }
 
-mcf::AST::Statement::While::While(mcf::AST::Expression::Pointer&& condition, mcf::AST::Statement::Block::Pointer&& block) noexcept
-	: _condition(std::move(condition))
-	, _block(std::move(block))
+mcf::AST::Statement::While::While(mcf::AST::Expression::Pointer condition, mcf::AST::Statement::Block::Pointer block) noexcept
+	: _condition(condition)
+	, _block(block)
 {
-	MCF_DEBUG_ASSERT(_condition.get() != nullptr, u8"인자로 받은 _condition은 nullptr 여선 안됩니다.");
-	MCF_DEBUG_ASSERT(_block.get() != nullptr, u8"인자로 받은 _block은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_condition != nullptr, u8"인자로 받은 _condition은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_block != nullptr, u8"인자로 받은 _block은 nullptr 여선 안됩니다.");
 }
 
 const std::string mcf::AST::Statement::While::ConvertToString(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(_condition.get() != nullptr, u8"인자로 받은 _condition은 nullptr 여선 안됩니다.");
-	MCF_DEBUG_ASSERT(_block.get() != nullptr, u8"인자로 받은 _block은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_condition != nullptr, u8"인자로 받은 _condition은 nullptr 여선 안됩니다.");
+	MCF_DEBUG_ASSERT(_block != nullptr, u8"인자로 받은 _block은 nullptr 여선 안됩니다.");
 	return "[While: LPAREN " + _condition->ConvertToString() + " RPAREN " + _block->ConvertToString() + "]";
 }
 
-mcf::AST::Program::Program(mcf::AST::Statement::PointerVector&& statements) noexcept
-	: _statements(std::move(statements))
+mcf::AST::Program::Program(std::unique_ptr<mcf::AST::Arena>&& arena, mcf::AST::Statement::PointerVector&& statements) noexcept
+	: _arena(std::move(arena))
+	, _statements(std::move(statements))
 {
 #if defined(_DEBUG)
 	const size_t size = _statements.size();
 	MCF_DEBUG_ASSERT(size != 0, u8"_statements에 값이 최소 한개 이상 있어야 합니다.");
 	for (size_t i = 0; i < size; i++)
 	{
-		MCF_DEBUG_ASSERT(_statements[i].get() != nullptr, u8"_statements[%zu]는 nullptr 여선 안됩니다.", i);
+		MCF_DEBUG_ASSERT(_statements[i] != nullptr, u8"_statements[%zu]는 nullptr 여선 안됩니다.", i);
 	}
 #endif
 }
 
+mcf::AST::Program::Program(std::unique_ptr<mcf::AST::Arena>&& arena, mcf::AST::Statement::PointerVector&& statements, const mcf::Lexer::Source& source, const std::shared_ptr<mcf::Symbol::Table>& symbols) noexcept
+	: Program(std::move(arena), std::move(statements))
+{
+	_source = source;
+	_symbols = symbols;
+}
+
+mcf::AST::Program::Program(std::unique_ptr<mcf::AST::Arena>&& arena, mcf::AST::Statement::PointerVector&& statements, const mcf::Lexer::Source& source, const std::shared_ptr<mcf::Symbol::Table>& symbols,
+	std::unique_ptr<mcf::AST::BodyParser>&& bodyParser) noexcept
+	: Program(std::move(arena), std::move(statements), source, symbols)
+{
+	_bodyParser = std::move(bodyParser);
+}
+
+mcf::AST::Program::Program(std::vector<std::shared_ptr<const mcf::AST::Arena>>&& sharedArenas, std::vector<mcf::Lexer::Source>&& sharedSources, mcf::AST::Statement::PointerVector&& statements,
+	const mcf::Lexer::Source& source, const std::shared_ptr<mcf::Symbol::Table>& symbols) noexcept
+	: Program(nullptr, std::move(statements), source, symbols)
+{
+	_sharedArenas = std::move(sharedArenas);
+	_sharedSources = std::move(sharedSources);
+}
+
+const bool mcf::AST::Program::MaterializeFunctionBody(_Notnull_ const mcf::AST::Statement::Func* func) const noexcept
+{
+	if (func->IsBodyParsed())
+	{
+		return true;
+	}
+
+	if (_bodyParser == nullptr || _arena == nullptr)
+	{
+		MCF_DEBUG_BREAK(u8"지연 파싱된 함수가 있는 프로그램은 BodyParser 를 가지고 있어야 합니다.");
+		return false;
+	}
+
+	mcf::AST::Statement::Block::Pointer block = _bodyParser->ParseBody(*_arena, func->GetBodyBeginTokenIndex(), func->GetBodyEndTokenIndex());
+	if (block == nullptr)
+	{
+		return false;
+	}
+	func->_block = block;
+	return true;
+}
+
 const std::string mcf::AST::Program::ConvertToString(void) const noexcept
 {
 	const size_t size = _statements.size();
@@ -511,9 +618,849 @@ const std::string mcf::AST::Program::ConvertToString(void) const noexcept
 
 	for (size_t i = 0; i < size; i++)
 	{
-		MCF_DEBUG_ASSERT(_statements[i].get() != nullptr, u8"_statements[%zu]는 nullptr 여선 안됩니다.", i);
+		MCF_DEBUG_ASSERT(_statements[i] != nullptr, u8"_statements[%zu]는 nullptr 여선 안됩니다.", i);
 		buffer += (i == 0 ? "" : "\n") + _statements[i]->ConvertToString();
 	}
 
 	return buffer;
+}
+
+mcf::AST::Flat::Program::Program(const mcf::AST::Program& program) noexcept
+	: _source(program.GetSource())
+	, _sharedSources(program.GetSharedSources())
+	, _symbols(program.GetSharedSymbolTable())
+{
+	const size_t statementCount = program.GetStatementCount();
+	_statements.reserve(statementCount);
+	for (size_t i = 0; i < statementCount; i++)
+	{
+		// 평면 AST 는 지연 파싱을 지원하지 않으므로 변환하기 전에 모든 함수 본문을 파싱합니다.
+		const mcf::AST::Statement::Interface* statement = program.GetUnsafeStatementPointerAt(i);
+		if (statement->GetStatementType() == mcf::AST::Statement::Type::FUNC)
+		{
+			program.MaterializeFunctionBody(static_cast<const mcf::AST::Statement::Func*>(statement));
+		}
+		_statements.emplace_back(ConvertStatement(statement));
+	}
+}
+
+const mcf::AST::Flat::Index mcf::AST::Flat::Program::ConvertStatement(const mcf::AST::Statement::Interface* statement) noexcept
+{
+	MCF_DEBUG_ASSERT(statement != nullptr, u8"인자로 받은 statement는 nullptr 여선 안됩니다.");
+
+	constexpr const size_t STATEMENT_TYPE_COUNT_BEGIN = __COUNTER__;
+	switch (statement->GetStatementType())
+	{
+	case mcf::AST::Statement::Type::INVALID:
+		return AddNode(Kind::INVALID, INVALID_INDEX, INVALID_INDEX);
+
+	case mcf::AST::Statement::Type::INCLUDE_LIBRARY: __COUNTER__;
+		return AddNode(Kind::INCLUDE_LIBRARY, static_cast<const mcf::AST::Statement::IncludeLibrary*>(statement)->GetLibPathToken(), INVALID_INDEX, INVALID_INDEX);
+
+	case mcf::AST::Statement::Type::TYPEDEF: __COUNTER__;
+		return AddNode(Kind::TYPEDEF, ConvertIntermediate(static_cast<const mcf::AST::Statement::Typedef*>(statement)->GetUnsafeSignaturePointer()), INVALID_INDEX);
+
+	case mcf::AST::Statement::Type::EXTERN: __COUNTER__;
+		return AddNode(Kind::EXTERN, ConvertIntermediate(static_cast<const mcf::AST::Statement::Extern*>(statement)->GetUnsafeSignaturePointer()), INVALID_INDEX);
+
+	case mcf::AST::Statement::Type::LET: __COUNTER__;
+	{
+		const mcf::AST::Statement::Let* let = static_cast<const mcf::AST::Statement::Let*>(statement);
+		const Index signature = ConvertIntermediate(let->GetUnsafeSignaturePointer());
+		const Index expression = let->GetUnsafeExpressionPointer() == nullptr ? INVALID_INDEX : ConvertExpression(let->GetUnsafeExpressionPointer());
+		return AddNode(Kind::LET, signature, expression);
+	}
+
+	case mcf::AST::Statement::Type::BLOCK: __COUNTER__;
+	{
+		const mcf::AST::Statement::Block* block = static_cast<const mcf::AST::Statement::Block*>(statement);
+		std::vector<Index> statements;
+		const size_t statementCount = block->GetStatementCount();
+		for (size_t i = 0; i < statementCount; i++)
+		{
+			statements.emplace_back(ConvertStatement(block->GetUnsafeStatementPointerAt(i)));
+		}
+		return AddNode(Kind::BLOCK, AddList(statements), INVALID_INDEX);
+	}
+
+	case mcf::AST::Statement::Type::RETURN: __COUNTER__;
+		return AddNode(Kind::RETURN, ConvertExpression(static_cast<const mcf::AST::Statement::Return*>(statement)->GetUnsafeReturnValueExpressionPointer()), INVALID_INDEX);
+
+	case mcf::AST::Statement::Type::FUNC: __COUNTER__;
+	{
+		const mcf::AST::Statement::Func* func = static_cast<const mcf::AST::Statement::Func*>(statement);
+		if (func->IsBodyParsed() == false)
+		{
+			MCF_DEBUG_TODO(u8"함수 본문 파싱에 실패하였습니다.");
+			return AddNode(Kind::INVALID, INVALID_INDEX, INVALID_INDEX);
+		}
+		const Index signature = ConvertIntermediate(func->GetUnsafeSignaturePointer());
+		const Index block = ConvertStatement(func->GetUnsafeBlockPointer());
+		return AddNode(Kind::FUNC, signature, block);
+	}
+
+	case mcf::AST::Statement::Type::MAIN: __COUNTER__;
+	{
+		const mcf::AST::Statement::Main* main = static_cast<const mcf::AST::Statement::Main*>(statement);
+		const Index params = ConvertIntermediate(main->GetUnsafeFunctionParamsPointer());
+		const Index returnType = main->IsReturnVoid() ? INVALID_INDEX : ConvertIntermediate(main->GetUnsafeReturnTypePointer());
+		const Index block = ConvertStatement(main->GetUnsafeBlockPointer());
+		return AddNode(Kind::MAIN, AddList({ params, returnType, block }), INVALID_INDEX);
+	}
+
+	case mcf::AST::Statement::Type::EXPRESSION: __COUNTER__;
+		return AddNode(Kind::EXPRESSION, ConvertExpression(static_cast<const mcf::AST::Statement::Expression*>(statement)->GetUnsafeExpression()), INVALID_INDEX);
+
+	case mcf::AST::Statement::Type::ASSIGN_EXPRESSION: __COUNTER__;
+	{
+		const mcf::AST::Statement::AssignExpression* assign = static_cast<const mcf::AST::Statement::AssignExpression*>(statement);
+		const Index left = ConvertExpression(assign->GetUnsafeLeftExpression());
+		const Index right = ConvertExpression(assign->GetUnsafeRightExpression());
+		return AddNode(Kind::ASSIGN_EXPRESSION, left, right);
+	}
+
+	case mcf::AST::Statement::Type::UNUSED: __COUNTER__;
+	{
+		const mcf::AST::Statement::Unused* unused = static_cast<const mcf::AST::Statement::Unused*>(statement);
+		std::vector<Index> identifiers;
+		const size_t identifierCount = unused->GetIdentifiersCount();
+		for (size_t i = 0; i < identifierCount; i++)
+		{
+			identifiers.emplace_back(ConvertExpression(unused->GetUnsafeIdentifierPointerAt(i)));
+		}
+		return AddNode(Kind::UNUSED, AddList(identifiers), INVALID_INDEX);
+	}
+
+	case mcf::AST::Statement::Type::WHILE: __COUNTER__;
+	{
+		const mcf::AST::Statement::While* whileStatement = static_cast<const mcf::AST::Statement::While*>(statement);
+		const Index condition = ConvertExpression(whileStatement->GetUnsafeConditionPointer());
+		const Index block = ConvertStatement(whileStatement->GetUnsafeBlockPointer());
+		return AddNode(Kind::WHILE, condition, block);
+	}
+
+	case mcf::AST::Statement::Type::BREAK: __COUNTER__;
+		return AddNode(Kind::BREAK, static_cast<const mcf::AST::Statement::Break*>(statement)->GetToken(), INVALID_INDEX, INVALID_INDEX);
+
+	default:
+		MCF_DEBUG_BREAK(u8"예상치 못한 값이 들어왔습니다. StatementType=%s(%zu)", mcf::AST::Statement::CONVERT_TYPE_TO_STRING(statement->GetStatementType()), mcf::ENUM_INDEX(statement->GetStatementType()));
+		break;
+	}
+	constexpr const size_t STATEMENT_TYPE_COUNT = __COUNTER__ - STATEMENT_TYPE_COUNT_BEGIN;
+	static_assert(static_cast<size_t>(mcf::AST::Statement::Type::COUNT) == STATEMENT_TYPE_COUNT, "statement type count is changed. this SWITCH need to be changed as well.");
+	return AddNode(Kind::INVALID, INVALID_INDEX, INVALID_INDEX);
+}
+
+const mcf::AST::Flat::Index mcf::AST::Flat::Program::ConvertIntermediate(const mcf::AST::Intermediate::Interface* intermediate) noexcept
+{
+	MCF_DEBUG_ASSERT(intermediate != nullptr, u8"인자로 받은 intermediate는 nullptr 여선 안됩니다.");
+
+	constexpr const size_t INTERMEDIATE_TYPE_COUNT_BEGIN = __COUNTER__;
+	switch (intermediate->GetIntermediateType())
+	{
+	case mcf::AST::Intermediate::Type::INVALID:
+		return AddNode(Kind::INVALID, INVALID_INDEX, INVALID_INDEX);
+
+	case mcf::AST::Intermediate::Type::VARIADIC: __COUNTER__;
+		return AddNode(Kind::VARIADIC, ConvertExpression(static_cast<const mcf::AST::Intermediate::Variadic*>(intermediate)->GetUnsafeNamePointer()), INVALID_INDEX);
+
+	case mcf::AST::Intermediate::Type::TYPE_SIGNATURE: __COUNTER__;
+	{
+		const mcf::AST::Intermediate::TypeSignature* typeSignature = static_cast<const mcf::AST::Intermediate::TypeSignature*>(intermediate);
+		return AddNode(Kind::TYPE_SIGNATURE, ConvertExpression(typeSignature->GetUnsafeSignaturePointer()), typeSignature->IsUnsigned() ? 1 : 0);
+	}
+
+	case mcf::AST::Intermediate::Type::VARIABLE_SIGNATURE: __COUNTER__;
+	{
+		const mcf::AST::Intermediate::VariableSignature* variableSignature = static_cast<const mcf::AST::Intermediate::VariableSignature*>(intermediate);
+		const Index name = ConvertExpression(variableSignature->GetUnsafeNamePointer());
+		const Index typeSignature = ConvertIntermediate(variableSignature->GetUnsafeTypeSignaturePointer());
+		return AddNode(Kind::VARIABLE_SIGNATURE, name, typeSignature);
+	}
+
+	case mcf::AST::Intermediate::Type::FUNCTION_SIGNATURE: __COUNTER__;
+	{
+		const mcf::AST::Intermediate::FunctionSignature* functionSignature = static_cast<const mcf::AST::Intermediate::FunctionSignature*>(intermediate);
+		const Index name = ConvertExpression(functionSignature->GetUnsafeNamePointer());
+		const Index params = ConvertIntermediate(functionSignature->GetUnsafeFunctionParamsPointer());
+		const Index returnType = functionSignature->IsReturnTypeVoid() ? INVALID_INDEX : ConvertIntermediate(functionSignature->GetUnsafeReturnTypePointer());
+		return AddNode(Kind::FUNCTION_SIGNATURE, name, AddList({ params, returnType }));
+	}
+
+	case mcf::AST::Intermediate::Type::FUNCTION_PARAMS: __COUNTER__;
+	{
+		const mcf::AST::Intermediate::FunctionParams* functionParams = static_cast<const mcf::AST::Intermediate::FunctionParams*>(intermediate);
+		std::vector<Index> params;
+		const size_t paramCount = functionParams->GetParamCount();
+		for (size_t i = 0; i < paramCount; i++)
+		{
+			params.emplace_back(ConvertIntermediate(functionParams->GetUnsafeParamPointerAt(i)));
+		}
+		const Index variadic = functionParams->HasVariadic() ? ConvertIntermediate(functionParams->GetUnsafeVariadic()) : INVALID_INDEX;
+		return AddNode(Kind::FUNCTION_PARAMS, AddList(params), variadic);
+	}
+
+	case mcf::AST::Intermediate::Type::STATEMENTS: __COUNTER__; [[fallthrough]];
+	default:
+		MCF_DEBUG_BREAK(u8"예상치 못한 값이 들어왔습니다. IntermediateType=%zu", mcf::ENUM_INDEX(intermediate->GetIntermediateType()));
+		break;
+	}
+	constexpr const size_t INTERMEDIATE_TYPE_COUNT = __COUNTER__ - INTERMEDIATE_TYPE_COUNT_BEGIN;
+	static_assert(static_cast<size_t>(mcf::AST::Intermediate::Type::COUNT) == INTERMEDIATE_TYPE_COUNT, "intermediate type count is changed. this SWITCH need to be changed as well.");
+	return AddNode(Kind::INVALID, INVALID_INDEX, INVALID_INDEX);
+}
+
+const mcf::AST::Flat::Index mcf::AST::Flat::Program::ConvertExpression(const mcf::AST::Expression::Interface* expression) noexcept
+{
+	MCF_DEBUG_ASSERT(expression != nullptr, u8"인자로 받은 expression는 nullptr 여선 안됩니다.");
+
+	constexpr const size_t EXPRESSION_TYPE_COUNT_BEGIN = __COUNTER__;
+	switch (expression->GetExpressionType())
+	{
+	case mcf::AST::Expression::Type::INVALID:
+		return AddNode(Kind::INVALID, INVALID_INDEX, INVALID_INDEX);
+
+	case mcf::AST::Expression::Type::IDENTIFIER: __COUNTER__;
+		return AddNode(Kind::IDENTIFIER, static_cast<const mcf::AST::Expression::Identifier*>(expression)->GetToken(), INVALID_INDEX, INVALID_INDEX);
+
+	case mcf::AST::Expression::Type::INTEGER: __COUNTER__;
+		return AddNode(Kind::INTEGER, static_cast<const mcf::AST::Expression::Integer*>(expression)->GetToken(), INVALID_INDEX, INVALID_INDEX);
+
+	case mcf::AST::Expression::Type::STRING: __COUNTER__;
+		return AddNode(Kind::STRING, static_cast<const mcf::AST::Expression::String*>(expression)->GetToken(), INVALID_INDEX, INVALID_INDEX);
+
+	case mcf::AST::Expression::Type::PREFIX: __COUNTER__;
+	{
+		const mcf::AST::Expression::Prefix* prefix = static_cast<const mcf::AST::Expression::Prefix*>(expression);
+		return AddNode(Kind::PREFIX, prefix->GetPrefixOperator(), ConvertExpression(prefix->GetUnsafeRightExpressionPointer()), INVALID_INDEX);
+	}
+
+	case mcf::AST::Expression::Type::GROUP: __COUNTER__;
+		return AddNode(Kind::GROUP, ConvertExpression(static_cast<const mcf::AST::Expression::Group*>(expression)->GetUnsafeExpressionPointer()), INVALID_INDEX);
+
+	case mcf::AST::Expression::Type::INFIX: __COUNTER__;
+	{
+		const mcf::AST::Expression::Infix* infix = static_cast<const mcf::AST::Expression::Infix*>(expression);
+		const Index left = ConvertExpression(infix->GetUnsafeLeftExpressionPointer());
+		const Index right = ConvertExpression(infix->GetUnsafeRightExpressionPointer());
+		return AddNode(Kind::INFIX, infix->GetInfixOperator(), left, right);
+	}
+
+	case mcf::AST::Expression::Type::CALL: __COUNTER__;
+	{
+		const mcf::AST::Expression::Call* call = static_cast<const mcf::AST::Expression::Call*>(expression);
+		const Index left = ConvertExpression(call->GetUnsafeLeftExpressionPointer());
+		std::vector<Index> params;
+		const size_t paramCount = call->GetParamExpressionsCount();
+		for (size_t i = 0; i < paramCount; i++)
+		{
+			params.emplace_back(ConvertExpression(call->GetUnsafeParamExpressionPointerAt(i)));
+		}
+		return AddNode(Kind::CALL, left, AddList(params));
+	}
+
+	case mcf::AST::Expression::Type::AS: __COUNTER__;
+	{
+		const mcf::AST::Expression::As* as = static_cast<const mcf::AST::Expression::As*>(expression);
+		const Index left = ConvertExpression(as->GetUnsafeLeftExpressionPointer());
+		const Index typeSignature = ConvertIntermediate(as->GetUnsafeTypeSignatureIntermediatePointer());
+		return AddNode(Kind::AS, left, typeSignature);
+	}
+
+	case mcf::AST::Expression::Type::INDEX: __COUNTER__;
+	{
+		const mcf::AST::Expression::Index* index = static_cast<const mcf::AST::Expression::Index*>(expression);
+		const Index left = ConvertExpression(index->GetUnsafeLeftExpressionPointer());
+		const Index indexExpression = index->GetUnsafeIndexExpressionPointer() == nullptr ? INVALID_INDEX : ConvertExpression(index->GetUnsafeIndexExpressionPointer());
+		return AddNode(Kind::INDEX, left, indexExpression);
+	}
+
+	case mcf::AST::Expression::Type::INITIALIZER: __COUNTER__;
+	{
+		const mcf::AST::Expression::Initializer* initializer = static_cast<const mcf::AST::Expression::Initializer*>(expression);
+		std::vector<Index> keys;
+		const size_t keyCount = initializer->GetKeyExpressionCount();
+		for (size_t i = 0; i < keyCount; i++)
+		{
+			keys.emplace_back(ConvertExpression(initializer->GetUnsafeKeyExpressionPointerAt(i)));
+		}
+		return AddNode(Kind::INITIALIZER, AddList(keys), INVALID_INDEX);
+	}
+
+	case mcf::AST::Expression::Type::MAP_INITIALIZER: __COUNTER__;
+	{
+		const mcf::AST::Expression::MapInitializer* mapInitializer = static_cast<const mcf::AST::Expression::MapInitializer*>(expression);
+		std::vector<Index> keys;
+		std::vector<Index> values;
+		const size_t keyCount = mapInitializer->GetKeyExpressionCount();
+		for (size_t i = 0; i < keyCount; i++)
+		{
+			keys.emplace_back(ConvertExpression(mapInitializer->GetUnsafeKeyExpressionPointerAt(i)));
+			values.emplace_back(ConvertExpression(mapInitializer->GetUnsafeValueExpressionPointerAt(i)));
+		}
+		const Index keyList = AddList(keys);
+		return AddNode(Kind::MAP_INITIALIZER, keyList, AddList(values));
+	}
+
+	default:
+		MCF_DEBUG_BREAK(u8"예상치 못한 값이 들어왔습니다. ExpressionType=%s(%zu)", mcf::AST::Expression::CONVERT_TYPE_TO_STRING(expression->GetExpressionType()), mcf::ENUM_INDEX(expression->GetExpressionType()));
+		break;
+	}
+	constexpr const size_t EXPRESSION_TYPE_COUNT = __COUNTER__ - EXPRESSION_TYPE_COUNT_BEGIN;
+	static_assert(static_cast<size_t>(mcf::AST::Expression::Type::COUNT) == EXPRESSION_TYPE_COUNT, "expression type count is changed. this SWITCH need to be changed as well.");
+	return AddNode(Kind::INVALID, INVALID_INDEX, INVALID_INDEX);
+}
+
+const mcf::AST::Flat::Index mcf::AST::Flat::Program::AddNode(const Kind kind, const Index left, const Index right) noexcept
+{
+	MCF_DEBUG_ASSERT(_kinds.size() < INVALID_INDEX, u8"노드 갯수가 32비트 인덱스 범위를 넘었습니다.");
+	_kinds.emplace_back(kind);
+	_nodes.emplace_back(Node{ INVALID_INDEX, left, right });
+	return static_cast<Index>(_kinds.size() - 1);
+}
+
+const mcf::AST::Flat::Index mcf::AST::Flat::Program::AddNode(const Kind kind, const mcf::Token::Data& token, const Index left, const Index right) noexcept
+{
+	const Index node = AddNode(kind, left, right);
+	_nodes[node].Token = static_cast<Index>(_tokens.size());
+	_tokens.emplace_back(token);
+	return node;
+}
+
+const mcf::AST::Flat::Index mcf::AST::Flat::Program::AddList(const std::vector<Index>& items) noexcept
+{
+	const Index list = static_cast<Index>(_lists.size());
+	_lists.emplace_back(static_cast<Index>(items.size()));
+	_lists.insert(_lists.end(), items.begin(), items.end());
+	return list;
+}
+
+namespace mcf
+{
+	namespace AST
+	{
+		namespace Cache
+		{
+			namespace Internal
+			{
+				constexpr const char MAGIC[4] = { 'M', 'C', 'F', 'A' };
+
+				// 캐시 파일은 [Header, Node 배열, SerializedToken 배열, 리스트 배열, 문장 배열, Kind 배열] 순서이며 실행한 머신의 바이트 순서를 사용합니다.
+				struct Header final
+				{
+					char Magic[4];
+					std::uint32_t Version;
+					std::uint64_t SourceHash;
+					std::uint32_t SourceLength;
+					std::uint32_t NodeCount;
+					std::uint32_t TokenCount;
+					std::uint32_t ListCount;
+					std::uint32_t StatementCount;
+					std::uint32_t PayloadHash;	// 헤더 뒤의 모든 바이트를 HashSource 로 해시한 값의 아래 32비트입니다.
+				};
+				static_assert(sizeof(Header) == 40, "cache header must be 40 bytes.");
+
+				// 토큰의 문자열은 소스 버퍼의 [Offset, Offset + Length) 범위입니다.
+				struct SerializedToken final
+				{
+					mcf::Token::Type Type;
+					unsigned char Padding[3];
+					std::uint32_t Offset;
+					std::uint32_t Length;
+				};
+				static_assert(sizeof(SerializedToken) == 12, "serialized token must be 12 bytes.");
+
+				template <class T>
+				inline static void APPEND_ARRAY(_Inout_ std::string& outBinary, const std::vector<T>& values) noexcept
+				{
+					static_assert(std::is_trivially_copyable<T>::value, "serialized array element must be trivially copyable.");
+					outBinary.append(reinterpret_cast<const char*>(values.data()), sizeof(T) * values.size());
+				}
+
+				inline static const std::uint32_t HASH_PAYLOAD(const std::string_view binary) noexcept
+				{
+					return static_cast<std::uint32_t>(mcf::AST::Cache::HashSource(binary.substr(sizeof(Header))));
+				}
+
+				// 노드의 Left, Right 가 담는 값의 종류입니다.
+				enum class Operand : unsigned char
+				{
+					NONE,	// INVALID_INDEX 여야 합니다.
+					NODE,	// 먼저 만들어진 노드의 인덱스 또는 INVALID_INDEX 입니다.
+					LIST,	// 리스트 배열의 인덱스이며 리스트의 항목은 NODE 와 같습니다.
+					VALUE,	// 인덱스가 아닌 값입니다.
+				};
+
+				struct NodeLayout final
+				{
+					bool HasToken;
+					Operand Left;
+					Operand Right;
+				};
+
+				// Flat::Kind 의 주석과 같아야 합니다.
+				inline static const NodeLayout GET_NODE_LAYOUT(const mcf::AST::Flat::Kind kind) noexcept
+				{
+					using Kind = mcf::AST::Flat::Kind;
+					constexpr const size_t KIND_COUNT_BEGIN = __COUNTER__;
+					switch (kind)
+					{
+					case Kind::INVALID:							return { false, Operand::NONE, Operand::NONE };
+					case Kind::IDENTIFIER: __COUNTER__;			return { true, Operand::NONE, Operand::NONE };
+					case Kind::INTEGER: __COUNTER__;			return { true, Operand::NONE, Operand::NONE };
+					case Kind::STRING: __COUNTER__;				return { true, Operand::NONE, Operand::NONE };
+					case Kind::PREFIX: __COUNTER__;				return { true, Operand::NODE, Operand::NONE };
+					case Kind::GROUP: __COUNTER__;				return { false, Operand::NODE, Operand::NONE };
+					case Kind::INFIX: __COUNTER__;				return { true, Operand::NODE, Operand::NODE };
+					case Kind::CALL: __COUNTER__;				return { false, Operand::NODE, Operand::LIST };
+					case Kind::AS: __COUNTER__;					return { false, Operand::NODE, Operand::NODE };
+					case Kind::INDEX: __COUNTER__;				return { false, Operand::NODE, Operand::NODE };
+					case Kind::INITIALIZER: __COUNTER__;		return { false, Operand::LIST, Operand::NONE };
+					case Kind::MAP_INITIALIZER: __COUNTER__;	return { false, Operand::LIST, Operand::LIST };
+					case Kind::VARIADIC: __COUNTER__;			return { false, Operand::NODE, Operand::NONE };
+					case Kind::TYPE_SIGNATURE: __COUNTER__;		return { false, Operand::NODE, Operand::VALUE };
+					case Kind::VARIABLE_SIGNATURE: __COUNTER__;	return { false, Operand::NODE, Operand::NODE };
+					case Kind::FUNCTION_PARAMS: __COUNTER__;	return { false, Operand::LIST, Operand::NODE };
+					case Kind::FUNCTION_SIGNATURE: __COUNTER__;	return { false, Operand::NODE, Operand::LIST };
+					case Kind::INCLUDE_LIBRARY: __COUNTER__;	return { true, Operand::NONE, Operand::NONE };
+					case Kind::TYPEDEF: __COUNTER__;			return { false, Operand::NODE, Operand::NONE };
+					case Kind::EXTERN: __COUNTER__;				return { false, Operand::NODE, Operand::NONE };
+					case Kind::LET: __COUNTER__;				return { false, Operand::NODE, Operand::NODE };
+					case Kind::BLOCK: __COUNTER__;				return { false, Operand::LIST, Operand::NONE };
+					case Kind::RETURN: __COUNTER__;				return { false, Operand::NODE, Operand::NONE };
+					case Kind::FUNC: __COUNTER__;				return { false, Operand::NODE, Operand::NODE };
+					case Kind::MAIN: __COUNTER__;				return { false, Operand::LIST, Operand::NONE };
+					case Kind::EXPRESSION: __COUNTER__;			return { false, Operand::NODE, Operand::NONE };
+					case Kind::ASSIGN_EXPRESSION: __COUNTER__;	return { false, Operand::NODE, Operand::NODE };
+					case Kind::UNUSED: __COUNTER__;				return { false, Operand::LIST, Operand::NONE };
+					case Kind::WHILE: __COUNTER__;				return { false, Operand::NODE, Operand::NODE };
+					case Kind::BREAK: __COUNTER__;				return { true, Operand::NONE, Operand::NONE };
+
+					default:
+						break;
+					}
+					constexpr const size_t KIND_COUNT = __COUNTER__ - KIND_COUNT_BEGIN;
+					static_assert(static_cast<size_t>(Kind::COUNT) == KIND_COUNT, "flat node kind count is changed. this SWITCH need to be changed as well.");
+					return { false, Operand::NONE, Operand::NONE };
+				}
+
+				// 노드는 자식을 모두 만든 뒤에 만들어지므로 자식의 인덱스는 항상 부모보다 작습니다. 이를 검사하여 손상된 파일로 순환하는 트리를 만들지 않습니다.
+				inline static const bool IS_VALID_OPERAND(const Operand operand, const mcf::AST::Flat::Index value, const mcf::AST::Flat::Index node, const std::vector<mcf::AST::Flat::Index>& lists) noexcept
+				{
+					constexpr const size_t OPERAND_COUNT_BEGIN = __COUNTER__;
+					switch (operand)
+					{
+					case Operand::NONE:
+						return value == mcf::AST::Flat::INVALID_INDEX;
+
+					case Operand::NODE: __COUNTER__;
+						return value == mcf::AST::Flat::INVALID_INDEX || value < node;
+
+					case Operand::LIST: __COUNTER__;
+					{
+						if (value >= lists.size() || lists[value] > lists.size() - value - 1)
+						{
+							return false;
+						}
+						const size_t itemCount = lists[value];
+						for (size_t i = 0; i < itemCount; i++)
+						{
+							const mcf::AST::Flat::Index item = lists[value + 1 + i];
+							if (item != mcf::AST::Flat::INVALID_INDEX && item >= node)
+							{
+								return false;
+							}
+						}
+						return true;
+					}
+
+					case Operand::VALUE: __COUNTER__;
+						return true;
+
+					default:
+						break;
+					}
+					constexpr const size_t OPERAND_COUNT = __COUNTER__ - OPERAND_COUNT_BEGIN;
+					static_assert(OPERAND_COUNT == 4, "operand count is changed. this SWITCH need to be changed as well.");
+					return false;
+				}
+
+				using KindPredicate = const bool (*)(const mcf::AST::Flat::Kind kind);
+
+				template <mcf::AST::Flat::Kind KIND>
+				inline static const bool IS_KIND(const mcf::AST::Flat::Kind kind) noexcept { return kind == KIND; }
+				inline static const bool IS_EXPRESSION_KIND(const mcf::AST::Flat::Kind kind) noexcept { return mcf::AST::Flat::Kind::IDENTIFIER <= kind && kind <= mcf::AST::Flat::Kind::MAP_INITIALIZER; }
+				inline static const bool IS_STATEMENT_KIND(const mcf::AST::Flat::Kind kind) noexcept { return mcf::AST::Flat::Kind::INCLUDE_LIBRARY <= kind && kind <= mcf::AST::Flat::Kind::BREAK; }
+
+				// child 는 IS_VALID_OPERAND 로 범위를 검사한 인덱스여야 합니다.
+				inline static const bool IS_VALID_CHILD(const mcf::AST::Flat::Index child, const bool isOptional, const KindPredicate predicate, const std::vector<mcf::AST::Flat::Kind>& kinds) noexcept
+				{
+					return (child == mcf::AST::Flat::INVALID_INDEX) ? isOptional : predicate(kinds[child]);
+				}
+
+				inline static const bool IS_VALID_LIST(const mcf::AST::Flat::Index list, const KindPredicate predicate, const std::vector<mcf::AST::Flat::Kind>& kinds, const std::vector<mcf::AST::Flat::Index>& lists) noexcept
+				{
+					const size_t itemCount = lists[list];
+					for (size_t i = 0; i < itemCount; i++)
+					{
+						if (IS_VALID_CHILD(lists[list + 1 + i], false, predicate, kinds) == false)
+						{
+							return false;
+						}
+					}
+					return true;
+				}
+
+				// 자식이 Flat::Kind 의 주석에 적힌 종류인지 검사합니다. 평가기는 자식의 종류를 다시 확인하지 않으므로, 해시가 맞는 조작된 캐시 파일로
+				// 예를 들어 본문이 BLOCK 이 아닌 FUNC 를 읽으면 INVALID_INDEX 로 인덱싱하게 됩니다. 노드의 Left, Right 는 IS_VALID_OPERAND 로 먼저 검사해야 합니다.
+				inline static const bool IS_VALID_CHILDREN(const mcf::AST::Flat::Kind kind, const mcf::AST::Flat::Node& node, const std::vector<mcf::AST::Flat::Kind>& kinds, const std::vector<mcf::AST::Flat::Index>& lists) noexcept
+				{
+					using Kind = mcf::AST::Flat::Kind;
+					constexpr const size_t KIND_COUNT_BEGIN = __COUNTER__;
+					switch (kind)
+					{
+					case Kind::INVALID:
+						return false;
+
+					case Kind::IDENTIFIER: __COUNTER__; [[fallthrough]];
+					case Kind::INTEGER: __COUNTER__; [[fallthrough]];
+					case Kind::STRING: __COUNTER__; [[fallthrough]];
+					case Kind::INCLUDE_LIBRARY: __COUNTER__; [[fallthrough]];
+					case Kind::BREAK: __COUNTER__;
+						return true;
+
+					case Kind::PREFIX: __COUNTER__; [[fallthrough]];
+					case Kind::GROUP: __COUNTER__; [[fallthrough]];
+					case Kind::RETURN: __COUNTER__; [[fallthrough]];
+					case Kind::EXPRESSION: __COUNTER__;
+						return IS_VALID_CHILD(node.Left, false, IS_EXPRESSION_KIND, kinds);
+
+					case Kind::INFIX: __COUNTER__; [[fallthrough]];
+					case Kind::ASSIGN_EXPRESSION: __COUNTER__;
+						return IS_VALID_CHILD(node.Left, false, IS_EXPRESSION_KIND, kinds) && IS_VALID_CHILD(node.Right, false, IS_EXPRESSION_KIND, kinds);
+
+					case Kind::CALL: __COUNTER__;
+						return IS_VALID_CHILD(node.Left, false, IS_EXPRESSION_KIND, kinds) && IS_VALID_LIST(node.Right, IS_EXPRESSION_KIND, kinds, lists);
+
+					case Kind::AS: __COUNTER__;
+						return IS_VALID_CHILD(node.Left, false, IS_EXPRESSION_KIND, kinds) && IS_VALID_CHILD(node.Right, false, IS_KIND<Kind::TYPE_SIGNATURE>, kinds);
+
+					case Kind::INDEX: __COUNTER__;
+						return IS_VALID_CHILD(node.Left, false, IS_EXPRESSION_KIND, kinds) && IS_VALID_CHILD(node.Right, true, IS_EXPRESSION_KIND, kinds);
+
+					case Kind::INITIALIZER: __COUNTER__;
+						return IS_VALID_LIST(node.Left, IS_EXPRESSION_KIND, kinds, lists);
+
+					case Kind::MAP_INITIALIZER: __COUNTER__;
+						return lists[node.Left] == lists[node.Right] && IS_VALID_LIST(node.Left, IS_EXPRESSION_KIND, kinds, lists) && IS_VALID_LIST(node.Right, IS_EXPRESSION_KIND, kinds, lists);
+
+					case Kind::VARIADIC: __COUNTER__;
+						return IS_VALID_CHILD(node.Left, false, IS_KIND<Kind::IDENTIFIER>, kinds);
+
+					case Kind::TYPE_SIGNATURE: __COUNTER__;
+						return IS_VALID_CHILD(node.Left, false, IS_EXPRESSION_KIND, kinds) && node.Right <= 1;
+
+					case Kind::VARIABLE_SIGNATURE: __COUNTER__;
+						return IS_VALID_CHILD(node.Left, false, IS_KIND<Kind::IDENTIFIER>, kinds) && IS_VALID_CHILD(node.Right, false, IS_KIND<Kind::TYPE_SIGNATURE>, kinds);
+
+					case Kind::FUNCTION_PARAMS: __COUNTER__;
+						return IS_VALID_LIST(node.Left, IS_KIND<Kind::VARIABLE_SIGNATURE>, kinds, lists) && IS_VALID_CHILD(node.Right, true, IS_KIND<Kind::VARIADIC>, kinds);
+
+					case Kind::FUNCTION_SIGNATURE: __COUNTER__;
+						return IS_VALID_CHILD(node.Left, false, IS_KIND<Kind::IDENTIFIER>, kinds) && lists[node.Right] == 2 &&
+							IS_VALID_CHILD(lists[node.Right + 1], false, IS_KIND<Kind::FUNCTION_PARAMS>, kinds) && IS_VALID_CHILD(lists[node.Right + 2], true, IS_KIND<Kind::TYPE_SIGNATURE>, kinds);
+
+					case Kind::TYPEDEF: __COUNTER__;
+						return IS_VALID_CHILD(node.Left, false, IS_KIND<Kind::VARIABLE_SIGNATURE>, kinds);
+
+					case Kind::EXTERN: __COUNTER__;
+						return IS_VALID_CHILD(node.Left, false, IS_KIND<Kind::FUNCTION_SIGNATURE>, kinds);
+
+					case Kind::LET: __COUNTER__;
+						return IS_VALID_CHILD(node.Left, false, IS_KIND<Kind::VARIABLE_SIGNATURE>, kinds) && IS_VALID_CHILD(node.Right, true, IS_EXPRESSION_KIND, kinds);
+
+					case Kind::BLOCK: __COUNTER__;
+						return IS_VALID_LIST(node.Left, IS_STATEMENT_KIND, kinds, lists);
+
+					case Kind::FUNC: __COUNTER__;
+						return IS_VALID_CHILD(node.Left, false, IS_KIND<Kind::FUNCTION_SIGNATURE>, kinds) && IS_VALID_CHILD(node.Right, false, IS_KIND<Kind::BLOCK>, kinds);
+
+					case Kind::MAIN: __COUNTER__;
+						return lists[node.Left] == 3 && IS_VALID_CHILD(lists[node.Left + 1], false, IS_KIND<Kind::FUNCTION_PARAMS>, kinds) &&
+							IS_VALID_CHILD(lists[node.Left + 2], true, IS_KIND<Kind::TYPE_SIGNATURE>, kinds) && IS_VALID_CHILD(lists[node.Left + 3], false, IS_KIND<Kind::BLOCK>, kinds);
+
+					case Kind::UNUSED: __COUNTER__;
+						return IS_VALID_LIST(node.Left, IS_KIND<Kind::IDENTIFIER>, kinds, lists);
+
+					case Kind::WHILE: __COUNTER__;
+						return IS_VALID_CHILD(node.Left, false, IS_EXPRESSION_KIND, kinds) && IS_VALID_CHILD(node.Right, false, IS_KIND<Kind::BLOCK>, kinds);
+
+					default:
+						break;
+					}
+					constexpr const size_t KIND_COUNT = __COUNTER__ - KIND_COUNT_BEGIN;
+					static_assert(static_cast<size_t>(Kind::COUNT) == KIND_COUNT, "flat node kind count is changed. this SWITCH need to be changed as well.");
+					return false;
+				}
+
+				// 매핑된 파일은 정렬을 보장하지 않으므로 memcpy 로 복사합니다.
+				template <class T>
+				inline static const bool READ_ARRAY(_Out_ std::vector<T>& outValues, const std::string_view binary, _Inout_ size_t& inOutPosition, const size_t count) noexcept
+				{
+					static_assert(std::is_trivially_copyable<T>::value, "serialized array element must be trivially copyable.");
+					if (count > (binary.size() - inOutPosition) / sizeof(T))
+					{
+						return false;
+					}
+					outValues.resize(count);
+					if (count != 0)
+					{
+						memcpy(outValues.data(), binary.data() + inOutPosition, sizeof(T) * count);
+					}
+					inOutPosition += sizeof(T) * count;
+					return true;
+				}
+			}
+		}
+	}
+}
+
+const bool mcf::AST::Flat::Program::Serialize(_Out_ std::string& outBinary, const std::uint64_t sourceHash) const noexcept
+{
+	if (_source == nullptr)
+	{
+		return false;
+	}
+
+	const std::string_view view = _source->GetView();
+	std::vector<mcf::AST::Cache::Internal::SerializedToken> tokens;
+	tokens.reserve(_tokens.size());
+	for (const mcf::Token::Data& token : _tokens)
+	{
+		// 리터럴이 소스 버퍼의 Offset 위치를 가리키는 토큰만 위치로 저장할 수 있습니다.
+		if (token.Offset > view.size() || token.Literal.size() > view.size() - token.Offset || token.Literal.data() != view.data() + token.Offset)
+		{
+			return false;
+		}
+		tokens.emplace_back(mcf::AST::Cache::Internal::SerializedToken{ token.Type, { 0, 0, 0 }, token.Offset, static_cast<std::uint32_t>(token.Literal.size()) });
+	}
+
+	const mcf::AST::Cache::Internal::Header header =
+	{
+		{ mcf::AST::Cache::Internal::MAGIC[0], mcf::AST::Cache::Internal::MAGIC[1], mcf::AST::Cache::Internal::MAGIC[2], mcf::AST::Cache::Internal::MAGIC[3] },
+		mcf::AST::Cache::VERSION,
+		sourceHash,
+		static_cast<std::uint32_t>(view.size()),
+		static_cast<std::uint32_t>(_nodes.size()),
+		static_cast<std::uint32_t>(tokens.size()),
+		static_cast<std::uint32_t>(_lists.size()),
+		static_cast<std::uint32_t>(_statements.size()),
+		0,
+	};
+
+	outBinary.clear();
+	outBinary.reserve(sizeof(header) + sizeof(Node) * _nodes.size() + sizeof(mcf::AST::Cache::Internal::SerializedToken) * tokens.size() + sizeof(Index) * (_lists.size() + _statements.size()) + _kinds.size());
+	outBinary.append(reinterpret_cast<const char*>(&header), sizeof(header));
+	mcf::AST::Cache::Internal::APPEND_ARRAY(outBinary, _nodes);
+	mcf::AST::Cache::Internal::APPEND_ARRAY(outBinary, tokens);
+	mcf::AST::Cache::Internal::APPEND_ARRAY(outBinary, _lists);
+	mcf::AST::Cache::Internal::APPEND_ARRAY(outBinary, _statements);
+	mcf::AST::Cache::Internal::APPEND_ARRAY(outBinary, _kinds);
+
+	const std::uint32_t payloadHash = mcf::AST::Cache::Internal::HASH_PAYLOAD(outBinary);
+	memcpy(outBinary.data() + offsetof(mcf::AST::Cache::Internal::Header, PayloadHash), &payloadHash, sizeof(payloadHash));
+	return true;
+}
+
+const bool mcf::AST::Flat::Program::Deserialize(const std::string_view binary, const mcf::Lexer::Source& source, const std::uint64_t sourceHash, const std::shared_ptr<mcf::Symbol::Table>& symbols) noexcept
+{
+	if (source == nullptr || binary.size() < sizeof(mcf::AST::Cache::Internal::Header))
+	{
+		return false;
+	}
+
+	const std::string_view view = source->GetView();
+	mcf::AST::Cache::Internal::Header header;
+	memcpy(&header, binary.data(), sizeof(header));
+	if (memcmp(header.Magic, mcf::AST::Cache::Internal::MAGIC, sizeof(header.Magic)) != 0 || header.Version != mcf::AST::Cache::VERSION || header.SourceHash != sourceHash || header.SourceLength != view.size() ||
+		header.PayloadHash != mcf::AST::Cache::Internal::HASH_PAYLOAD(binary))
+	{
+		return false;
+	}
+
+	size_t position = sizeof(header);
+	std::vector<Node> nodes;
+	std::vector<mcf::AST::Cache::Internal::SerializedToken> serializedTokens;
+	std::vector<Index> lists;
+	std::vector<Index> statements;
+	std::vector<Kind> kinds;
+	if (mcf::AST::Cache::Internal::READ_ARRAY(nodes, binary, position, header.NodeCount) == false ||
+		mcf::AST::Cache::Internal::READ_ARRAY(serializedTokens, binary, position, header.TokenCount) == false ||
+		mcf::AST::Cache::Internal::READ_ARRAY(lists, binary, position, header.ListCount) == false ||
+		mcf::AST::Cache::Internal::READ_ARRAY(statements, binary, position, header.StatementCount) == false ||
+		mcf::AST::Cache::Internal::READ_ARRAY(kinds, binary, position, header.NodeCount) == false ||
+		position != binary.size())
+	{
+		return false;
+	}
+
+	// 해시가 맞더라도 손상되거나 조작된 캐시 파일로 범위를 벗어나 읽지 않도록 노드의 종류에 맞게 토큰, 자식, 리스트, 문장의 인덱스와 자식의 종류를 모두 검사합니다.
+	for (size_t i = 0; i < nodes.size(); i++)
+	{
+		if (mcf::ENUM_INDEX(kinds[i]) >= mcf::ENUM_COUNT<Kind>())
+		{
+			return false;
+		}
+
+		const Node& node = nodes[i];
+		const mcf::AST::Cache::Internal::NodeLayout layout = mcf::AST::Cache::Internal::GET_NODE_LAYOUT(kinds[i]);
+		if ((layout.HasToken ? node.Token >= header.TokenCount : node.Token != INVALID_INDEX) ||
+			mcf::AST::Cache::Internal::IS_VALID_OPERAND(layout.Left, node.Left, static_cast<Index>(i), lists) == false ||
+			mcf::AST::Cache::Internal::IS_VALID_OPERAND(layout.Right, node.Right, static_cast<Index>(i), lists) == false ||
+			mcf::AST::Cache::Internal::IS_VALID_CHILDREN(kinds[i], node, kinds, lists) == false)
+		{
+			return false;
+		}
+	}
+	for (const Index statement : statements)
+	{
+		if (statement >= header.NodeCount || mcf::AST::Cache::Internal::IS_STATEMENT_KIND(kinds[statement]) == false)
+		{
+			return false;
+		}
+	}
+
+	std::vector<mcf::Token::Data> tokens;
+	tokens.reserve(serializedTokens.size());
+	for (const mcf::AST::Cache::Internal::SerializedToken& serializedToken : serializedTokens)
+	{
+		if (mcf::ENUM_INDEX(serializedToken.Type) >= mcf::ENUM_COUNT<mcf::Token::Type>() || serializedToken.Offset > view.size() || serializedToken.Length > view.size() - serializedToken.Offset)
+		{
+			return false;
+		}
+
+		mcf::Token::Data token = { serializedToken.Type, view.substr(serializedToken.Offset, serializedToken.Length), serializedToken.Offset };
+		// 렉서와 같이 식별자 토큰에만 심볼을 지정합니다.
+		if (symbols != nullptr && token.Type == mcf::Token::Type::IDENTIFIER)
+		{
+			token.Symbol = symbols->Intern(token.Literal);
+		}
+		tokens.emplace_back(token);
+	}
+
+	_kinds = std::move(kinds);
+	_nodes = std::move(nodes);
+	_tokens = std::move(tokens);
+	_lists = std::move(lists);
+	_statements = std::move(statements);
+	_source = source;
+	_sharedSources.clear();
+	_symbols = symbols;
+	return true;
+}
+
+const std::uint64_t mcf::AST::Cache::HashSource(const std::string_view source) noexcept
+{
+	constexpr const std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+	constexpr const std::uint64_t FNV_PRIME = 1099511628211ULL;
+
+	// 곱셈은 아래 비트를 위로만 퍼뜨리므로 8바이트마다 위 비트를 아래로 섞습니다.
+	std::uint64_t hash = (FNV_OFFSET_BASIS ^ static_cast<std::uint64_t>(source.size())) * FNV_PRIME;
+	size_t position = 0;
+	for (; position + sizeof(std::uint64_t) <= source.size(); position += sizeof(std::uint64_t))
+	{
+		std::uint64_t word;
+		memcpy(&word, source.data() + position, sizeof(word));
+		hash = (hash ^ word) * FNV_PRIME;
+		hash ^= hash >> 29;
+	}
+	for (; position < source.size(); ++position)
+	{
+		hash = (hash ^ static_cast<unsigned char>(source[position])) * FNV_PRIME;
+	}
+	return hash;
+}
+
+const std::string mcf::AST::Cache::MakeFilePath(const std::string& cacheDirectory, const std::uint64_t sourceHash) noexcept
+{
+	constexpr const char HEX_DIGITS[] = "0123456789abcdef";
+	std::string fileName(sizeof(sourceHash) * 2, '0');
+	for (size_t i = 0; i < fileName.size(); ++i)
+	{
+		fileName[fileName.size() - 1 - i] = HEX_DIGITS[(sourceHash >> (i * 4)) & 0xf];
+	}
+	return (std::filesystem::path(cacheDirectory) / (fileName + mcf::AST::Cache::FILE_EXTENSION)).string();
+}
+
+const bool mcf::AST::Cache::Load(_Out_ mcf::AST::Flat::Program& outProgram, const std::string& cacheDirectory, const mcf::Lexer::Source& source, const std::shared_ptr<mcf::Symbol::Table>& symbols) noexcept
+{
+	if (source == nullptr)
+	{
+		return false;
+	}
+
+	// 캐시 파일도 소스 파일과 같이 SourceBuffer 로 메모리 매핑하여 읽습니다. 캐시 파일은 MAGIC 으로 시작하므로 BOM 으로 잘리지 않습니다.
+	const std::uint64_t sourceHash = mcf::AST::Cache::HashSource(source->GetView());
+	const mcf::Lexer::Source cacheFile = mcf::Lexer::SourceBuffer::MakeFromFile(mcf::AST::Cache::MakeFilePath(cacheDirectory, sourceHash));
+	if (cacheFile == nullptr)
+	{
+		return false;
+	}
+	return outProgram.Deserialize(cacheFile->GetView(), source, sourceHash, symbols);
+}
+
+const bool mcf::AST::Cache::Store(const mcf::AST::Flat::Program& program, const std::string& cacheDirectory) noexcept
+{
+	if (program.GetSource() == nullptr)
+	{
+		return false;
+	}
+
+	const std::uint64_t sourceHash = mcf::AST::Cache::HashSource(program.GetSource()->GetView());
+	std::string binary;
+	if (program.Serialize(binary, sourceHash) == false)
+	{
+		return false;
+	}
+
+	std::error_code error;
+	std::filesystem::create_directories(cacheDirectory, error);
+	if (error)
+	{
+		return false;
+	}
+
+	// 다른 컴파일러가 읽는 중인 파일을 덮어쓰지 않도록 임시 파일에 쓴 뒤 이름을 바꿉니다.
+	const std::string path = mcf::AST::Cache::MakeFilePath(cacheDirectory, sourceHash);
+	// 같은 캐시 파일을 동시에 쓰는 다른 프로세스와는 프로세스 ID 로, 같은 프로세스의 다른 스레드와는 카운터로 임시 파일 이름이 겹치지 않게 합니다.
+	// 시간은 종료된 프로세스의 ID 를 재사용한 프로세스가 남아있는 임시 파일과 겹치지 않도록 붙입니다. 모두 예외를 던지지 않는 값입니다.
+	static std::atomic<std::uint64_t> temporaryCounter = 0;
+#if defined(_WIN32)
+	const std::uint64_t processId = static_cast<std::uint64_t>(_getpid());
+#else
+	const std::uint64_t processId = static_cast<std::uint64_t>(getpid());
+#endif
+	const std::uint64_t time = static_cast<std::uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
+	char temporarySuffix[64];
+	snprintf(temporarySuffix, sizeof(temporarySuffix), ".%llx.%llx.%llx.tmp", static_cast<unsigned long long>(processId), static_cast<unsigned long long>(time),
+		static_cast<unsigned long long>(temporaryCounter.fetch_add(1)));
+	const std::string temporaryPath = path + temporarySuffix;
+	{
+		// 쓰기에 실패하면 파일을 닫은 뒤 쓰다 만 임시 파일을 지웁니다. close 가 실패하여도 failbit 가 켜집니다.
+		std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+		file.write(binary.data(), binary.size());
+		file.close();
+		if (file.fail())
+		{
+			std::filesystem::remove(temporaryPath, error);
+			return false;
+		}
+	}
+	std::filesystem::rename(temporaryPath, path, error);
+	if (error)
+	{
+		std::filesystem::remove(temporaryPath, error);
+		return false;
+	}
+	return true;
 }
\ No newline at end of file
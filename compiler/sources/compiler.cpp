@@ -35,7 +35,7 @@ mcf::ASM::MASM64::Typedef::Typedef(const mcf::Object::TypeInfo& definedType, con
 
 const std::string mcf::ASM::MASM64::Typedef::ConvertToString(void) const noexcept
 {
-	return _definedType.Name + " typedef " + _sourceType.Inspect();
+	return _definedType.GetName() + " typedef " + _sourceType.Inspect();
 }
 
 mcf::ASM::MASM64::Proto::Proto(const std::string& externFunction) noexcept
@@ -93,13 +93,13 @@ mcf::ASM::MASM64::GlobalVariable::GlobalVariable(const mcf::Object::Variable& va
 	, _value(value)
 {
 	MCF_DEBUG_ASSERT(_variable.IsValid(), u8"유효하지 않은 _info입니다.");
-	MCF_DEBUG_ASSERT(_value.first <= _variable.DataType.IntrinsicSize, u8"값의 데이터 크기가 변수의 타입이 허용하는 데이터의 크기보다 큽니다.");
+	MCF_DEBUG_ASSERT(_value.first <= _variable.DataType.GetIntrinsicSize(), u8"값의 데이터 크기가 변수의 타입이 허용하는 데이터의 크기보다 큽니다.");
 }
 
 const std::string mcf::ASM::MASM64::GlobalVariable::ConvertToString(void) const noexcept
 {
 	MCF_DEBUG_ASSERT(_variable.IsValid(), u8"유효하지 않은 _info입니다.");
-	MCF_DEBUG_ASSERT(_value.first <= _variable.DataType.IntrinsicSize, u8"값의 데이터 크기가 변수의 타입이 허용하는 데이터의 크기보다 큽니다.");
+	MCF_DEBUG_ASSERT(_value.first <= _variable.DataType.GetIntrinsicSize(), u8"값의 데이터 크기가 변수의 타입이 허용하는 데이터의 크기보다 큽니다.");
 
 	std::string buffer;
 	buffer = _variable.Name + " " + _variable.DataType.Inspect();
@@ -178,84 +178,38 @@ mcf::ASM::PointerVector mcf::ASM::MASM64::Compiler::Object::GenerateCodes(_In_ c
 		const mcf::IR::Interface* const irObject = program->GetUnsafeObjectPointerAt(i);
 		MCF_DEBUG_ASSERT(irObject != nullptr, u8"irObject는 nullptr이 아니어야 합니다!");
 
-		constexpr const size_t IR_TYPE_COUNT_BEGIN = __COUNTER__;
-		switch (irObject->GetType())
+		const auto checkCompiled = [](const bool isCompiled) -> void
 		{
-		case IR::Type::EXPRESSION: __COUNTER__;
-			MCF_DEBUG_TODO(u8"구현 필요");
-			break;
-
-		case IR::Type::ASM: __COUNTER__;
-			MCF_DEBUG_TODO(u8"구현 필요");
-			break;
-
-		case IR::Type::INCLUDELIB: __COUNTER__;
-			if (CompileIncludeLib(codes, static_cast<const mcf::IR::IncludeLib*>(irObject), scopeTree) == false)
-			{
-				MCF_DEBUG_TODO(u8"컴파일에 실패하였습니다!");
-			}
-			break;
-
-		case IR::Type::TYPEDEF: __COUNTER__;
-			if (CompileTypedef(codes, static_cast<const mcf::IR::Typedef*>(irObject), scopeTree) == false)
-			{
-				MCF_DEBUG_TODO(u8"컴파일에 실패하였습니다!");
-			}
-			break;
-
-		case IR::Type::EXTERN: __COUNTER__;
-			if (CompileExtern(codes, static_cast<const mcf::IR::Extern*>(irObject), scopeTree) == false)
-			{
-				MCF_DEBUG_TODO(u8"컴파일에 실패하였습니다!");
-			}
-			break;
-
-		case IR::Type::LET: __COUNTER__;
-			if (CompileLet(codes, static_cast<const mcf::IR::Let*>(irObject), scopeTree) == false)
+			if (isCompiled == false)
 			{
 				MCF_DEBUG_TODO(u8"컴파일에 실패하였습니다!");
 			}
-			break;
-
-		case IR::Type::FUNC: __COUNTER__;
-			if (CompileFunc(codes, static_cast<const mcf::IR::Func*>(irObject), scopeTree) == false)
+		};
+		mcf::IR::VISIT(irObject, mcf::Visitor
+		{
+			[&](const mcf::IR::Invalid*) -> void
 			{
-				MCF_DEBUG_TODO(u8"컴파일에 실패하였습니다!");
-			}
-			break;
-
-		case IR::Type::UNUSEDIR: __COUNTER__;
-			MCF_DEBUG_TODO(u8"구현 필요");
-			break;
-
-		case IR::Type::RETURN: __COUNTER__;
-			MCF_DEBUG_TODO(u8"구현 필요");
-			break;
-
-		case IR::Type::WHILE: __COUNTER__;
-			MCF_DEBUG_TODO(u8"구현 필요");
-			break;
-
-		case IR::Type::BREAK: __COUNTER__;
-			MCF_DEBUG_TODO(u8"구현 필요");
-			break;
-
-		case IR::Type::PROGRAM: __COUNTER__;
-			MCF_DEBUG_TODO(u8"구현 필요");
-			break;
-
-		default:
-			MCF_DEBUG_TODO(u8"예상치 못한 값이 들어왔습니다. 에러가 아닐 수도 있습니다. 확인 해 주세요. GetType=%s(%zu) Inspect=`%s`",
-				mcf::IR::CONVERT_TYPE_TO_STRING(irObject->GetType()), mcf::ENUM_INDEX(irObject->GetType()), irObject->Inspect().c_str());
-			break;
-		}
-		constexpr const size_t IR_TYPE_COUNT = __COUNTER__ - IR_TYPE_COUNT_BEGIN;
-		static_assert(static_cast<size_t>(mcf::IR::Type::COUNT) == IR_TYPE_COUNT, "Generate ASM codes by IR statements.");
+				MCF_DEBUG_TODO(u8"예상치 못한 값이 들어왔습니다. 에러가 아닐 수도 있습니다. 확인 해 주세요. GetType=%s(%zu) Inspect=`%s`",
+					mcf::IR::CONVERT_TYPE_TO_STRING(irObject->GetType()), mcf::ENUM_INDEX(irObject->GetType()), irObject->Inspect().c_str());
+			},
+			[&](const mcf::IR::Expression::Interface*) -> void { MCF_DEBUG_TODO(u8"구현 필요"); },
+			[&](const mcf::IR::ASM::Interface*) -> void { MCF_DEBUG_TODO(u8"구현 필요"); },
+			[&](const mcf::IR::IncludeLib* includeLib) -> void { checkCompiled(CompileIncludeLib(codes, includeLib, scopeTree)); },
+			[&](const mcf::IR::Typedef* typedefIR) -> void { checkCompiled(CompileTypedef(codes, typedefIR, scopeTree)); },
+			[&](const mcf::IR::Extern* externIR) -> void { checkCompiled(CompileExtern(codes, externIR, scopeTree)); },
+			[&](const mcf::IR::Let* let) -> void { checkCompiled(CompileLet(codes, let, scopeTree)); },
+			[&](const mcf::IR::Func* func) -> void { checkCompiled(CompileFunc(codes, func, scopeTree)); },
+			[&](const mcf::IR::Unused*) -> void { MCF_DEBUG_TODO(u8"구현 필요"); },
+			[&](const mcf::IR::Return*) -> void { MCF_DEBUG_TODO(u8"구현 필요"); },
+			[&](const mcf::IR::While*) -> void { MCF_DEBUG_TODO(u8"구현 필요"); },
+			[&](const mcf::IR::Break*) -> void { MCF_DEBUG_TODO(u8"구현 필요"); },
+			[&](const mcf::IR::Program*) -> void { MCF_DEBUG_TODO(u8"구현 필요"); },
+		});
 	}
 
 	codes.emplace_back(mcf::ASM::MASM64::Predefined::Make("END"));
 
-	return std::move(codes);
+	return codes;
 }
 
 const bool mcf::ASM::MASM64::Compiler::Object::CompileIncludeLib(_Out_ mcf::ASM::PointerVector& outCodes, _In_ const mcf::IR::IncludeLib* irCode, _In_ const mcf::Object::ScopeTree* scopeTree) noexcept
@@ -321,123 +275,89 @@ const mcf::Object::Data mcf::ASM::MASM64::Compiler::Object::EvaluateExpressionIn
 	}
 
 	mcf::Object::Data data;
-	constexpr const size_t EXPRESSION_TYPE_COUNT_BEGIN = __COUNTER__;
-	switch (expressionIR->GetExpressionType())
-	{
-	case mcf::IR::Expression::Type::GLOBAL_VARIABLE_IDENTIFIER: __COUNTER__;
-		MCF_DEBUG_TODO(u8"구현 필요");
-		break;
-
-	case mcf::IR::Expression::Type::LOCAL_VARIABLE_IDENTIFIER: __COUNTER__;
-		MCF_DEBUG_TODO(u8"구현 필요");
-		break;
-
-	case mcf::IR::Expression::Type::FUNCTION_IDENTIFIER: __COUNTER__;
-		MCF_DEBUG_TODO(u8"구현 필요");
-		break;
-
-	case mcf::IR::Expression::Type::CALL: __COUNTER__;
-		MCF_DEBUG_TODO(u8"구현 필요");
-		break;
-
-	case mcf::IR::Expression::Type::STATIC_CAST: __COUNTER__;
-		MCF_DEBUG_TODO(u8"구현 필요");
-		break;
-
-	case mcf::IR::Expression::Type::TYPE_IDENTIFIER: __COUNTER__;
-		MCF_DEBUG_TODO(u8"구현 필요");
-		break;
-
-	case mcf::IR::Expression::Type::INTEGER: __COUNTER__;
+	mcf::IR::Expression::VISIT(expressionIR, mcf::Visitor
 	{
-		const mcf::IR::Expression::Integer* integer = static_cast<const mcf::IR::Expression::Integer*>(expressionIR);
-		if (integer->IsNaturalInteger())
+		[&](const mcf::IR::Expression::Invalid*) -> void
 		{
-			if (integer->IsUInt8())
-			{
-				data.first = data.first >= 1 ? data.first : 1;
-				data.second.emplace_back(static_cast<const mcf::IR::Expression::Integer*>(expressionIR)->GetUInt8());
-			}
-			else if (integer->IsUInt16())
-			{
-				data.first = data.first >= 1 ? data.first : 2;
-				data.second.emplace_back(static_cast<const mcf::IR::Expression::Integer*>(expressionIR)->GetUInt16());
-			}
-			else if (integer->IsUInt32())
-			{
-				data.first = data.first >= 1 ? data.first : 4;
-				data.second.emplace_back(static_cast<const mcf::IR::Expression::Integer*>(expressionIR)->GetUInt32());
-			}
-			else if (integer->IsUInt64())
-			{
-				data.first = data.first >= 1 ? data.first : 8;
-				data.second.emplace_back(static_cast<const mcf::IR::Expression::Integer*>(expressionIR)->GetUInt64());
-			}
-		}
-		else
+			MCF_DEBUG_TODO(u8"예상치 못한 값이 들어왔습니다. 에러가 아닐 수도 있습니다. 확인 해 주세요. ExpressionType=%s(%zu) ConvertedString=`%s`",
+				mcf::IR::Expression::CONVERT_TYPE_TO_STRING(expressionIR->GetExpressionType()), mcf::ENUM_INDEX(expressionIR->GetExpressionType()), expressionIR->Inspect().c_str());
+		},
+		[&](const mcf::IR::Expression::TypeIdentifier*) -> void { MCF_DEBUG_TODO(u8"구현 필요"); },
+		[&](const mcf::IR::Expression::GlobalVariableIdentifier*) -> void { MCF_DEBUG_TODO(u8"구현 필요"); },
+		[&](const mcf::IR::Expression::LocalVariableIdentifier*) -> void { MCF_DEBUG_TODO(u8"구현 필요"); },
+		[&](const mcf::IR::Expression::FunctionIdentifier*) -> void { MCF_DEBUG_TODO(u8"구현 필요"); },
+		[&](const mcf::IR::Expression::Integer* integer) -> void
 		{
-			if (integer->IsInt8())
-			{
-				data.first = data.first >= 1 ? data.first : 1;
-				data.second.emplace_back(static_cast<const mcf::IR::Expression::Integer*>(expressionIR)->GetInt8());
-			}
-			else if (integer->IsInt16())
+			if (integer->IsNaturalInteger())
 			{
-				data.first = data.first >= 1 ? data.first : 2;
-				data.second.emplace_back(static_cast<const mcf::IR::Expression::Integer*>(expressionIR)->GetInt16());
+				if (integer->IsUInt8())
+				{
+					data.first = data.first >= 1 ? data.first : 1;
+					data.second.emplace_back(integer->GetUInt8());
+				}
+				else if (integer->IsUInt16())
+				{
+					data.first = data.first >= 1 ? data.first : 2;
+					data.second.emplace_back(integer->GetUInt16());
+				}
+				else if (integer->IsUInt32())
+				{
+					data.first = data.first >= 1 ? data.first : 4;
+					data.second.emplace_back(integer->GetUInt32());
+				}
+				else if (integer->IsUInt64())
+				{
+					data.first = data.first >= 1 ? data.first : 8;
+					data.second.emplace_back(integer->GetUInt64());
+				}
 			}
-			else if (integer->IsInt32())
+			else
 			{
-				data.first = data.first >= 1 ? data.first : 4;
-				data.second.emplace_back(static_cast<const mcf::IR::Expression::Integer*>(expressionIR)->GetInt32());
+				if (integer->IsInt8())
+				{
+					data.first = data.first >= 1 ? data.first : 1;
+					data.second.emplace_back(integer->GetInt8());
+				}
+				else if (integer->IsInt16())
+				{
+					data.first = data.first >= 1 ? data.first : 2;
+					data.second.emplace_back(integer->GetInt16());
+				}
+				else if (integer->IsInt32())
+				{
+					data.first = data.first >= 1 ? data.first : 4;
+					data.second.emplace_back(integer->GetInt32());
+				}
+				else if (integer->IsInt64())
+				{
+					data.first = data.first >= 1 ? data.first : 8;
+					data.second.emplace_back(integer->GetInt64());
+				}
 			}
-			else if (integer->IsInt64())
+		},
+		[&](const mcf::IR::Expression::String*) -> void { MCF_DEBUG_TODO(u8"구현 필요"); },
+		[&](const mcf::IR::Expression::Initializer* initializer) -> void
+		{
+			const size_t keyCount = initializer->GetKeyExpressionCount();
+			for (size_t i = 0; i < keyCount; ++i)
 			{
-				data.first = data.first >= 1 ? data.first : 8;
-				data.second.emplace_back(static_cast<const mcf::IR::Expression::Integer*>(expressionIR)->GetInt64());
+				const mcf::Object::Data KeyData = EvaluateExpressionInCompileTime(initializer->GetUnsafeKeyExpressionPointerAt(i), scopeTree);
+				MCF_DEBUG_ASSERT(i == 0 || data.first == KeyData.first, u8"사이즈가 일치 하지 않습니다!");
+				data.first = data.first >= KeyData.first ? data.first : KeyData.first;
+				data.second.insert(data.second.end(), KeyData.second.begin(), KeyData.second.end());
 			}
-		}
-		break;
-	}
-
-	case mcf::IR::Expression::Type::STRING: __COUNTER__;
-		MCF_DEBUG_TODO(u8"구현 필요");
-		break;
-
-	case mcf::IR::Expression::Type::INITIALIZER: __COUNTER__;
-	{
-		const mcf::IR::Expression::Initializer* initializer = static_cast<const mcf::IR::Expression::Initializer*>(expressionIR);
-		const size_t keyCount = initializer->GetKeyExpressionCount();
-		for (size_t i = 0; i < keyCount; ++i)
+		},
+		[&](const mcf::IR::Expression::MapInitializer*) -> void { MCF_DEBUG_TODO(u8"구현 필요"); },
+		[&](const mcf::IR::Expression::Call*) -> void { MCF_DEBUG_TODO(u8"구현 필요"); },
+		[&](const mcf::IR::Expression::StaticCast*) -> void { MCF_DEBUG_TODO(u8"구현 필요"); },
+		[&](const mcf::IR::Expression::Assign*) -> void
 		{
-			const mcf::Object::Data KeyData = EvaluateExpressionInCompileTime(initializer->GetUnsafeKeyExpressionPointerAt(i), scopeTree);
-			MCF_DEBUG_ASSERT(i == 0 || data.first == KeyData.first, u8"사이즈가 일치 하지 않습니다!");
-			data.first = data.first >= KeyData.first ? data.first : KeyData.first;
-			data.second.insert(data.second.end(), KeyData.second.begin(), KeyData.second.end());
-		}
-		break;
-	}
-
-	case mcf::IR::Expression::Type::MAP_INITIALIZER: __COUNTER__;
-		MCF_DEBUG_TODO(u8"구현 필요");
-		break;
-
-	case mcf::IR::Expression::Type::CONDITIONAL: __COUNTER__;
-		MCF_DEBUG_TODO(u8"구현 필요");
-		break;
-
-	case mcf::IR::Expression::Type::ARITHMETIC: __COUNTER__;
-		MCF_DEBUG_TODO(u8"구현 필요");
-		break;
-
-	case mcf::IR::Expression::Type::ASSIGN: __COUNTER__; [[fallthrough]];
-	default:
-		MCF_DEBUG_TODO(u8"예상치 못한 값이 들어왔습니다. 에러가 아닐 수도 있습니다. 확인 해 주세요. ExpressionType=%s(%zu) ConvertedString=`%s`",
-			mcf::IR::Expression::CONVERT_TYPE_TO_STRING(expressionIR->GetExpressionType()), mcf::ENUM_INDEX(expressionIR->GetExpressionType()), expressionIR->Inspect().c_str());
-		break;
-	}
-	constexpr const size_t EXPRESSION_TYPE_COUNT = __COUNTER__ - EXPRESSION_TYPE_COUNT_BEGIN;
-	static_assert(static_cast<size_t>(mcf::IR::Expression::Type::COUNT) == EXPRESSION_TYPE_COUNT, "expression type count is changed. this SWITCH need to be changed as well.");
+			MCF_DEBUG_TODO(u8"예상치 못한 값이 들어왔습니다. 에러가 아닐 수도 있습니다. 확인 해 주세요. ExpressionType=%s(%zu) ConvertedString=`%s`",
+				mcf::IR::Expression::CONVERT_TYPE_TO_STRING(expressionIR->GetExpressionType()), mcf::ENUM_INDEX(expressionIR->GetExpressionType()), expressionIR->Inspect().c_str());
+		},
+		[&](const mcf::IR::Expression::Conditional*) -> void { MCF_DEBUG_TODO(u8"구현 필요"); },
+		[&](const mcf::IR::Expression::Arithmetic*) -> void { MCF_DEBUG_TODO(u8"구현 필요"); },
+	});
 
 	return data;
 }
@@ -1,6 +1,13 @@
 ﻿#include "pch.h"
 #include "evaluator.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
 namespace mcf
 {
 	namespace Evaluator
@@ -170,40 +177,40 @@ namespace mcf
 						switch (stringLiteral[i])
 						{
 						case '0':
-							data.second.emplace_back(static_cast<unsigned __int8>(0));
+							data.second.emplace_back(static_cast<std::uint8_t>(0));
 							break;
 						case 'n':
-							data.second.emplace_back(static_cast<unsigned __int8>('\n'));
+							data.second.emplace_back(static_cast<std::uint8_t>('\n'));
 							break;
 						case 't':
-							data.second.emplace_back(static_cast<unsigned __int8>('\t'));
+							data.second.emplace_back(static_cast<std::uint8_t>('\t'));
 							break;
 						case 'v':
-							data.second.emplace_back(static_cast<unsigned __int8>('\v'));
+							data.second.emplace_back(static_cast<std::uint8_t>('\v'));
 							break;
 						case 'b':
-							data.second.emplace_back(static_cast<unsigned __int8>('\b'));
+							data.second.emplace_back(static_cast<std::uint8_t>('\b'));
 							break;
 						case 'r':
-							data.second.emplace_back(static_cast<unsigned __int8>('\r'));
+							data.second.emplace_back(static_cast<std::uint8_t>('\r'));
 							break;
 						case 'f':
-							data.second.emplace_back(static_cast<unsigned __int8>('\f'));
+							data.second.emplace_back(static_cast<std::uint8_t>('\f'));
 							break;
 						case 'a':
-							data.second.emplace_back(static_cast<unsigned __int8>('\a'));
+							data.second.emplace_back(static_cast<std::uint8_t>('\a'));
 							break;
 						case '\'':
-							data.second.emplace_back(static_cast<unsigned __int8>('\''));
+							data.second.emplace_back(static_cast<std::uint8_t>('\''));
 							break;
 						case '"':
-							data.second.emplace_back(static_cast<unsigned __int8>('\"'));
+							data.second.emplace_back(static_cast<std::uint8_t>('\"'));
 							break;
 						case '\\':
-							data.second.emplace_back(static_cast<unsigned __int8>('\\'));
+							data.second.emplace_back(static_cast<std::uint8_t>('\\'));
 							break;
 						case '?':
-							data.second.emplace_back(static_cast<unsigned __int8>('\?'));
+							data.second.emplace_back(static_cast<std::uint8_t>('\?'));
 							break;
 						default:
 							break;
@@ -211,12 +218,177 @@ namespace mcf
 						isEscapeChar = false;
 						continue;
 					}
-					data.second.emplace_back(static_cast<unsigned __int8>(stringLiteral[i]));
+					data.second.emplace_back(static_cast<std::uint8_t>(stringLiteral[i]));
 				}
 
-				data.second.emplace_back(static_cast<unsigned __int8>(0));
+				data.second.emplace_back(static_cast<std::uint8_t>(0));
 				return data;
 			}
+
+			// 함수 본문을 병렬로 평가하는 동안 등록된 리터럴은 모든 본문의 평가가 끝난 뒤 인덱스를 받습니다.
+			constexpr const size_t UNASSIGNED_LITERAL_INDEX = static_cast<size_t>(-1);
+
+			// 작업을 스레드마다 연속된 구간으로 나누어 담고, 자기 작업을 다 끝낸 스레드는 다른 스레드의 작업을 훔쳐 실행합니다.
+			// 주인은 자기 큐의 뒤에서 꺼내고 훔치는 스레드는 앞에서 꺼내므로 본문의 크기가 고르지 않아도 스레드가 놀지 않습니다.
+			// 스레드는 풀이 사라질 때까지 유지되므로 Run 을 여러번 호출하여도 스레드를 다시 만들지 않습니다.
+			class WorkStealingPool final
+			{
+			public:
+				// threadIndex 는 작업을 실행하는 스레드의 번호이며 0 부터 threadCount - 1 까지입니다. Run 을 호출한 스레드는 0 번입니다.
+				using Task = std::function<void(const size_t threadIndex, const size_t taskIndex)>;
+
+			public:
+				explicit WorkStealingPool(void) noexcept = delete;
+				explicit WorkStealingPool(const size_t threadCount) noexcept
+				{
+					MCF_DEBUG_ASSERT(threadCount > 0, u8"스레드는 하나 이상이어야 합니다.");
+					for (size_t i = 0; i < threadCount; ++i)
+					{
+						_queues.emplace_back();
+					}
+
+					// Run 을 호출한 스레드가 0 번 큐를 맡으므로 나머지 큐의 스레드만 만듭니다.
+					_workers.reserve(threadCount - 1);
+					for (size_t i = 1; i < threadCount; ++i)
+					{
+						_workers.emplace_back(&WorkStealingPool::RunWorker, this, i);
+					}
+				}
+
+				~WorkStealingPool(void) noexcept
+				{
+					{
+						std::lock_guard<std::mutex> lock(_mutex);
+						_isStopping = true;
+					}
+					_workStarted.notify_all();
+					for (std::thread& worker : _workers)
+					{
+						worker.join();
+					}
+				}
+
+				// 0 부터 taskCount - 1 까지의 작업을 모두 실행한 뒤 반환합니다. 호출한 스레드도 작업을 실행합니다.
+				void Run(const size_t taskCount, const Task& task) noexcept
+				{
+					if (taskCount == 0)
+					{
+						return;
+					}
+
+					const size_t queueCount = _queues.size();
+					for (size_t i = 0; i < queueCount; ++i)
+					{
+						const size_t begin = taskCount * i / queueCount;
+						const size_t end = taskCount * (i + 1) / queueCount;
+						std::lock_guard<std::mutex> lock(_queues[i].Mutex);
+						for (size_t taskIndex = begin; taskIndex < end; ++taskIndex)
+						{
+							_queues[i].TaskIndices.emplace_back(taskIndex);
+						}
+					}
+
+					{
+						std::lock_guard<std::mutex> lock(_mutex);
+						_task = &task;
+						_runningWorkerCount = _workers.size();
+						++_generation;
+					}
+					_workStarted.notify_all();
+
+					ExecuteTasks(0);
+
+					std::unique_lock<std::mutex> lock(_mutex);
+					_workFinished.wait(lock, [this]() noexcept { return _runningWorkerCount == 0; });
+					_task = nullptr;
+				}
+
+			private:
+				struct TaskQueue final
+				{
+					std::mutex Mutex;
+					std::deque<size_t> TaskIndices;
+				};
+
+				void RunWorker(const size_t queueIndex) noexcept
+				{
+					size_t generation = 0;
+					while (true)
+					{
+						{
+							std::unique_lock<std::mutex> lock(_mutex);
+							_workStarted.wait(lock, [&]() noexcept { return _isStopping || _generation != generation; });
+							if (_isStopping)
+							{
+								return;
+							}
+							generation = _generation;
+						}
+
+						ExecuteTasks(queueIndex);
+
+						bool isLastWorker = false;
+						{
+							std::lock_guard<std::mutex> lock(_mutex);
+							isLastWorker = (--_runningWorkerCount == 0);
+						}
+						if (isLastWorker)
+						{
+							_workFinished.notify_one();
+						}
+					}
+				}
+
+				void ExecuteTasks(const size_t queueIndex) noexcept
+				{
+					// 작업은 새 작업을 만들지 않으므로 모든 큐가 비면 이번 Run 의 작업이 더 이상 없습니다.
+					size_t taskIndex = 0;
+					while (PopTask(queueIndex, taskIndex))
+					{
+						(*_task)(queueIndex, taskIndex);
+					}
+				}
+
+				const bool PopTask(const size_t queueIndex, _Out_ size_t& outTaskIndex) noexcept
+				{
+					{
+						TaskQueue& ownQueue = _queues[queueIndex];
+						std::lock_guard<std::mutex> lock(ownQueue.Mutex);
+						if (ownQueue.TaskIndices.empty() == false)
+						{
+							outTaskIndex = ownQueue.TaskIndices.back();
+							ownQueue.TaskIndices.pop_back();
+							return true;
+						}
+					}
+
+					const size_t queueCount = _queues.size();
+					for (size_t i = 1; i < queueCount; ++i)
+					{
+						TaskQueue& victimQueue = _queues[(queueIndex + i) % queueCount];
+						std::lock_guard<std::mutex> lock(victimQueue.Mutex);
+						if (victimQueue.TaskIndices.empty() == false)
+						{
+							outTaskIndex = victimQueue.TaskIndices.front();
+							victimQueue.TaskIndices.pop_front();
+							return true;
+						}
+					}
+					return false;
+				}
+
+			private:
+				// std::mutex 는 옮길 수 없으므로 큐를 옮기지 않는 std::deque 에 보관합니다.
+				std::deque<TaskQueue> _queues;
+				std::vector<std::thread> _workers;
+				std::mutex _mutex;
+				std::condition_variable _workStarted;
+				std::condition_variable _workFinished;
+				const Task* _task = nullptr;
+				size_t _generation = 0;
+				size_t _runningWorkerCount = 0;
+				bool _isStopping = false;
+			};
 		}
 	}
 }
@@ -330,7 +502,7 @@ const bool mcf::Evaluator::FunctionCallIRGenerator::AddParameter(_Notnull_ const
 	{
 		const mcf::IR::Expression::GlobalVariableIdentifier* globalExpression = static_cast<const mcf::IR::Expression::GlobalVariableIdentifier*>(expression);
 		const mcf::Object::Variable& variable = globalExpression->GetVariable();
-		if (variable.DataType.IsArrayType() || variable.DataType.IsStruct)
+		if (variable.DataType.IsArrayType() || variable.DataType.IsStruct())
 		{
 			MCF_DEBUG_TODO(u8"구현 필요");
 			return false;
@@ -354,7 +526,7 @@ const bool mcf::Evaluator::FunctionCallIRGenerator::AddParameter(_Notnull_ const
 		const mcf::Object::Variable& variable = static_cast<const mcf::IR::Expression::LocalVariableIdentifier*>(expression)->GetVariable();
 		const mcf::IR::ASM::Address address(variable.DataType, mcf::IR::ASM::Register::RSP, GetReservedMemory() + functionGenerator->GetLocalVariableOffset(variable.Name));
 
-		if (variable.DataType.IsArrayType() || variable.DataType.IsStruct)
+		if (variable.DataType.IsArrayType() || variable.DataType.IsStruct())
 		{
 			MCF_DEBUG_TODO(u8"구현 필요");
 			return false;
@@ -629,67 +801,67 @@ bool mcf::Evaluator::FunctionIRGenerator::ConvertStatements(
 		const mcf::IR::Interface* object = (*statementsPointer)[i].get();
 		MCF_DEBUG_ASSERT(object != nullptr, u8"object가 유효하지 않습니다.");
 
-		constexpr const size_t IR_TYPE_COUNT_BEGIN = __COUNTER__;
-		switch (object->GetType())
+		const auto convertUnexpectedObject = [&]() -> bool
 		{
-		case IR::Type::LET: __COUNTER__;
-			if (inOutGenerator.AddLetStatement(static_cast<const mcf::IR::Let*>(object), scope) == false)
-			{
-				MCF_DEBUG_TODO(u8"함수 정의에 실패하였습니다. 원인: Let문 코드 변환 오류.");
-				return false;
-			}
-			break;
-
-		case IR::Type::EXPRESSION: __COUNTER__;
-			if (inOutGenerator.AddExpressionStatement(static_cast<const mcf::IR::Expression::Interface*>(object), scope) == false)
+			MCF_DEBUG_TODO(u8"예상치 못한 값이 들어왔습니다. 에러가 아닐 수도 있습니다. 확인 해 주세요. IRType=%s(%zu) ConvertedString=`%s`",
+				mcf::IR::CONVERT_TYPE_TO_STRING(object->GetType()), mcf::ENUM_INDEX(object->GetType()), object->Inspect().c_str());
+			return false;
+		};
+		const bool isConverted = mcf::IR::VISIT(object, mcf::Visitor
+		{
+			[&](const mcf::IR::Invalid*) -> bool { return convertUnexpectedObject(); },
+			[&](const mcf::IR::Expression::Interface* expression) -> bool
 			{
-				MCF_DEBUG_TODO(u8"함수 정의에 실패하였습니다. 원인: 표현문 코드 변환 오류.");
-				return false;
-			}
-			break;
-
-		case IR::Type::UNUSEDIR: __COUNTER__;
-			break;
-
-		case IR::Type::RETURN: __COUNTER__;
-			if (inOutGenerator.IsReturnTypeVoid() == true)
+				if (inOutGenerator.AddExpressionStatement(expression, scope) == false)
+				{
+					MCF_DEBUG_TODO(u8"함수 정의에 실패하였습니다. 원인: 표현문 코드 변환 오류.");
+					return false;
+				}
+				return true;
+			},
+			[&](const mcf::IR::ASM::Interface*) -> bool { return convertUnexpectedObject(); },
+			[&](const mcf::IR::IncludeLib*) -> bool { return convertUnexpectedObject(); },
+			[&](const mcf::IR::Typedef*) -> bool { return convertUnexpectedObject(); },
+			[&](const mcf::IR::Extern*) -> bool { return convertUnexpectedObject(); },
+			[&](const mcf::IR::Let* let) -> bool
 			{
-				MCF_DEBUG_TODO(u8"리턴 타입이 없는 함수에는 리턴이 들어올 수 없습니다.");
-				return false;
-			}
-			inOutGenerator.AddReturnStatement(static_cast<const mcf::IR::Return*>(object));
-			hasReturn = true;
-			break;
-
-		case IR::Type::WHILE: __COUNTER__;
-			if (inOutGenerator.AddWhileStatement(static_cast<const mcf::IR::While*>(object)) == false)
+				if (inOutGenerator.AddLetStatement(let, scope) == false)
+				{
+					MCF_DEBUG_TODO(u8"함수 정의에 실패하였습니다. 원인: Let문 코드 변환 오류.");
+					return false;
+				}
+				return true;
+			},
+			[&](const mcf::IR::Func*) -> bool { return convertUnexpectedObject(); },
+			[&](const mcf::IR::Unused*) -> bool { return true; },
+			[&](const mcf::IR::Return* returnObject) -> bool
 			{
-				return false;
-			}
-			break;
-
-		case IR::Type::BREAK: __COUNTER__;
-			if (breakLabel == NOT_ALLOW_BREAK_LABEL())
+				if (inOutGenerator.IsReturnTypeVoid() == true)
+				{
+					MCF_DEBUG_TODO(u8"리턴 타입이 없는 함수에는 리턴이 들어올 수 없습니다.");
+					return false;
+				}
+				inOutGenerator.AddReturnStatement(returnObject);
+				hasReturn = true;
+				return true;
+			},
+			[&](const mcf::IR::While* whileObject) -> bool { return inOutGenerator.AddWhileStatement(whileObject); },
+			[&](const mcf::IR::Break*) -> bool
 			{
-				MCF_DEBUG_TODO(u8"구현 필요");
-				return false;
-			}
-			inOutGenerator.AddBreakStatement(breakLabel);
-			break;
-
-		case IR::Type::ASM: __COUNTER__; [[fallthrough]];
-		case IR::Type::INCLUDELIB: __COUNTER__; [[fallthrough]];
-		case IR::Type::TYPEDEF: __COUNTER__; [[fallthrough]];
-		case IR::Type::EXTERN: __COUNTER__; [[fallthrough]];
-		case IR::Type::FUNC: __COUNTER__; [[fallthrough]];
-		case IR::Type::PROGRAM: __COUNTER__; [[fallthrough]];
-		default:
-			MCF_DEBUG_TODO(u8"예상치 못한 값이 들어왔습니다. 에러가 아닐 수도 있습니다. 확인 해 주세요. IRType=%s(%zu) ConvertedString=`%s`",
-				mcf::IR::CONVERT_TYPE_TO_STRING(object->GetType()), mcf::ENUM_INDEX(object->GetType()), object->Inspect().c_str());
+				if (breakLabel == NOT_ALLOW_BREAK_LABEL())
+				{
+					MCF_DEBUG_TODO(u8"구현 필요");
+					return false;
+				}
+				inOutGenerator.AddBreakStatement(breakLabel);
+				return true;
+			},
+			[&](const mcf::IR::Program*) -> bool { return convertUnexpectedObject(); },
+		});
+		if (isConverted == false)
+		{
 			return false;
 		}
-		constexpr const size_t IR_TYPE_COUNT = __COUNTER__ - IR_TYPE_COUNT_BEGIN;
-		static_assert(static_cast<size_t>(mcf::IR::Type::COUNT) == IR_TYPE_COUNT, "Convert IR statements to ASM codes.");
 	}
 
 	if (inOutGenerator.IsReturnTypeVoid() == hasReturn)
@@ -721,7 +893,7 @@ mcf::Evaluator::FunctionIRGenerator::FunctionIRGenerator(const mcf::Object::Func
 
 	// 함수 인자 초기화 관련 코드를 처리합니다.
 	const size_t paramCount = info.Params.Variables.size();
-	const mcf::Object::TypeInfo paramType = mcf::Object::TypeInfo::MakePrimitive(true, "qword", sizeof(unsigned __int64));
+	const mcf::Object::TypeInfo paramType = info.LocalScope->GetUnsafeScopeTreePointer()->Types.MakePrimitive(true, "qword", sizeof(std::uint64_t));
 	MCF_DEBUG_ASSERT(paramType.IsValid(), u8"");
 	for (size_t i = 0; i < paramCount && i < Internal::FIRST_FOUR_FUNCTION_PARAM_TARGET_REGISTER_COUNT; ++i)
 	{
@@ -745,8 +917,8 @@ mcf::IR::ASM::PointerVector mcf::Evaluator::FunctionIRGenerator::GenerateIRCode(
 	if (_localMemory.IsEmpty() == false)
 	{
 		const size_t reservedMemory = _localMemory.GetTotalSize();
-		finalCodes.emplace_back(mcf::IR::ASM::Sub::Make(mcf::IR::ASM::Register::RSP, static_cast<unsigned __int64>(reservedMemory)));
-		_endCodes.emplace_back(mcf::IR::ASM::Add::Make(mcf::IR::ASM::Register::RSP, static_cast<unsigned __int64>(reservedMemory)));
+		finalCodes.emplace_back(mcf::IR::ASM::Sub::Make(mcf::IR::ASM::Register::RSP, static_cast<std::uint64_t>(reservedMemory)));
+		_endCodes.emplace_back(mcf::IR::ASM::Add::Make(mcf::IR::ASM::Register::RSP, static_cast<std::uint64_t>(reservedMemory)));
 	}
 
 	if (_localCodes.empty() == false)
@@ -765,11 +937,11 @@ mcf::IR::ASM::PointerVector mcf::Evaluator::FunctionIRGenerator::GenerateIRCode(
 	}
 	_endCodes.clear();
 
-	return std::move(finalCodes);
+	return finalCodes;
 }
 
 const mcf::IR::ASM::Register mcf::Evaluator::FunctionIRGenerator::EvaluateExpressionAndGetRegisterForMoving(
-	const mcf::IR::ASM::Register availableRegisters[sizeof(__int64)], 
+	const mcf::IR::ASM::Register availableRegisters[sizeof(std::int64_t)], 
 	_Notnull_ const mcf::IR::Expression::Interface* expression) noexcept
 {
 	constexpr const size_t EXPRESSION_TYPE_COUNT_BEGIN = __COUNTER__;
@@ -783,8 +955,8 @@ const mcf::IR::ASM::Register mcf::Evaluator::FunctionIRGenerator::EvaluateExpres
 	{
 		const mcf::IR::Expression::LocalVariableIdentifier* localVariableIdentifier = static_cast<const mcf::IR::Expression::LocalVariableIdentifier*>(expression);
 		const size_t typeSize = localVariableIdentifier->GetVariable().DataType.GetSize();
-		const size_t typeBytes = typeSize / sizeof(__int8);
-		MCF_DEBUG_ASSERT(typeSize % sizeof(__int8) == 0 && sizeof(__int8) <= typeSize && typeBytes <= sizeof(__int64), u8"유효하지 않은 데이터 크기가 들어왔습니다.");
+		const size_t typeBytes = typeSize / sizeof(std::int8_t);
+		MCF_DEBUG_ASSERT(typeSize % sizeof(std::int8_t) == 0 && sizeof(std::int8_t) <= typeSize && typeBytes <= sizeof(std::int64_t), u8"유효하지 않은 데이터 크기가 들어왔습니다.");
 		if (availableRegisters[typeBytes] == mcf::IR::ASM::Register::INVALID)
 		{
 			MCF_DEBUG_TODO(u8"기본 타입중에 처리할 수 있는 크기가 아닙니다.");
@@ -804,19 +976,19 @@ const mcf::IR::ASM::Register mcf::Evaluator::FunctionIRGenerator::EvaluateExpres
 		{
 			if (integerExpression->IsUInt8())
 			{
-				return availableRegisters[sizeof(__int8)];
+				return availableRegisters[sizeof(std::int8_t)];
 			} 
 			else if (integerExpression->IsUInt16())
 			{
-				return availableRegisters[sizeof(__int16)];
+				return availableRegisters[sizeof(std::int16_t)];
 			}
 			else if (integerExpression->IsUInt32())
 			{
-				return availableRegisters[sizeof(__int32)];
+				return availableRegisters[sizeof(std::int32_t)];
 			}
 			else if (integerExpression->IsUInt64())
 			{
-				return availableRegisters[sizeof(__int64)];
+				return availableRegisters[sizeof(std::int64_t)];
 			}
 			else
 			{
@@ -828,19 +1000,19 @@ const mcf::IR::ASM::Register mcf::Evaluator::FunctionIRGenerator::EvaluateExpres
 		{
 			if (integerExpression->IsInt8())
 			{
-				return availableRegisters[sizeof(__int8)];
+				return availableRegisters[sizeof(std::int8_t)];
 			}
 			else if (integerExpression->IsInt16())
 			{
-				return availableRegisters[sizeof(__int16)];
+				return availableRegisters[sizeof(std::int16_t)];
 			}
 			else if (integerExpression->IsInt32())
 			{
-				return availableRegisters[sizeof(__int32)];
+				return availableRegisters[sizeof(std::int32_t)];
 			}
 			else if (integerExpression->IsInt64())
 			{
-				return availableRegisters[sizeof(__int64)];
+				return availableRegisters[sizeof(std::int64_t)];
 			}
 			else
 			{
@@ -896,8 +1068,8 @@ mcf::IR::ASM::Pointer mcf::Evaluator::FunctionIRGenerator::MoveExpressionToRegis
 	{
 		const mcf::IR::Expression::LocalVariableIdentifier* localVariableIdentifier = static_cast<const mcf::IR::Expression::LocalVariableIdentifier*>(expression);
 		const size_t typeSize = localVariableIdentifier->GetVariable().DataType.GetSize();
-		const size_t typeBytes = typeSize / sizeof(__int8);
-		MCF_DEBUG_ASSERT(typeSize % sizeof(__int8) == 0 && sizeof(__int8) <= typeSize && typeBytes <= sizeof(__int64), u8"유효하지 않은 데이터 크기가 들어왔습니다.");
+		const size_t typeBytes = typeSize / sizeof(std::int8_t);
+		MCF_DEBUG_ASSERT(typeSize % sizeof(std::int8_t) == 0 && sizeof(std::int8_t) <= typeSize && typeBytes <= sizeof(std::int64_t), u8"유효하지 않은 데이터 크기가 들어왔습니다.");
 		if (mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(targetRegister) < typeBytes)
 		{
 			MCF_DEBUG_TODO(u8"타겟 레지스터보다 표현식의 타입 크기가 더 큽니다.");
@@ -1085,19 +1257,19 @@ const bool mcf::Evaluator::FunctionIRGenerator::AddCondition(
 		switch (leftRegisters[returnTypeSize])
 		{
 		case mcf::IR::ASM::Register::AL:
-			_localCodes.emplace_back(mcf::IR::ASM::Cmp::Make(leftRegisters[returnTypeSize], static_cast<__int8>(0)));
+			_localCodes.emplace_back(mcf::IR::ASM::Cmp::Make(leftRegisters[returnTypeSize], static_cast<std::int8_t>(0)));
 			break;
 
 		case mcf::IR::ASM::Register::AX:
-			_localCodes.emplace_back(mcf::IR::ASM::Cmp::Make(leftRegisters[returnTypeSize], static_cast<__int16>(0)));
+			_localCodes.emplace_back(mcf::IR::ASM::Cmp::Make(leftRegisters[returnTypeSize], static_cast<std::int16_t>(0)));
 			break;
 
 		case mcf::IR::ASM::Register::EAX:
-			_localCodes.emplace_back(mcf::IR::ASM::Cmp::Make(leftRegisters[returnTypeSize], static_cast<__int32>(0)));
+			_localCodes.emplace_back(mcf::IR::ASM::Cmp::Make(leftRegisters[returnTypeSize], static_cast<std::int32_t>(0)));
 			break;
 
 		case mcf::IR::ASM::Register::RAX:
-			_localCodes.emplace_back(mcf::IR::ASM::Cmp::Make(leftRegisters[returnTypeSize], static_cast<__int64>(0)));
+			_localCodes.emplace_back(mcf::IR::ASM::Cmp::Make(leftRegisters[returnTypeSize], static_cast<std::int64_t>(0)));
 			break;
 
 		default:
@@ -1226,7 +1398,7 @@ const bool mcf::Evaluator::FunctionIRGenerator::AddAssignExpressionWithLocalVari
 	_Notnull_ const mcf::IR::Expression::Interface* rightExpression,
 	_Notnull_ const mcf::Object::Scope* scope) noexcept
 {
-	MCF_DEBUG_ASSERT(scope->FindVariableInfo(leftOperand.Name).IsGlobal == false, u8"leftOperand는 지역 변수여야 합니다.");
+	MCF_DEBUG_ASSERT(_paramOffsetMap.find(leftOperand.Name) != _paramOffsetMap.end() || _localVariableIndicesMap.find(leftOperand.Name) != _localVariableIndicesMap.end(), u8"leftOperand는 지역 변수여야 합니다.");
 
 	constexpr const size_t EXPRESSION_TYPE_COUNT_BEGIN = __COUNTER__;
 	switch (rightExpression->GetExpressionType())
@@ -1246,7 +1418,7 @@ const bool mcf::Evaluator::FunctionIRGenerator::AddAssignExpressionWithLocalVari
 			break;
 		}
 
-		if (leftOperand.DataType.IsStruct == true)
+		if (leftOperand.DataType.IsStruct() == true)
 		{
 			MCF_DEBUG_TODO(u8"구조체 타입 구현 필요");
 			break;
@@ -1266,8 +1438,8 @@ const bool mcf::Evaluator::FunctionIRGenerator::AddAssignExpressionWithLocalVari
 		};
 
 		const size_t targetTypeSize = leftOperand.DataType.GetSize();
-		const size_t targetTypeBytes = targetTypeSize / sizeof(__int8);
-		MCF_DEBUG_ASSERT(targetTypeSize % sizeof(__int8) == 0 && sizeof(__int8) <= targetTypeSize && targetTypeBytes <= sizeof(__int64), u8"유효하지 않은 데이터 크기가 들어왔습니다.");
+		const size_t targetTypeBytes = targetTypeSize / sizeof(std::int8_t);
+		MCF_DEBUG_ASSERT(targetTypeSize % sizeof(std::int8_t) == 0 && sizeof(std::int8_t) <= targetTypeSize && targetTypeBytes <= sizeof(std::int64_t), u8"유효하지 않은 데이터 크기가 들어왔습니다.");
 		if (registers[targetTypeBytes] == mcf::IR::ASM::Register::INVALID)
 		{
 			MCF_DEBUG_TODO(u8"기본 타입중에 처리할 수 있는 크기가 아닙니다.");
@@ -1299,20 +1471,20 @@ const bool mcf::Evaluator::FunctionIRGenerator::AddAssignExpressionWithLocalVari
 		const mcf::IR::ASM::Address target(leftOperand.DataType, mcf::IR::ASM::Register::RSP, GetLocalVariableOffset(leftOperand.Name));
 		switch (leftOperand.DataType.GetSize())
 		{
-			case sizeof(__int8) :
-				_localCodes.emplace_back(leftOperand.DataType.IsUnsigned ? mcf::IR::ASM::Mov::Make(target, integerExpression->GetUInt8()) : mcf::IR::ASM::Mov::Make(target, integerExpression->GetInt8()));
+			case sizeof(std::int8_t) :
+				_localCodes.emplace_back(leftOperand.DataType.IsUnsigned() ? mcf::IR::ASM::Mov::Make(target, integerExpression->GetUInt8()) : mcf::IR::ASM::Mov::Make(target, integerExpression->GetInt8()));
 				break;
 
-			case sizeof(__int16) :
-				_localCodes.emplace_back(leftOperand.DataType.IsUnsigned ? mcf::IR::ASM::Mov::Make(target, integerExpression->GetUInt16()) : mcf::IR::ASM::Mov::Make(target, integerExpression->GetInt16()));
+			case sizeof(std::int16_t) :
+				_localCodes.emplace_back(leftOperand.DataType.IsUnsigned() ? mcf::IR::ASM::Mov::Make(target, integerExpression->GetUInt16()) : mcf::IR::ASM::Mov::Make(target, integerExpression->GetInt16()));
 				break;
 
-			case sizeof(__int32) :
-				_localCodes.emplace_back(leftOperand.DataType.IsUnsigned ? mcf::IR::ASM::Mov::Make(target, integerExpression->GetUInt32()) : mcf::IR::ASM::Mov::Make(target, integerExpression->GetInt32()));
+			case sizeof(std::int32_t) :
+				_localCodes.emplace_back(leftOperand.DataType.IsUnsigned() ? mcf::IR::ASM::Mov::Make(target, integerExpression->GetUInt32()) : mcf::IR::ASM::Mov::Make(target, integerExpression->GetInt32()));
 				break;
 
-			case sizeof(__int64) :
-				_localCodes.emplace_back(leftOperand.DataType.IsUnsigned ? mcf::IR::ASM::Mov::Make(target, integerExpression->GetUInt64()) : mcf::IR::ASM::Mov::Make(target, integerExpression->GetInt64()));
+			case sizeof(std::int64_t) :
+				_localCodes.emplace_back(leftOperand.DataType.IsUnsigned() ? mcf::IR::ASM::Mov::Make(target, integerExpression->GetUInt64()) : mcf::IR::ASM::Mov::Make(target, integerExpression->GetInt64()));
 				break;
 
 			default:
@@ -1463,7 +1635,7 @@ const mcf::IR::ASM::Register mcf::Evaluator::FunctionIRGenerator::AddArithmeticE
 	_Notnull_ const mcf::IR::Expression::Interface* rightExpression,
 	_Notnull_ const mcf::Object::Scope* scope) noexcept
 {
-	MCF_DEBUG_ASSERT(scope->FindVariableInfo(leftOperand.Name).IsGlobal == false, u8"leftOperand는 지역 변수여야 합니다.");
+	MCF_DEBUG_ASSERT(_paramOffsetMap.find(leftOperand.Name) != _paramOffsetMap.end() || _localVariableIndicesMap.find(leftOperand.Name) != _localVariableIndicesMap.end(), u8"leftOperand는 지역 변수여야 합니다.");
 
 	constexpr const size_t EXPRESSION_TYPE_COUNT_BEGIN = __COUNTER__;
 	switch (rightExpression->GetExpressionType())
@@ -1483,7 +1655,7 @@ const mcf::IR::ASM::Register mcf::Evaluator::FunctionIRGenerator::AddArithmeticE
 			break;
 		}
 
-		if (leftOperand.DataType.IsStruct == true)
+		if (leftOperand.DataType.IsStruct() == true)
 		{
 			MCF_DEBUG_TODO(u8"구조체 타입 구현 필요");
 			break;
@@ -1503,8 +1675,8 @@ const mcf::IR::ASM::Register mcf::Evaluator::FunctionIRGenerator::AddArithmeticE
 		};
 
 		const size_t targetTypeSize = leftOperand.DataType.GetSize();
-		const size_t targetTypeBytes = targetTypeSize / sizeof(__int8);
-		MCF_DEBUG_ASSERT(targetTypeSize % sizeof(__int8) == 0 && sizeof(__int8) <= targetTypeSize && targetTypeBytes <= sizeof(__int64), u8"유효하지 않은 데이터 크기가 들어왔습니다.");
+		const size_t targetTypeBytes = targetTypeSize / sizeof(std::int8_t);
+		MCF_DEBUG_ASSERT(targetTypeSize % sizeof(std::int8_t) == 0 && sizeof(std::int8_t) <= targetTypeSize && targetTypeBytes <= sizeof(std::int64_t), u8"유효하지 않은 데이터 크기가 들어왔습니다.");
 		if (registers[targetTypeBytes] == mcf::IR::ASM::Register::INVALID)
 		{
 			MCF_DEBUG_TODO(u8"기본 타입중에 처리할 수 있는 크기가 아닙니다.");
@@ -1531,39 +1703,39 @@ const mcf::IR::ASM::Register mcf::Evaluator::FunctionIRGenerator::AddArithmeticE
 
 		switch (leftOperand.DataType.GetSize())
 		{
-			case sizeof(__int8) :
+			case sizeof(std::int8_t) :
 			{
 				const mcf::IR::ASM::Register target = mcf::IR::ASM::Register::AL;
 				const mcf::IR::ASM::Address leftAddress(leftOperand.DataType, mcf::IR::ASM::Register::RSP, GetLocalVariableOffset(leftOperand.Name));
 				_localCodes.emplace_back(mcf::IR::ASM::Mov::Make(target, leftAddress));
-				_localCodes.emplace_back(leftOperand.DataType.IsUnsigned ? mcf::IR::ASM::Add::Make(target, integerExpression->GetUInt8()) : mcf::IR::ASM::Add::Make(target, integerExpression->GetInt8()));
+				_localCodes.emplace_back(leftOperand.DataType.IsUnsigned() ? mcf::IR::ASM::Add::Make(target, integerExpression->GetUInt8()) : mcf::IR::ASM::Add::Make(target, integerExpression->GetInt8()));
 				return target;
 			}
 
-			case sizeof(__int16) :
+			case sizeof(std::int16_t) :
 			{
 				const mcf::IR::ASM::Register target = mcf::IR::ASM::Register::AX;
 				const mcf::IR::ASM::Address leftAddress(leftOperand.DataType, mcf::IR::ASM::Register::RSP, GetLocalVariableOffset(leftOperand.Name));
 				_localCodes.emplace_back(mcf::IR::ASM::Mov::Make(target, leftAddress));
-				_localCodes.emplace_back(leftOperand.DataType.IsUnsigned ? mcf::IR::ASM::Add::Make(target, integerExpression->GetUInt16()) : mcf::IR::ASM::Add::Make(target, integerExpression->GetInt16()));
+				_localCodes.emplace_back(leftOperand.DataType.IsUnsigned() ? mcf::IR::ASM::Add::Make(target, integerExpression->GetUInt16()) : mcf::IR::ASM::Add::Make(target, integerExpression->GetInt16()));
 				return target;
 			}
 
-			case sizeof(__int32) :
+			case sizeof(std::int32_t) :
 			{
 				const mcf::IR::ASM::Register target = mcf::IR::ASM::Register::EAX;
 				const mcf::IR::ASM::Address leftAddress(leftOperand.DataType, mcf::IR::ASM::Register::RSP, GetLocalVariableOffset(leftOperand.Name));
 				_localCodes.emplace_back(mcf::IR::ASM::Mov::Make(target, leftAddress));
-				_localCodes.emplace_back(leftOperand.DataType.IsUnsigned ? mcf::IR::ASM::Add::Make(target, integerExpression->GetUInt32()) : mcf::IR::ASM::Add::Make(target, integerExpression->GetInt32()));
+				_localCodes.emplace_back(leftOperand.DataType.IsUnsigned() ? mcf::IR::ASM::Add::Make(target, integerExpression->GetUInt32()) : mcf::IR::ASM::Add::Make(target, integerExpression->GetInt32()));
 				return target;
 			}
 
-			case sizeof(__int64) :
+			case sizeof(std::int64_t) :
 			{
 				const mcf::IR::ASM::Register target = mcf::IR::ASM::Register::RAX;
 				const mcf::IR::ASM::Address leftAddress(leftOperand.DataType, mcf::IR::ASM::Register::RSP, GetLocalVariableOffset(leftOperand.Name));
 				_localCodes.emplace_back(mcf::IR::ASM::Mov::Make(target, leftAddress));
-				_localCodes.emplace_back(leftOperand.DataType.IsUnsigned ? mcf::IR::ASM::Add::Make(target, integerExpression->GetUInt64()) : mcf::IR::ASM::Add::Make(target, integerExpression->GetInt64()));
+				_localCodes.emplace_back(leftOperand.DataType.IsUnsigned() ? mcf::IR::ASM::Add::Make(target, integerExpression->GetUInt64()) : mcf::IR::ASM::Add::Make(target, integerExpression->GetInt64()));
 				return target;
 			}
 
@@ -1829,7 +2001,7 @@ void mcf::Evaluator::FunctionIRGenerator::AddReturnStatement(_Notnull_ const mcf
 			return;
 		}
 
-		if (_returnType.IsStruct == true)
+		if (_returnType.IsStruct() == true)
 		{
 			MCF_DEBUG_TODO(u8"구조체 타입 구현 필요");
 			return;
@@ -1849,8 +2021,8 @@ void mcf::Evaluator::FunctionIRGenerator::AddReturnStatement(_Notnull_ const mcf
 		};
 
 		const size_t returnTypeSize = _returnType.GetSize();
-		const size_t returnTypeBytes = returnTypeSize / sizeof(__int8);
-		MCF_DEBUG_ASSERT(returnTypeSize % sizeof(__int8) == 0 && sizeof(__int8) <= returnTypeSize && returnTypeBytes <= sizeof(__int64), u8"유효하지 않은 데이터 크기가 들어왔습니다.");
+		const size_t returnTypeBytes = returnTypeSize / sizeof(std::int8_t);
+		MCF_DEBUG_ASSERT(returnTypeSize % sizeof(std::int8_t) == 0 && sizeof(std::int8_t) <= returnTypeSize && returnTypeBytes <= sizeof(std::int64_t), u8"유효하지 않은 데이터 크기가 들어왔습니다.");
 		if (returnRegisters[returnTypeBytes] != mcf::IR::ASM::Register::INVALID)
 		{
 			const std::string varName = localVariableIdentifier->GetVariable().Name;
@@ -1893,40 +2065,40 @@ void mcf::Evaluator::FunctionIRGenerator::AddReturnStatement(_Notnull_ const mcf
 
 		switch (_returnType.GetSize())
 		{
-		case sizeof(__int8):
+		case sizeof(std::int8_t):
 			if (integerExpression->IsZero())
 			{
 				_localCodes.emplace_back(mcf::IR::ASM::Xor::Make(mcf::IR::ASM::Register::AL, mcf::IR::ASM::Register::AL));
 				break;
 			}
-			_localCodes.emplace_back(_returnType.IsUnsigned ? mcf::IR::ASM::Mov::Make(mcf::IR::ASM::Register::AL, integerExpression->GetUInt8()) : mcf::IR::ASM::Mov::Make(mcf::IR::ASM::Register::AL, integerExpression->GetInt8()));
+			_localCodes.emplace_back(_returnType.IsUnsigned() ? mcf::IR::ASM::Mov::Make(mcf::IR::ASM::Register::AL, integerExpression->GetUInt8()) : mcf::IR::ASM::Mov::Make(mcf::IR::ASM::Register::AL, integerExpression->GetInt8()));
 			break;
 
-		case sizeof(__int16):
+		case sizeof(std::int16_t):
 			if (integerExpression->IsZero())
 			{
 				_localCodes.emplace_back(mcf::IR::ASM::Xor::Make(mcf::IR::ASM::Register::AX, mcf::IR::ASM::Register::AX));
 				break;
 			}
-			_localCodes.emplace_back(_returnType.IsUnsigned ? mcf::IR::ASM::Mov::Make(mcf::IR::ASM::Register::AX, integerExpression->GetUInt16()) : mcf::IR::ASM::Mov::Make(mcf::IR::ASM::Register::AX, integerExpression->GetInt16()));
+			_localCodes.emplace_back(_returnType.IsUnsigned() ? mcf::IR::ASM::Mov::Make(mcf::IR::ASM::Register::AX, integerExpression->GetUInt16()) : mcf::IR::ASM::Mov::Make(mcf::IR::ASM::Register::AX, integerExpression->GetInt16()));
 			break;
 
-		case sizeof(__int32):
+		case sizeof(std::int32_t):
 			if (integerExpression->IsZero())
 			{
 				_localCodes.emplace_back(mcf::IR::ASM::Xor::Make(mcf::IR::ASM::Register::EAX, mcf::IR::ASM::Register::EAX));
 				break;
 			}
-			_localCodes.emplace_back(_returnType.IsUnsigned ? mcf::IR::ASM::Mov::Make(mcf::IR::ASM::Register::EAX, integerExpression->GetUInt32()) : mcf::IR::ASM::Mov::Make(mcf::IR::ASM::Register::EAX, integerExpression->GetInt32()));
+			_localCodes.emplace_back(_returnType.IsUnsigned() ? mcf::IR::ASM::Mov::Make(mcf::IR::ASM::Register::EAX, integerExpression->GetUInt32()) : mcf::IR::ASM::Mov::Make(mcf::IR::ASM::Register::EAX, integerExpression->GetInt32()));
 			break;
 
-		case sizeof(__int64) :
+		case sizeof(std::int64_t) :
 			if (integerExpression->IsZero())
 			{
 				_localCodes.emplace_back(mcf::IR::ASM::Xor::Make(mcf::IR::ASM::Register::RAX, mcf::IR::ASM::Register::RAX));
 				break;
 			}
-			_localCodes.emplace_back(_returnType.IsUnsigned ? mcf::IR::ASM::Mov::Make(mcf::IR::ASM::Register::RAX, integerExpression->GetUInt64()) : mcf::IR::ASM::Mov::Make(mcf::IR::ASM::Register::EAX, integerExpression->GetInt64()));
+			_localCodes.emplace_back(_returnType.IsUnsigned() ? mcf::IR::ASM::Mov::Make(mcf::IR::ASM::Register::RAX, integerExpression->GetUInt64()) : mcf::IR::ASM::Mov::Make(mcf::IR::ASM::Register::EAX, integerExpression->GetInt64()));
 			break;
 
 		default:
@@ -2087,7 +2259,7 @@ const bool mcf::Evaluator::Object::ValidateVariableTypeAndValue(const mcf::Objec
 		}
 
 		mcf::Object::Variable arrayItem = variable;
-		arrayItem.DataType.ArraySizeList.pop_back();
+		arrayItem.DataType = arrayItem.DataType.MakeArrayItemType();
 
 		const mcf::IR::Expression::Initializer* initializerObject = static_cast<const mcf::IR::Expression::Initializer*>(value);
 		const size_t expressionCount = initializerObject->GetKeyExpressionCount();
@@ -2217,102 +2389,211 @@ const bool mcf::Evaluator::Object::ValidateExpressionTypes(_Notnull_ const mcf::
 		
 mcf::IR::Program::Pointer mcf::Evaluator::Object::EvalProgram(_Notnull_ const mcf::AST::Program* program, _Notnull_ mcf::Object::Scope* scope) noexcept
 {
+	return EvalProgramParallel(program, scope, 1);
+}
+
+mcf::IR::Program::Pointer mcf::Evaluator::Object::EvalProgramParallel(_Notnull_ const mcf::AST::Program* program, _Notnull_ mcf::Object::Scope* scope, const size_t threadCount) noexcept
+{
+	_programSymbols = program->GetSymbolTable();
+	_bindingStack = &scope->GetUnsafeScopeTreePointer()->Stack;
+
+	// 전역 문장과 함수 시그니처를 먼저 등록합니다. 함수 본문은 자리만 비워두고 EvalFunctionBodies 에서 채웁니다.
 	mcf::IR::PointerVector objects;
 	const size_t statementCount = program->GetStatementCount();
 	for (size_t i = 0; i < statementCount; i++)
 	{
-		objects.emplace_back(EvalStatement(program->GetUnsafeStatementPointerAt(i), scope, false));
+		const mcf::AST::Statement::Interface* statement = program->GetUnsafeStatementPointerAt(i);
+		const mcf::AST::Statement::Type statementType = statement->GetStatementType();
+		if (statementType == mcf::AST::Statement::Type::FUNC && static_cast<const mcf::AST::Statement::Func*>(statement)->IsBodyParsed() == false)
+		{
+			objects.emplace_back(EvalLazyFuncStatement(static_cast<const mcf::AST::Statement::Func*>(statement), objects.size(), scope));
+			continue;
+		}
+
+		if (statementType == mcf::AST::Statement::Type::FUNC || statementType == mcf::AST::Statement::Type::MAIN)
+		{
+			const bool isMain = statementType == mcf::AST::Statement::Type::MAIN;
+			const mcf::Object::FunctionInfo* functionInfo = isMain ? DefineMainStatement(static_cast<const mcf::AST::Statement::Main*>(statement), scope) : DefineFuncStatement(static_cast<const mcf::AST::Statement::Func*>(statement), scope);
+			if (functionInfo == nullptr)
+			{
+				objects.emplace_back(mcf::IR::Invalid::Make());
+				continue;
+			}
+
+			const mcf::AST::Statement::Block* block = isMain ? static_cast<const mcf::AST::Statement::Main*>(statement)->GetUnsafeBlockPointer() : static_cast<const mcf::AST::Statement::Func*>(statement)->GetUnsafeBlockPointer();
+			_functionBodies.emplace_back(FunctionBody{ block, mcf::AST::Flat::INVALID_INDEX, functionInfo, objects.size() });
+			objects.emplace_back(nullptr);
+			continue;
+		}
+		objects.emplace_back(EvalStatement(statement, scope, false));
 	}
+
+	EvalFunctionBodies(objects, program, scope, threadCount);
+
+	// 참조되지 않은 함수는 본문을 파싱하지 않고 결과에서 제외합니다.
+	objects.erase(std::remove(objects.begin(), objects.end(), nullptr), objects.end());
 	return mcf::IR::Program::Make(std::move(objects));
 }
 
-mcf::IR::Pointer mcf::Evaluator::Object::EvalStatement(_Notnull_ const mcf::AST::Statement::Interface* statement, _Notnull_ mcf::Object::Scope* scope, const bool isBreakAllowed) noexcept
+void mcf::Evaluator::Object::EvalFunctionBodies(_Inout_ mcf::IR::PointerVector& outObjects, const mcf::AST::Program* program, _Notnull_ mcf::Object::Scope* scope, const size_t threadCount) noexcept
 {
-	mcf::IR::Pointer object = mcf::IR::Invalid::Make();
-	constexpr const size_t STATEMENT_TYPE_COUNT_BEGIN = __COUNTER__;
-	switch (statement->GetStatementType())
-	{
-	case AST::Statement::Type::INCLUDE_LIBRARY: __COUNTER__;
-		object = mcf::IR::IncludeLib::Make(static_cast<const mcf::AST::Statement::IncludeLibrary*>(statement)->GetLibPath());
-		break;
-
-	case AST::Statement::Type::TYPEDEF: __COUNTER__;
-		object = EvalTypedefStatement(static_cast<const mcf::AST::Statement::Typedef*>(statement), scope);
-		break;
-
-	case AST::Statement::Type::EXTERN: __COUNTER__;
-		object = EvalExternStatement(static_cast<const mcf::AST::Statement::Extern*>(statement), scope);
-		break;
-
-	case AST::Statement::Type::LET: __COUNTER__;
-		object = EvalLetStatement(static_cast<const mcf::AST::Statement::Let*>(statement), scope);
-		break;
+	// 본문은 자신의 함수 스코프에만 정의하고 전역 스코프는 읽기만 하므로 서로 다른 함수의 본문은 동시에 평가할 수 있습니다.
+	mcf::Object::ScopeTree* const scopeTree = scope->GetUnsafeScopeTreePointer();
+	const size_t globalLiteralCount = scopeTree->LiteralIndexMap.size();
+	const size_t actualThreadCount = (threadCount != 0) ? threadCount : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+	Internal::WorkStealingPool pool(actualThreadCount);
+	// 본문의 스코프는 본문을 평가하는 스레드의 섀도 스택에 엽니다.
+	std::vector<mcf::Object::BindingStack> bindingStacks(actualThreadCount);
 
-	case AST::Statement::Type::BLOCK: __COUNTER__;
-		MCF_DEBUG_TODO(u8"구현 필요");
-		break;
+	size_t evaluatedCount = 0;
+	const auto evalPendingBodies = [&]() noexcept
+	{
+		const size_t firstBodyIndex = evaluatedCount;
+		pool.Run(_functionBodies.size() - firstBodyIndex, [&](const size_t threadIndex, const size_t taskIndex) noexcept
+		{
+			FunctionBody& body = _functionBodies[firstBodyIndex + taskIndex];
+			if (EvalFunctionBody(body, bindingStacks[threadIndex]) == false)
+			{
+				outObjects[body.ObjectIndex] = mcf::IR::Invalid::Make();
+			}
+		});
+		evaluatedCount = _functionBodies.size();
+	};
+	evalPendingBodies();
 
-	case AST::Statement::Type::RETURN: __COUNTER__;
-		object = EvalReturnStatement(static_cast<const mcf::AST::Statement::Return*>(statement), scope);
-		break;
+	// 지연 파싱된 함수는 참조된 경우에만 본문을 파싱하고 평가합니다. 본문을 파싱하면 AST 가 바뀌므로 평가가 끝난 뒤 순서대로 파싱하고,
+	// 새로 파싱한 본문이 다른 함수를 참조할 수 있으므로 새로 참조되는 함수가 없을 때까지 반복합니다.
+	while (_lazyFunctions.empty() == false)
+	{
+		for (const LazyFunction& lazyFunction : _lazyFunctions)
+		{
+			if (outObjects[lazyFunction.ObjectIndex] != nullptr || lazyFunction.Statement->IsBodyParsed() || scope->IsFunctionUsed(lazyFunction.Info->Name) == false)
+			{
+				continue;
+			}
 
-	case AST::Statement::Type::FUNC: __COUNTER__;
-		object = EvalFuncStatement(static_cast<const mcf::AST::Statement::Func*>(statement), scope);
-		break;
+			MCF_DEBUG_ASSERT(program != nullptr, u8"평면 AST 에는 지연 파싱된 함수가 없어야 합니다.");
+			if (program->MaterializeFunctionBody(lazyFunction.Statement) == false)
+			{
+				MCF_DEBUG_TODO(u8"함수 본문 파싱에 실패하였습니다. 함수 이름=%s", lazyFunction.Info->Name.c_str());
+				outObjects[lazyFunction.ObjectIndex] = mcf::IR::Invalid::Make();
+				continue;
+			}
+			_functionBodies.emplace_back(FunctionBody{ lazyFunction.Statement->GetUnsafeBlockPointer(), mcf::AST::Flat::INVALID_INDEX, lazyFunction.Info, lazyFunction.ObjectIndex });
+		}
 
-	case AST::Statement::Type::MAIN: __COUNTER__;
-		object = EvalMainStatement(static_cast<const mcf::AST::Statement::Main*>(statement), scope);
-		break;
+		if (evaluatedCount == _functionBodies.size())
+		{
+			break;
+		}
+		evalPendingBodies();
+	}
 
-	case AST::Statement::Type::EXPRESSION: __COUNTER__;
+	// 본문에서 처음 나온 리터럴은 평가한 스레드와 상관없이 본문의 순서대로 인덱스를 받습니다.
+	size_t nextLiteralIndex = globalLiteralCount;
+	for (FunctionBody& body : _functionBodies)
 	{
-		mcf::IR::Expression::Pointer expressionObject = EvalExpression(static_cast<const mcf::AST::Statement::Expression*>(statement)->GetUnsafeExpression(), scope);
-		if (expressionObject.get() == nullptr || expressionObject->GetExpressionType() == mcf::IR::Expression::Type::INVALID)
+		for (std::pair<size_t, mcf::Object::Data>* literal : body.Literals)
 		{
-			return mcf::IR::Invalid::Make();
+			if (literal->first == Internal::UNASSIGNED_LITERAL_INDEX)
+			{
+				literal->first = nextLiteralIndex++;
+			}
 		}
-		object = std::move(expressionObject);
-		break;
 	}
+	MCF_DEBUG_ASSERT(nextLiteralIndex == scopeTree->LiteralIndexMap.size(), u8"모든 리터럴이 인덱스를 받아야 합니다.");
 
-	case AST::Statement::Type::ASSIGN_EXPRESSION: __COUNTER__;
-		object = EvalAssignExpressionStatement(static_cast<const mcf::AST::Statement::AssignExpression*>(statement), scope);
-		break;
+	// 평가에 실패한 본문은 이미 Invalid 가 들어있으므로 코드를 생성하지 않습니다. 코드 생성은 scope 를 읽기만 하므로 같은 풀에서 나누어 실행합니다.
+	std::vector<FunctionBody*> bodies;
+	bodies.reserve(_functionBodies.size());
+	for (FunctionBody& body : _functionBodies)
+	{
+		if (outObjects[body.ObjectIndex] == nullptr)
+		{
+			bodies.emplace_back(&body);
+		}
+	}
+	pool.Run(bodies.size(), [&](const size_t, const size_t taskIndex) noexcept
+	{
+		FunctionBody& body = *bodies[taskIndex];
+		body.Codes = GenerateFunctionASM(*body.Info, body.Objects);
+	});
 
-	case AST::Statement::Type::UNUSED: __COUNTER__;
-		object = EvalUnusedStatement(static_cast<const mcf::AST::Statement::Unused*>(statement), scope);
-		break;
+	// 결과는 스레드 수와 상관없이 소스 순서의 자리에 넣습니다.
+	for (FunctionBody* body : bodies)
+	{
+		outObjects[body->ObjectIndex] = MakeFuncObject(std::move(body->Codes));
+	}
+	_functionBodies.clear();
+	_lazyFunctions.clear();
+}
 
-	case AST::Statement::Type::WHILE: __COUNTER__;
-		object = EvalWhileStatement(static_cast<const mcf::AST::Statement::While*>(statement), scope);
-		break;
+const bool mcf::Evaluator::Object::EvalFunctionBody(_Inout_ FunctionBody& body, _Inout_ mcf::Object::BindingStack& bindingStack) const noexcept
+{
+	mcf::Evaluator::Object bodyEvaluator;
+	bodyEvaluator._programSymbols = _programSymbols;
+	bodyEvaluator._flatProgram = _flatProgram;
+	bodyEvaluator._bodyLiterals = &body.Literals;
+	bodyEvaluator._bindingStack = &bindingStack;
+	return body.Block != nullptr ? bodyEvaluator.EvalFunctionBlockStatement(body.Objects, *body.Info, body.Block) : bodyEvaluator.EvalFlatFunctionBlockStatement(body.Objects, *body.Info, body.FlatBlock);
+}
 
-	case AST::Statement::Type::BREAK: __COUNTER__;
-		object = EvalBreakStatement(static_cast<const mcf::AST::Statement::Break*>(statement), scope, isBreakAllowed);
-		if (object.get() == nullptr || object->GetType() == mcf::IR::Type::INVALID)
+mcf::IR::Pointer mcf::Evaluator::Object::EvalStatement(_Notnull_ const mcf::AST::Statement::Interface* statement, _Notnull_ mcf::Object::Scope* scope, const bool isBreakAllowed) noexcept
+{
+	return mcf::AST::Statement::VISIT(statement, mcf::Visitor
+	{
+		[&](const mcf::AST::Statement::Invalid*) -> mcf::IR::Pointer
 		{
+			MCF_DEBUG_TODO(u8"예상치 못한 값이 들어왔습니다. 에러가 아닐 수도 있습니다. 확인 해 주세요. StatementType=%s(%zu) ConvertedString=`%s`",
+				mcf::AST::Statement::CONVERT_TYPE_TO_STRING(statement->GetStatementType()), mcf::ENUM_INDEX(statement->GetStatementType()), statement->ConvertToString().c_str());
 			return mcf::IR::Invalid::Make();
-		}
-		break;
-
-	default:
-		object = mcf::IR::Invalid::Make();
-		MCF_DEBUG_TODO(u8"예상치 못한 값이 들어왔습니다. 에러가 아닐 수도 있습니다. 확인 해 주세요. StatementType=%s(%zu) ConvertedString=`%s`",
-			mcf::AST::Statement::CONVERT_TYPE_TO_STRING(statement->GetStatementType()), mcf::ENUM_INDEX(statement->GetStatementType()), statement->ConvertToString().c_str());
-		break;
-	}
-	constexpr const size_t STATEMENT_TYPE_COUNT = __COUNTER__ - STATEMENT_TYPE_COUNT_BEGIN;
-	static_assert(static_cast<size_t>(mcf::AST::Statement::Type::COUNT) == STATEMENT_TYPE_COUNT, "statement type count is changed. this SWITCH need to be changed as well.");
-	return std::move(object);
+		},
+		[&](const mcf::AST::Statement::IncludeLibrary* includeLibrary) -> mcf::IR::Pointer { return mcf::IR::IncludeLib::Make(includeLibrary->GetLibPath()); },
+		[&](const mcf::AST::Statement::Typedef* typedefStatement) -> mcf::IR::Pointer { return EvalTypedefStatement(typedefStatement, scope); },
+		[&](const mcf::AST::Statement::Extern* externStatement) -> mcf::IR::Pointer { return EvalExternStatement(externStatement, scope); },
+		[&](const mcf::AST::Statement::Let* letStatement) -> mcf::IR::Pointer { return EvalLetStatement(letStatement, scope); },
+		[&](const mcf::AST::Statement::Block*) -> mcf::IR::Pointer
+		{
+			MCF_DEBUG_TODO(u8"구현 필요");
+			return mcf::IR::Invalid::Make();
+		},
+		[&](const mcf::AST::Statement::Return* returnStatement) -> mcf::IR::Pointer { return EvalReturnStatement(returnStatement, scope); },
+		[&](const mcf::AST::Statement::Func* funcStatement) -> mcf::IR::Pointer { return EvalFuncStatement(funcStatement, scope); },
+		[&](const mcf::AST::Statement::Main* mainStatement) -> mcf::IR::Pointer { return EvalMainStatement(mainStatement, scope); },
+		[&](const mcf::AST::Statement::Expression* expressionStatement) -> mcf::IR::Pointer
+		{
+			mcf::IR::Expression::Pointer expressionObject = EvalExpression(expressionStatement->GetUnsafeExpression(), scope);
+			if (expressionObject.get() == nullptr || expressionObject->GetExpressionType() == mcf::IR::Expression::Type::INVALID)
+			{
+				return mcf::IR::Invalid::Make();
+			}
+			return expressionObject;
+		},
+		[&](const mcf::AST::Statement::AssignExpression* assignStatement) -> mcf::IR::Pointer { return EvalAssignExpressionStatement(assignStatement, scope); },
+		[&](const mcf::AST::Statement::Unused* unusedStatement) -> mcf::IR::Pointer { return EvalUnusedStatement(unusedStatement, scope); },
+		[&](const mcf::AST::Statement::While* whileStatement) -> mcf::IR::Pointer { return EvalWhileStatement(whileStatement, scope); },
+		[&](const mcf::AST::Statement::Break* breakStatement) -> mcf::IR::Pointer
+		{
+			mcf::IR::Pointer object = EvalBreakStatement(breakStatement, scope, isBreakAllowed);
+			if (object.get() == nullptr || object->GetType() == mcf::IR::Type::INVALID)
+			{
+				return mcf::IR::Invalid::Make();
+			}
+			return object;
+		},
+	});
 }
 
 mcf::IR::Pointer mcf::Evaluator::Object::EvalTypedefStatement(_Notnull_ const mcf::AST::Statement::Typedef* statement, _Notnull_ mcf::Object::Scope* scope) noexcept
 {
-	mcf::Object::Variable variable = EvalVariavbleSignatureIntermediate(statement->GetUnsafeSignaturePointer(), scope);
-	mcf::Object::TypeInfo typeToDefine = variable.DataType;
-	typeToDefine.Name = variable.Name;
+	return MakeTypedefObject(EvalVariavbleSignatureIntermediate(statement->GetUnsafeSignaturePointer(), scope), scope);
+}
+
+mcf::IR::Pointer mcf::Evaluator::Object::MakeTypedefObject(const mcf::Object::Variable& variable, _Notnull_ mcf::Object::Scope* scope) noexcept
+{
+	const mcf::Object::TypeInfo typeToDefine = variable.DataType.MakeNamedType(variable.Name);
 
-	if (scope->DefineType(typeToDefine.Name, typeToDefine) == false)
+	if (scope->DefineType(typeToDefine.GetName(), typeToDefine) == false)
 	{
 		MCF_DEBUG_TODO(u8"타입 정의에 실패 하였습니다.");
 		return mcf::IR::Invalid::Make();
@@ -2324,6 +2605,11 @@ mcf::IR::Pointer mcf::Evaluator::Object::EvalExternStatement(_Notnull_ const mcf
 {
 	const mcf::AST::Intermediate::FunctionSignature* signature = statement->GetUnsafeSignaturePointer();
 	mcf::Object::FunctionInfo functionInfo = EvalFunctionSignatureIntermediate(signature, scope);
+	return MakeExternObject(functionInfo, scope);
+}
+
+mcf::IR::Pointer mcf::Evaluator::Object::MakeExternObject(_Inout_ mcf::Object::FunctionInfo& functionInfo, _Notnull_ mcf::Object::Scope* scope) noexcept
+{
 	scope->MakeLocalScopeToFunctionInfo(functionInfo);
 	if (functionInfo.IsValid() == false)
 	{
@@ -2338,7 +2624,7 @@ mcf::IR::Pointer mcf::Evaluator::Object::EvalExternStatement(_Notnull_ const mcf
 		MCF_DEBUG_ASSERT(functionInfo.Params.Variables[i].IsValid(), u8"functionInfo.Params.Variables[%zu]가 유효하지 않습니다.", i );
 		MCF_DEBUG_ASSERT(functionInfo.Params.Variables[i].DataType.IsValid(), u8"functionInfo.Params.Variables[%zu].DataType가 유효하지 않습니다.", i );
 		MCF_DEBUG_ASSERT(functionInfo.Params.Variables[i].DataType.HasUnknownArrayIndex() == false, u8"unknown 배열이 있으면 안됩니다. functionInfo.Params.Variables[%zu].DataType", i);
-		MCF_DEBUG_ASSERT(functionInfo.Params.Variables[i].DataType.IsVariadic || scope->FindTypeInfo(functionInfo.Params.Variables[i].DataType.Name).IsValid(), u8"변수 타입은 variadic 이거나 scope에 등록되어 있어야 합니다. functionInfo.Params.Variables[%zu].DataType", i);
+		MCF_DEBUG_ASSERT(functionInfo.Params.Variables[i].DataType.IsVariadic() || scope->FindTypeInfo(functionInfo.Params.Variables[i].DataType.GetName()).IsValid(), u8"변수 타입은 variadic 이거나 scope에 등록되어 있어야 합니다. functionInfo.Params.Variables[%zu].DataType", i);
 	}
 #endif
 
@@ -2373,7 +2659,11 @@ mcf::IR::Pointer mcf::Evaluator::Object::EvalLetStatement(_Notnull_ const mcf::A
 		return mcf::IR::Let::Make(info, nullptr);
 	}
 
-	mcf::IR::Expression::Pointer expressionObject = EvalExpression(statement->GetUnsafeExpressionPointer(), scope);
+	return MakeLetObject(info, EvalExpression(statement->GetUnsafeExpressionPointer(), scope), scope);
+}
+
+mcf::IR::Pointer mcf::Evaluator::Object::MakeLetObject(_Inout_ mcf::Object::VariableInfo& info, mcf::IR::Expression::Pointer&& expressionObject, _Notnull_ mcf::Object::Scope* scope) noexcept
+{
 	if (expressionObject.get() == nullptr)
 	{
 		MCF_DEBUG_TODO(u8"구현 필요");
@@ -2401,10 +2691,9 @@ mcf::IR::Pointer mcf::Evaluator::Object::EvalUnusedStatement(_Notnull_ const mcf
 	{
 		const mcf::AST::Expression::Identifier* identifier = statement->GetUnsafeIdentifierPointerAt(i);
 		MCF_DEBUG_ASSERT(identifier != nullptr, u8"identifier가 nullptr이면 안됩니다.");
-		std::string tokenLiteral = identifier->GetTokenLiteral();
-		if (scope->UseVariableInfo(tokenLiteral) == false)
+		if (scope->UseVariableInfo(ResolveSymbol(identifier, scope)) == false)
 		{
-			MCF_DEBUG_TODO(u8"해당 이름의 변수를 찾을 수 없습니다.");
+			// 실패한 원인은 UseVariableInfo 가 출력합니다.
 			return mcf::IR::Invalid::Make();
 		}
 	}
@@ -2438,91 +2727,106 @@ mcf::IR::Pointer mcf::Evaluator::Object::EvalReturnStatement(_Notnull_ const mcf
 
 mcf::IR::Pointer mcf::Evaluator::Object::EvalFuncStatement(_Notnull_ const mcf::AST::Statement::Func* statement, _Notnull_ mcf::Object::Scope* scope) noexcept
 {
-	const mcf::AST::Intermediate::FunctionSignature* signature = statement->GetUnsafeSignaturePointer();
-	if (signature->GetName() == mcf::AST::Statement::Main::NAME)
+	const mcf::Object::FunctionInfo* functionInfo = DefineFuncStatement(statement, scope);
+	if (functionInfo == nullptr)
 	{
-		MCF_DEBUG_TODO(u8"메인 함수는 func문이 아닌 main문으로 작성 해야 합니다.");
 		return mcf::IR::Invalid::Make();
 	}
 
-	mcf::Object::FunctionInfo functionInfo = EvalFunctionSignatureIntermediate(signature, scope);
-	scope->MakeLocalScopeToFunctionInfo(functionInfo);
-	if (functionInfo.IsValid() == false)
+	return EvalFuncBody(*functionInfo, statement->GetUnsafeBlockPointer());
+}
+
+mcf::IR::Pointer mcf::Evaluator::Object::EvalLazyFuncStatement(_Notnull_ const mcf::AST::Statement::Func* statement, const size_t objectIndex, _Notnull_ mcf::Object::Scope* scope) noexcept
+{
+	const mcf::Object::FunctionInfo* functionInfo = DefineFuncStatement(statement, scope);
+	if (functionInfo == nullptr)
 	{
-		MCF_DEBUG_TODO(u8"구현 필요");
 		return mcf::IR::Invalid::Make();
 	}
 
-	const size_t paramCount = functionInfo.Params.Variables.size();
-	for (size_t i = 0; i < paramCount; ++i)
-	{
-		MCF_DEBUG_ASSERT(functionInfo.Params.Variables[i].IsValid(), u8"");
-		MCF_DEBUG_ASSERT(functionInfo.Params.Variables[i].DataType.IsValid(), u8"");
-		if (functionInfo.Params.Variables[i].DataType.IsVariadic)
-		{
-			continue;
-		}
-
-		MCF_DEBUG_ASSERT(scope->FindTypeInfo(functionInfo.Params.Variables[i].DataType.Name).IsValid(), u8"");
-	}
+	_lazyFunctions.emplace_back(LazyFunction{ statement, functionInfo, objectIndex });
+	return nullptr;
+}
 
-	if (scope->DefineFunction(functionInfo.Name, functionInfo) == false)
+mcf::IR::Pointer mcf::Evaluator::Object::EvalFuncBody(const mcf::Object::FunctionInfo& info, _Notnull_ const mcf::AST::Statement::Block* block) noexcept
+{
+	mcf::IR::PointerVector objects;
+	if (EvalFunctionBlockStatement(objects, info, block) == false)
 	{
-		MCF_DEBUG_TODO(u8"구현 필요");
 		return mcf::IR::Invalid::Make();
 	}
 
-	const mcf::AST::Statement::Block* functionBlock = statement->GetUnsafeBlockPointer();
-	mcf::IR::ASM::PointerVector objects = EvalFunctionBlockStatement(functionInfo, functionBlock);
-	if (objects.empty() == true)
+	return MakeFuncObject(GenerateFunctionASM(info, objects));
+}
+
+mcf::IR::Pointer mcf::Evaluator::Object::EvalMainStatement(_Notnull_ const mcf::AST::Statement::Main* statement, _Notnull_ mcf::Object::Scope* scope) noexcept
+{
+	const mcf::Object::FunctionInfo* functionInfo = DefineMainStatement(statement, scope);
+	if (functionInfo == nullptr)
 	{
-		MCF_DEBUG_TODO(u8"구현 필요");
 		return mcf::IR::Invalid::Make();
 	}
 
-	return mcf::IR::Func::Make(std::move(objects));
+	return EvalFuncBody(*functionInfo, statement->GetUnsafeBlockPointer());
 }
 
-mcf::IR::Pointer mcf::Evaluator::Object::EvalMainStatement(_Notnull_ const mcf::AST::Statement::Main* statement, _Notnull_ mcf::Object::Scope* scope) noexcept
+const mcf::Object::FunctionInfo* mcf::Evaluator::Object::DefineFuncStatement(_Notnull_ const mcf::AST::Statement::Func* statement, _Notnull_ mcf::Object::Scope* scope) noexcept
 {
-	MCF_DEBUG_ASSERT(mcf::AST::Statement::Main::NAME.empty() == false, u8"FunctionSignature에는 반드시 함수 이름이 있어야 합니다.");
-	mcf::Object::FunctionInfo functionInfo = BuildFunctionInfo(mcf::AST::Statement::Main::NAME, statement->GetUnsafeFunctionParamsPointer(), statement->IsReturnVoid() ? nullptr : statement->GetUnsafeReturnTypePointer(), scope);
-	scope->MakeLocalScopeToFunctionInfo(functionInfo);
-	if (functionInfo.IsValid() == false)
+	const mcf::AST::Intermediate::FunctionSignature* signature = statement->GetUnsafeSignaturePointer();
+	if (signature->GetName() == mcf::AST::Statement::Main::NAME)
 	{
-		MCF_DEBUG_TODO(u8"구현 필요");
-		return mcf::IR::Invalid::Make();
+		MCF_DEBUG_TODO(u8"메인 함수는 func문이 아닌 main문으로 작성 해야 합니다.");
+		return nullptr;
+	}
+
+	mcf::Object::FunctionInfo functionInfo = EvalFunctionSignatureIntermediate(signature, scope);
+	if (DefineFunctionInfo(functionInfo, scope) == false)
+	{
+		return nullptr;
+	}
+	return &scope->FindFunction(functionInfo.Name);
+}
+
+const mcf::Object::FunctionInfo* mcf::Evaluator::Object::DefineMainStatement(_Notnull_ const mcf::AST::Statement::Main* statement, _Notnull_ mcf::Object::Scope* scope) noexcept
+{
+	MCF_DEBUG_ASSERT(mcf::AST::Statement::Main::NAME.empty() == false, u8"FunctionSignature에는 반드시 함수 이름이 있어야 합니다.");
+	mcf::Object::FunctionInfo functionInfo = BuildFunctionInfo(mcf::AST::Statement::Main::NAME, statement->GetUnsafeFunctionParamsPointer(), statement->IsReturnVoid() ? nullptr : statement->GetUnsafeReturnTypePointer(), scope);
+	// TODO #35: 메인 함수에서는 특정 인자들만 받을 수 있도록 개선
+	if (DefineFunctionInfo(functionInfo, scope) == false)
+	{
+		return nullptr;
+	}
+	return &scope->FindFunction(functionInfo.Name);
+}
+
+const bool mcf::Evaluator::Object::DefineFunctionInfo(_Inout_ mcf::Object::FunctionInfo& functionInfo, _Notnull_ mcf::Object::Scope* scope) noexcept
+{
+	scope->MakeLocalScopeToFunctionInfo(functionInfo);
+	if (functionInfo.IsValid() == false)
+	{
+		MCF_DEBUG_TODO(u8"구현 필요");
+		return false;
 	}
 
-	// TODO #35: 메인 함수에서는 특정 인자들만 받을 수 있도록 개선
 	const size_t paramCount = functionInfo.Params.Variables.size();
 	for (size_t i = 0; i < paramCount; ++i)
 	{
 		MCF_DEBUG_ASSERT(functionInfo.Params.Variables[i].IsValid(), u8"");
 		MCF_DEBUG_ASSERT(functionInfo.Params.Variables[i].DataType.IsValid(), u8"");
-		if (functionInfo.Params.Variables[i].DataType.IsVariadic)
+		if (functionInfo.Params.Variables[i].DataType.IsVariadic())
 		{
 			continue;
 		}
 
-		MCF_DEBUG_ASSERT(scope->FindTypeInfo(functionInfo.Params.Variables[i].DataType.Name).IsValid(), u8"");
+		MCF_DEBUG_ASSERT(scope->FindTypeInfo(functionInfo.Params.Variables[i].DataType.GetName()).IsValid(), u8"");
 	}
 
 	if (scope->DefineFunction(functionInfo.Name, functionInfo) == false)
 	{
 		MCF_DEBUG_TODO(u8"구현 필요");
-		return mcf::IR::Invalid::Make();
-	}
-
-	const mcf::AST::Statement::Block* functionBlock = statement->GetUnsafeBlockPointer();
-	mcf::IR::ASM::PointerVector objects = EvalFunctionBlockStatement(functionInfo, functionBlock);
-	if (objects.empty() == true)
-	{
-		MCF_DEBUG_TODO(u8"구현 필요");
-		return mcf::IR::Invalid::Make();
+		return false;
 	}
-
-	return mcf::IR::Func::Make(std::move(objects));
+	return true;
 }
 
 mcf::IR::Pointer mcf::Evaluator::Object::EvalAssignExpressionStatement(_Notnull_ const mcf::AST::Statement::AssignExpression* statement, _Notnull_ mcf::Object::Scope* scope) noexcept
@@ -2553,6 +2857,26 @@ mcf::IR::Pointer mcf::Evaluator::Object::EvalWhileStatement(_Notnull_ const mcf:
 		return mcf::IR::Invalid::Make();
 	}
 
+	if (ValidateConditionObject(conditionObject.get()) == false)
+	{
+		return mcf::IR::Invalid::Make();
+	}
+
+	mcf::Object::Scope* blockScope = nullptr;
+	if (scope->MakeLocalScope(&blockScope, false) == false)
+	{
+		MCF_DEBUG_TODO(u8"구현 필요");
+		return mcf::IR::Invalid::Make();
+	}
+
+	_bindingStack->Enter(blockScope);
+	mcf::IR::PointerVector blockObject = EvalBlockStatement(statement->GetUnsafeBlockPointer(), blockScope, true);
+	_bindingStack->Leave(blockScope);
+	return mcf::IR::While::Make(std::move(conditionObject), std::move(blockObject), blockScope);
+}
+
+const bool mcf::Evaluator::Object::ValidateConditionObject(_Notnull_ const mcf::IR::Expression::Interface* conditionObject) noexcept
+{
 	constexpr const size_t EXPRESSION_TYPE_COUNT_BEGIN = __COUNTER__;
 	switch (conditionObject->GetExpressionType())
 	{
@@ -2573,10 +2897,10 @@ mcf::IR::Pointer mcf::Evaluator::Object::EvalWhileStatement(_Notnull_ const mcf:
 		break;
 
 	case IR::Expression::Type::CALL: __COUNTER__;
-		if (static_cast<const mcf::IR::Expression::Call*>(conditionObject.get())->GetInfo().IsReturnTypeVoid())
+		if (static_cast<const mcf::IR::Expression::Call*>(conditionObject)->GetInfo().IsReturnTypeVoid())
 		{
 			MCF_DEBUG_TODO(u8"리턴 타입이 없는 함수는 while문의 조건 표현식에서 호출될수 없습니다.");
-			return mcf::IR::Invalid::Make();
+			return false;
 		}
 		break;
 
@@ -2596,20 +2920,11 @@ mcf::IR::Pointer mcf::Evaluator::Object::EvalWhileStatement(_Notnull_ const mcf:
 	default:
 		MCF_DEBUG_TODO(u8"예상치 못한 값이 들어왔습니다. 확인 해 주세요. ExpressionType=%s(%zu) ConvertedString=`%s`",
 			mcf::IR::Expression::CONVERT_TYPE_TO_STRING(conditionObject->GetExpressionType()), mcf::ENUM_INDEX(conditionObject->GetExpressionType()), conditionObject->Inspect().c_str());
-		return mcf::IR::Invalid::Make();
+		return false;
 	}
 	constexpr const size_t EXPRESSION_TYPE_COUNT = __COUNTER__ - EXPRESSION_TYPE_COUNT_BEGIN;
 	static_assert(static_cast<size_t>(mcf::IR::Expression::Type::COUNT) == EXPRESSION_TYPE_COUNT, "validate whether the expression is conditional expression.");
-
-	mcf::Object::Scope* blockScope = nullptr;
-	if (scope->MakeLocalScope(&blockScope, false) == false)
-	{
-		MCF_DEBUG_TODO(u8"구현 필요");
-		return mcf::IR::Invalid::Make();
-	}
-
-	mcf::IR::PointerVector blockObject = EvalBlockStatement(statement->GetUnsafeBlockPointer(), blockScope, true);
-	return mcf::IR::While::Make(std::move(conditionObject), std::move(blockObject), blockScope);
+	return true;
 }
 
 mcf::IR::Pointer mcf::Evaluator::Object::EvalBreakStatement(_Notnull_ const mcf::AST::Statement::Break* statement, _Notnull_ mcf::Object::Scope* scope, const bool isBreakAllowed) noexcept
@@ -2642,9 +2957,10 @@ mcf::IR::PointerVector mcf::Evaluator::Object::EvalBlockStatement(_Notnull_ cons
 	return objects;
 }
 
-mcf::IR::ASM::PointerVector mcf::Evaluator::Object::EvalFunctionBlockStatement(const mcf::Object::FunctionInfo& info, _Notnull_ const mcf::AST::Statement::Block* statement) noexcept
+const bool mcf::Evaluator::Object::EvalFunctionBlockStatement(_Out_ mcf::IR::PointerVector& outObjects, const mcf::Object::FunctionInfo& info, _Notnull_ const mcf::AST::Statement::Block* statement) noexcept
 {
-	mcf::IR::PointerVector objects;
+	_bindingStack->Enter(info.LocalScope);
+	bool isSucceeded = true;
 	const size_t statementCount = statement->GetStatementCount();
 	for (size_t i = 0; i < statementCount; i++)
 	{
@@ -2652,11 +2968,24 @@ mcf::IR::ASM::PointerVector mcf::Evaluator::Object::EvalFunctionBlockStatement(c
 		if (object.get() == nullptr)
 		{
 			MCF_DEBUG_TODO(u8"구현 필요");
-			return mcf::IR::ASM::PointerVector();
+			isSucceeded = false;
+			break;
 		}
-		objects.emplace_back(std::move(object));
+
+		// 실패한 명령문은 평가하면서 원인을 이미 출력하였으므로 본문의 평가만 실패로 처리합니다.
+		if (object->GetType() == mcf::IR::Type::INVALID)
+		{
+			isSucceeded = false;
+			break;
+		}
+		outObjects.emplace_back(std::move(object));
 	}
+	_bindingStack->Leave(info.LocalScope);
+	return isSucceeded;
+}
 
+mcf::IR::ASM::PointerVector mcf::Evaluator::Object::GenerateFunctionASM(const mcf::Object::FunctionInfo& info, mcf::IR::PointerVector& objects) noexcept
+{
 	mcf::Evaluator::FunctionIRGenerator generator(info);
 	if (FunctionIRGenerator::ConvertStatements(generator, &objects, info.LocalScope) == false)
 	{
@@ -2667,10 +2996,20 @@ mcf::IR::ASM::PointerVector mcf::Evaluator::Object::EvalFunctionBlockStatement(c
 	return std::move(generator.GenerateIRCode());
 }
 
+mcf::IR::Pointer mcf::Evaluator::Object::MakeFuncObject(mcf::IR::ASM::PointerVector&& codes) noexcept
+{
+	if (codes.empty() == true)
+	{
+		MCF_DEBUG_TODO(u8"구현 필요");
+		return mcf::IR::Invalid::Make();
+	}
+	return mcf::IR::Func::Make(std::move(codes));
+}
+
 mcf::Object::FunctionInfo mcf::Evaluator::Object::EvalFunctionSignatureIntermediate(_Notnull_ const mcf::AST::Intermediate::FunctionSignature* intermediate, _Notnull_ mcf::Object::Scope* scope) const noexcept
 {
 	MCF_DEBUG_ASSERT(intermediate->GetName().empty() == false, u8"FunctionSignature에는 반드시 함수 이름이 있어야 합니다.");
-	return BuildFunctionInfo(intermediate->GetName(), intermediate->GetUnsafeFunctionParamsPointer(), intermediate->IsReturnTypeVoid() ? nullptr : intermediate->GetUnsafeReturnTypePointer(), scope);
+	return BuildFunctionInfo(std::string(intermediate->GetName()), intermediate->GetUnsafeFunctionParamsPointer(), intermediate->IsReturnTypeVoid() ? nullptr : intermediate->GetUnsafeReturnTypePointer(), scope);
 }
 
 const bool mcf::Evaluator::Object::EvalFunctionParamsIntermediate(_Out_ mcf::Object::FunctionParams& outParams, _Notnull_ const mcf::AST::Intermediate::FunctionParams* intermediate, _Notnull_ mcf::Object::Scope* scope) const noexcept
@@ -2697,7 +3036,7 @@ const bool mcf::Evaluator::Object::EvalFunctionParamsIntermediate(_Out_ mcf::Obj
 	{
 		mcf::Object::Variable variadic;
 		variadic.Name = intermediate->GetUnsafeVariadic()->GetIdentifier();
-		variadic.DataType.IsVariadic = true;
+		variadic.DataType = mcf::Object::TypeInfo::GetVariadicTypeInfo();
 		outParams.Variables.emplace_back(variadic);
 	}
 	return true;
@@ -2727,14 +3066,17 @@ mcf::Object::Variable mcf::Evaluator::Object::EvalVariavbleSignatureIntermediate
 
 mcf::Object::TypeInfo mcf::Evaluator::Object::EvalTypeSignatureIntermediate(_Notnull_ const mcf::AST::Intermediate::TypeSignature* intermediate, _Notnull_ mcf::Object::Scope* scope) const noexcept
 {
-	mcf::IR::Pointer object = EvalExpression(intermediate->GetUnsafeSignaturePointer(), scope);
-	MCF_DEBUG_ASSERT(object->GetType() == mcf::IR::Type::EXPRESSION, u8"");
-	mcf::IR::Expression::Interface* expressionObject = static_cast<mcf::IR::Expression::Interface*>(object.get());
+	mcf::IR::Expression::Pointer object = EvalExpression(intermediate->GetUnsafeSignaturePointer(), scope);
+	return MakeTypeInfo(object.get(), intermediate->IsUnsigned());
+}
+
+mcf::Object::TypeInfo mcf::Evaluator::Object::MakeTypeInfo(_Notnull_ const mcf::IR::Expression::Interface* expressionObject, const bool isUnsigned) const noexcept
+{
 	mcf::Object::TypeInfo typeInfo;
 	switch (expressionObject->GetExpressionType())
 	{
 	case mcf::IR::Expression::Type::TYPE_IDENTIFIER:
-		typeInfo = static_cast<mcf::IR::Expression::TypeIdentifier*>(expressionObject)->GetInfo();
+		typeInfo = static_cast<const mcf::IR::Expression::TypeIdentifier*>(expressionObject)->GetInfo();
 		break;
 
 	default:
@@ -2742,99 +3084,82 @@ mcf::Object::TypeInfo mcf::Evaluator::Object::EvalTypeSignatureIntermediate(_Not
 		break;
 	}
 
-	if (intermediate->IsUnsigned() && typeInfo.IsUnsigned)
+	if (isUnsigned && typeInfo.IsUnsigned())
 	{
 		MCF_DEBUG_TODO(u8"구현 필요");
 		return mcf::Object::TypeInfo();
 	}
-	typeInfo.IsUnsigned = intermediate->IsUnsigned() ? intermediate->IsUnsigned() : typeInfo.IsUnsigned;
-	return typeInfo;
+	return isUnsigned ? typeInfo.MakeUnsignedType() : typeInfo;
 }
 
 mcf::IR::Expression::Pointer mcf::Evaluator::Object::EvalExpression(_Notnull_ const mcf::AST::Expression::Interface* expression, _Notnull_ mcf::Object::Scope* scope) const noexcept
 {
-	mcf::IR::Expression::Pointer object = mcf::IR::Expression::Invalid::Make();
-	constexpr const size_t EXPRESSION_TYPE_COUNT_BEGIN = __COUNTER__;
-	switch (expression->GetExpressionType())
+	return mcf::AST::Expression::VISIT(expression, mcf::Visitor
 	{
-	case AST::Expression::Type::IDENTIFIER: __COUNTER__;
-		object = EvalIdentifierExpression(static_cast<const mcf::AST::Expression::Identifier*>(expression), scope);
-		break;
-
-	case AST::Expression::Type::INTEGER: __COUNTER__;
-		object = EvalIntegerExpression(static_cast<const mcf::AST::Expression::Integer*>(expression), scope);
-		break;
-
-	case AST::Expression::Type::STRING: __COUNTER__;
-		object = EvalStringExpression(static_cast<const mcf::AST::Expression::String*>(expression), scope);
-		break;
-
-	case AST::Expression::Type::PREFIX: __COUNTER__;
-		MCF_DEBUG_TODO(u8"구현 필요");
-		break;
-
-	case AST::Expression::Type::GROUP: __COUNTER__;
-		MCF_DEBUG_TODO(u8"구현 필요");
-		break;
-
-	case AST::Expression::Type::INFIX: __COUNTER__;
-		object = EvalInfixExpression(static_cast<const mcf::AST::Expression::Infix*>(expression), scope);
-		break;
-
-	case AST::Expression::Type::CALL: __COUNTER__;
-		object = EvalCallExpression(static_cast<const mcf::AST::Expression::Call*>(expression), scope);
-		break;
-
-	case AST::Expression::Type::AS: __COUNTER__;
-		object = EvalAsExpression(static_cast<const mcf::AST::Expression::As*>(expression), scope);
-		if (object.get() == nullptr || object->GetExpressionType() != mcf::IR::Expression::Type::STATIC_CAST)
+		[&](const mcf::AST::Expression::Invalid*) -> mcf::IR::Expression::Pointer
 		{
-			MCF_DEBUG_TODO(u8"정적 캐스팅에 실패 하였습니다.");
-			break;
-		}
-		break;
-
-	case AST::Expression::Type::INDEX: __COUNTER__;
-		object = EvalIndexExpression(static_cast<const mcf::AST::Expression::Index*>(expression), scope);
-		break;
-
-	case AST::Expression::Type::INITIALIZER: __COUNTER__;
-		object = EvalInitializerExpression(static_cast<const mcf::AST::Expression::Initializer*>(expression), scope);
-		break;
-
-	case AST::Expression::Type::MAP_INITIALIZER: __COUNTER__;
-		MCF_DEBUG_TODO(u8"구현 필요");
-		break;
-
-	default:
-		MCF_DEBUG_TODO(u8"예상치 못한 값이 들어왔습니다. 에러가 아닐 수도 있습니다. 확인 해 주세요. ExpressionType=%s(%zu) ConvertedString=`%s`",
-			mcf::AST::Expression::CONVERT_TYPE_TO_STRING(expression->GetExpressionType()), mcf::ENUM_INDEX(expression->GetExpressionType()), expression->ConvertToString().c_str());
-		break;
-	}
-	constexpr const size_t EXPRESSION_TYPE_COUNT = __COUNTER__ - EXPRESSION_TYPE_COUNT_BEGIN;
-	static_assert(static_cast<size_t>(mcf::AST::Expression::Type::COUNT) == EXPRESSION_TYPE_COUNT, "expression type count is changed. this SWITCH need to be changed as well.");
-	return std::move(object);
+			MCF_DEBUG_TODO(u8"예상치 못한 값이 들어왔습니다. 에러가 아닐 수도 있습니다. 확인 해 주세요. ExpressionType=%s(%zu) ConvertedString=`%s`",
+				mcf::AST::Expression::CONVERT_TYPE_TO_STRING(expression->GetExpressionType()), mcf::ENUM_INDEX(expression->GetExpressionType()), expression->ConvertToString().c_str());
+			return mcf::IR::Expression::Invalid::Make();
+		},
+		[&](const mcf::AST::Expression::Identifier* identifier) -> mcf::IR::Expression::Pointer { return EvalIdentifierExpression(identifier, scope); },
+		[&](const mcf::AST::Expression::Integer* integer) -> mcf::IR::Expression::Pointer { return EvalIntegerExpression(integer, scope); },
+		[&](const mcf::AST::Expression::String* string) -> mcf::IR::Expression::Pointer { return EvalStringExpression(string, scope); },
+		[&](const mcf::AST::Expression::Prefix*) -> mcf::IR::Expression::Pointer
+		{
+			MCF_DEBUG_TODO(u8"구현 필요");
+			return mcf::IR::Expression::Invalid::Make();
+		},
+		[&](const mcf::AST::Expression::Group*) -> mcf::IR::Expression::Pointer
+		{
+			MCF_DEBUG_TODO(u8"구현 필요");
+			return mcf::IR::Expression::Invalid::Make();
+		},
+		[&](const mcf::AST::Expression::Infix* infix) -> mcf::IR::Expression::Pointer { return EvalInfixExpression(infix, scope); },
+		[&](const mcf::AST::Expression::Call* call) -> mcf::IR::Expression::Pointer { return EvalCallExpression(call, scope); },
+		[&](const mcf::AST::Expression::As* as) -> mcf::IR::Expression::Pointer
+		{
+			mcf::IR::Expression::Pointer object = EvalAsExpression(as, scope);
+			if (object.get() == nullptr || object->GetExpressionType() != mcf::IR::Expression::Type::STATIC_CAST)
+			{
+				MCF_DEBUG_TODO(u8"정적 캐스팅에 실패 하였습니다.");
+			}
+			return object;
+		},
+		[&](const mcf::AST::Expression::Index* index) -> mcf::IR::Expression::Pointer { return EvalIndexExpression(index, scope); },
+		[&](const mcf::AST::Expression::Initializer* initializer) -> mcf::IR::Expression::Pointer { return EvalInitializerExpression(initializer, scope); },
+		[&](const mcf::AST::Expression::MapInitializer*) -> mcf::IR::Expression::Pointer
+		{
+			MCF_DEBUG_TODO(u8"구현 필요");
+			return mcf::IR::Expression::Invalid::Make();
+		},
+	});
 }
 
 mcf::IR::Expression::Pointer mcf::Evaluator::Object::EvalIdentifierExpression(_Notnull_ const mcf::AST::Expression::Identifier* expression, _Notnull_ mcf::Object::Scope* scope) const noexcept
 {
-	const std::string name = expression->GetTokenLiteral();
-	if (scope->IsIdentifierRegistered(name) == false)
+	// 이름을 한번만 ID 로 바꾸고 부모 스코프를 따라가는 검색은 모두 ID 로 합니다.
+	return EvalIdentifierSymbol(ResolveSymbol(expression, scope), scope);
+}
+
+mcf::IR::Expression::Pointer mcf::Evaluator::Object::EvalIdentifierSymbol(const mcf::Symbol::ID symbol, _Notnull_ mcf::Object::Scope* scope) const noexcept
+{
+	if (scope->IsIdentifierRegistered(symbol) == false)
 	{
-		MCF_DEBUG_TODO(u8"구현 필요");
+		MCF_DEBUG_MESSAGE(u8"등록되지 않은 식별자입니다. 정의되지 않았거나 사용하는 곳보다 뒤에 선언된 식별자는 사용할 수 없습니다.");
 		return mcf::IR::Expression::Invalid::Make();
 	}
 
-	const mcf::Object::TypeInfo typeInfo = scope->FindTypeInfo(name);
+	const mcf::Object::TypeInfo typeInfo = scope->FindTypeInfo(symbol);
 	if (typeInfo.IsValid() == true)
 	{
 		return mcf::IR::Expression::TypeIdentifier::Make(typeInfo);
 	}
 
-	const mcf::Object::VariableInfo variableInfo = scope->FindVariableInfo(name);
+	const mcf::Object::VariableInfo variableInfo = scope->FindVariableInfo(symbol);
 	if (variableInfo.IsValid() == true)
 	{
-		MCF_EXECUTE_AND_DEBUG_ASSERT(scope->UseVariableInfo(variableInfo.Variable.Name), u8"변수가 존재해야 하는데 존재하지 않는 경우입니다. 존재하지 않는 원인을 찾아 해결해야 합니다.");
+		MCF_EXECUTE_AND_DEBUG_ASSERT(scope->UseVariableInfo(symbol), u8"변수가 존재해야 하는데 존재하지 않는 경우입니다. 존재하지 않는 원인을 찾아 해결해야 합니다.");
 		if (variableInfo.IsGlobal)
 		{
 			return mcf::IR::Expression::GlobalVariableIdentifier::Make(variableInfo.Variable);
@@ -2845,9 +3170,10 @@ mcf::IR::Expression::Pointer mcf::Evaluator::Object::EvalIdentifierExpression(_N
 		}
 	}
 
-	const mcf::Object::FunctionInfo functionInfo = scope->FindFunction(name);
+	const mcf::Object::FunctionInfo& functionInfo = scope->FindFunction(symbol);
 	if (functionInfo.IsValid() == true)
 	{
+		MCF_EXECUTE_AND_DEBUG_ASSERT(scope->UseFunction(symbol), u8"함수가 존재해야 하는데 존재하지 않는 경우입니다. 존재하지 않는 원인을 찾아 해결해야 합니다.");
 		return mcf::IR::Expression::FunctionIdentifier::Make(functionInfo);
 	}
 
@@ -2858,17 +3184,21 @@ mcf::IR::Expression::Pointer mcf::Evaluator::Object::EvalIdentifierExpression(_N
 mcf::IR::Expression::Pointer mcf::Evaluator::Object::EvalIntegerExpression(_Notnull_ const mcf::AST::Expression::Integer* expression, _Notnull_ const mcf::Object::Scope* scope) const noexcept
 {
 	MCF_UNUSED(scope);
+	return EvalIntegerLiteral(expression->GetTokenLiteral());
+}
 
-	std::string stringValue = expression->GetTokenLiteral();
+mcf::IR::Expression::Pointer mcf::Evaluator::Object::EvalIntegerLiteral(const std::string_view literal) const noexcept
+{
+	std::string stringValue(literal);
 
 	if (Internal::IsStringConvertibleToInt64(stringValue) == true)
 	{
-		return mcf::IR::Expression::Integer::Make(std::stoll(stringValue));
+		return mcf::IR::Expression::Integer::Make(static_cast<std::int64_t>(std::stoll(stringValue)));
 	}
 
 	if (Internal::IsStringConvertibleToUInt64(stringValue) == true)
 	{
-		return mcf::IR::Expression::Integer::Make(std::stoull(stringValue));
+		return mcf::IR::Expression::Integer::Make(static_cast<std::uint64_t>(std::stoull(stringValue)));
 	}
 
 	MCF_DEBUG_TODO(u8"구현 필요");
@@ -2876,21 +3206,83 @@ mcf::IR::Expression::Pointer mcf::Evaluator::Object::EvalIntegerExpression(_Notn
 }
 
 mcf::IR::Expression::Pointer mcf::Evaluator::Object::EvalStringExpression(_Notnull_ const mcf::AST::Expression::String* expression, _Notnull_ mcf::Object::Scope* scope) const noexcept
+{
+	return EvalStringLiteral(expression->GetTokenLiteral(), scope);
+}
+
+mcf::IR::Expression::Pointer mcf::Evaluator::Object::EvalStringLiteral(const std::string_view literal, _Notnull_ mcf::Object::Scope* scope) const noexcept
 {
 	// This is hard-coded because I assumed String TokenLiteral enclosing value by double quotations('"').
-	const std::string stringLiteral = expression->GetTokenLiteral().substr(1, expression->GetTokenLiteral().size() - 2);
+	const std::string stringLiteral(literal.substr(1, literal.size() - 2));
 	mcf::Object::Data literalData = Internal::ConvertStringToData(stringLiteral);
+	const size_t size = literalData.second.size();
 	mcf::Object::ScopeTree* const scopeTree = scope->GetUnsafeScopeTreePointer();
-	const auto emplacePairIter = scopeTree->LiteralIndexMap.try_emplace(expression->GetTokenLiteral(), std::make_pair(scopeTree->LiteralIndexMap.size(), literalData));
-	return mcf::IR::Expression::String::Make(emplacePairIter.first->second.first, literalData.second.size());
+	std::pair<size_t, mcf::Object::Data>* literalEntry = nullptr;
+	{
+		// 함수 본문을 평가하는 중이면 다른 스레드도 리터럴을 등록하므로 자리만 등록하고 인덱스는 평가가 끝난 뒤 정합니다.
+		std::lock_guard<std::mutex> lock(scopeTree->LiteralIndexMutex);
+		const size_t literalIndex = (_bodyLiterals == nullptr) ? scopeTree->LiteralIndexMap.size() : Internal::UNASSIGNED_LITERAL_INDEX;
+		literalEntry = &scopeTree->LiteralIndexMap.try_emplace(std::string(literal), std::make_pair(literalIndex, std::move(literalData))).first->second;
+	}
+
+	if (_bodyLiterals != nullptr)
+	{
+		_bodyLiterals->emplace_back(literalEntry);
+	}
+	return mcf::IR::Expression::String::Make(literalEntry, size, scopeTree->Types.MakePrimitive(true, "byte", 1, { size }));
 }
 
 mcf::IR::Expression::Pointer mcf::Evaluator::Object::EvalCallExpression(_Notnull_ const mcf::AST::Expression::Call* expression, _Notnull_ mcf::Object::Scope* scope) const noexcept
 {
 	const mcf::AST::Expression::Interface* leftExpression = expression->GetUnsafeLeftExpressionPointer();
 	mcf::IR::Expression::Pointer leftObject = EvalExpression(leftExpression, scope);
+	if (leftObject.get() == nullptr || leftObject->GetExpressionType() == mcf::IR::Expression::Type::INVALID)
+	{
+		// 호출할 식을 평가하면서 실패한 원인을 이미 출력하였습니다.
+		return mcf::IR::Expression::Invalid::Make();
+	}
 
-	mcf::Object::FunctionInfo functionInfo;
+	const mcf::Object::FunctionInfo& functionInfo = FindCalleeFunctionInfo(leftObject.get());
+	if (functionInfo.IsValid() == false)
+	{
+		MCF_DEBUG_TODO(u8"함수 정보를 가져올수 없습니다.");
+		return mcf::IR::Expression::Invalid::Make();
+	}
+
+	const size_t functionDefineParamCount = functionInfo.Params.HasVariadic() ? (functionInfo.Params.Variables.size() - 1) : functionInfo.Params.Variables.size();
+	const size_t paramCount = expression->GetParamExpressionsCount();
+	if (paramCount < functionDefineParamCount)
+	{
+		MCF_DEBUG_TODO(u8"함수 정보와 실제 함수 호출이 일치 하지 않습니다.");
+		return mcf::IR::Expression::Invalid::Make();
+	}
+
+	mcf::IR::Expression::PointerVector paramObjects;
+	if (functionInfo.Params.IsVoid() == false)
+	{
+		for (size_t i = 0; i < paramCount; i++)
+		{
+			paramObjects.emplace_back(EvalExpression(expression->GetUnsafeParamExpressionPointerAt(i), scope));
+			if (paramObjects.back().get() == nullptr || paramObjects.back()->GetExpressionType() == mcf::IR::Expression::Type::INVALID)
+			{
+				MCF_DEBUG_TODO(u8"함수 인자 정보가 잘못 되었습니다.");
+				return mcf::IR::Expression::Invalid::Make();
+			}
+
+			if (i < functionDefineParamCount && ValidateVariableTypeAndValue(functionInfo.Params.Variables[i], paramObjects.back().get()) == false)
+			{
+				MCF_DEBUG_TODO(u8"함수에 정의된 인자 타입과 호출 인자의 타입이 일치하지 않습니다.");
+				return mcf::IR::Expression::Invalid::Make();
+			}
+		}
+	}
+
+	return mcf::IR::Expression::Call::Make(functionInfo, std::move(paramObjects));
+}
+
+const mcf::Object::FunctionInfo& mcf::Evaluator::Object::FindCalleeFunctionInfo(_Notnull_ const mcf::IR::Expression::Interface* leftObject) const noexcept
+{
+	const mcf::Object::FunctionInfo* functionInfo = &mcf::Object::FunctionInfo::GetInvalidFunctionInfo();
 
 	constexpr const size_t LEFT_EXPRESSION_TYPE_COUNT_BEGIN = __COUNTER__;
 	switch (leftObject->GetExpressionType())
@@ -2904,7 +3296,7 @@ mcf::IR::Expression::Pointer mcf::Evaluator::Object::EvalCallExpression(_Notnull
 		break;
 
 	case mcf::IR::Expression::Type::FUNCTION_IDENTIFIER: __COUNTER__;
-		functionInfo = static_cast<mcf::IR::Expression::FunctionIdentifier*>(leftObject.get())->GetInfo();
+		functionInfo = &static_cast<const mcf::IR::Expression::FunctionIdentifier*>(leftObject)->GetInfo();
 		break;
 
 	case mcf::IR::Expression::Type::CALL: __COUNTER__;
@@ -2936,42 +3328,7 @@ mcf::IR::Expression::Pointer mcf::Evaluator::Object::EvalCallExpression(_Notnull
 	}
 	constexpr const size_t LEFT_EXPRESSION_TYPE_COUNT = __COUNTER__ - LEFT_EXPRESSION_TYPE_COUNT_BEGIN;
 	static_assert(static_cast<size_t>(mcf::IR::Expression::Type::COUNT) == LEFT_EXPRESSION_TYPE_COUNT, "Find and return function identifier from expression object");
-
-	if (functionInfo.IsValid() == false)
-	{
-		MCF_DEBUG_TODO(u8"함수 정보를 가져올수 없습니다.");
-		return mcf::IR::Expression::Invalid::Make();
-	}
-
-	const size_t functionDefineParamCount = functionInfo.Params.HasVariadic() ? (functionInfo.Params.Variables.size() - 1) : functionInfo.Params.Variables.size();
-	const size_t paramCount = expression->GetParamExpressionsCount();
-	if (paramCount < functionDefineParamCount)
-	{
-		MCF_DEBUG_TODO(u8"함수 정보와 실제 함수 호출이 일치 하지 않습니다.");
-		return mcf::IR::Expression::Invalid::Make();
-	}
-
-	mcf::IR::Expression::PointerVector paramObjects;
-	if (functionInfo.Params.IsVoid() == false)
-	{
-		for (size_t i = 0; i < paramCount; i++)
-		{
-			paramObjects.emplace_back(EvalExpression(expression->GetUnsafeParamExpressionPointerAt(i), scope));
-			if (paramObjects.back().get() == nullptr || paramObjects.back()->GetExpressionType() == mcf::IR::Expression::Type::INVALID)
-			{
-				MCF_DEBUG_TODO(u8"함수 인자 정보가 잘못 되었습니다.");
-				return mcf::IR::Expression::Invalid::Make();
-			}
-
-			if (i < functionDefineParamCount && ValidateVariableTypeAndValue(functionInfo.Params.Variables[i], paramObjects.back().get()) == false)
-			{
-				MCF_DEBUG_TODO(u8"함수에 정의된 인자 타입과 호출 인자의 타입이 일치하지 않습니다.");
-				return mcf::IR::Expression::Invalid::Make();
-			}
-		}
-	}
-
-	return mcf::IR::Expression::Call::Make(functionInfo, std::move(paramObjects));
+	return *functionInfo;
 }
 
 mcf::IR::Expression::Pointer mcf::Evaluator::Object::EvalAsExpression(_Notnull_ const mcf::AST::Expression::As* expression, _Notnull_ mcf::Object::Scope* scope) const noexcept
@@ -2983,7 +3340,11 @@ mcf::IR::Expression::Pointer mcf::Evaluator::Object::EvalAsExpression(_Notnull_
 		return mcf::IR::Expression::Invalid::Make();
 	}
 
-	mcf::IR::Expression::Pointer leftObject = EvalExpression(expression->GetUnsafeLeftExpressionPointer(), scope);
+	return MakeStaticCastObject(EvalExpression(expression->GetUnsafeLeftExpressionPointer(), scope), targetType);
+}
+
+mcf::IR::Expression::Pointer mcf::Evaluator::Object::MakeStaticCastObject(mcf::IR::Expression::Pointer&& leftObject, const mcf::Object::TypeInfo& targetType) const noexcept
+{
 	const mcf::Object::TypeInfo originalDataType = mcf::IR::Expression::Interface::GetDataTypeFromExpression(leftObject.get());
 	if (originalDataType.IsStaticCastable(targetType) == false)
 	{
@@ -2999,22 +3360,31 @@ mcf::IR::Expression::Pointer mcf::Evaluator::Object::EvalIndexExpression(_Notnul
 	const mcf::AST::Expression::Interface* indexExpression = expression->GetUnsafeIndexExpressionPointer();
 
 	mcf::IR::Expression::Pointer leftObject = EvalExpression(leftExpression, scope);
+	if (leftObject->GetExpressionType() != mcf::IR::Expression::Type::TYPE_IDENTIFIER)
+	{
+		return MakeIndexObject(leftObject.get(), nullptr);
+	}
+	// 인덱스 표현식은 배열 타입을 만들 때만 평가합니다.
+	mcf::IR::Expression::Pointer indexObject = (indexExpression == nullptr) ? nullptr : EvalExpression(indexExpression, scope);
+	return MakeIndexObject(leftObject.get(), indexObject.get());
+}
 
+mcf::IR::Expression::Pointer mcf::Evaluator::Object::MakeIndexObject(_Notnull_ const mcf::IR::Expression::Interface* leftObject, const mcf::IR::Expression::Interface* indexObject) const noexcept
+{
 	constexpr const size_t LEFT_EXPRESSION_TYPE_COUNT_BEGIN = __COUNTER__;
 	switch (leftObject->GetExpressionType())
 	{
 	case mcf::IR::Expression::Type::TYPE_IDENTIFIER: __COUNTER__;
 	{
-		mcf::Object::TypeInfo info = static_cast<const mcf::IR::Expression::TypeIdentifier*>(leftObject.get())->GetInfo();
-		if (indexExpression == nullptr)
+		mcf::Object::TypeInfo info = static_cast<const mcf::IR::Expression::TypeIdentifier*>(leftObject)->GetInfo();
+		if (indexObject == nullptr)
 		{
-			info.ArraySizeList.emplace_back(0);
+			info = info.MakeArrayType(0);
 			return mcf::IR::Expression::TypeIdentifier::Make(info);
 		}
-		mcf::IR::Expression::Pointer indexObject = EvalExpression(indexExpression, scope);
 		MCF_DEBUG_ASSERT(indexObject->GetType() == mcf::IR::Type::EXPRESSION, u8"구현 필요");
 
-		mcf::Object::TypeInfo arrayTypeInfo = MakeArrayTypeInfo(info, indexObject.get());
+		mcf::Object::TypeInfo arrayTypeInfo = MakeArrayTypeInfo(info, indexObject);
 		if (arrayTypeInfo.IsValid() == false)
 		{
 			MCF_DEBUG_TODO(u8"구현 필요");
@@ -3101,14 +3471,17 @@ mcf::IR::Expression::Pointer mcf::Evaluator::Object::EvalInfixExpression(_Notnul
 		MCF_DEBUG_TODO(u8"구현 필요");
 		return mcf::IR::Expression::Invalid::Make();
 	}
+	return MakeInfixObject(std::move(leftObject), expression->GetInfixOperator(), std::move(rightObject));
+}
 
+mcf::IR::Expression::Pointer mcf::Evaluator::Object::MakeInfixObject(mcf::IR::Expression::Pointer&& leftObject, const mcf::Token::Data& token, mcf::IR::Expression::Pointer&& rightObject) const noexcept
+{
 	if (ValidateExpressionTypes(leftObject.get(), rightObject.get()) == false)
 	{
 		MCF_DEBUG_TODO(u8"구현 필요");
 		return mcf::IR::Expression::Invalid::Make();
 	}
 
-	const mcf::Token::Data& token = expression->GetInfixOperator();
 	if (mcf::IR::Expression::Conditional::IsValidTokenType(token.Type))
 	{
 		return mcf::IR::Expression::Conditional::Make(std::move(leftObject), token, std::move(rightObject));
@@ -3120,7 +3493,7 @@ mcf::IR::Expression::Pointer mcf::Evaluator::Object::EvalInfixExpression(_Notnul
 	}
 
 	MCF_DEBUG_TODO(u8"예상치 못한 값이 들어왔습니다. 에러가 아닐 수도 있습니다. 확인 해 주세요. TokenType=%s(%zu) TokenLiteral=`%s`",
-		mcf::Token::CONVERT_TYPE_TO_STRING(token.Type), mcf::ENUM_INDEX(token.Type), token.Literal.c_str());
+		mcf::Token::CONVERT_TYPE_TO_STRING(token.Type), mcf::ENUM_INDEX(token.Type), std::string(token.Literal).c_str());
 	return mcf::IR::Expression::Invalid::Make();
 }
 
@@ -3150,7 +3523,7 @@ mcf::Object::FunctionInfo mcf::Evaluator::Object::BuildFunctionInfo(const std::s
 	}
 
 	functionInfo.ReturnType = EvalTypeSignatureIntermediate(returnType, scope);
-	if (functionInfo.ReturnType.IsValid() == false || scope->FindTypeInfo(functionInfo.ReturnType.Name).IsValid() == false)
+	if (functionInfo.ReturnType.IsValid() == false || scope->FindTypeInfo(functionInfo.ReturnType.GetName()).IsValid() == false)
 	{
 		MCF_DEBUG_TODO(u8"구현 필요");
 		return mcf::Object::FunctionInfo();
@@ -3165,31 +3538,554 @@ mcf::Object::FunctionInfo mcf::Evaluator::Object::BuildFunctionInfo(const std::s
 	return functionInfo;
 }
 
-mcf::Object::TypeInfo mcf::Evaluator::Object::MakeArrayTypeInfo(_In_ mcf::Object::TypeInfo info, _Notnull_ const mcf::IR::Expression::Interface* index) const noexcept
+mcf::IR::Program::Pointer mcf::Evaluator::Object::EvalProgram(_Notnull_ const mcf::AST::Flat::Program* program, _Notnull_ mcf::Object::Scope* scope) noexcept
 {
-	MCF_DEBUG_ASSERT(info.IsValid(), u8"구현 필요");
-
-	constexpr const size_t INDEX_EXPRESSION_TYPE_COUNT_BEGIN = __COUNTER__;
-	switch (index->GetExpressionType())
-	{
-	case mcf::IR::Expression::Type::GLOBAL_VARIABLE_IDENTIFIER: __COUNTER__; 
-		MCF_DEBUG_TODO(u8"구현 필요");
-		break;
+	return EvalProgramParallel(program, scope, 1);
+}
 
-	case mcf::IR::Expression::Type::LOCAL_VARIABLE_IDENTIFIER: __COUNTER__;
-		MCF_DEBUG_TODO(u8"구현 필요");
-		break;
+mcf::IR::Program::Pointer mcf::Evaluator::Object::EvalProgramParallel(_Notnull_ const mcf::AST::Flat::Program* program, _Notnull_ mcf::Object::Scope* scope, const size_t threadCount) noexcept
+{
+	_programSymbols = program->GetSymbolTable();
+	_flatProgram = program;
+	_bindingStack = &scope->GetUnsafeScopeTreePointer()->Stack;
 
-	case mcf::IR::Expression::Type::INTEGER: __COUNTER__; 
+	mcf::IR::PointerVector objects;
+	const size_t statementCount = program->GetStatementCount();
+	for (size_t i = 0; i < statementCount; i++)
 	{
-		const mcf::IR::Expression::Integer* integerObject = static_cast<const mcf::IR::Expression::Integer*>(index);
-		if (integerObject->IsNaturalInteger() == false)
+		const mcf::AST::Flat::Index statement = program->GetStatementAt(i);
+		const mcf::AST::Flat::Kind kind = program->GetKind(statement);
+		if (kind == mcf::AST::Flat::Kind::FUNC || kind == mcf::AST::Flat::Kind::MAIN)
 		{
-			MCF_DEBUG_TODO(u8"구현 필요");
-			return mcf::Object::TypeInfo();
-		}
-		info.ArraySizeList.emplace_back(integerObject->GetUInt64());
-		break;
+			const bool isMain = kind == mcf::AST::Flat::Kind::MAIN;
+			const mcf::Object::FunctionInfo* functionInfo = isMain ? DefineFlatMainStatement(statement, scope) : DefineFlatFuncStatement(statement, scope);
+			if (functionInfo == nullptr)
+			{
+				objects.emplace_back(mcf::IR::Invalid::Make());
+				continue;
+			}
+
+			const mcf::AST::Flat::Node& node = program->GetNode(statement);
+			const mcf::AST::Flat::Index block = isMain ? program->GetListItem(node.Left, 2) : node.Right;
+			_functionBodies.emplace_back(FunctionBody{ nullptr, block, functionInfo, objects.size() });
+			objects.emplace_back(nullptr);
+			continue;
+		}
+		objects.emplace_back(EvalFlatStatement(statement, scope, false));
+	}
+
+	EvalFunctionBodies(objects, nullptr, scope, threadCount);
+	return mcf::IR::Program::Make(std::move(objects));
+}
+
+mcf::IR::Pointer mcf::Evaluator::Object::EvalFlatStatement(const mcf::AST::Flat::Index statement, _Notnull_ mcf::Object::Scope* scope, const bool isBreakAllowed) noexcept
+{
+	const mcf::AST::Flat::Node& node = _flatProgram->GetNode(statement);
+	switch (_flatProgram->GetKind(statement))
+	{
+	case mcf::AST::Flat::Kind::INCLUDE_LIBRARY:
+		return mcf::IR::IncludeLib::Make(std::string(_flatProgram->GetToken(statement).Literal));
+
+	case mcf::AST::Flat::Kind::TYPEDEF:
+		return MakeTypedefObject(EvalFlatVariableSignature(node.Left, scope), scope);
+
+	case mcf::AST::Flat::Kind::EXTERN:
+	{
+		mcf::Object::FunctionInfo functionInfo = EvalFlatFunctionSignature(node.Left, scope);
+		return MakeExternObject(functionInfo, scope);
+	}
+
+	case mcf::AST::Flat::Kind::LET:
+	{
+		mcf::Object::Variable variable = EvalFlatVariableSignature(node.Left, scope);
+		if (variable.IsValid() == false)
+		{
+			MCF_DEBUG_TODO(u8"구현 필요");
+			return mcf::IR::Invalid::Make();
+		}
+
+		mcf::Object::VariableInfo info = scope->DefineVariable(variable.Name, variable);
+		if (info.IsValid() == false)
+		{
+			MCF_DEBUG_TODO(u8"구현 필요");
+			return mcf::IR::Invalid::Make();
+		}
+
+		if (node.Right == mcf::AST::Flat::INVALID_INDEX)
+		{
+			return mcf::IR::Let::Make(info, nullptr);
+		}
+		return MakeLetObject(info, EvalFlatExpression(node.Right, scope), scope);
+	}
+
+	case mcf::AST::Flat::Kind::RETURN:
+	{
+		if (scope->IsGlobalScope() || scope->IsFunctionScope() == false)
+		{
+			MCF_DEBUG_TODO(u8"구현 필요");
+			return mcf::IR::Invalid::Make();
+		}
+
+		mcf::IR::Expression::Pointer returnObject = EvalFlatExpression(node.Left, scope);
+		if (returnObject.get() == nullptr || returnObject->GetExpressionType() == mcf::IR::Expression::Type::INVALID)
+		{
+			MCF_DEBUG_TODO(u8"구현 필요");
+			return mcf::IR::Invalid::Make();
+		}
+		return mcf::IR::Return::Make(std::move(returnObject));
+	}
+
+	case mcf::AST::Flat::Kind::FUNC: [[fallthrough]];
+	case mcf::AST::Flat::Kind::MAIN:
+	{
+		const bool isMain = _flatProgram->GetKind(statement) == mcf::AST::Flat::Kind::MAIN;
+		const mcf::Object::FunctionInfo* functionInfo = isMain ? DefineFlatMainStatement(statement, scope) : DefineFlatFuncStatement(statement, scope);
+		if (functionInfo == nullptr)
+		{
+			return mcf::IR::Invalid::Make();
+		}
+
+		mcf::IR::PointerVector objects;
+		if (EvalFlatFunctionBlockStatement(objects, *functionInfo, isMain ? _flatProgram->GetListItem(node.Left, 2) : node.Right) == false)
+		{
+			return mcf::IR::Invalid::Make();
+		}
+		return MakeFuncObject(GenerateFunctionASM(*functionInfo, objects));
+	}
+
+	case mcf::AST::Flat::Kind::EXPRESSION:
+	{
+		mcf::IR::Expression::Pointer expressionObject = EvalFlatExpression(node.Left, scope);
+		if (expressionObject.get() == nullptr || expressionObject->GetExpressionType() == mcf::IR::Expression::Type::INVALID)
+		{
+			return mcf::IR::Invalid::Make();
+		}
+		return expressionObject;
+	}
+
+	case mcf::AST::Flat::Kind::ASSIGN_EXPRESSION:
+	{
+		mcf::IR::Expression::Pointer leftObject = EvalFlatExpression(node.Left, scope);
+		if (leftObject.get() == nullptr || leftObject->GetExpressionType() == mcf::IR::Expression::Type::INVALID)
+		{
+			MCF_DEBUG_TODO(u8"구현 필요");
+			return mcf::IR::Invalid::Make();
+		}
+
+		mcf::IR::Expression::Pointer rightObject = EvalFlatExpression(node.Right, scope);
+		if (rightObject.get() == nullptr || rightObject->GetExpressionType() == mcf::IR::Expression::Type::INVALID)
+		{
+			MCF_DEBUG_TODO(u8"구현 필요");
+			return mcf::IR::Invalid::Make();
+		}
+		return mcf::IR::Expression::Assign::Make(std::move(leftObject), std::move(rightObject));
+	}
+
+	case mcf::AST::Flat::Kind::UNUSED:
+	{
+		const size_t identifierCount = _flatProgram->GetListCount(node.Left);
+		for (size_t i = 0; i < identifierCount; ++i)
+		{
+			const mcf::AST::Flat::Index identifier = _flatProgram->GetListItem(node.Left, i);
+			if (scope->UseVariableInfo(ResolveSymbol(_flatProgram->GetToken(identifier), scope)) == false)
+			{
+				// 실패한 원인은 UseVariableInfo 가 출력합니다.
+				return mcf::IR::Invalid::Make();
+			}
+		}
+		return mcf::IR::Unused::Make();
+	}
+
+	case mcf::AST::Flat::Kind::WHILE:
+	{
+		mcf::IR::Expression::Pointer conditionObject = EvalFlatExpression(node.Left, scope);
+		if (conditionObject.get() == nullptr)
+		{
+			MCF_DEBUG_TODO(u8"구현 필요");
+			return mcf::IR::Invalid::Make();
+		}
+
+		if (ValidateConditionObject(conditionObject.get()) == false)
+		{
+			return mcf::IR::Invalid::Make();
+		}
+
+		mcf::Object::Scope* blockScope = nullptr;
+		if (scope->MakeLocalScope(&blockScope, false) == false)
+		{
+			MCF_DEBUG_TODO(u8"구현 필요");
+			return mcf::IR::Invalid::Make();
+		}
+
+		_bindingStack->Enter(blockScope);
+		mcf::IR::PointerVector blockObject = EvalFlatBlockStatement(node.Right, blockScope, true);
+		_bindingStack->Leave(blockScope);
+		return mcf::IR::While::Make(std::move(conditionObject), std::move(blockObject), blockScope);
+	}
+
+	case mcf::AST::Flat::Kind::BREAK:
+		if (isBreakAllowed == false)
+		{
+			MCF_DEBUG_TODO(u8"break문이 허용 되지 않는곳에 사용되었습니다.");
+			return mcf::IR::Invalid::Make();
+		}
+		return mcf::IR::Break::Make();
+
+	case mcf::AST::Flat::Kind::BLOCK:
+		MCF_DEBUG_TODO(u8"구현 필요");
+		break;
+
+	default:
+		MCF_DEBUG_TODO(u8"예상치 못한 값이 들어왔습니다. 에러가 아닐 수도 있습니다. 확인 해 주세요. Kind=%s(%zu)",
+			mcf::AST::Flat::CONVERT_KIND_TO_STRING(_flatProgram->GetKind(statement)), mcf::ENUM_INDEX(_flatProgram->GetKind(statement)));
+		break;
+	}
+	return mcf::IR::Invalid::Make();
+}
+
+mcf::IR::PointerVector mcf::Evaluator::Object::EvalFlatBlockStatement(const mcf::AST::Flat::Index block, _Notnull_ mcf::Object::Scope* scope, const bool isBreakAllowed) noexcept
+{
+	MCF_DEBUG_ASSERT(_flatProgram->GetKind(block) == mcf::AST::Flat::Kind::BLOCK, u8"block은 BLOCK 노드여야 합니다.");
+	const mcf::AST::Flat::Index statements = _flatProgram->GetNode(block).Left;
+
+	mcf::IR::PointerVector objects;
+	const size_t statementCount = _flatProgram->GetListCount(statements);
+	for (size_t i = 0; i < statementCount; i++)
+	{
+		mcf::IR::Pointer object = EvalFlatStatement(_flatProgram->GetListItem(statements, i), scope, isBreakAllowed);
+		if (object.get() == nullptr || object->GetType() == mcf::IR::Type::INVALID)
+		{
+			MCF_DEBUG_TODO(u8"구현 필요");
+			return mcf::IR::PointerVector();
+		}
+		objects.emplace_back(std::move(object));
+	}
+	return objects;
+}
+
+const bool mcf::Evaluator::Object::EvalFlatFunctionBlockStatement(_Out_ mcf::IR::PointerVector& outObjects, const mcf::Object::FunctionInfo& info, const mcf::AST::Flat::Index block) noexcept
+{
+	MCF_DEBUG_ASSERT(_flatProgram->GetKind(block) == mcf::AST::Flat::Kind::BLOCK, u8"block은 BLOCK 노드여야 합니다.");
+	const mcf::AST::Flat::Index statements = _flatProgram->GetNode(block).Left;
+
+	_bindingStack->Enter(info.LocalScope);
+	bool isSucceeded = true;
+	const size_t statementCount = _flatProgram->GetListCount(statements);
+	for (size_t i = 0; i < statementCount; i++)
+	{
+		mcf::IR::Pointer object = EvalFlatStatement(_flatProgram->GetListItem(statements, i), info.LocalScope, false);
+		if (object.get() == nullptr)
+		{
+			MCF_DEBUG_TODO(u8"구현 필요");
+			isSucceeded = false;
+			break;
+		}
+
+		// 실패한 명령문은 평가하면서 원인을 이미 출력하였으므로 본문의 평가만 실패로 처리합니다.
+		if (object->GetType() == mcf::IR::Type::INVALID)
+		{
+			isSucceeded = false;
+			break;
+		}
+		outObjects.emplace_back(std::move(object));
+	}
+	_bindingStack->Leave(info.LocalScope);
+	return isSucceeded;
+}
+
+const mcf::Object::FunctionInfo* mcf::Evaluator::Object::DefineFlatFuncStatement(const mcf::AST::Flat::Index statement, _Notnull_ mcf::Object::Scope* scope) noexcept
+{
+	const mcf::AST::Flat::Node& node = _flatProgram->GetNode(statement);
+	const mcf::AST::Flat::Index functionName = _flatProgram->GetNode(node.Left).Left;
+	if (_flatProgram->GetToken(functionName).Literal == mcf::AST::Statement::Main::NAME)
+	{
+		MCF_DEBUG_TODO(u8"메인 함수는 func문이 아닌 main문으로 작성 해야 합니다.");
+		return nullptr;
+	}
+
+	mcf::Object::FunctionInfo functionInfo = EvalFlatFunctionSignature(node.Left, scope);
+	if (DefineFunctionInfo(functionInfo, scope) == false)
+	{
+		return nullptr;
+	}
+	return &scope->FindFunction(functionInfo.Name);
+}
+
+const mcf::Object::FunctionInfo* mcf::Evaluator::Object::DefineFlatMainStatement(const mcf::AST::Flat::Index statement, _Notnull_ mcf::Object::Scope* scope) noexcept
+{
+	const mcf::AST::Flat::Node& node = _flatProgram->GetNode(statement);
+	const mcf::AST::Flat::Index params = _flatProgram->GetListItem(node.Left, 0);
+	const mcf::AST::Flat::Index returnType = _flatProgram->GetListItem(node.Left, 1);
+	mcf::Object::FunctionInfo functionInfo = BuildFlatFunctionInfo(mcf::AST::Statement::Main::NAME, params, returnType, scope);
+	if (DefineFunctionInfo(functionInfo, scope) == false)
+	{
+		return nullptr;
+	}
+	return &scope->FindFunction(functionInfo.Name);
+}
+
+mcf::Object::FunctionInfo mcf::Evaluator::Object::EvalFlatFunctionSignature(const mcf::AST::Flat::Index signature, _Notnull_ mcf::Object::Scope* scope) const noexcept
+{
+	MCF_DEBUG_ASSERT(_flatProgram->GetKind(signature) == mcf::AST::Flat::Kind::FUNCTION_SIGNATURE, u8"signature는 FUNCTION_SIGNATURE 노드여야 합니다.");
+	const mcf::AST::Flat::Node& node = _flatProgram->GetNode(signature);
+	const std::string name(_flatProgram->GetToken(node.Left).Literal);
+	MCF_DEBUG_ASSERT(name.empty() == false, u8"FunctionSignature에는 반드시 함수 이름이 있어야 합니다.");
+	return BuildFlatFunctionInfo(name, _flatProgram->GetListItem(node.Right, 0), _flatProgram->GetListItem(node.Right, 1), scope);
+}
+
+mcf::Object::FunctionInfo mcf::Evaluator::Object::BuildFlatFunctionInfo(const std::string& name, const mcf::AST::Flat::Index functionParams, const mcf::AST::Flat::Index returnType, _Notnull_ mcf::Object::Scope* scope) const noexcept
+{
+	mcf::Object::FunctionInfo functionInfo;
+	functionInfo.Name = name;
+	if (functionInfo.Name.empty())
+	{
+		MCF_DEBUG_TODO(u8"구현 필요");
+		return mcf::Object::FunctionInfo();
+	}
+
+	const mcf::AST::Flat::Node& paramsNode = _flatProgram->GetNode(functionParams);
+	const size_t paramCount = _flatProgram->GetListCount(paramsNode.Left);
+	for (size_t i = 0; i < paramCount; ++i)
+	{
+		functionInfo.Params.Variables.emplace_back(EvalFlatVariableSignature(_flatProgram->GetListItem(paramsNode.Left, i), scope));
+		if (functionInfo.Params.Variables.back().IsValid() == false)
+		{
+			MCF_DEBUG_TODO(u8"구현 필요");
+			return mcf::Object::FunctionInfo();
+		}
+
+		if (functionInfo.Params.Variables.back().DataType.HasUnknownArrayIndex())
+		{
+			MCF_DEBUG_TODO(u8"함수의 인자 값으로 unknown 배열이 들어오면 안됩니다.");
+			return mcf::Object::FunctionInfo();
+		}
+	}
+
+	if (paramsNode.Right != mcf::AST::Flat::INVALID_INDEX)
+	{
+		mcf::Object::Variable variadic;
+		variadic.Name = _flatProgram->GetToken(_flatProgram->GetNode(paramsNode.Right).Left).Literal;
+		variadic.DataType = mcf::Object::TypeInfo::GetVariadicTypeInfo();
+		functionInfo.Params.Variables.emplace_back(variadic);
+	}
+
+	if (returnType == mcf::AST::Flat::INVALID_INDEX)
+	{
+		return functionInfo;
+	}
+
+	functionInfo.ReturnType = EvalFlatTypeSignature(returnType, scope);
+	if (functionInfo.ReturnType.IsValid() == false || scope->FindTypeInfo(functionInfo.ReturnType.GetName()).IsValid() == false)
+	{
+		MCF_DEBUG_TODO(u8"구현 필요");
+		return mcf::Object::FunctionInfo();
+	}
+
+	if (functionInfo.ReturnType.HasUnknownArrayIndex())
+	{
+		MCF_DEBUG_TODO(u8"함수의 반환 값으로 unknown 배열이 들어오면 안됩니다.");
+		return mcf::Object::FunctionInfo();
+	}
+	return functionInfo;
+}
+
+mcf::Object::Variable mcf::Evaluator::Object::EvalFlatVariableSignature(const mcf::AST::Flat::Index signature, _Notnull_ mcf::Object::Scope* scope) const noexcept
+{
+	MCF_DEBUG_ASSERT(_flatProgram->GetKind(signature) == mcf::AST::Flat::Kind::VARIABLE_SIGNATURE, u8"signature는 VARIABLE_SIGNATURE 노드여야 합니다.");
+	const mcf::AST::Flat::Node& node = _flatProgram->GetNode(signature);
+
+	mcf::Object::Variable variable;
+	variable.Name = _flatProgram->GetToken(node.Left).Literal;
+	if (variable.Name.empty())
+	{
+		MCF_DEBUG_TODO(u8"구현 필요");
+		return mcf::Object::Variable();
+	}
+
+	variable.DataType = EvalFlatTypeSignature(node.Right, scope);
+	if (variable.DataType.IsValid() == false)
+	{
+		MCF_DEBUG_TODO(u8"구현 필요");
+		return mcf::Object::Variable();
+	}
+
+	variable.IsUsed = false;
+	return variable;
+}
+
+mcf::Object::TypeInfo mcf::Evaluator::Object::EvalFlatTypeSignature(const mcf::AST::Flat::Index signature, _Notnull_ mcf::Object::Scope* scope) const noexcept
+{
+	MCF_DEBUG_ASSERT(_flatProgram->GetKind(signature) == mcf::AST::Flat::Kind::TYPE_SIGNATURE, u8"signature는 TYPE_SIGNATURE 노드여야 합니다.");
+	const mcf::AST::Flat::Node& node = _flatProgram->GetNode(signature);
+	mcf::IR::Expression::Pointer object = EvalFlatExpression(node.Left, scope);
+	return MakeTypeInfo(object.get(), node.Right != 0);
+}
+
+mcf::IR::Expression::Pointer mcf::Evaluator::Object::EvalFlatExpression(const mcf::AST::Flat::Index expression, _Notnull_ mcf::Object::Scope* scope) const noexcept
+{
+	const mcf::AST::Flat::Node& node = _flatProgram->GetNode(expression);
+	switch (_flatProgram->GetKind(expression))
+	{
+	case mcf::AST::Flat::Kind::IDENTIFIER:
+		return EvalIdentifierSymbol(ResolveSymbol(_flatProgram->GetToken(expression), scope), scope);
+
+	case mcf::AST::Flat::Kind::INTEGER:
+		return EvalIntegerLiteral(_flatProgram->GetToken(expression).Literal);
+
+	case mcf::AST::Flat::Kind::STRING:
+		return EvalStringLiteral(_flatProgram->GetToken(expression).Literal, scope);
+
+	case mcf::AST::Flat::Kind::INFIX:
+	{
+		mcf::IR::Expression::Pointer leftObject = EvalFlatExpression(node.Left, scope);
+		if (leftObject.get() == nullptr || leftObject->GetExpressionType() == mcf::IR::Expression::Type::INVALID)
+		{
+			MCF_DEBUG_TODO(u8"구현 필요");
+			return mcf::IR::Expression::Invalid::Make();
+		}
+
+		mcf::IR::Expression::Pointer rightObject = EvalFlatExpression(node.Right, scope);
+		if (rightObject.get() == nullptr || rightObject->GetExpressionType() == mcf::IR::Expression::Type::INVALID)
+		{
+			MCF_DEBUG_TODO(u8"구현 필요");
+			return mcf::IR::Expression::Invalid::Make();
+		}
+		return MakeInfixObject(std::move(leftObject), _flatProgram->GetToken(expression), std::move(rightObject));
+	}
+
+	case mcf::AST::Flat::Kind::CALL:
+		return EvalFlatCallExpression(expression, scope);
+
+	case mcf::AST::Flat::Kind::AS:
+	{
+		const mcf::Object::TypeInfo targetType = EvalFlatTypeSignature(node.Right, scope);
+		if (targetType.IsValid() == false)
+		{
+			MCF_DEBUG_TODO(u8"as 표현식 평가에 실패하였습니다.");
+			return mcf::IR::Expression::Invalid::Make();
+		}
+
+		mcf::IR::Expression::Pointer object = MakeStaticCastObject(EvalFlatExpression(node.Left, scope), targetType);
+		if (object.get() == nullptr || object->GetExpressionType() != mcf::IR::Expression::Type::STATIC_CAST)
+		{
+			MCF_DEBUG_TODO(u8"정적 캐스팅에 실패 하였습니다.");
+		}
+		return object;
+	}
+
+	case mcf::AST::Flat::Kind::INDEX:
+	{
+		mcf::IR::Expression::Pointer leftObject = EvalFlatExpression(node.Left, scope);
+		if (leftObject->GetExpressionType() != mcf::IR::Expression::Type::TYPE_IDENTIFIER)
+		{
+			return MakeIndexObject(leftObject.get(), nullptr);
+		}
+		mcf::IR::Expression::Pointer indexObject = (node.Right == mcf::AST::Flat::INVALID_INDEX) ? nullptr : EvalFlatExpression(node.Right, scope);
+		return MakeIndexObject(leftObject.get(), indexObject.get());
+	}
+
+	case mcf::AST::Flat::Kind::INITIALIZER:
+	{
+		mcf::IR::Expression::PointerVector keyVector;
+		const size_t expressionCount = _flatProgram->GetListCount(node.Left);
+		for (size_t i = 0; i < expressionCount; i++)
+		{
+			keyVector.emplace_back(EvalFlatExpression(_flatProgram->GetListItem(node.Left, i), scope));
+			if (keyVector.back().get() == nullptr || keyVector.back()->GetExpressionType() == mcf::IR::Expression::Type::INVALID)
+			{
+				MCF_DEBUG_TODO(u8"구현 필요");
+				return mcf::IR::Expression::Invalid::Make();
+			}
+		}
+		return mcf::IR::Expression::Initializer::Make(std::move(keyVector));
+	}
+
+	case mcf::AST::Flat::Kind::PREFIX: [[fallthrough]];
+	case mcf::AST::Flat::Kind::GROUP: [[fallthrough]];
+	case mcf::AST::Flat::Kind::MAP_INITIALIZER:
+		MCF_DEBUG_TODO(u8"구현 필요");
+		break;
+
+	default:
+		MCF_DEBUG_TODO(u8"예상치 못한 값이 들어왔습니다. 에러가 아닐 수도 있습니다. 확인 해 주세요. Kind=%s(%zu)",
+			mcf::AST::Flat::CONVERT_KIND_TO_STRING(_flatProgram->GetKind(expression)), mcf::ENUM_INDEX(_flatProgram->GetKind(expression)));
+		break;
+	}
+	return mcf::IR::Expression::Invalid::Make();
+}
+
+mcf::IR::Expression::Pointer mcf::Evaluator::Object::EvalFlatCallExpression(const mcf::AST::Flat::Index expression, _Notnull_ mcf::Object::Scope* scope) const noexcept
+{
+	const mcf::AST::Flat::Node& node = _flatProgram->GetNode(expression);
+	mcf::IR::Expression::Pointer leftObject = EvalFlatExpression(node.Left, scope);
+	if (leftObject.get() == nullptr || leftObject->GetExpressionType() == mcf::IR::Expression::Type::INVALID)
+	{
+		// 호출할 식을 평가하면서 실패한 원인을 이미 출력하였습니다.
+		return mcf::IR::Expression::Invalid::Make();
+	}
+
+	const mcf::Object::FunctionInfo& functionInfo = FindCalleeFunctionInfo(leftObject.get());
+	if (functionInfo.IsValid() == false)
+	{
+		MCF_DEBUG_TODO(u8"함수 정보를 가져올수 없습니다.");
+		return mcf::IR::Expression::Invalid::Make();
+	}
+
+	const size_t functionDefineParamCount = functionInfo.Params.HasVariadic() ? (functionInfo.Params.Variables.size() - 1) : functionInfo.Params.Variables.size();
+	const size_t paramCount = _flatProgram->GetListCount(node.Right);
+	if (paramCount < functionDefineParamCount)
+	{
+		MCF_DEBUG_TODO(u8"함수 정보와 실제 함수 호출이 일치 하지 않습니다.");
+		return mcf::IR::Expression::Invalid::Make();
+	}
+
+	mcf::IR::Expression::PointerVector paramObjects;
+	if (functionInfo.Params.IsVoid() == false)
+	{
+		for (size_t i = 0; i < paramCount; i++)
+		{
+			paramObjects.emplace_back(EvalFlatExpression(_flatProgram->GetListItem(node.Right, i), scope));
+			if (paramObjects.back().get() == nullptr || paramObjects.back()->GetExpressionType() == mcf::IR::Expression::Type::INVALID)
+			{
+				MCF_DEBUG_TODO(u8"함수 인자 정보가 잘못 되었습니다.");
+				return mcf::IR::Expression::Invalid::Make();
+			}
+
+			if (i < functionDefineParamCount && ValidateVariableTypeAndValue(functionInfo.Params.Variables[i], paramObjects.back().get()) == false)
+			{
+				MCF_DEBUG_TODO(u8"함수에 정의된 인자 타입과 호출 인자의 타입이 일치하지 않습니다.");
+				return mcf::IR::Expression::Invalid::Make();
+			}
+		}
+	}
+	return mcf::IR::Expression::Call::Make(functionInfo, std::move(paramObjects));
+}
+
+mcf::Object::TypeInfo mcf::Evaluator::Object::MakeArrayTypeInfo(_In_ mcf::Object::TypeInfo info, _Notnull_ const mcf::IR::Expression::Interface* index) const noexcept
+{
+	MCF_DEBUG_ASSERT(info.IsValid(), u8"구현 필요");
+
+	constexpr const size_t INDEX_EXPRESSION_TYPE_COUNT_BEGIN = __COUNTER__;
+	switch (index->GetExpressionType())
+	{
+	case mcf::IR::Expression::Type::GLOBAL_VARIABLE_IDENTIFIER: __COUNTER__; 
+		MCF_DEBUG_TODO(u8"구현 필요");
+		break;
+
+	case mcf::IR::Expression::Type::LOCAL_VARIABLE_IDENTIFIER: __COUNTER__;
+		MCF_DEBUG_TODO(u8"구현 필요");
+		break;
+
+	case mcf::IR::Expression::Type::INTEGER: __COUNTER__; 
+	{
+		const mcf::IR::Expression::Integer* integerObject = static_cast<const mcf::IR::Expression::Integer*>(index);
+		if (integerObject->IsNaturalInteger() == false)
+		{
+			MCF_DEBUG_TODO(u8"구현 필요");
+			return mcf::Object::TypeInfo();
+		}
+		info = info.MakeArrayType(integerObject->GetUInt64());
+		break;
 	}
 
 	case mcf::IR::Expression::Type::STRING: __COUNTER__;
@@ -3245,14 +4141,14 @@ const std::vector<size_t> mcf::Evaluator::Object::CalculateMaximumArrayIndex(_No
 	{
 		const mcf::IR::Expression::GlobalVariableIdentifier* globalVariableIdentifier = static_cast<const mcf::IR::Expression::GlobalVariableIdentifier*>(expression);
 		MCF_DEBUG_ASSERT(globalVariableIdentifier->GetVariable().DataType.HasUnknownArrayIndex(), u8"unknown 배열이 있으면 안됩니다.");
-		return globalVariableIdentifier->GetVariable().DataType.ArraySizeList;
+		return globalVariableIdentifier->GetVariable().DataType.GetArraySizeList();
 	}
 
 	case mcf::IR::Expression::Type::LOCAL_VARIABLE_IDENTIFIER: __COUNTER__;
 	{
 		const mcf::IR::Expression::LocalVariableIdentifier* localVariableIdentifier = static_cast<const mcf::IR::Expression::LocalVariableIdentifier*>(expression);
 		MCF_DEBUG_ASSERT(localVariableIdentifier->GetVariable().DataType.HasUnknownArrayIndex(), u8"unknown 배열이 있으면 안됩니다.");
-		return localVariableIdentifier->GetVariable().DataType.ArraySizeList;
+		return localVariableIdentifier->GetVariable().DataType.GetArraySizeList();
 	}
 
 	case mcf::IR::Expression::Type::INTEGER: __COUNTER__;
@@ -3328,14 +4224,14 @@ const std::vector<size_t> mcf::Evaluator::Object::CalculateMaximumArrayIndex(_No
 	{
 		const mcf::IR::Expression::Call* callExpression = static_cast<const mcf::IR::Expression::Call*>(expression);
 		MCF_DEBUG_ASSERT(callExpression->GetInfo().ReturnType.HasUnknownArrayIndex(), u8"unknown 배열이 있으면 안됩니다.");
-		return callExpression->GetInfo().ReturnType.ArraySizeList;
+		return callExpression->GetInfo().ReturnType.GetArraySizeList();
 	}
 
 	case mcf::IR::Expression::Type::STATIC_CAST: __COUNTER__;
 	{
 		const mcf::IR::Expression::StaticCast* staticCast = static_cast<const mcf::IR::Expression::StaticCast*>(expression);
 		MCF_DEBUG_ASSERT(staticCast->GetCastedDatType().HasUnknownArrayIndex(), u8"unknown 배열이 있으면 안됩니다.");
-		return staticCast->GetCastedDatType().ArraySizeList;
+		return staticCast->GetCastedDatType().GetArraySizeList();
 	}
 
 	case mcf::IR::Expression::Type::CONDITIONAL: __COUNTER__;
@@ -3358,3 +4254,19 @@ const std::vector<size_t> mcf::Evaluator::Object::CalculateMaximumArrayIndex(_No
 	static_assert(static_cast<size_t>(mcf::IR::Expression::Type::COUNT) == EXPRESSION_TYPE_COUNT, "calculate maximum array index.");
 	return std::vector<size_t>();
 }
+
+const mcf::Symbol::ID mcf::Evaluator::Object::ResolveSymbol(_Notnull_ const mcf::AST::Expression::Identifier* identifier, _Notnull_ const mcf::Object::Scope* scope) const noexcept
+{
+	return ResolveSymbol(identifier->GetToken(), scope);
+}
+
+const mcf::Symbol::ID mcf::Evaluator::Object::ResolveSymbol(const mcf::Token::Data& token, _Notnull_ const mcf::Object::Scope* scope) const noexcept
+{
+	const mcf::Symbol::Table* scopeSymbols = scope->GetUnsafeScopeTreePointer()->Symbols.get();
+	if (_programSymbols == scopeSymbols && token.Symbol != mcf::Symbol::INVALID_ID)
+	{
+		return token.Symbol;
+	}
+	// 다른 테이블로 파싱된 프로그램이면 이름으로 찾습니다. 등록되지 않은 이름은 INVALID_ID 가 되어 모든 검색에 실패합니다.
+	return scopeSymbols->Find(token.Literal);
+}
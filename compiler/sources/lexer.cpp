@@ -1,5 +1,28 @@
 ﻿#include "pch.h"
 #include "lexer.h"
+#include "internal_lexer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <thread>
+
+#if defined(_WIN32)
+#if !defined(NOMINMAX)
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#include <io.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace mcf
 {
@@ -12,130 +35,795 @@ namespace mcf
 	}
 }
 
-const mcf::Token::Data mcf::Token::FindPredefinedKeyword(const std::string& tokenLiteral) noexcept
+namespace mcf
 {
-	// identifier 조건에 부합하는 키워드만 등록합니다.
-	constexpr const char* IDENTIFIER_KEYWORDS[] =
+	namespace Token
 	{
-		"asm",
-		"extern",
-		"typedef",
-		"let",
-		"func",
-		"main",
-		"void",
-		"unsigned",
-		"return",
-		"unused",
-		"as",
-		"while",
-		"break",
-	};
-	constexpr const size_t KEYWORDS_SIZE = MCF_ARRAY_SIZE(IDENTIFIER_KEYWORDS);
-	static_assert(ENUM_INDEX(Type::KEYWORD_IDENTIFIER_END) - ENUM_INDEX(Type::KEYWORD_IDENTIFIER_START) - 1 == KEYWORDS_SIZE,
-		"identifier keyword TokenType count is changed. this array need to be changed as well.");
+		namespace Internal
+		{
+			// identifier 조건에 부합하는 키워드만 등록합니다. 순서는 KEYWORD_IDENTIFIER_START..END 와 같아야 합니다.
+			constexpr const std::string_view IDENTIFIER_KEYWORDS[] =
+			{
+				"asm",
+				"extern",
+				"typedef",
+				"let",
+				"func",
+				"main",
+				"void",
+				"unsigned",
+				"return",
+				"unused",
+				"as",
+				"while",
+				"break",
+			};
+			constexpr const size_t KEYWORDS_SIZE = MCF_ARRAY_SIZE(IDENTIFIER_KEYWORDS);
+			static_assert(ENUM_INDEX(Type::KEYWORD_IDENTIFIER_END) - ENUM_INDEX(Type::KEYWORD_IDENTIFIER_START) - 1 == KEYWORDS_SIZE,
+				"identifier keyword TokenType count is changed. this array need to be changed as well.");
+
+			// 키워드 해시 테이블의 크기는 2의 거듭제곱이어야 합니다.
+			constexpr const size_t KEYWORD_HASH_TABLE_SIZE = 32;
+			constexpr const size_t KEYWORD_HASH_LENGTH_MULTIPLIER = 10;
+			constexpr const unsigned char KEYWORD_HASH_EMPTY_SLOT = 0xff;
+			static_assert((KEYWORD_HASH_TABLE_SIZE & (KEYWORD_HASH_TABLE_SIZE - 1)) == 0, "KEYWORD_HASH_TABLE_SIZE must be power of two.");
+			static_assert(KEYWORDS_SIZE < KEYWORD_HASH_EMPTY_SLOT, "keyword index must fit in unsigned char.");
+
+			// 길이와 처음, 마지막 문자만 사용하므로 비어있지 않은 문자열에 대해서만 호출하여야 합니다.
+			constexpr static const size_t HASH_KEYWORD(const std::string_view literal) noexcept
+			{
+				return (literal.size() * KEYWORD_HASH_LENGTH_MULTIPLIER
+					+ static_cast<unsigned char>(literal.front())
+					+ static_cast<unsigned char>(literal.back())) & (KEYWORD_HASH_TABLE_SIZE - 1);
+			}
+
+			struct KeywordHashTable final
+			{
+				unsigned char Slots[KEYWORD_HASH_TABLE_SIZE];
+				bool IsPerfect;
+			};
+
+			constexpr static const KeywordHashTable BUILD_KEYWORD_HASH_TABLE(void) noexcept
+			{
+				KeywordHashTable table = {};
+				table.IsPerfect = true;
+				for (size_t i = 0; i < KEYWORD_HASH_TABLE_SIZE; ++i)
+				{
+					table.Slots[i] = KEYWORD_HASH_EMPTY_SLOT;
+				}
+
+				for (size_t i = 0; i < KEYWORDS_SIZE; ++i)
+				{
+					const size_t hash = HASH_KEYWORD(IDENTIFIER_KEYWORDS[i]);
+					if (table.Slots[hash] != KEYWORD_HASH_EMPTY_SLOT)
+					{
+						table.IsPerfect = false;
+					}
+					table.Slots[hash] = static_cast<unsigned char>(i);
+				}
+				return table;
+			}
+
+			constexpr const KeywordHashTable KEYWORD_HASH_TABLE = BUILD_KEYWORD_HASH_TABLE();
+			static_assert(KEYWORD_HASH_TABLE.IsPerfect, "identifier keyword hash collision. change KEYWORD_HASH_LENGTH_MULTIPLIER or KEYWORD_HASH_TABLE_SIZE.");
+		}
+	}
+}
 
-	// 기본 제공 키워드 검색
-	for (size_t i = 0; i < KEYWORDS_SIZE; i++)
+const mcf::Token::Type mcf::Token::FindPredefinedKeyword(const std::string_view tokenLiteral) noexcept
+{
+	if (tokenLiteral.empty())
 	{
-		if (tokenLiteral.compare(IDENTIFIER_KEYWORDS[i]) == 0)
+		return Type::INVALID;
+	}
+
+	// 완전 해시이므로 한 번의 비교로 키워드 여부를 판단합니다.
+	const unsigned char keywordIndex = Internal::KEYWORD_HASH_TABLE.Slots[Internal::HASH_KEYWORD(tokenLiteral)];
+	if (keywordIndex == Internal::KEYWORD_HASH_EMPTY_SLOT || Internal::IDENTIFIER_KEYWORDS[keywordIndex] != tokenLiteral)
+	{
+		return Type::INVALID;
+	}
+	return mcf::ENUM_AT<Type>(ENUM_INDEX(Type::KEYWORD_IDENTIFIER_START) + keywordIndex + 1);
+}
+
+const mcf::Symbol::ID mcf::Symbol::Table::Intern(const std::string_view name) noexcept
+{
+	MCF_DEBUG_ASSERT(name.empty() == false, u8"이름이 비어 있으면 안됩니다.");
+
+	const mcf::Symbol::ID registeredID = Find(name);
+	if (registeredID != mcf::Symbol::INVALID_ID)
+	{
+		return registeredID;
+	}
+
+	// 잠금을 바꾸는 사이에 다른 스레드가 같은 이름을 등록하였을 수 있으므로 다시 찾습니다.
+	std::unique_lock<std::shared_mutex> lock(_mutex);
+	const std::unordered_map<std::string_view, mcf::Symbol::ID>::const_iterator idFound = _ids.find(name);
+	if (idFound != _ids.end())
+	{
+		return idFound->second;
+	}
+
+	MCF_DEBUG_ASSERT(_names.size() <= UINT32_MAX, u8"심볼의 개수는 32비트를 넘을 수 없습니다.");
+	const mcf::Symbol::ID id = static_cast<mcf::Symbol::ID>(_names.size());
+	_names.emplace_back(name);
+	_ids.emplace(_names.back(), id);
+	return id;
+}
+
+const mcf::Symbol::ID mcf::Symbol::Table::Find(const std::string_view name) const noexcept
+{
+	std::shared_lock<std::shared_mutex> lock(_mutex);
+	const std::unordered_map<std::string_view, mcf::Symbol::ID>::const_iterator idFound = _ids.find(name);
+	return (idFound == _ids.end()) ? mcf::Symbol::INVALID_ID : idFound->second;
+}
+
+const std::string_view mcf::Symbol::Table::GetName(const mcf::Symbol::ID id) const noexcept
+{
+	// 등록된 문자열은 옮겨지지 않으므로 잠금을 푼 뒤에도 반환한 문자열을 읽을 수 있습니다.
+	std::shared_lock<std::shared_mutex> lock(_mutex);
+	return _names[id];
+}
+
+const size_t mcf::Symbol::Table::GetCount(void) const noexcept
+{
+	std::shared_lock<std::shared_mutex> lock(_mutex);
+	return _names.size() - 1;
+}
+
+namespace mcf
+{
+	namespace Lexer
+	{
+		namespace Internal
 		{
-			return Data{ mcf::ENUM_AT<Type>(ENUM_INDEX(Type::KEYWORD_IDENTIFIER_START) + i + 1), tokenLiteral, 0, 0 };
+			constexpr const size_t BULK_READ_CHUNK_SIZE = 64 * 1024;
+
+			// offset 앞에 있는 줄바꿈의 개수로 줄 번호를 계산합니다. 줄 번호는 1 부터 시작합니다.
+			inline static const size_t CALCULATE_LINE(const std::vector<std::uint32_t>& newLineOffsets, const std::uint32_t offset) noexcept
+			{
+				return static_cast<size_t>(std::lower_bound(newLineOffsets.begin(), newLineOffsets.end(), offset) - newLineOffsets.begin()) + 1;
+			}
+
+			// 줄바꿈 다음 바이트의 인덱스가 1 이 되도록 계산합니다. 첫 줄은 오프셋을 그대로 사용합니다.
+			inline static const size_t CALCULATE_INDEX(const std::vector<std::uint32_t>& newLineOffsets, const std::uint32_t offset) noexcept
+			{
+				const std::vector<std::uint32_t>::const_iterator lastNewLine = std::lower_bound(newLineOffsets.begin(), newLineOffsets.end(), offset);
+				return (lastNewLine == newLineOffsets.begin()) ? offset : offset - *(lastNewLine - 1);
+			}
+
+#if defined(_WIN32)
+			inline static const bool ReadAll(HANDLE handle, std::string& outInput) noexcept
+			{
+				std::string buffer;
+				DWORD readSize = 0;
+				for (;;)
+				{
+					const size_t offset = buffer.size();
+					buffer.resize(offset + BULK_READ_CHUNK_SIZE);
+					if (::ReadFile(handle, buffer.data() + offset, static_cast<DWORD>(BULK_READ_CHUNK_SIZE), &readSize, nullptr) == FALSE)
+					{
+						// 파이프의 쓰기 쪽이 닫히면 ERROR_BROKEN_PIPE 로 입력의 끝을 알립니다.
+						if (GetLastError() != ERROR_BROKEN_PIPE)
+						{
+							return false;
+						}
+						readSize = 0;
+					}
+					buffer.resize(offset + readSize);
+					if (readSize == 0)
+					{
+						break;
+					}
+				}
+				outInput = std::move(buffer);
+				return true;
+			}
+#else
+			inline static const bool ReadAll(const int fileDescriptor, std::string& outInput) noexcept
+			{
+				std::string buffer;
+				for (;;)
+				{
+					const size_t offset = buffer.size();
+					buffer.resize(offset + BULK_READ_CHUNK_SIZE);
+					const ssize_t readSize = read(fileDescriptor, buffer.data() + offset, BULK_READ_CHUNK_SIZE);
+					if (readSize < 0)
+					{
+						if (errno == EINTR)
+						{
+							buffer.resize(offset);
+							continue;
+						}
+						return false;
+					}
+					buffer.resize(offset + static_cast<size_t>(readSize));
+					if (readSize == 0)
+					{
+						break;
+					}
+				}
+				outInput = std::move(buffer);
+				return true;
+			}
+#endif
 		}
 	}
+}
 
-	return Data{ Type::INVALID, "INVALID", 0, 0 };
+mcf::Lexer::SourceBuffer::~SourceBuffer(void) noexcept
+{
+	if (_mappedAddress == nullptr)
+	{
+		return;
+	}
+#if defined(_WIN32)
+	UnmapViewOfFile(_mappedAddress);
+#else
+	munmap(_mappedAddress, _mappedSize);
+#endif
 }
 
-const std::string mcf::Lexer::ReadFile(const std::string& path) noexcept
+std::shared_ptr<const mcf::Lexer::SourceBuffer> mcf::Lexer::SourceBuffer::MakeFromString(const std::string& input) noexcept
 {
-	std::string input;
+	std::shared_ptr<mcf::Lexer::SourceBuffer> source(new mcf::Lexer::SourceBuffer());
+	source->_bufferedInput = input;
+	source->_view = source->_bufferedInput;
+	return source;
+}
+
+std::shared_ptr<const mcf::Lexer::SourceBuffer> mcf::Lexer::SourceBuffer::MakeFromString(std::string&& input) noexcept
+{
+	std::shared_ptr<mcf::Lexer::SourceBuffer> source(new mcf::Lexer::SourceBuffer());
+	source->_bufferedInput = std::move(input);
+	source->_view = source->_bufferedInput;
+	return source;
+}
+
+std::shared_ptr<const mcf::Lexer::SourceBuffer> mcf::Lexer::SourceBuffer::MakeFromEdit(const std::shared_ptr<const SourceBuffer>& source, const size_t offset, const size_t removedLength, const std::string_view insertedText) noexcept
+{
+	const std::string_view input = source->GetView();
+	MCF_DEBUG_ASSERT(offset <= input.length() && removedLength <= input.length() - offset, u8"편집 범위가 입력을 벗어났습니다. inputLength=%zu, offset=%zu, removedLength=%zu", input.length(), offset, removedLength);
+
+	std::shared_ptr<mcf::Lexer::SourceBuffer> editedSource(new mcf::Lexer::SourceBuffer());
+	editedSource->_bufferedInput.reserve(input.length() - removedLength + insertedText.length());
+	editedSource->_bufferedInput.append(input.data(), offset);
+	editedSource->_bufferedInput.append(insertedText.data(), insertedText.length());
+	editedSource->_bufferedInput.append(input.data() + offset + removedLength, input.length() - offset - removedLength);
+	editedSource->_view = editedSource->_bufferedInput;
+	return editedSource;
+}
+
+std::shared_ptr<const mcf::Lexer::SourceBuffer> mcf::Lexer::SourceBuffer::MakeFromFile(const std::string& path) noexcept
+{
+	std::shared_ptr<mcf::Lexer::SourceBuffer> source(new mcf::Lexer::SourceBuffer());
+	const bool isStandardInput = (path == "-");
+
+#if defined(_WIN32)
+	HANDLE file = isStandardInput ? GetStdHandle(STD_INPUT_HANDLE) : CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE || file == nullptr)
 	{
-		std::ifstream file(path.c_str());
-		if (file.is_open() == false || file.fail() == true)
+		return nullptr;
+	}
+
+	LARGE_INTEGER fileSize = { 0 };
+	if (isStandardInput == false && GetFileType(file) == FILE_TYPE_DISK && GetFileSizeEx(file, &fileSize) != FALSE)
+	{
+		// 크기가 0 인 파일은 매핑할 수 없으므로 빈 입력으로 처리합니다.
+		if (fileSize.QuadPart == 0)
 		{
-			return std::string();
+			CloseHandle(file);
+			return source;
 		}
 
-		std::string line;
-		std::getline(file, line);
-		if (file.fail() == true)
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		void* mappedAddress = (mapping == nullptr) ? nullptr : MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (mapping != nullptr)
 		{
-			return std::string();
+			// 매핑된 뷰가 남아있는 동안에는 핸들을 닫아도 매핑이 유지됩니다.
+			CloseHandle(mapping);
 		}
+		if (mappedAddress != nullptr)
+		{
+			CloseHandle(file);
+			source->_mappedAddress = mappedAddress;
+			source->_mappedSize = static_cast<size_t>(fileSize.QuadPart);
+			source->SetViewSkippingBOM(static_cast<const char*>(mappedAddress), source->_mappedSize);
+			return source;
+		}
+	}
+
+	const bool isSucceeded = mcf::Lexer::Internal::ReadAll(file, source->_bufferedInput);
+	if (isStandardInput == false)
+	{
+		CloseHandle(file);
+	}
+#else
+	const int file = isStandardInput ? STDIN_FILENO : open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (file < 0)
+	{
+		return nullptr;
+	}
+
+	struct stat fileStatus;
+	if (isStandardInput == false && fstat(file, &fileStatus) == 0 && S_ISREG(fileStatus.st_mode))
+	{
+		// 크기가 0 인 파일은 매핑할 수 없으므로 빈 입력으로 처리합니다.
+		if (fileStatus.st_size == 0)
+		{
+			close(file);
+			return source;
+		}
+
+		const size_t fileSize = static_cast<size_t>(fileStatus.st_size);
+		void* mappedAddress = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, file, 0);
+		if (mappedAddress != MAP_FAILED)
+		{
+			// 매핑은 파일 디스크립터를 닫아도 유지됩니다.
+			close(file);
+			madvise(mappedAddress, fileSize, MADV_SEQUENTIAL);
+			source->_mappedAddress = mappedAddress;
+			source->_mappedSize = fileSize;
+			source->SetViewSkippingBOM(static_cast<const char*>(mappedAddress), fileSize);
+			return source;
+		}
+	}
+
+	const bool isSucceeded = mcf::Lexer::Internal::ReadAll(file, source->_bufferedInput);
+	if (isStandardInput == false)
+	{
+		close(file);
+	}
+#endif
+
+	if (isSucceeded == false)
+	{
+		return nullptr;
+	}
+	source->SetViewSkippingBOM(source->_bufferedInput.data(), source->_bufferedInput.size());
+	return source;
+}
+
+void mcf::Lexer::SourceBuffer::SetViewSkippingBOM(const char* data, const size_t size) noexcept
+{
+	constexpr const char UTF8_BOM[] = { '\xef', '\xbb', '\xbf' };
+	constexpr const size_t UTF8_BOM_SIZE = MCF_ARRAY_SIZE(UTF8_BOM);
+
+	_view = std::string_view(data, size);
+	if (_view.compare(0, UTF8_BOM_SIZE, UTF8_BOM, UTF8_BOM_SIZE) == 0)
+	{
+		_view.remove_prefix(UTF8_BOM_SIZE);
+	}
+}
 
-		constexpr const unsigned char ENCODING_ARRAY[][5] =
+const std::string mcf::Lexer::ReadFile(const std::string& path) noexcept
+{
+	const mcf::Lexer::Source source = mcf::Lexer::SourceBuffer::MakeFromFile(path);
+	if (source == nullptr)
+	{
+		return std::string();
+	}
+
+	const std::string_view view = source->GetView();
+	std::string input;
+	input.reserve(view.size());
+	for (size_t i = 0; i < view.size(); ++i)
+	{
+		if (view[i] == '\r' && i + 1 < view.size() && view[i + 1] == '\n')
 		{
-			{0xef, 0xbb, 0xbf, 0},
-		};
-		constexpr size_t encodingArraySize = MCF_ARRAY_SIZE(ENCODING_ARRAY);
-		constexpr size_t MAX_ENCODING_BYTE = 4;
+			continue;
+		}
+		input.push_back(view[i]);
+	}
+
+	// std::getline 으로 읽던 때와 같이 마지막 줄바꿈은 포함하지 않습니다.
+	if (input.empty() == false && input.back() == '\n')
+	{
+		input.pop_back();
+	}
+	return input;
+}
 
-		for (size_t i = 0; i < encodingArraySize; ++i)
+const size_t mcf::Lexer::SourceBuffer::GetLine(const std::uint32_t offset) const noexcept
+{
+	return Internal::CALCULATE_LINE(GetNewLineOffsets(), offset);
+}
+
+const size_t mcf::Lexer::SourceBuffer::GetIndex(const std::uint32_t offset) const noexcept
+{
+	return Internal::CALCULATE_INDEX(GetNewLineOffsets(), offset);
+}
+
+const std::vector<std::uint32_t>& mcf::Lexer::SourceBuffer::GetNewLineOffsets(void) const noexcept
+{
+	// 렉싱 중에는 줄 번호가 필요하지 않으므로 에러를 보고할 때 처음으로 만듭니다.
+	std::call_once(_newLineOffsetsFlag, [this]() noexcept
 		{
-			bool foundHeader = true;
-			size_t offset = 0;
+			MCF_DEBUG_ASSERT(_view.size() <= UINT32_MAX, u8"입력의 크기는 32비트를 넘을 수 없습니다. size=%zu", _view.size());
+			Internal::FindNewLines(_view.data(), 0, _view.size(), _newLineOffsets);
+		});
+	return _newLineOffsets;
+}
 
-			const size_t encodingSize = strlen(reinterpret_cast<const char*>(ENCODING_ARRAY[i]));
-			for (size_t j = 0; j <= MAX_ENCODING_BYTE - encodingSize; j++)
+const mcf::Token::Data mcf::Lexer::TokenBuffer::GetToken(const size_t index) const noexcept
+{
+	return mcf::Token::Data{ _types[index], GetLiteral(index), _offsets[index], _symbols[index] };
+}
+
+void mcf::Lexer::TokenBuffer::Reset(const mcf::Lexer::Source& source, mcf::Symbol::Table* symbols, const bool isSkippingComments) noexcept
+{
+	_source = source;
+	_symbolTable = symbols;
+	_isSkippingComments = isSkippingComments;
+	_types.clear();
+	_offsets.clear();
+	_lengths.clear();
+	_symbols.clear();
+}
+
+void mcf::Lexer::TokenBuffer::Reserve(const size_t tokenCount) noexcept
+{
+	_types.reserve(tokenCount);
+	_offsets.reserve(tokenCount);
+	_lengths.reserve(tokenCount);
+	_symbols.reserve(tokenCount);
+}
+
+void mcf::Lexer::TokenBuffer::PushBack(const mcf::Token::Data& token) noexcept
+{
+	const std::string_view input = (_source == nullptr) ? std::string_view() : _source->GetView();
+
+	// END_OF_FILE 토큰의 Literal 은 입력을 가리키지 않으므로 입력의 끝으로 기록합니다.
+	const bool isEndOfFile = token.Type == mcf::Token::Type::END_OF_FILE;
+	MCF_DEBUG_ASSERT(isEndOfFile || (input.data() + token.Offset == token.Literal.data() && token.Literal.data() + token.Literal.size() <= input.data() + input.size()),
+		u8"토큰의 Literal 과 Offset 이 입력 버퍼를 가리키지 않습니다. Literal=%s, Offset=%u", std::string(token.Literal).c_str(), token.Offset);
+	const size_t offset = isEndOfFile ? input.size() : token.Offset;
+	const size_t length = isEndOfFile ? 0 : token.Literal.size();
+
+	_types.emplace_back(token.Type);
+	_offsets.emplace_back(static_cast<std::uint32_t>(offset));
+	_lengths.emplace_back(static_cast<std::uint32_t>(length));
+	_symbols.emplace_back(token.Symbol);
+}
+
+void mcf::Lexer::TokenBuffer::Append(const mcf::Lexer::TokenBuffer& other) noexcept
+{
+	MCF_DEBUG_ASSERT(_source == other._source, u8"같은 source 로 만들어진 토큰 버퍼만 붙일 수 있습니다.");
+	_types.insert(_types.end(), other._types.begin(), other._types.end());
+	_offsets.insert(_offsets.end(), other._offsets.begin(), other._offsets.end());
+	_lengths.insert(_lengths.end(), other._lengths.begin(), other._lengths.end());
+	_symbols.insert(_symbols.end(), other._symbols.begin(), other._symbols.end());
+}
+
+namespace mcf
+{
+	namespace Lexer
+	{
+		namespace Internal
+		{
+			// target 의 [begin, end) 범위를 replacement 로 바꿉니다.
+			template <typename T>
+			static void REPLACE_RANGE(std::vector<T>& target, const size_t begin, const size_t end, const std::vector<T>& replacement) noexcept
 			{
-				foundHeader = true;
-				offset = j;
-				for (; ENCODING_ARRAY[i][offset] != 0; ++offset)
+				const size_t overwriteCount = std::min(end - begin, replacement.size());
+				std::copy(replacement.begin(), replacement.begin() + overwriteCount, target.begin() + begin);
+				if (overwriteCount < replacement.size())
 				{
-					// encodingArray 를 초기화 할 때 unsigned char 로만 초기화 가능한데 char 과 unsigned 를 비교하려면
-					// 타입을 맞춰줘야함.
-					if (line[offset] != static_cast<char>(ENCODING_ARRAY[i][offset]))
-					{
-						foundHeader = false;
-						break;
-					}
+					target.insert(target.begin() + end, replacement.begin() + overwriteCount, replacement.end());
 				}
+				else
+				{
+					target.erase(target.begin() + begin + overwriteCount, target.begin() + end);
+				}
+			}
+		}
+	}
+}
+
+const mcf::Lexer::Error mcf::Lexer::TokenBuffer::ApplyEdit(const mcf::Lexer::Edit& edit, _Out_opt_ size_t* optionalOutRelexedCount) noexcept
+{
+	if (optionalOutRelexedCount != nullptr)
+	{
+		*optionalOutRelexedCount = 0;
+	}
+
+	if (_source == nullptr || _types.empty())
+	{
+		return mcf::Lexer::Error::INVALID_EDIT_RANGE;
+	}
+
+	const std::string_view oldInput = _source->GetView();
+	if (edit.Offset > oldInput.length() || edit.RemovedLength > oldInput.length() - edit.Offset)
+	{
+		return mcf::Lexer::Error::INVALID_EDIT_RANGE;
+	}
+
+	const size_t newLength = oldInput.length() - edit.RemovedLength + edit.InsertedText.length();
+	if (newLength == 0 || newLength > UINT32_MAX)
+	{
+		return mcf::Lexer::Error::INVALID_INPUT_LENGTH;
+	}
+
+	const mcf::Lexer::Source newSource = mcf::Lexer::SourceBuffer::MakeFromEdit(_source, edit.Offset, edit.RemovedLength, edit.InsertedText);
+
+	// 렉서는 '\0' 을 입력의 끝으로 처리하므로 '\0' 뒤의 토큰은 버퍼에 없습니다. 이 경우에는 전체를 다시 렉싱합니다.
+	if (oldInput.find('\0') != std::string_view::npos || edit.InsertedText.find('\0') != std::string_view::npos)
+	{
+		mcf::Lexer::Object lexer(std::string(), newSource);
+		lexer.SetSymbolTable(_symbolTable);
+		lexer.SetCommentSkipping(_isSkippingComments, nullptr);
+		lexer.TokenizeAll(*this);
+		if (optionalOutRelexedCount != nullptr)
+		{
+			*optionalOutRelexedCount = GetCount();
+		}
+		return mcf::Lexer::Error::SUCCESS;
+	}
+
+	// 렉서는 토큰이 끝난 바로 다음 바이트까지 확인하므로, 끝 위치가 편집 시작 위치 이상인 첫 토큰부터 영향을 받습니다.
+	// 그 앞 토큰이 끝난 위치에서 렉서의 상태는 위치뿐이므로 그 위치부터 다시 렉싱할 수 있습니다.
+	const size_t oldTokenCount = _types.size();
+	size_t firstIndex = static_cast<size_t>(std::upper_bound(_offsets.begin(), _offsets.end(), edit.Offset) - _offsets.begin());
+	while (firstIndex > 0 && static_cast<size_t>(_offsets[firstIndex - 1]) + _lengths[firstIndex - 1] >= edit.Offset)
+	{
+		--firstIndex;
+	}
+	const size_t restartPosition = (firstIndex == 0) ? 0 : static_cast<size_t>(_offsets[firstIndex - 1]) + _lengths[firstIndex - 1];
+
+	// 편집된 범위를 지난 새 토큰이 이전 토큰과 같은 위치(편집 전 기준)에서 끝나면 렉서의 상태가 같아지므로 나머지 토큰을 재사용합니다.
+	const size_t insertedEnd = edit.Offset + edit.InsertedText.length();
+	mcf::Lexer::TokenBuffer relexed;
+	relexed.Reset(newSource);
+	size_t reuseIndex = oldTokenCount;
+	if (restartPosition == newLength)
+	{
+		relexed.PushBack(mcf::Token::Data{ mcf::Token::Type::END_OF_FILE, "\0", static_cast<std::uint32_t>(newLength) });
+	}
+	else
+	{
+		mcf::Lexer::Object lexer(std::string(), newSource, restartPosition, newLength - restartPosition);
+		lexer.SetSymbolTable(_symbolTable);
+		lexer.SetCommentSkipping(_isSkippingComments, nullptr);
+		size_t oldIndex = firstIndex;
+		for (mcf::Token::Data token = lexer.ReadNextToken(); ; token = lexer.ReadNextToken())
+		{
+			relexed.PushBack(token);
+			if (token.Type == mcf::Token::Type::END_OF_FILE)
+			{
+				break;
+			}
+
+			const size_t newEnd = static_cast<size_t>(relexed._offsets.back()) + relexed._lengths.back();
+			if (newEnd < insertedEnd)
+			{
+				continue;
 			}
 
-			if (foundHeader == true)
+			const size_t oldEnd = newEnd - edit.InsertedText.length() + edit.RemovedLength;
+			while (oldIndex < oldTokenCount && static_cast<size_t>(_offsets[oldIndex]) + _lengths[oldIndex] < oldEnd)
 			{
-				line.erase(0, encodingSize);
+				++oldIndex;
+			}
+			if (oldIndex < oldTokenCount && _types[oldIndex] != mcf::Token::Type::END_OF_FILE && static_cast<size_t>(_offsets[oldIndex]) + _lengths[oldIndex] == oldEnd)
+			{
+				reuseIndex = oldIndex + 1;
 				break;
 			}
 		}
+	}
+
+	// 재사용하는 토큰의 오프셋을 옮기고 [firstIndex, reuseIndex) 범위를 새 토큰으로 바꿉니다. 32비트 연산의 wrap-around 로 음수 이동도 처리됩니다.
+	const std::uint32_t offsetDelta = static_cast<std::uint32_t>(edit.InsertedText.length()) - static_cast<std::uint32_t>(edit.RemovedLength);
+	for (size_t i = reuseIndex; i < oldTokenCount; ++i)
+	{
+		_offsets[i] += offsetDelta;
+	}
+	Internal::REPLACE_RANGE(_types, firstIndex, reuseIndex, relexed._types);
+	Internal::REPLACE_RANGE(_offsets, firstIndex, reuseIndex, relexed._offsets);
+	Internal::REPLACE_RANGE(_lengths, firstIndex, reuseIndex, relexed._lengths);
+	Internal::REPLACE_RANGE(_symbols, firstIndex, reuseIndex, relexed._symbols);
 
-		input += line;
-		while (std::getline(file, line))
+	_source = newSource;
+	if (optionalOutRelexedCount != nullptr)
+	{
+		*optionalOutRelexedCount = relexed.GetCount();
+	}
+	return mcf::Lexer::Error::SUCCESS;
+}
+
+const mcf::Lexer::Error mcf::Lexer::TokenizeAll(const std::string& input, const bool isFile, mcf::Lexer::TokenBuffer& outBuffer) noexcept
+{
+	mcf::Lexer::Object lexer(input, isFile);
+	const mcf::Lexer::Error error = lexer.GetLastErrorToken();
+	if (error != mcf::Lexer::Error::SUCCESS)
+	{
+		outBuffer.Reset(nullptr);
+		return error;
+	}
+
+	lexer.TokenizeAll(outBuffer);
+	return mcf::Lexer::Error::SUCCESS;
+}
+
+namespace mcf
+{
+	namespace Lexer
+	{
+		namespace Internal
 		{
-			if (file.fail() == true)
+			// 렉서와 같은 규칙으로 문자열, 한줄 주석, 블록 주석의 밖에 있는 줄바꿈을 찾아 청크를 나눌 위치를 반환합니다.
+			// 반환되는 위치는 줄바꿈 바로 다음이며, 첫번째 값은 항상 0 입니다. 입력에 '\0' 이 없어야 합니다.
+			static const std::vector<size_t> FIND_SAFE_SPLIT_POSITIONS(const std::string_view input, const size_t chunkSize) noexcept
 			{
-				return std::string();
+				std::vector<size_t> splitPositions = { 0 };
+
+				const char* const data = input.data();
+				const size_t length = input.length();
+				size_t nextSplitPosition = chunkSize;
+				size_t position = 0;
+				while (position < length)
+				{
+					position = FindAnyOf(data, position, length, '"', '/', '\n');
+					if (position >= length)
+					{
+						break;
+					}
+
+					switch (data[position])
+					{
+					case '\n':
+						position += 1;
+						if (position >= nextSplitPosition && position < length)
+						{
+							splitPositions.emplace_back(position);
+							nextSplitPosition = position + chunkSize;
+						}
+						break;
+
+					case '"':
+						// ReadStringUtf8 은 여는 '"' 바로 다음 바이트를 검사하지 않고 읽으므로 같은 규칙을 따릅니다.
+						position += 1;
+						if (position < length && data[position] == '"')
+						{
+							position += 1;
+							break;
+						}
+						position = FindAnyOf(data, (position < length) ? position + 1 : length, length, '"', '\n', '\r');
+						if (position < length && data[position] == '"')
+						{
+							position += 1;
+						}
+						break;
+
+					case '/':
+						if (position + 1 < length && data[position + 1] == '/')
+						{
+							position = FindLineEnd(data, position + 2, length);
+						}
+						else if (position + 1 < length && data[position + 1] == '*')
+						{
+							const size_t commentEnd = FindBlockCommentEnd(data, position + 2, length);
+							position = (commentEnd < length) ? commentEnd + 2 : length;
+						}
+						else
+						{
+							position += 1;
+						}
+						break;
+
+					default:
+						MCF_DEBUG_BREAK(u8"예상하지 못한 문자입니다. 문자=%c, 값=%d", data[position], data[position]);
+						position += 1;
+						break;
+					}
+				}
+				return splitPositions;
 			}
-			// 이전에 읽은 라인이 없다면 새로운 라인을 만들지 않는다. 
-			input += "\n" + line;
 		}
 	}
-	return input;
 }
 
-mcf::Lexer::Object::Object(const std::string& input, const bool isFIle) noexcept
-	: _input(isFIle ? mcf::Lexer::ReadFile(input) : input)
-	, _name(input)
+const mcf::Lexer::Error mcf::Lexer::TokenizeAllParallel(const std::string& input, const bool isFile, const size_t threadCount, const size_t chunkSize, mcf::Lexer::TokenBuffer& outBuffer) noexcept
 {
-	if ( _input.length() == 0 )
+	const mcf::Lexer::Source source = isFile ? mcf::Lexer::SourceBuffer::MakeFromFile(input) : mcf::Lexer::SourceBuffer::MakeFromString(input);
+	mcf::Lexer::Object lexer(input, source);
+	const mcf::Lexer::Error error = lexer.GetLastErrorToken();
+	if (error != mcf::Lexer::Error::SUCCESS)
 	{
-		if (isFIle)
+		outBuffer.Reset(nullptr);
+		return error;
+	}
+
+	// 렉서는 '\0' 을 입력의 끝으로 처리하므로 '\0' 이 있는 입력은 순차적으로 렉싱합니다.
+	const std::string_view view = source->GetView();
+	const size_t actualThreadCount = (threadCount != 0) ? threadCount : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+	const size_t actualChunkSize = (chunkSize != 0) ? chunkSize : mcf::Lexer::DEFAULT_PARALLEL_CHUNK_SIZE;
+	if (actualThreadCount == 1 || view.length() <= actualChunkSize || view.find('\0') != std::string_view::npos)
+	{
+		lexer.TokenizeAll(outBuffer);
+		return mcf::Lexer::Error::SUCCESS;
+	}
+
+	const std::vector<size_t> splitPositions = Internal::FIND_SAFE_SPLIT_POSITIONS(view, actualChunkSize);
+	const size_t chunkCount = splitPositions.size();
+	std::vector<mcf::Lexer::TokenBuffer> chunkBuffers(chunkCount);
+	std::atomic<size_t> nextChunkIndex(0);
+	const auto lexChunks = [&]() noexcept
+	{
+		for (size_t chunkIndex = nextChunkIndex.fetch_add(1); chunkIndex < chunkCount; chunkIndex = nextChunkIndex.fetch_add(1))
 		{
-			std::ifstream file(_name.c_str());
-			if (file.fail())
+			const size_t begin = splitPositions[chunkIndex];
+			const size_t end = (chunkIndex + 1 < chunkCount) ? splitPositions[chunkIndex + 1] : view.length();
+			mcf::Lexer::Object chunkLexer(input, source, begin, end - begin);
+			mcf::Lexer::TokenBuffer& chunkBuffer = chunkBuffers[chunkIndex];
+			chunkBuffer.Reset(source);
+
+			// 각 청크의 END_OF_FILE 은 버리고 마지막에 한번만 추가합니다.
+			for (mcf::Token::Data token = chunkLexer.ReadNextToken(); token.Type != mcf::Token::Type::END_OF_FILE; token = chunkLexer.ReadNextToken())
 			{
-				_tokens.push(Error::FAIL_READ_FILE);
-				return;
+				chunkBuffer.PushBack(token);
 			}
 		}
+	};
+
+	std::vector<std::thread> workers;
+	const size_t workerCount = std::min(actualThreadCount, chunkCount) - 1;
+	workers.reserve(workerCount);
+	for (size_t i = 0; i < workerCount; ++i)
+	{
+		workers.emplace_back(lexChunks);
+	}
+	lexChunks();
+	for (size_t i = 0; i < workerCount; ++i)
+	{
+		workers[i].join();
+	}
+
+	outBuffer.Reset(source);
+	size_t tokenCount = 1;
+	for (size_t i = 0; i < chunkCount; ++i)
+	{
+		tokenCount += chunkBuffers[i].GetCount();
+	}
+	outBuffer.Reserve(tokenCount);
+	for (size_t i = 0; i < chunkCount; ++i)
+	{
+		outBuffer.Append(chunkBuffers[i]);
+	}
+	outBuffer.PushBack(mcf::Token::Data{ mcf::Token::Type::END_OF_FILE, "\0", static_cast<std::uint32_t>(view.length()) });
+	return mcf::Lexer::Error::SUCCESS;
+}
+
+mcf::Lexer::Object::Object(const std::string& input, const bool isFIle) noexcept
+	: Object(input, isFIle ? mcf::Lexer::SourceBuffer::MakeFromFile(input) : mcf::Lexer::SourceBuffer::MakeFromString(input))
+{
+}
+
+mcf::Lexer::Object::Object(const std::string& name, const mcf::Lexer::Source& source) noexcept
+	: Object(name, source, 0, (source == nullptr) ? 0 : source->GetView().length())
+{
+}
+
+mcf::Lexer::Object::Object(const std::string& name, const mcf::Lexer::Source& source, const size_t begin, const size_t length) noexcept
+	: _source(source)
+	, _input(_source == nullptr ? std::string_view() : _source->GetView().substr(begin, length))
+	, _inputOffset(begin)
+	, _name(name)
+{
+	if (_source == nullptr)
+	{
+		_tokens.push(Error::FAIL_READ_FILE);
+		return;
+	}
+
+	// 토큰 버퍼는 32비트 오프셋을 사용하므로 4GB 이상의 입력은 지원하지 않습니다.
+	if ( _input.length() == 0 || _input.length() > UINT32_MAX )
+	{
 		_tokens.push(Error::INVALID_INPUT_LENGTH);
 		return;
 	}
 
 	ReadNextByte();
-	// reset index to 0 after read next byte
-	_currentIndex = 0;
 }
 
 const mcf::Lexer::Error mcf::Lexer::Object::GetLastErrorToken(void) noexcept
@@ -153,19 +841,23 @@ const mcf::Lexer::Error mcf::Lexer::Object::GetLastErrorToken(void) noexcept
 const mcf::Token::Data mcf::Lexer::Object::ReadNextToken(void) noexcept
 {
 	// 공백 문자는 스킵 하도록 합니다.
-	while (_currentByte == ' ' || _currentByte == '\t' || _currentByte == '\n' || _currentByte == '\r')
+	SkipWhitespace();
+
+	// 주석을 건너뛰는 경우에는 주석 토큰을 반환하지 않고 뒤따르는 공백과 함께 건너뜁니다.
+	while (_isSkippingComments && _currentByte == '/' && (GetNextByte() == '/' || GetNextByte() == '*'))
 	{
-		// EOF 를 맞나면 즉시 종료 루프를 빠져나옵니다.
-		if (_currentByte == 0)
+		const mcf::Token::Data comment = ReadSlashStartingToken();
+		if (comment.Type == Token::Type::INVALID)
 		{
-			break;
+			return comment;
 		}
-		else if ( _currentByte == '\n' )
+
+		if (_commentRanges != nullptr)
 		{
-			_currentLine++;
-			_currentIndex = 0;
+			const size_t offset = static_cast<size_t>(comment.Literal.data() - _source->GetView().data());
+			_commentRanges->emplace_back(mcf::Lexer::CommentRange{ static_cast<std::uint32_t>(offset), static_cast<std::uint32_t>(comment.Literal.length()) });
 		}
-		ReadNextByte();
+		SkipWhitespace();
 	}
 
 	constexpr const size_t TOKEN_COUNT_BEGIN = __COUNTER__;
@@ -174,7 +866,7 @@ const mcf::Token::Data mcf::Lexer::Object::ReadNextToken(void) noexcept
 	{
 	case 0: __COUNTER__;
 		// 입력의 끝에 도달 하였을때 read_next_byte()가 호출될 경우 에러가 발생하기 때문에 EOF 를 만나면 강제로 종료합니다.
-		return { Token::Type::END_OF_FILE, "\0", _currentLine, _currentIndex };
+		return { Token::Type::END_OF_FILE, "\0", GetSourceOffset(_currentPosition) };
 	case '"': __COUNTER__;
 		return ReadStringUtf8();
 	case '=':
@@ -189,12 +881,12 @@ const mcf::Token::Data mcf::Lexer::Object::ReadNextToken(void) noexcept
 		if (_currentByte == '=')
 		{
 			ReadNextByte();
-			return { Token::Type::EQUAL, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), _currentLine, _currentIndex };
+			return { Token::Type::EQUAL, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), GetSourceOffset(firstLetterPosition) };
 		}
-		return { Token::Type::ASSIGN, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), _currentLine, _currentIndex };
+		return { Token::Type::ASSIGN, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), GetSourceOffset(firstLetterPosition) };
 	}
 	case '+': __COUNTER__;
-		token = { Token::Type::PLUS, std::string(1, _currentByte), _currentLine, _currentIndex };
+		token = { Token::Type::PLUS, _input.substr(_currentPosition, 1), GetSourceOffset(_currentPosition) };
 		break;
 	case '-': 
 	{
@@ -208,12 +900,12 @@ const mcf::Token::Data mcf::Lexer::Object::ReadNextToken(void) noexcept
 		if ( _currentByte == '>' )
 		{
 			ReadNextByte();
-			return { Token::Type::POINTING, _input.substr( firstLetterPosition, _currentPosition - firstLetterPosition ), _currentLine, _currentIndex };
+			return { Token::Type::POINTING, _input.substr( firstLetterPosition, _currentPosition - firstLetterPosition ), GetSourceOffset(firstLetterPosition) };
 		}
-		return { Token::Type::MINUS, _input.substr( firstLetterPosition, _currentPosition - firstLetterPosition ), _currentLine, _currentIndex };
+		return { Token::Type::MINUS, _input.substr( firstLetterPosition, _currentPosition - firstLetterPosition ), GetSourceOffset(firstLetterPosition) };
 	}
 	case '*': __COUNTER__;
-		token = { Token::Type::ASTERISK, std::string(1, _currentByte), _currentLine, _currentIndex };
+		token = { Token::Type::ASTERISK, _input.substr(_currentPosition, 1), GetSourceOffset(_currentPosition) };
 		break;
 	case '/': 
 		__COUNTER__; // count for SLASH
@@ -232,36 +924,36 @@ const mcf::Token::Data mcf::Lexer::Object::ReadNextToken(void) noexcept
 		if (_currentByte == '=')
 		{
 			ReadNextByte();
-			return { Token::Type::NOT_EQUAL, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), _currentLine, _currentIndex };
+			return { Token::Type::NOT_EQUAL, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), GetSourceOffset(firstLetterPosition) };
 		}
-		return { Token::Type::BANG, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), _currentLine, _currentIndex };
+		return { Token::Type::BANG, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), GetSourceOffset(firstLetterPosition) };
 	}
 	case '<': __COUNTER__;
-		token = { Token::Type::LT, std::string(1, _currentByte), _currentLine, _currentIndex };
+		token = { Token::Type::LT, _input.substr(_currentPosition, 1), GetSourceOffset(_currentPosition) };
 		break;
 	case '>': __COUNTER__;
-		token = { Token::Type::GT, std::string(1, _currentByte), _currentLine, _currentIndex };
+		token = { Token::Type::GT, _input.substr(_currentPosition, 1), GetSourceOffset(_currentPosition) };
 		break;
 	case '&': __COUNTER__;
-		token = { Token::Type::AMPERSAND, std::string(1, _currentByte), _currentLine, _currentIndex };
+		token = { Token::Type::AMPERSAND, _input.substr(_currentPosition, 1), GetSourceOffset(_currentPosition) };
 		break;
 	case '(': __COUNTER__;
-		token = { Token::Type::LPAREN, std::string(1, _currentByte), _currentLine, _currentIndex };
+		token = { Token::Type::LPAREN, _input.substr(_currentPosition, 1), GetSourceOffset(_currentPosition) };
 		break;
 	case ')': __COUNTER__;
-		token = { Token::Type::RPAREN, std::string(1, _currentByte), _currentLine, _currentIndex };
+		token = { Token::Type::RPAREN, _input.substr(_currentPosition, 1), GetSourceOffset(_currentPosition) };
 		break;
 	case '{': __COUNTER__;
-		token = { Token::Type::LBRACE, std::string(1, _currentByte), _currentLine, _currentIndex };
+		token = { Token::Type::LBRACE, _input.substr(_currentPosition, 1), GetSourceOffset(_currentPosition) };
 		break;
 	case '}': __COUNTER__;
-		token = { Token::Type::RBRACE, std::string(1, _currentByte), _currentLine, _currentIndex };
+		token = { Token::Type::RBRACE, _input.substr(_currentPosition, 1), GetSourceOffset(_currentPosition) };
 		break;
 	case '[': __COUNTER__;
-		token = { Token::Type::LBRACKET, std::string(1, _currentByte), _currentLine, _currentIndex };
+		token = { Token::Type::LBRACKET, _input.substr(_currentPosition, 1), GetSourceOffset(_currentPosition) };
 		break;
 	case ']': __COUNTER__;
-		token = { Token::Type::RBRACKET, std::string(1, _currentByte), _currentLine, _currentIndex };
+		token = { Token::Type::RBRACKET, _input.substr(_currentPosition, 1), GetSourceOffset(_currentPosition) };
 		break;
 	case ':': 
 	{
@@ -275,15 +967,15 @@ const mcf::Token::Data mcf::Lexer::Object::ReadNextToken(void) noexcept
 		if (_currentByte == ':')
 		{
 			ReadNextByte();
-			return { Token::Type::DOUBLE_COLON, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), _currentLine, _currentIndex };
+			return { Token::Type::DOUBLE_COLON, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), GetSourceOffset(firstLetterPosition) };
 		}
-		return { Token::Type::COLON, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), _currentLine, _currentIndex };
+		return { Token::Type::COLON, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), GetSourceOffset(firstLetterPosition) };
 	}
 	case ';': __COUNTER__;
-		token = { Token::Type::SEMICOLON, std::string(1, _currentByte), _currentLine, _currentIndex };
+		token = { Token::Type::SEMICOLON, _input.substr(_currentPosition, 1), GetSourceOffset(_currentPosition) };
 		break;
 	case ',': __COUNTER__;
-		token = { Token::Type::COMMA, std::string(1, _currentByte), _currentLine, _currentIndex };
+		token = { Token::Type::COMMA, _input.substr(_currentPosition, 1), GetSourceOffset(_currentPosition) };
 		break;
 	case '.':
 		__COUNTER__; // count for VARIADIC
@@ -310,10 +1002,10 @@ const mcf::Token::Data mcf::Lexer::Object::ReadNextToken(void) noexcept
 			__COUNTER__; // count for KEYWORD_AS
 			__COUNTER__; // count for KEYWORD_WHILE
 			__COUNTER__; // count for KEYWORD_BREAK
+			token.Offset = GetSourceOffset(_currentPosition);
 			token.Literal = ReadKeywordOrIdentifier(); 
 			token.Type = DetermineKeywordOrIdentifier(token.Literal);
-			token.Line = _currentLine;
-			token.Index = _currentIndex;
+			token.Symbol = (token.Type == Token::Type::IDENTIFIER && _symbols != nullptr) ? _symbols->Intern(token.Literal) : mcf::Symbol::INVALID_ID;
 			return token; 
 		}
 		else if (mcf::Internal::IS_DIGIT(_currentByte))
@@ -327,7 +1019,7 @@ const mcf::Token::Data mcf::Lexer::Object::ReadNextToken(void) noexcept
 			__COUNTER__; // count for KEYWORD_IDENTIFIER_END
 			__COUNTER__; // count for MACRO_START
 			__COUNTER__; // count for MACRO_END
-			token = { Token::Type::INVALID, std::string(1, _currentByte), _currentLine, _currentIndex };
+			token = { Token::Type::INVALID, _input.substr(_currentPosition, 1), GetSourceOffset(_currentPosition) };
 			MCF_DEBUG_BREAK(u8"예상치 못한 바이트 값이 들어 왔습니다. 토큰 생성에 실패 하였습니다. 현재 바이트[%u], ascii[%c]", _currentByte, _currentByte);
 			break;
 		}
@@ -339,6 +1031,22 @@ const mcf::Token::Data mcf::Lexer::Object::ReadNextToken(void) noexcept
 	return token;
 }
 
+void mcf::Lexer::Object::TokenizeAll(mcf::Lexer::TokenBuffer& outBuffer) noexcept
+{
+	// 토큰 하나의 평균 길이(공백 포함)를 대략 4바이트로 보고 미리 할당합니다.
+	constexpr const size_t AVERAGE_BYTES_PER_TOKEN = 4;
+
+	outBuffer.Reset(_source, _symbols, _isSkippingComments);
+	outBuffer.Reserve((_input.length() - _currentPosition) / AVERAGE_BYTES_PER_TOKEN + 1);
+
+	mcf::Token::Data token;
+	do
+	{
+		token = ReadNextToken();
+		outBuffer.PushBack(token);
+	} while (token.Type != mcf::Token::Type::END_OF_FILE);
+}
+
 inline const char mcf::Lexer::Object::GetNextByte(void) const noexcept
 {
 	return _nextPosition < _input.length() ? _input[_nextPosition] : 0;
@@ -349,42 +1057,36 @@ inline void mcf::Lexer::Object::ReadNextByte(void) noexcept
 	const size_t length = _input.length();
 	MCF_DEBUG_ASSERT(_nextPosition <= length, u8"currentPosition 은 inputLength 보다 크거나 같을 수 없습니다!. inputLength=%zu, nextPosition=%zu", length, _nextPosition);
 
-	_currentByte = (_nextPosition > length) ? 0 : _input[_nextPosition];
+	_currentByte = (_nextPosition >= length) ? 0 : _input[_nextPosition];
 	_currentPosition = _nextPosition;
 	_nextPosition += 1;
-	_currentIndex += 1;
 }
 
-inline const bool mcf::Lexer::Object::ReadLineIfStartWith(_Outptr_opt_ std::string* optionalOut, const char* _In_opt_ startWith) noexcept
+inline void mcf::Lexer::Object::SkipWhitespace(void) noexcept
 {
-	const size_t startWithLength = std::strlen(startWith);
-	const size_t firstLetterPosition = _currentPosition;
-
-	for (size_t i = 0; i < startWithLength; ++i)
+	// 연속된 공백은 스캐너가 한번에 건너뜁니다. 줄 번호는 에러를 보고할 때 오프셋으로 계산하므로 줄바꿈을 세지 않습니다.
+	if (_currentByte == ' ' || _currentByte == '\t' || _currentByte == '\n' || _currentByte == '\r')
 	{
-		if (_currentByte != startWith[i] || _currentByte == 0)
-		{
-			if (optionalOut != nullptr)
-			{
-				*optionalOut = _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition);
-			}
-			return false;
-		}
-		ReadNextByte();
+		ReadBytesUntil(Internal::SkipWhitespace(_input.data(), _currentPosition, _input.length()));
 	}
+}
 
-	while (_currentByte != 0 && _currentByte != '\r' && _currentByte != '\n')
-	{
-		ReadNextByte();
-	}
-	if (optionalOut != nullptr)
-	{
-		*optionalOut = _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition);
-	}
-	return true;
+inline void mcf::Lexer::Object::ReadBytesUntil(const size_t position) noexcept
+{
+	const size_t length = _input.length();
+	MCF_DEBUG_ASSERT(_currentPosition <= position && position <= length, u8"position 은 currentPosition 과 inputLength 사이여야 합니다. currentPosition=%zu, position=%zu, inputLength=%zu", _currentPosition, position, length);
+
+	_currentByte = (position >= length) ? 0 : _input[position];
+	_currentPosition = position;
+	_nextPosition = position + 1;
+}
+
+inline const std::uint32_t mcf::Lexer::Object::GetSourceOffset(const size_t position) const noexcept
+{
+	return static_cast<std::uint32_t>(_inputOffset + position);
 }
 
-inline const bool mcf::Lexer::Object::ReadAndValidate(_Outptr_opt_ std::string* optionalOut, _In_opt_ const char* stringToCompare) noexcept
+inline const bool mcf::Lexer::Object::ReadAndValidate(_Outptr_opt_ std::string_view* optionalOut, _In_opt_ const char* stringToCompare) noexcept
 {
 	MCF_DEBUG_ASSERT(stringToCompare != nullptr, u8"stringToCompare가 null일 수 없습니다.");
 
@@ -411,7 +1113,7 @@ inline const bool mcf::Lexer::Object::ReadAndValidate(_Outptr_opt_ std::string*
 	return true;
 }
 
-inline const bool mcf::Lexer::Object::ReadAndValidate(_Outptr_opt_ std::string* optionalOut, _In_opt_ const char* startWith, _In_opt_ const char* endWith, _In_opt_ const char* invalidCharList) noexcept
+inline const bool mcf::Lexer::Object::ReadAndValidate(_Outptr_opt_ std::string_view* optionalOut, _In_opt_ const char* startWith, _In_opt_ const char* endWith, _In_opt_ const char* invalidCharList) noexcept
 {
 	MCF_DEBUG_ASSERT(startWith != nullptr || endWith != nullptr, u8"startWith와 endWith 둘다 null이면 안됩니다.");
 	MCF_DEBUG_ASSERT(endWith != nullptr || (endWith == nullptr && invalidCharList != nullptr), u8"endWith가 null인 경우 invalidCharList는 null이면 안됩니다.");
@@ -476,7 +1178,7 @@ inline const bool mcf::Lexer::Object::ReadAndValidate(_Outptr_opt_ std::string*
 	return true;
 }
 
-inline const std::string mcf::Lexer::Object::ReadKeywordOrIdentifier(void) noexcept
+inline const std::string_view mcf::Lexer::Object::ReadKeywordOrIdentifier(void) noexcept
 {
 	MCF_DEBUG_ASSERT(internal::IS_ALPHABET(_currentByte) || _currentByte == '_', u8"키워드 혹은 식별자의 시작은 알파벳이거나 '_' 이어야만 합니다. 시작 문자=%c, 값=%d", _currentByte, _currentByte);
 
@@ -491,7 +1193,7 @@ inline const std::string mcf::Lexer::Object::ReadKeywordOrIdentifier(void) noexc
 	return _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition);
 }
 
-inline const std::string mcf::Lexer::Object::ReadNumber(void) noexcept
+inline const std::string_view mcf::Lexer::Object::ReadNumber(void) noexcept
 {
 	MCF_DEBUG_ASSERT(mcf::Internal::IS_DIGIT(_currentByte), u8"숫자의 시작은 0부터 9까지의 문자여야 합니다. 시작 문자=%c, 값=%d", _currentByte, _currentByte);
 
@@ -516,10 +1218,10 @@ const mcf::Token::Data mcf::Lexer::Object::ReadStringUtf8(void) noexcept
 	if (ReadAndValidate(nullptr, nullptr, "\"", "\n\r") == true)
 	{
 		// TODO: #24 valid utf8 문자열인지 확인 필요, 아닌 경우 INVALID 토큰을 보냅고 토큰 생성 실패 시킵니다.
-		return { Token::Type::STRING, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), _currentLine, _currentIndex };
+		return { Token::Type::STRING, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), GetSourceOffset(firstLetterPosition) };
 	}
 
-	return { Token::Type::INVALID, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), _currentLine, _currentIndex };
+	return { Token::Type::INVALID, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), GetSourceOffset(firstLetterPosition) };
 }
 
 inline const mcf::Token::Data mcf::Lexer::Object::ReadSlashStartingToken(void) noexcept
@@ -530,28 +1232,36 @@ inline const mcf::Token::Data mcf::Lexer::Object::ReadSlashStartingToken(void) n
 	const size_t firstLetterPosition = _currentPosition;
 	ReadNextByte();
 
-	// 연속되는 문자열이 `//`(comment) 인지 검사합니다.
-	if (ReadLineIfStartWith(nullptr, "/") == true)
+	// 연속되는 문자열이 `//`(comment) 인지 검사합니다. 주석의 본문은 스캐너가 한번에 건너뜁니다.
+	if (_currentByte == '/')
 	{
-		return { Token::Type::COMMENT, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), _currentLine, _currentIndex };
+		ReadBytesUntil(Internal::FindLineEnd(_input.data(), _nextPosition, _input.length()));
+		return { Token::Type::COMMENT, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), GetSourceOffset(firstLetterPosition) };
 	}
 
 	// 연속되는 문자열이 `/*[^"*/"]*/`(comment_block) 인지 검사합니다.
-	if (ReadAndValidate(nullptr, "*", "*/", nullptr) == true)
+	if (_currentByte == '*')
 	{
-		return { Token::Type::COMMENT_BLOCK, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), _currentLine, _currentIndex };
+		ReadBytesUntil(Internal::FindBlockCommentEnd(_input.data(), _nextPosition, _input.length()));
+		if (_currentByte == '*')
+		{
+			// "*/" 를 읽습니다.
+			ReadNextByte();
+			ReadNextByte();
+			return { Token::Type::COMMENT_BLOCK, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), GetSourceOffset(firstLetterPosition) };
+		}
 	}
 
-	std::string tokenLiteral = _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition);
+	const std::string_view tokenLiteral = _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition);
 	// 위의 comment_block(`/*[^"*/"]*/`)의 검사가 실패 하는 경우는 시작 문자열의 '*'스타를 못읽었거나 EOF 로 끝나는 경우 뿐이므로
 	// 문자열이 "/*"로 시작 하는 상태에서 EOF로 인해 실패 하였다면 INVALID 한 토큰을 리턴합니다.
 	if ((tokenLiteral.rfind("/*", 0) == 0) && _currentByte == 0)
 	{
 		MCF_DEBUG_BREAK(u8"주석에서 예기치 않은 파일의 끝이 나타났습니다.");
-		return { Token::Type::INVALID, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), _currentLine, _currentIndex };
+		return { Token::Type::INVALID, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), GetSourceOffset(firstLetterPosition) };
 	}
 
-	return { Token::Type::SLASH, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), _currentLine, _currentIndex };
+	return { Token::Type::SLASH, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), GetSourceOffset(firstLetterPosition) };
 }
 
 inline const mcf::Token::Data mcf::Lexer::Object::ReadDotStartingToken(void) noexcept
@@ -568,14 +1278,14 @@ inline const mcf::Token::Data mcf::Lexer::Object::ReadDotStartingToken(void) noe
 	}
 
 	// 연속되는 문자열이 "..."(VARIADIC) 인지 검사합니다.
-	const std::string variadicCandidate = _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition);
+	const std::string_view variadicCandidate = _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition);
 	if (variadicCandidate == "...")
 	{
-		return { Token::Type::VARIADIC, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), _currentLine, _currentIndex };
+		return { Token::Type::VARIADIC, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), GetSourceOffset(firstLetterPosition) };
 	}
 
 	// "..." 보다 '.' 문자가 더 많다면 에러를 발생 시킵니다..
-	return { Token::Type::INVALID, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), _currentLine, _currentIndex };
+	return { Token::Type::INVALID, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), GetSourceOffset(firstLetterPosition) };
 }
 
 inline const mcf::Token::Data mcf::Lexer::Object::ReadMacroToken( void ) noexcept
@@ -602,7 +1312,7 @@ inline const mcf::Token::Data mcf::Lexer::Object::ReadMacroToken( void ) noexcep
 		ReadNextByte();
 	}
 
-	std::string macroType = _input.substr( firstLetterPosition, _currentPosition - firstLetterPosition );
+	const std::string_view macroType = _input.substr( firstLetterPosition, _currentPosition - firstLetterPosition );
 	for (size_t i = 0; i < MACRO_START_WITH_SIZE; i++)
 	{
 		if (macroType == MACRO_START_WITH[i])
@@ -617,7 +1327,7 @@ inline const mcf::Token::Data mcf::Lexer::Object::ReadMacroToken( void ) noexcep
 	switch (tokenType)
 	{
 	case Token::Type::MACRO_INCLUDE: __COUNTER__;
-		return { Token::Type::MACRO_INCLUDE, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), _currentLine, _currentIndex };
+		return { Token::Type::MACRO_INCLUDE, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), GetSourceOffset(firstLetterPosition) };
 
 	case Token::Type::INVALID:
 		break;
@@ -630,7 +1340,7 @@ inline const mcf::Token::Data mcf::Lexer::Object::ReadMacroToken( void ) noexcep
 	static_assert(ENUM_INDEX(Token::Type::MACRO_END) - ENUM_INDEX(Token::Type::MACRO_START) - 1 == MACRO_COUNT,
 		"macro TokenType count is changed. this switch need to be changed as well.");
 
-	return { Token::Type::INVALID, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), _currentLine, _currentIndex };
+	return { Token::Type::INVALID, _input.substr(firstLetterPosition, _currentPosition - firstLetterPosition), GetSourceOffset(firstLetterPosition) };
 }
 
 inline const mcf::Token::Data mcf::Lexer::Object::ReadNumeric(void) noexcept
@@ -639,18 +1349,357 @@ inline const mcf::Token::Data mcf::Lexer::Object::ReadNumeric(void) noexcept
 
 	mcf::Token::Data token;
 
+	token.Offset = GetSourceOffset(_currentPosition);
 	token.Literal = ReadNumber();
 	token.Type = Token::Type::INTEGER; // 타입이 명시되지 않은 정수 리터럴의 기본 값은 64bit integer 입니다.
 
 	// TODO: #8 0x (16진수), 0 (8진수), 또는 0b (2진수) 숫자의 토큰을 생성 가능하게 개선 필요
 	// TODO: #9 decimal 토큰을 생성 가능하게 개선 필요
-	token.Line = _currentLine;
-	token.Index = _currentIndex;
 	return token;
 }
 
-const mcf::Token::Type mcf::Lexer::Object::DetermineKeywordOrIdentifier(const std::string& tokenLiteral) noexcept
+const mcf::Token::Type mcf::Lexer::Object::DetermineKeywordOrIdentifier(const std::string_view tokenLiteral) noexcept
 {
-	const mcf::Token::Type tokenFound = Token::FindPredefinedKeyword(tokenLiteral).Type;
+	const mcf::Token::Type tokenFound = Token::FindPredefinedKeyword(tokenLiteral);
 	return tokenFound != Token::Type::INVALID ? tokenFound : mcf::Token::Type::IDENTIFIER;
-}
\ No newline at end of file
+}
+
+const mcf::Lexer::StreamReader mcf::Lexer::MakeStreamReader(std::istream& stream) noexcept
+{
+	return [&stream](char* const buffer, const size_t size) -> size_t
+	{
+		// 파이프처럼 한번에 채워지지 않는 스트림에서는 이미 도착한 입력만 읽고 돌려줍니다.
+		std::streamsize readSize = stream.readsome(buffer, static_cast<std::streamsize>(size));
+		if (readSize == 0 && stream.good())
+		{
+			stream.read(buffer, 1);
+			readSize = stream.gcount();
+		}
+		if (stream.bad())
+		{
+			return mcf::Lexer::STREAM_READ_ERROR;
+		}
+		return static_cast<size_t>(readSize);
+	};
+}
+
+const mcf::Lexer::StreamReader mcf::Lexer::MakeFileDescriptorReader(const int fileDescriptor) noexcept
+{
+	return [fileDescriptor](char* const buffer, const size_t size) -> size_t
+	{
+#if defined(_WIN32)
+		const int readSize = _read(fileDescriptor, buffer, static_cast<unsigned int>(std::min<size_t>(size, INT_MAX)));
+		return (readSize < 0) ? mcf::Lexer::STREAM_READ_ERROR : static_cast<size_t>(readSize);
+#else
+		for (;;)
+		{
+			const ssize_t readSize = read(fileDescriptor, buffer, size);
+			if (readSize >= 0)
+			{
+				return static_cast<size_t>(readSize);
+			}
+			if (errno != EINTR)
+			{
+				return mcf::Lexer::STREAM_READ_ERROR;
+			}
+		}
+#endif
+	};
+}
+
+namespace mcf
+{
+	namespace Lexer
+	{
+		namespace Internal
+		{
+			inline static const bool IS_WHITESPACE(const char byte) noexcept
+			{
+				return byte == ' ' || byte == '\t' || byte == '\n' || byte == '\r';
+			}
+
+			// 뒤에 입력이 더 이어질 수 있는 input 에서 렉서가 토큰 사이에 있게 되는 마지막 위치를 찾습니다. 찾지 못하면 0 을 반환합니다.
+			// 문자열, 주석을 판단하는 규칙은 FIND_SAFE_SPLIT_POSITIONS 와 같으며, 끝나지 않은 문자열과 주석, 다음 바이트를 봐야 하는 마지막 '/' 는 나누지 않습니다.
+			// 줄바꿈이 없는 긴 줄도 나눌 수 있도록 마지막 문자열, 주석 뒤의 구간에서는 공백 바로 다음 위치도 사용합니다. 입력에 '\0' 이 없어야 합니다.
+			static const size_t FIND_LAST_STREAM_SPLIT_POSITION(const std::string_view input) noexcept
+			{
+				const char* const data = input.data();
+				const size_t length = input.length();
+				size_t lastSplitPosition = 0;
+				size_t position = 0;
+				size_t tailEnd = length;
+				while (position < length)
+				{
+					const size_t foundPosition = FindAnyOf(data, position, length, '"', '/', '\n');
+					if (foundPosition >= length)
+					{
+						break;
+					}
+
+					size_t nextPosition = length;
+					switch (data[foundPosition])
+					{
+					case '\n':
+						nextPosition = foundPosition + 1;
+						lastSplitPosition = nextPosition;
+						break;
+
+					case '"':
+						// ReadStringUtf8 은 여는 '"' 바로 다음 바이트를 검사하지 않고 읽으므로 같은 규칙을 따릅니다.
+						if (foundPosition + 1 < length && data[foundPosition + 1] == '"')
+						{
+							nextPosition = foundPosition + 2;
+							lastSplitPosition = nextPosition;
+						}
+						else if (foundPosition + 1 < length)
+						{
+							const size_t stringEnd = FindAnyOf(data, foundPosition + 2, length, '"', '\n', '\r');
+							nextPosition = (stringEnd < length && data[stringEnd] == '"') ? stringEnd + 1 : stringEnd;
+							lastSplitPosition = (stringEnd < length && data[stringEnd] == '"') ? nextPosition : lastSplitPosition;
+						}
+						break;
+
+					case '/':
+						if (foundPosition + 1 < length && data[foundPosition + 1] == '/')
+						{
+							nextPosition = FindLineEnd(data, foundPosition + 2, length);
+							lastSplitPosition = (nextPosition < length) ? nextPosition : lastSplitPosition;
+						}
+						else if (foundPosition + 1 < length && data[foundPosition + 1] == '*')
+						{
+							const size_t commentEnd = FindBlockCommentEnd(data, foundPosition + 2, length);
+							nextPosition = (commentEnd + 2 <= length) ? commentEnd + 2 : length;
+							lastSplitPosition = (commentEnd + 2 <= length) ? nextPosition : lastSplitPosition;
+						}
+						else if (foundPosition + 1 < length)
+						{
+							nextPosition = foundPosition + 1;
+							lastSplitPosition = nextPosition;
+						}
+						break;
+
+					default:
+						MCF_DEBUG_BREAK(u8"예상하지 못한 문자입니다. 문자=%c, 값=%d", data[foundPosition], data[foundPosition]);
+						nextPosition = foundPosition + 1;
+						break;
+					}
+
+					// 입력의 끝까지 이어지는 문자열이나 주석은 뒤에 입력이 더 필요합니다.
+					if (nextPosition >= length && lastSplitPosition < length)
+					{
+						tailEnd = foundPosition;
+						break;
+					}
+					position = nextPosition;
+				}
+
+				// [position, tailEnd) 구간에는 문자열과 주석이 없으므로 공백 바로 다음은 항상 토큰 사이입니다.
+				for (size_t i = tailEnd; i > position && i > lastSplitPosition; --i)
+				{
+					if (IS_WHITESPACE(data[i - 1]))
+					{
+						return i;
+					}
+				}
+				return lastSplitPosition;
+			}
+		}
+	}
+}
+
+mcf::Lexer::StreamObject::StreamObject(const std::string& name, const mcf::Lexer::StreamReader& reader, const size_t chunkSize) noexcept
+	: _name(name)
+	, _reader(reader)
+	, _chunkSize((chunkSize != 0) ? chunkSize : mcf::Lexer::DEFAULT_STREAM_CHUNK_SIZE)
+{
+	if (_reader == nullptr)
+	{
+		_tokens.push(Error::FAIL_READ_FILE);
+		_isEndOfStream = true;
+	}
+}
+
+const mcf::Lexer::Error mcf::Lexer::StreamObject::GetLastErrorToken(void) noexcept
+{
+	if (_tokens.empty())
+	{
+		return Error::SUCCESS;
+	}
+
+	const Error lError = _tokens.top();
+	_tokens.pop();
+	return lError;
+}
+
+const size_t mcf::Lexer::StreamObject::GetBufferedSize(void) const noexcept
+{
+	return ((_segmentSource == nullptr) ? 0 : _segmentSource->GetView().length()) + GetPendingInput().length();
+}
+
+const size_t mcf::Lexer::StreamObject::GetLine(const std::uint32_t offset) const noexcept
+{
+	MCF_DEBUG_ASSERT(offset >= _segmentOffset, u8"지나간 세그먼트의 위치는 계산할 수 없습니다. offset=%u, segmentOffset=%u", offset, _segmentOffset);
+	return _previousNewLineCount + Internal::CALCULATE_LINE(_newLineOffsets, offset);
+}
+
+const size_t mcf::Lexer::StreamObject::GetIndex(const std::uint32_t offset) const noexcept
+{
+	MCF_DEBUG_ASSERT(offset >= _segmentOffset, u8"지나간 세그먼트의 위치는 계산할 수 없습니다. offset=%u, segmentOffset=%u", offset, _segmentOffset);
+	if (_newLineOffsets.empty() == false && _newLineOffsets.front() < offset)
+	{
+		return Internal::CALCULATE_INDEX(_newLineOffsets, offset);
+	}
+	// 세그먼트의 첫 줄은 앞 세그먼트에서 시작했을 수 있으므로 앞에 있는 마지막 줄바꿈을 기준으로 계산합니다.
+	return (_previousNewLineCount == 0) ? offset : offset - _previousNewLineOffset;
+}
+
+const mcf::Token::Data mcf::Lexer::StreamObject::ReadNextToken(void) noexcept
+{
+	for (;;)
+	{
+		if (_segmentLexer != nullptr)
+		{
+			mcf::Token::Data token = _segmentLexer->ReadNextToken();
+			if (token.Type != mcf::Token::Type::END_OF_FILE)
+			{
+				// 세그먼트 렉서의 오프셋은 세그먼트의 첫 바이트를 0 으로 계산한 값입니다.
+				token.Offset += _segmentOffset;
+				return token;
+			}
+			_segmentLexer.reset();
+		}
+
+		if (LoadNextSegment() == false)
+		{
+			const size_t segmentLength = (_segmentSource == nullptr) ? 0 : _segmentSource->GetView().length();
+			return { mcf::Token::Type::END_OF_FILE, "\0", static_cast<std::uint32_t>(_segmentOffset + segmentLength) };
+		}
+	}
+}
+
+void mcf::Lexer::StreamObject::ReadChunk(const size_t size, const size_t minimumSize) noexcept
+{
+	MCF_DEBUG_ASSERT(minimumSize <= size, u8"minimumSize 는 size 보다 클 수 없습니다. size=%zu, minimumSize=%zu", size, minimumSize);
+
+	// 세그먼트로 만든 앞쪽 입력을 버립니다. 옮기는 남은 입력은 이번에 읽는 크기(size) 이하이므로 옮기는 총량은 읽은 입력의 크기에 비례합니다.
+	if (_pendingBegin != 0)
+	{
+		_pendingBuffer.erase(0, _pendingBegin);
+		_pendingBegin = 0;
+	}
+
+	const size_t offset = _pendingBuffer.length();
+	_pendingBuffer.resize(offset + size);
+	size_t filledSize = 0;
+	while (filledSize < minimumSize)
+	{
+		const size_t readSize = _reader(_pendingBuffer.data() + offset + filledSize, size - filledSize);
+		if (readSize == mcf::Lexer::STREAM_READ_ERROR || readSize > size - filledSize)
+		{
+			_tokens.push(Error::FAIL_READ_FILE);
+			_isEndOfStream = true;
+			break;
+		}
+		if (readSize == 0)
+		{
+			_isEndOfStream = true;
+			break;
+		}
+		filledSize += readSize;
+	}
+	_pendingBuffer.resize(offset + filledSize);
+
+	// 렉서는 '\0' 을 입력의 끝으로 처리하므로 그 뒤의 입력은 읽지 않습니다.
+	const size_t nullPosition = _pendingBuffer.find('\0', offset);
+	if (nullPosition != std::string::npos)
+	{
+		_pendingBuffer.resize(nullPosition);
+		_isEndOfStream = true;
+	}
+}
+
+const bool mcf::Lexer::StreamObject::LoadNextSegment(void) noexcept
+{
+	constexpr const char UTF8_BOM[] = { '\xef', '\xbb', '\xbf' };
+	constexpr const size_t UTF8_BOM_SIZE = MCF_ARRAY_SIZE(UTF8_BOM);
+
+	for (;;)
+	{
+		if (_isEndOfStream == false)
+		{
+			// 남은 입력은 나눌 위치 뒤의 입력이므로, 같은 입력을 다시 검사하기 전에 남은 입력보다 많이 읽습니다.
+			// reader 가 조금씩 반환하더라도 검사할 때마다 입력이 두배 이상이 되므로 검사하는 총량은 입력의 크기에 비례합니다.
+			const size_t pendingLength = GetPendingInput().length();
+			ReadChunk(std::max(_chunkSize, pendingLength), std::max<size_t>(pendingLength, 1));
+		}
+
+		if (_isBOMChecked == false)
+		{
+			if (_isEndOfStream == false && GetPendingInput().length() < UTF8_BOM_SIZE)
+			{
+				continue;
+			}
+			if (GetPendingInput().compare(0, UTF8_BOM_SIZE, std::string_view(UTF8_BOM, UTF8_BOM_SIZE)) == 0)
+			{
+				_pendingBegin += UTF8_BOM_SIZE;
+			}
+			_isBOMChecked = true;
+		}
+
+		const std::string_view pendingInput = GetPendingInput();
+		if (pendingInput.empty())
+		{
+			if (_isEndOfStream == false)
+			{
+				continue;
+			}
+
+			// Object 와 같이 빈 입력은 에러로 처리합니다.
+			if (_segmentSource == nullptr && _tokens.empty())
+			{
+				_tokens.push(Error::INVALID_INPUT_LENGTH);
+			}
+			return false;
+		}
+
+		const size_t splitPosition = _isEndOfStream ? pendingInput.length() : Internal::FIND_LAST_STREAM_SPLIT_POSITION(pendingInput);
+		if (splitPosition == 0)
+		{
+			continue;
+		}
+
+		// 다음 세그먼트는 이전 세그먼트가 끝난 위치에서 시작합니다. 토큰의 위치는 32비트이므로 4GB 를 넘는 스트림은 거기서 멈추고 에러로 처리합니다.
+		const size_t segmentOffset = static_cast<size_t>(_segmentOffset) + ((_segmentSource == nullptr) ? 0 : _segmentSource->GetView().length());
+		if (segmentOffset + splitPosition > UINT32_MAX)
+		{
+			_tokens.push(Error::INVALID_INPUT_LENGTH);
+			_pendingBuffer.clear();
+			_pendingBegin = 0;
+			_isEndOfStream = true;
+			return false;
+		}
+		_segmentOffset = static_cast<std::uint32_t>(segmentOffset);
+
+		// 세그먼트의 토큰은 다음 세그먼트로 넘어간 뒤에도 유효해야 하므로 세그먼트는 자신의 버퍼로 복사합니다.
+		_segmentSource = mcf::Lexer::SourceBuffer::MakeFromString(std::string(pendingInput.substr(0, splitPosition)));
+		_pendingBegin += splitPosition;
+
+		// 지나간 세그먼트의 줄바꿈은 갯수와 마지막 위치만 남깁니다.
+		if (_newLineOffsets.empty() == false)
+		{
+			_previousNewLineCount += _newLineOffsets.size();
+			_previousNewLineOffset = _newLineOffsets.back();
+			_newLineOffsets.clear();
+		}
+		const std::string_view segmentView = _segmentSource->GetView();
+		Internal::FindNewLines(segmentView.data(), 0, segmentView.length(), _newLineOffsets);
+		for (std::uint32_t& newLineOffset : _newLineOffsets)
+		{
+			newLineOffset += _segmentOffset;
+		}
+
+		_segmentLexer = std::make_unique<mcf::Lexer::Object>(_name, _segmentSource);
+		_segmentLexer->SetSymbolTable(_symbols);
+		return true;
+	}
+}
@@ -0,0 +1,423 @@
+﻿#include "pch.h"
+#include "internal_lexer.h"
+
+#include <atomic>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define MCF_LEXER_SCANNER_X86
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define MCF_LEXER_SCANNER_TARGET_AVX2
+#else
+#define MCF_LEXER_SCANNER_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace mcf
+{
+	namespace Lexer
+	{
+		namespace Internal
+		{
+			inline static const std::uint32_t COUNT_TRAILING_ZERO(const std::uint32_t mask) noexcept
+			{
+				MCF_DEBUG_ASSERT(mask != 0, u8"mask 는 0 이 될 수 없습니다.");
+#if defined(_MSC_VER)
+				unsigned long index = 0;
+				_BitScanForward(&index, mask);
+				return static_cast<std::uint32_t>(index);
+#else
+				return static_cast<std::uint32_t>(__builtin_ctz(mask));
+#endif
+			}
+
+			constexpr static const bool IS_WHITESPACE(const char byte) noexcept
+			{
+				return byte == ' ' || byte == '\t' || byte == '\r' || byte == '\n';
+			}
+
+			// 스칼라 스캐너는 SIMD 스캐너의 남은 꼬리 부분을 처리하는데도 사용됩니다.
+			inline static const size_t SkipWhitespaceScalar(const char* const input, const size_t begin, const size_t end) noexcept
+			{
+				size_t position = begin;
+				while (position < end && IS_WHITESPACE(input[position]))
+				{
+					++position;
+				}
+				return position;
+			}
+
+			inline static const size_t FindAnyOfScalar(const char* const input, const size_t begin, const size_t end, const char first, const char second, const char third) noexcept
+			{
+				size_t position = begin;
+				for (; position < end; ++position)
+				{
+					const char byte = input[position];
+					if (byte == first || byte == second || byte == third)
+					{
+						break;
+					}
+				}
+				return position;
+			}
+
+			inline static void FindNewLinesScalar(const char* const input, const size_t begin, const size_t end, std::vector<std::uint32_t>& outPositions) noexcept
+			{
+				for (size_t position = begin; position < end; ++position)
+				{
+					if (input[position] == '\n')
+					{
+						outPositions.emplace_back(static_cast<std::uint32_t>(position));
+					}
+				}
+			}
+
+			// newLineMask 의 모든 비트를 chunkBegin 기준 위치로 바꾸어 추가합니다.
+			inline static void APPEND_NEW_LINES(const size_t chunkBegin, std::uint32_t newLineMask, std::vector<std::uint32_t>& outPositions) noexcept
+			{
+				while (newLineMask != 0)
+				{
+					outPositions.emplace_back(static_cast<std::uint32_t>(chunkBegin + COUNT_TRAILING_ZERO(newLineMask)));
+					newLineMask &= newLineMask - 1;
+				}
+			}
+
+#if defined(MCF_LEXER_SCANNER_X86)
+			static const size_t SkipWhitespaceSSE2(const char* const input, const size_t begin, const size_t end) noexcept
+			{
+				constexpr const size_t CHUNK_SIZE = 16;
+				const __m128i space = _mm_set1_epi8(' ');
+				const __m128i tab = _mm_set1_epi8('\t');
+				const __m128i carriageReturn = _mm_set1_epi8('\r');
+				const __m128i newLine = _mm_set1_epi8('\n');
+
+				size_t position = begin;
+				for (; position + CHUNK_SIZE <= end; position += CHUNK_SIZE)
+				{
+					const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + position));
+					const __m128i whitespaceBytes = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, tab)),
+						_mm_or_si128(_mm_cmpeq_epi8(chunk, carriageReturn), _mm_cmpeq_epi8(chunk, newLine)));
+
+					const std::uint32_t stopMask = ~static_cast<std::uint32_t>(_mm_movemask_epi8(whitespaceBytes)) & 0xffffu;
+					if (stopMask != 0)
+					{
+						return position + COUNT_TRAILING_ZERO(stopMask);
+					}
+				}
+				return SkipWhitespaceScalar(input, position, end);
+			}
+
+			static const size_t FindAnyOfSSE2(const char* const input, const size_t begin, const size_t end, const char first, const char second, const char third) noexcept
+			{
+				constexpr const size_t CHUNK_SIZE = 16;
+				const __m128i firstBytes = _mm_set1_epi8(first);
+				const __m128i secondBytes = _mm_set1_epi8(second);
+				const __m128i thirdBytes = _mm_set1_epi8(third);
+
+				size_t position = begin;
+				for (; position + CHUNK_SIZE <= end; position += CHUNK_SIZE)
+				{
+					const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + position));
+					const __m128i stopBytes = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, firstBytes), _mm_cmpeq_epi8(chunk, secondBytes)), _mm_cmpeq_epi8(chunk, thirdBytes));
+
+					const std::uint32_t stopMask = static_cast<std::uint32_t>(_mm_movemask_epi8(stopBytes));
+					if (stopMask != 0)
+					{
+						return position + COUNT_TRAILING_ZERO(stopMask);
+					}
+				}
+				return FindAnyOfScalar(input, position, end, first, second, third);
+			}
+
+			static void FindNewLinesSSE2(const char* const input, const size_t begin, const size_t end, std::vector<std::uint32_t>& outPositions) noexcept
+			{
+				constexpr const size_t CHUNK_SIZE = 16;
+				const __m128i newLine = _mm_set1_epi8('\n');
+
+				size_t position = begin;
+				for (; position + CHUNK_SIZE <= end; position += CHUNK_SIZE)
+				{
+					const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + position));
+					APPEND_NEW_LINES(position, static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, newLine))), outPositions);
+				}
+				FindNewLinesScalar(input, position, end, outPositions);
+			}
+
+			MCF_LEXER_SCANNER_TARGET_AVX2 static const size_t SkipWhitespaceAVX2(const char* const input, const size_t begin, const size_t end) noexcept
+			{
+				constexpr const size_t CHUNK_SIZE = 32;
+				const __m256i space = _mm256_set1_epi8(' ');
+				const __m256i tab = _mm256_set1_epi8('\t');
+				const __m256i carriageReturn = _mm256_set1_epi8('\r');
+				const __m256i newLine = _mm256_set1_epi8('\n');
+
+				size_t position = begin;
+				for (; position + CHUNK_SIZE <= end; position += CHUNK_SIZE)
+				{
+					const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + position));
+					const __m256i whitespaceBytes = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, space), _mm256_cmpeq_epi8(chunk, tab)),
+						_mm256_or_si256(_mm256_cmpeq_epi8(chunk, carriageReturn), _mm256_cmpeq_epi8(chunk, newLine)));
+
+					const std::uint32_t stopMask = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(whitespaceBytes));
+					if (stopMask != 0)
+					{
+						return position + COUNT_TRAILING_ZERO(stopMask);
+					}
+				}
+				return SkipWhitespaceSSE2(input, position, end);
+			}
+
+			MCF_LEXER_SCANNER_TARGET_AVX2 static const size_t FindAnyOfAVX2(const char* const input, const size_t begin, const size_t end, const char first, const char second, const char third) noexcept
+			{
+				constexpr const size_t CHUNK_SIZE = 32;
+				const __m256i firstBytes = _mm256_set1_epi8(first);
+				const __m256i secondBytes = _mm256_set1_epi8(second);
+				const __m256i thirdBytes = _mm256_set1_epi8(third);
+
+				size_t position = begin;
+				for (; position + CHUNK_SIZE <= end; position += CHUNK_SIZE)
+				{
+					const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + position));
+					const __m256i stopBytes = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, firstBytes), _mm256_cmpeq_epi8(chunk, secondBytes)), _mm256_cmpeq_epi8(chunk, thirdBytes));
+
+					const std::uint32_t stopMask = static_cast<std::uint32_t>(_mm256_movemask_epi8(stopBytes));
+					if (stopMask != 0)
+					{
+						return position + COUNT_TRAILING_ZERO(stopMask);
+					}
+				}
+				return FindAnyOfSSE2(input, position, end, first, second, third);
+			}
+
+			MCF_LEXER_SCANNER_TARGET_AVX2 static void FindNewLinesAVX2(const char* const input, const size_t begin, const size_t end, std::vector<std::uint32_t>& outPositions) noexcept
+			{
+				constexpr const size_t CHUNK_SIZE = 32;
+				const __m256i newLine = _mm256_set1_epi8('\n');
+
+				size_t position = begin;
+				for (; position + CHUNK_SIZE <= end; position += CHUNK_SIZE)
+				{
+					const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + position));
+					APPEND_NEW_LINES(position, static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, newLine))), outPositions);
+				}
+				FindNewLinesSSE2(input, position, end, outPositions);
+			}
+#endif
+
+			using SkipWhitespaceFunction = const size_t(*)(const char* const, const size_t, const size_t) noexcept;
+			using FindAnyOfFunction = const size_t(*)(const char* const, const size_t, const size_t, const char, const char, const char) noexcept;
+			using FindNewLinesFunction = void(*)(const char* const, const size_t, const size_t, std::vector<std::uint32_t>&) noexcept;
+
+			struct ScannerFunctions final
+			{
+				SkipWhitespaceFunction SkipWhitespace;
+				FindAnyOfFunction FindAnyOf;
+				FindNewLinesFunction FindNewLines;
+			};
+
+			constexpr const ScannerFunctions SCANNER_FUNCTIONS[] =
+			{
+				{ nullptr, nullptr, nullptr }, // INVALID
+				{ SkipWhitespaceScalar, FindAnyOfScalar, FindNewLinesScalar }, // SCALAR
+#if defined(MCF_LEXER_SCANNER_X86)
+				{ SkipWhitespaceSSE2, FindAnyOfSSE2, FindNewLinesSSE2 }, // SSE2
+				{ SkipWhitespaceAVX2, FindAnyOfAVX2, FindNewLinesAVX2 }, // AVX2
+#else
+				{ nullptr, nullptr, nullptr }, // SSE2
+				{ nullptr, nullptr, nullptr }, // AVX2
+#endif
+			};
+			static_assert(MCF_ARRAY_SIZE(SCANNER_FUNCTIONS) == mcf::ENUM_COUNT<mcf::Lexer::Scanner>(), "Scanner count is changed. this array need to be changed as well.");
+
+			static const bool IS_SCANNER_SUPPORTED(const mcf::Lexer::Scanner scanner) noexcept
+			{
+				constexpr const size_t SCANNER_COUNT_BEGIN = __COUNTER__;
+				switch (scanner)
+				{
+				case mcf::Lexer::Scanner::INVALID: __COUNTER__;
+					return false;
+
+				case mcf::Lexer::Scanner::SCALAR: __COUNTER__;
+					return true;
+
+				case mcf::Lexer::Scanner::SSE2: __COUNTER__;
+#if defined(_M_X64) || defined(__x86_64__)
+					// x64 CPU 는 항상 SSE2 를 지원합니다.
+					return true;
+#elif defined(MCF_LEXER_SCANNER_X86) && defined(_MSC_VER)
+				{
+					int cpuInfo[4] = { 0 };
+					__cpuid(cpuInfo, 1);
+					constexpr const int SSE2_BIT = 1 << 26;
+					return (cpuInfo[3] & SSE2_BIT) != 0;
+				}
+#elif defined(MCF_LEXER_SCANNER_X86)
+					return __builtin_cpu_supports("sse2");
+#else
+					return false;
+#endif
+
+				case mcf::Lexer::Scanner::AVX2: __COUNTER__;
+#if defined(MCF_LEXER_SCANNER_X86) && defined(_MSC_VER)
+				{
+					int cpuInfo[4] = { 0 };
+					__cpuid(cpuInfo, 0);
+					if (cpuInfo[0] < 7)
+					{
+						return false;
+					}
+
+					// 운영체제가 YMM 레지스터를 저장(OSXSAVE)하는지도 확인하여야 합니다.
+					__cpuid(cpuInfo, 1);
+					constexpr const int OSXSAVE_BIT = 1 << 27;
+					constexpr const int AVX_BIT = 1 << 28;
+					if ((cpuInfo[2] & OSXSAVE_BIT) == 0 || (cpuInfo[2] & AVX_BIT) == 0)
+					{
+						return false;
+					}
+					constexpr const std::uint64_t XMM_YMM_STATE = 0x6;
+					if ((_xgetbv(0) & XMM_YMM_STATE) != XMM_YMM_STATE)
+					{
+						return false;
+					}
+
+					__cpuidex(cpuInfo, 7, 0);
+					constexpr const int AVX2_BIT = 1 << 5;
+					return (cpuInfo[1] & AVX2_BIT) != 0;
+				}
+#elif defined(MCF_LEXER_SCANNER_X86)
+					return __builtin_cpu_supports("avx2");
+#else
+					return false;
+#endif
+
+				default:
+					MCF_DEBUG_TODO(u8"구현이 필요합니다.");
+					break;
+				}
+				constexpr const size_t SCANNER_COUNT = __COUNTER__ - SCANNER_COUNT_BEGIN - 1;
+				static_assert(static_cast<size_t>(mcf::Lexer::Scanner::COUNT) == SCANNER_COUNT, "Scanner count is changed. this SWITCH need to be changed as well.");
+				return false;
+			}
+
+			static const mcf::Lexer::Scanner DETECT_SCANNER(void) noexcept
+			{
+				if (IS_SCANNER_SUPPORTED(mcf::Lexer::Scanner::AVX2))
+				{
+					return mcf::Lexer::Scanner::AVX2;
+				}
+				if (IS_SCANNER_SUPPORTED(mcf::Lexer::Scanner::SSE2))
+				{
+					return mcf::Lexer::Scanner::SSE2;
+				}
+				return mcf::Lexer::Scanner::SCALAR;
+			}
+
+			static const size_t SkipWhitespaceDetecting(const char* const input, const size_t begin, const size_t end) noexcept;
+			static const size_t FindAnyOfDetecting(const char* const input, const size_t begin, const size_t end, const char first, const char second, const char third) noexcept;
+			static void FindNewLinesDetecting(const char* const input, const size_t begin, const size_t end, std::vector<std::uint32_t>& outPositions) noexcept;
+
+			// 스캐너를 고르기 전에 사용하는 함수들입니다. 처음 호출될 때 스캐너를 고른 뒤 고른 스캐너의 함수를 호출합니다.
+			constexpr const ScannerFunctions DETECTING_SCANNER_FUNCTIONS = { SkipWhitespaceDetecting, FindAnyOfDetecting, FindNewLinesDetecting };
+
+			// 상수로 초기화되므로 정적 초기화 순서와 상관없이 사용할 수 있고, 호출할 때마다 relaxed load 한번으로 스캐너의 함수를 찾습니다.
+			static std::atomic<const ScannerFunctions*> CurrentScannerFunctions(&DETECTING_SCANNER_FUNCTIONS);
+
+			static const mcf::Lexer::Internal::ScannerFunctions& DETECT_SCANNER_FUNCTIONS(void) noexcept
+			{
+				// SetScanner 로 먼저 정한 스캐너가 있으면 그대로 사용합니다.
+				const ScannerFunctions* expected = &DETECTING_SCANNER_FUNCTIONS;
+				CurrentScannerFunctions.compare_exchange_strong(expected, &SCANNER_FUNCTIONS[mcf::ENUM_INDEX(DETECT_SCANNER())], std::memory_order_relaxed);
+				return *CurrentScannerFunctions.load(std::memory_order_relaxed);
+			}
+
+			static const size_t SkipWhitespaceDetecting(const char* const input, const size_t begin, const size_t end) noexcept
+			{
+				return DETECT_SCANNER_FUNCTIONS().SkipWhitespace(input, begin, end);
+			}
+
+			static const size_t FindAnyOfDetecting(const char* const input, const size_t begin, const size_t end, const char first, const char second, const char third) noexcept
+			{
+				return DETECT_SCANNER_FUNCTIONS().FindAnyOf(input, begin, end, first, second, third);
+			}
+
+			static void FindNewLinesDetecting(const char* const input, const size_t begin, const size_t end, std::vector<std::uint32_t>& outPositions) noexcept
+			{
+				DETECT_SCANNER_FUNCTIONS().FindNewLines(input, begin, end, outPositions);
+			}
+
+			inline static const mcf::Lexer::Internal::ScannerFunctions& GET_SCANNER_FUNCTIONS(void) noexcept
+			{
+				return *CurrentScannerFunctions.load(std::memory_order_relaxed);
+			}
+		}
+	}
+}
+
+const mcf::Lexer::Scanner mcf::Lexer::GetScanner(void) noexcept
+{
+	const Internal::ScannerFunctions* functions = Internal::CurrentScannerFunctions.load(std::memory_order_relaxed);
+	if (functions == &Internal::DETECTING_SCANNER_FUNCTIONS)
+	{
+		functions = &Internal::DETECT_SCANNER_FUNCTIONS();
+	}
+	return static_cast<mcf::Lexer::Scanner>(functions - Internal::SCANNER_FUNCTIONS);
+}
+
+const bool mcf::Lexer::SetScanner(const mcf::Lexer::Scanner scanner) noexcept
+{
+	if (Internal::IS_SCANNER_SUPPORTED(scanner) == false)
+	{
+		return false;
+	}
+	Internal::CurrentScannerFunctions.store(&Internal::SCANNER_FUNCTIONS[mcf::ENUM_INDEX(scanner)], std::memory_order_relaxed);
+	return true;
+}
+
+const size_t mcf::Lexer::Internal::SkipWhitespace(_Notnull_ const char* const input, const size_t begin, const size_t end) noexcept
+{
+	MCF_DEBUG_ASSERT(begin <= end, u8"begin 은 end 보다 클 수 없습니다. begin=%zu, end=%zu", begin, end);
+	return GET_SCANNER_FUNCTIONS().SkipWhitespace(input, begin, end);
+}
+
+const size_t mcf::Lexer::Internal::FindAnyOf(_Notnull_ const char* const input, const size_t begin, const size_t end, const char first, const char second, const char third) noexcept
+{
+	MCF_DEBUG_ASSERT(begin <= end, u8"begin 은 end 보다 클 수 없습니다. begin=%zu, end=%zu", begin, end);
+	return GET_SCANNER_FUNCTIONS().FindAnyOf(input, begin, end, first, second, third);
+}
+
+const size_t mcf::Lexer::Internal::FindLineEnd(_Notnull_ const char* const input, const size_t begin, const size_t end) noexcept
+{
+	MCF_DEBUG_ASSERT(begin <= end, u8"begin 은 end 보다 클 수 없습니다. begin=%zu, end=%zu", begin, end);
+	return GET_SCANNER_FUNCTIONS().FindAnyOf(input, begin, end, '\r', '\n', '\0');
+}
+
+const size_t mcf::Lexer::Internal::FindBlockCommentEnd(_Notnull_ const char* const input, const size_t begin, const size_t end) noexcept
+{
+	MCF_DEBUG_ASSERT(begin <= end, u8"begin 은 end 보다 클 수 없습니다. begin=%zu, end=%zu", begin, end);
+
+	const FindAnyOfFunction findAnyOf = GET_SCANNER_FUNCTIONS().FindAnyOf;
+	size_t position = begin;
+	for (;;)
+	{
+		// '*' 를 찾은 뒤 바로 다음이 '/' 인지 확인합니다. 아니라면 '*' 다음부터 다시 찾습니다.
+		position = findAnyOf(input, position, end, '*', '\0', '*');
+		if (position == end || input[position] == '\0')
+		{
+			return position;
+		}
+		if (position + 1 < end && input[position + 1] == '/')
+		{
+			return position;
+		}
+		position += 1;
+	}
+}
+
+void mcf::Lexer::Internal::FindNewLines(_Notnull_ const char* const input, const size_t begin, const size_t end, std::vector<std::uint32_t>& outPositions) noexcept
+{
+	MCF_DEBUG_ASSERT(begin <= end && end <= UINT32_MAX, u8"범위가 올바르지 않습니다. begin=%zu, end=%zu", begin, end);
+	GET_SCANNER_FUNCTIONS().FindNewLines(input, begin, end, outPositions);
+}
@@ -1,8 +1,58 @@
 ﻿#include "pch.h"
 #include "object.h"
 
+#include <deque>
+#include <shared_mutex>
+
 namespace mcf
 {
+	namespace Object
+	{
+		namespace Internal
+		{
+			// 모든 타입 테이블이 함께 쓰는 상수 항목입니다. 수정되지 않으므로 여러 스코프 트리와 스레드에서 잠금 없이 읽을 수 있습니다.
+			static const mcf::Object::TypeEntry* GetVoidEntry(void) noexcept
+			{
+				static const mcf::Object::TypeEntry voidEntry;
+				return &voidEntry;
+			}
+
+			static const mcf::Object::TypeEntry* GetVariadicEntry(void) noexcept
+			{
+				static const mcf::Object::TypeEntry variadicEntry = []() -> mcf::Object::TypeEntry
+				{
+					mcf::Object::TypeEntry entry;
+					entry.IsVariadic = true;
+					entry.ID = mcf::Object::VARIADIC_TYPE_ID;
+					return entry;
+				}();
+				return &variadicEntry;
+			}
+
+			static const bool IsSameType(const mcf::Object::TypeEntry& lhs, const mcf::Object::TypeEntry& rhs) noexcept
+			{
+				return (lhs.ArraySizeList == rhs.ArraySizeList) &&
+					(lhs.Name == rhs.Name) &&
+					(lhs.IntrinsicSize == rhs.IntrinsicSize) &&
+					(lhs.IsStruct == rhs.IsStruct) &&
+					(lhs.IsUnsigned == rhs.IsUnsigned) &&
+					(lhs.IsVariadic == rhs.IsVariadic);
+			}
+
+			static const size_t HashType(const mcf::Object::TypeEntry& entry) noexcept
+			{
+				size_t hash = std::hash<std::string>()(entry.Name);
+				const size_t dimensionCount = entry.ArraySizeList.size();
+				for (size_t i = 0; i < dimensionCount; ++i)
+				{
+					hash = hash * 31 + entry.ArraySizeList[i];
+				}
+				hash = hash * 31 + entry.IntrinsicSize;
+				return hash * 8 + (entry.IsStruct ? 4 : 0) + (entry.IsUnsigned ? 2 : 0) + (entry.IsVariadic ? 1 : 0);
+			}
+		}
+	}
+
 	namespace IR
 	{
 		namespace ASM
@@ -38,6 +88,141 @@ namespace mcf
 	}
 }
 
+const mcf::Object::FunctionInfo& mcf::Object::FunctionInfo::GetInvalidFunctionInfo(void) noexcept
+{
+	static const mcf::Object::FunctionInfo invalidInfo;
+	return invalidInfo;
+}
+
+mcf::Object::TypeInfo::TypeInfo(void) noexcept
+	: _entry(Internal::GetVoidEntry())
+{
+}
+
+const mcf::Object::TypeInfo mcf::Object::TypeInfo::GetVariadicTypeInfo(void) noexcept
+{
+	return mcf::Object::TypeInfo(Internal::GetVariadicEntry());
+}
+
+const mcf::Object::TypeInfo mcf::Object::TypeInfo::Intern(const mcf::Object::TypeEntry& entry) const noexcept
+{
+	MCF_DEBUG_ASSERT(_entry->Table != nullptr, u8"void 또는 variadic 타입으로는 새 타입을 만들 수 없습니다.");
+	return _entry->Table->Intern(entry);
+}
+
+const mcf::Object::TypeInfo mcf::Object::TypeTable::MakePrimitive(const bool isUnsigned, const std::string& name, const size_t size, const std::vector<size_t>& arraySizeList) noexcept
+{
+	mcf::Object::TypeEntry entry;
+	entry.ArraySizeList = arraySizeList;
+	entry.Name = name;
+	entry.IntrinsicSize = size;
+	entry.IsUnsigned = isUnsigned;
+	return Intern(entry);
+}
+
+const mcf::Object::TypeInfo mcf::Object::TypeTable::Intern(const mcf::Object::TypeEntry& entry) noexcept
+{
+	if (Internal::IsSameType(*Internal::GetVoidEntry(), entry))
+	{
+		return mcf::Object::TypeInfo(Internal::GetVoidEntry());
+	}
+	if (Internal::IsSameType(*Internal::GetVariadicEntry(), entry))
+	{
+		return mcf::Object::TypeInfo(Internal::GetVariadicEntry());
+	}
+
+	// 대부분의 타입은 이미 등록되어 있으므로 공유 잠금으로 먼저 찾고, 없을 때만 배타 잠금을 잡은 뒤 다시 찾아서 등록합니다.
+	const size_t hash = Internal::HashType(entry);
+	{
+		std::shared_lock<std::shared_mutex> lock(_mutex);
+		const mcf::Object::TypeEntry* foundEntry = Find(hash, entry);
+		if (foundEntry != nullptr)
+		{
+			return mcf::Object::TypeInfo(foundEntry);
+		}
+	}
+
+	std::unique_lock<std::shared_mutex> lock(_mutex);
+	const mcf::Object::TypeEntry* foundEntry = Find(hash, entry);
+	if (foundEntry != nullptr)
+	{
+		return mcf::Object::TypeInfo(foundEntry);
+	}
+
+	MCF_DEBUG_ASSERT(_entries.size() + mcf::Object::VARIADIC_TYPE_ID < static_cast<size_t>(static_cast<mcf::Object::TypeID>(-1)), u8"타입 ID 가 32비트를 넘습니다.");
+	mcf::Object::TypeEntry& newEntry = _entries.emplace_back(entry);
+	newEntry.ID = static_cast<mcf::Object::TypeID>(_entries.size() + mcf::Object::VARIADIC_TYPE_ID);
+	newEntry.Table = this;
+	newEntry.Size = newEntry.IsVariadic ? 0 : newEntry.IntrinsicSize;
+	const size_t dimensionCount = newEntry.ArraySizeList.size();
+	for (size_t i = 0; i < dimensionCount && newEntry.IsVariadic == false; ++i)
+	{
+		newEntry.Size *= newEntry.ArraySizeList[i];
+	}
+	_entriesByHash.emplace(hash, &newEntry);
+	return mcf::Object::TypeInfo(&newEntry);
+}
+
+const size_t mcf::Object::TypeTable::GetCount(void) const noexcept
+{
+	std::shared_lock<std::shared_mutex> lock(_mutex);
+	return _entries.size();
+}
+
+const mcf::Object::TypeEntry* mcf::Object::TypeTable::Find(const size_t hash, const mcf::Object::TypeEntry& entry) const noexcept
+{
+	const auto range = _entriesByHash.equal_range(hash);
+	for (auto iter = range.first; iter != range.second; ++iter)
+	{
+		if (Internal::IsSameType(*iter->second, entry))
+		{
+			return iter->second;
+		}
+	}
+	return nullptr;
+}
+
+const mcf::Object::TypeInfo mcf::Object::TypeInfo::MakeArrayType(const size_t arraySize) const noexcept
+{
+	mcf::Object::TypeEntry entry = *_entry;
+	entry.ArraySizeList.emplace_back(arraySize);
+	return Intern(entry);
+}
+
+const mcf::Object::TypeInfo mcf::Object::TypeInfo::MakeArrayItemType(void) const noexcept
+{
+	MCF_DEBUG_ASSERT(IsArrayType(), u8"배열 타입이어야 합니다.");
+	mcf::Object::TypeEntry entry = *_entry;
+	entry.ArraySizeList.pop_back();
+	return Intern(entry);
+}
+
+const mcf::Object::TypeInfo mcf::Object::TypeInfo::MakeUnsignedType(void) const noexcept
+{
+	if (IsUnsigned())
+	{
+		return *this;
+	}
+	mcf::Object::TypeEntry entry = *_entry;
+	entry.IsUnsigned = true;
+	return Intern(entry);
+}
+
+const mcf::Object::TypeInfo mcf::Object::TypeInfo::MakeNamedType(const std::string& name) const noexcept
+{
+	mcf::Object::TypeEntry entry = *_entry;
+	entry.Name = name;
+	return Intern(entry);
+}
+
+const mcf::Object::TypeInfo mcf::Object::TypeInfo::MakeResizedArrayType(const std::vector<size_t>& arraySizeList) const noexcept
+{
+	MCF_DEBUG_ASSERT(arraySizeList.size() == GetArraySizeList().size(), u8"주어진 배열 차원 수가 기존 배열 차원수와 다릅니다.");
+	mcf::Object::TypeEntry entry = *_entry;
+	entry.ArraySizeList = arraySizeList;
+	return Intern(entry);
+}
+
 const bool mcf::Object::TypeInfo::IsStaticCastable(const TypeInfo& typeToCast) const noexcept
 {
 	MCF_DEBUG_ASSERT(IsValid() && typeToCast.IsValid(), u8"두 타입 모드 유효해야 합니다.");
@@ -47,7 +232,7 @@ const bool mcf::Object::TypeInfo::IsStaticCastable(const TypeInfo& typeToCast) c
 		return true;
 	}
 
-	if (IntrinsicSize != typeToCast.IntrinsicSize)
+	if (GetIntrinsicSize() != typeToCast.GetIntrinsicSize())
 	{
 		return false;
 	}
@@ -58,7 +243,7 @@ const bool mcf::Object::TypeInfo::IsStaticCastable(const TypeInfo& typeToCast) c
 	}
 
 	if (IsArrayType() && typeToCast.IsArrayType() && 
-		ArraySizeList.size() == typeToCast.ArraySizeList.size() &&
+		GetArraySizeList().size() == typeToCast.GetArraySizeList().size() &&
 		HasUnknownArrayIndex() == false && typeToCast.HasUnknownArrayIndex())
 	{
 		return true;
@@ -74,10 +259,10 @@ const bool mcf::Object::TypeInfo::IsStaticCastable(const TypeInfo& typeToCast) c
 
 const bool mcf::Object::TypeInfo::HasUnknownArrayIndex(void) const noexcept
 {
-	const size_t size = ArraySizeList.size();
+	const size_t size = _entry->ArraySizeList.size();
 	for (size_t i = 0; i < size; i++)
 	{
-		if (ArraySizeList[i] == 0)
+		if (_entry->ArraySizeList[i] == 0)
 		{
 			return true;
 		}
@@ -87,20 +272,14 @@ const bool mcf::Object::TypeInfo::HasUnknownArrayIndex(void) const noexcept
 
 const size_t mcf::Object::TypeInfo::GetSize(void) const noexcept
 {
-	MCF_DEBUG_ASSERT(IsVariadic == false, u8"variadic 은 사이즈를 알 수 없습니다.");
-	size_t totalSize = IntrinsicSize;
-	const size_t vectorCount = ArraySizeList.size();
-	for (size_t i = 0; i < vectorCount; ++i)
-	{
-		totalSize *= ArraySizeList[i];
-	}
-	return totalSize;
+	MCF_DEBUG_ASSERT(IsVariadic() == false, u8"variadic 은 사이즈를 알 수 없습니다.");
+	return _entry->Size;
 }
 
 const std::string mcf::Object::TypeInfo::Inspect(void) const noexcept
 {
 	MCF_DEBUG_ASSERT(IsValid(), u8"TypeInfo가 유효하지 않습니다.");
-	return IsVariadic ? "VARARG" : Name;
+	return IsVariadic() ? "VARARG" : GetName();
 }
 
 const std::string mcf::Object::Variable::Inspect(void) const noexcept
@@ -122,15 +301,13 @@ const bool mcf::Object::Scope::IsGlobalScope(void) const noexcept
 
 const bool mcf::Object::Scope::IsIdentifierRegistered(const std::string& name) const noexcept
 {
-	if (_allIdentifierSet.find(name) != _allIdentifierSet.end())
-	{
-		return true;
-	}
-	if (_parent == nullptr)
-	{
-		return false;
-	}
-	return _parent->IsIdentifierRegistered(name);
+	return IsIdentifierRegistered(FindSymbol(name));
+}
+
+const bool mcf::Object::Scope::IsIdentifierRegistered(const mcf::Symbol::ID symbol) const noexcept
+{
+	size_t bindingIndex = INVALID_BINDING_INDEX;
+	return FindOwnerScope(symbol, BindingKind::INVALID, bindingIndex) != nullptr;
 }
 
 const bool mcf::Object::Scope::DefineType(const std::string& name, const mcf::Object::TypeInfo& info) noexcept
@@ -138,39 +315,36 @@ const bool mcf::Object::Scope::DefineType(const std::string& name, const mcf::Ob
 	MCF_DEBUG_ASSERT(name.empty() == false, u8"이름이 비어 있으면 안됩니다.");
 	MCF_DEBUG_ASSERT(info.IsValid(), u8"함수 정보가 유효하지 않습니다.");
 
-	if (_allIdentifierSet.find(name) != _allIdentifierSet.end())
+	const mcf::Symbol::ID symbol = InternSymbol(name);
+	if (FindBindingIndex(symbol) != INVALID_BINDING_INDEX)
 	{
-		MCF_DEBUG_TODO(u8"구현 필요");
+		MCF_DEBUG_MESSAGE(u8"같은 스코프에 같은 이름의 식별자가 이미 있습니다. 함수[DefineType] 식별자[%s]", name.c_str());
 		return false;
 	}
 
-	_allIdentifierSet.emplace(name);
-	_typeInfoMap.emplace(name, info);
-
+	_types.emplace_back(info);
+	AddBinding(symbol, BindingKind::TYPE, _types.size() - 1);
 	return true;
 }
 
 const mcf::Object::TypeInfo mcf::Object::Scope::FindTypeInfo(const std::string& name) const noexcept
 {
 	MCF_DEBUG_ASSERT(name.empty() == false, u8"이름이 비어 있으면 안됩니다.");
+	return FindTypeInfo(FindSymbol(name));
+}
 
-	auto infoFound = _typeInfoMap.find(name);
-	if (infoFound == _typeInfoMap.end())
-	{
-		if (_parent == nullptr)
-		{
-			return mcf::Object::TypeInfo();
-		}
-		return _parent->FindTypeInfo(name);
-	}
-	return infoFound->second;
+const mcf::Object::TypeInfo mcf::Object::Scope::FindTypeInfo(const mcf::Symbol::ID symbol) const noexcept
+{
+	size_t bindingIndex = INVALID_BINDING_INDEX;
+	const Scope* owner = FindOwnerScope(symbol, BindingKind::TYPE, bindingIndex);
+	return owner == nullptr ? mcf::Object::TypeInfo() : owner->_types[owner->_bindings[bindingIndex].EntryIndex];
 }
 
 const bool mcf::Object::Scope::IsAllVariablesUsed(void) const noexcept
 {
-	for (auto pair : _variables)
+	for (const VariableEntry& entry : _variables)
 	{
-		if (pair.second.IsUsed == false)
+		if (entry.IsUsed.load() == false)
 		{
 			return false;
 		}
@@ -183,72 +357,88 @@ const mcf::Object::VariableInfo mcf::Object::Scope::DefineVariable(const std::st
 	MCF_DEBUG_ASSERT(name.empty() == false, u8"이름이 비어 있으면 안됩니다.");
 	MCF_DEBUG_ASSERT(variable.IsValid(), u8"변수 정보가 유효하지 않습니다.");
 
-	if (_allIdentifierSet.find(name) != _allIdentifierSet.end())
+	const mcf::Symbol::ID symbol = InternSymbol(name);
+	if (FindBindingIndex(symbol) != INVALID_BINDING_INDEX)
 	{
-		MCF_DEBUG_TODO(u8"구현 필요");
+		MCF_DEBUG_MESSAGE(u8"같은 스코프에 같은 이름의 식별자가 이미 있습니다. 함수[DefineVariable] 식별자[%s]", name.c_str());
 		return mcf::Object::VariableInfo();
 	}
 
-	_allIdentifierSet.emplace(name);
-	_variables.emplace(name, variable);
-
+	_variables.emplace_back(variable);
+	AddBinding(symbol, BindingKind::VARIABLE, _variables.size() - 1);
 	return { variable, _parent == nullptr };
 }
 
 const mcf::Object::VariableInfo mcf::Object::Scope::FindVariableInfo(const std::string& name) const noexcept
 {
 	MCF_DEBUG_ASSERT(name.empty() == false, u8"이름이 비어 있으면 안됩니다.");
+	return FindVariableInfo(FindSymbol(name));
+}
 
-	auto infoFound = _variables.find(name);
-	if (infoFound == _variables.end())
+const mcf::Object::VariableInfo mcf::Object::Scope::FindVariableInfo(const mcf::Symbol::ID symbol) const noexcept
+{
+	size_t bindingIndex = INVALID_BINDING_INDEX;
+	const Scope* owner = FindOwnerScope(symbol, BindingKind::VARIABLE, bindingIndex);
+	if (owner == nullptr)
 	{
-		if (_parent == nullptr)
-		{
-			return mcf::Object::VariableInfo();
-		}
-		return _parent->FindVariableInfo(name);
+		return mcf::Object::VariableInfo();
 	}
-	return { infoFound->second, _parent == nullptr };
+	const VariableEntry& entry = owner->_variables[owner->_bindings[bindingIndex].EntryIndex];
+	mcf::Object::VariableInfo info = { entry.Variable, owner->_parent == nullptr };
+	info.Variable.IsUsed = entry.IsUsed.load();
+	return info;
+}
+
+const bool mcf::Object::Scope::IsLocalVariable(const std::string& name) const noexcept
+{
+	size_t bindingIndex = INVALID_BINDING_INDEX;
+	const Scope* owner = FindOwnerScope(FindSymbol(name), BindingKind::VARIABLE, bindingIndex);
+	return owner != nullptr && owner->_parent != nullptr;
 }
 
 const bool mcf::Object::Scope::UseVariableInfo(const std::string& name) noexcept
 {
-	Scope* currentScope = this;
-	while (currentScope != nullptr)
+	return UseVariableInfo(FindSymbol(name));
+}
+
+const bool mcf::Object::Scope::UseVariableInfo(const mcf::Symbol::ID symbol) noexcept
+{
+	// 가장 안쪽의 같은 이름 식별자가 변수가 아니면 바깥쪽 변수가 가려진 것이므로 실패합니다.
+	size_t bindingIndex = INVALID_BINDING_INDEX;
+	const Scope* owner = FindOwnerScope(symbol, BindingKind::INVALID, bindingIndex);
+	if (owner == nullptr)
 	{
-		auto infoFound = currentScope->_variables.find(name);
-		if (infoFound == currentScope->_variables.end())
-		{
-			if (currentScope->_allIdentifierSet.find(name) != currentScope->_allIdentifierSet.end())
-			{
-				MCF_DEBUG_MESSAGE(u8"해당 식별자는 변수가 아닙니다. 함수[UseVariableInfo] 식별자[%s]", name.c_str());
-				return false;
-			}
-			currentScope = currentScope->_parent;
-			continue;
-		}
+		MCF_DEBUG_MESSAGE(u8"해당 식별자를 가지고 있는 변수를 찾을 수 없습니다. 함수[UseVariableInfo] 식별자[%s]", std::string(_tree->Symbols->GetName(symbol)).c_str());
+		return false;
+	}
 
-		infoFound->second.IsUsed = true;
-		return true;
+	const Binding& binding = owner->_bindings[bindingIndex];
+	if (binding.Kind != BindingKind::VARIABLE)
+	{
+		MCF_DEBUG_MESSAGE(u8"해당 식별자는 변수가 아닙니다. 함수[UseVariableInfo] 식별자[%s]", std::string(_tree->Symbols->GetName(symbol)).c_str());
+		return false;
 	}
-	
-	MCF_DEBUG_MESSAGE(u8"해당 식별자를 가지고 있는 변수를 찾을 수 없습니다. 함수[UseVariableInfo] 식별자[%s]", name.c_str());
-	return false;
+
+	// 전역 변수는 여러 함수의 본문에서 동시에 사용할 수 있으므로 사용 여부만 atomic 으로 기록합니다.
+	owner->_variables[binding.EntryIndex].IsUsed.store(true);
+	return true;
 }
 
 void mcf::Object::Scope::DetermineUnknownVariableTypeSize(const std::string& name, std::vector<size_t> arraySizeList) noexcept
 {
 	MCF_DEBUG_ASSERT(name.empty() == false, u8"이름이 비어 있으면 안됩니다.");
 
-	auto infoFound = _variables.find(name);
-	if (infoFound == _variables.end())
+	const size_t bindingIndex = FindBindingIndex(FindSymbol(name));
+	if (bindingIndex == INVALID_BINDING_INDEX || _bindings[bindingIndex].Kind != BindingKind::VARIABLE)
 	{
 		MCF_DEBUG_ASSERT(_parent != nullptr, u8"현재 스코프에서 해당 이름의 변수를 찾을 수 없습니다.");
 		return;
 	}
-	MCF_DEBUG_ASSERT(arraySizeList.size() == infoFound->second.DataType.ArraySizeList.size(), u8"주어진 배열 차원 수가 기존 배열 차원수와 다릅니다.");
-	infoFound->second.DataType.ArraySizeList = arraySizeList;
-	MCF_DEBUG_ASSERT(infoFound->second.DataType.HasUnknownArrayIndex() == false, u8"주어진 배열 크기 값에 unknown이 있으면 안됩니다.");
+
+	mcf::Object::Variable& variable = _variables[_bindings[bindingIndex].EntryIndex].Variable;
+	MCF_DEBUG_ASSERT(arraySizeList.size() == variable.DataType.GetArraySizeList().size(), u8"주어진 배열 차원 수가 기존 배열 차원수와 다릅니다.");
+	variable.DataType = variable.DataType.MakeResizedArrayType(arraySizeList);
+	MCF_DEBUG_ASSERT(variable.DataType.HasUnknownArrayIndex() == false, u8"주어진 배열 크기 값에 unknown이 있으면 안됩니다.");
 }
 
 const bool mcf::Object::Scope::MakeLocalScopeToFunctionInfo(_Inout_ mcf::Object::FunctionInfo& info) noexcept
@@ -278,35 +468,66 @@ const bool mcf::Object::Scope::DefineFunction(const std::string& name, const mcf
 	MCF_DEBUG_ASSERT(name.empty() == false, u8"이름이 비어 있으면 안됩니다.");
 	MCF_DEBUG_ASSERT(info.IsValid(), u8"함수 정보가 유효하지 않습니다.");
 
-	if (_allIdentifierSet.find(name) != _allIdentifierSet.end())
+	const mcf::Symbol::ID symbol = InternSymbol(name);
+	if (FindBindingIndex(symbol) != INVALID_BINDING_INDEX)
 	{
-		MCF_DEBUG_TODO(u8"구현 필요");
+		MCF_DEBUG_MESSAGE(u8"같은 스코프에 같은 이름의 식별자가 이미 있습니다. 함수[DefineFunction] 식별자[%s]", name.c_str());
 		return false;
 	}
 
-	_allIdentifierSet.emplace(name);
-	_functionInfoMap.emplace(name, info);
+	if (_functions.get() == nullptr)
+	{
+		_functions = std::make_unique<std::deque<FunctionEntry>>();
+	}
+	_functions->emplace_back(info);
+	AddBinding(symbol, BindingKind::FUNCTION, _functions->size() - 1);
 
+	// 함수 스코프는 함수를 정의하기 전에 만들어지므로 재귀 호출을 위해 함수 자신까지 보이도록 합니다.
+	if (info.LocalScope->_parent == this)
+	{
+		info.LocalScope->_parentVisibleCount = _bindings.size();
+	}
 	return true;
 }
 
-const mcf::Object::FunctionInfo mcf::Object::Scope::FindFunction(const std::string& name) const noexcept
+const mcf::Object::FunctionInfo& mcf::Object::Scope::FindFunction(const std::string& name) const noexcept
 {
 	MCF_DEBUG_ASSERT(name.empty() == false, u8"이름이 비어 있으면 안됩니다.");
+	return FindFunction(FindSymbol(name));
+}
+
+const mcf::Object::FunctionInfo& mcf::Object::Scope::FindFunction(const mcf::Symbol::ID symbol) const noexcept
+{
+	size_t bindingIndex = INVALID_BINDING_INDEX;
+	const Scope* owner = FindOwnerScope(symbol, BindingKind::FUNCTION, bindingIndex);
+	return owner == nullptr ? mcf::Object::FunctionInfo::GetInvalidFunctionInfo() : (*owner->_functions)[owner->_bindings[bindingIndex].EntryIndex].Info;
+}
 
-	auto infoFound = _functionInfoMap.find(name);
-	if (infoFound == _functionInfoMap.end())
+const bool mcf::Object::Scope::UseFunction(const mcf::Symbol::ID symbol) noexcept
+{
+	size_t bindingIndex = INVALID_BINDING_INDEX;
+	const Scope* owner = FindOwnerScope(symbol, BindingKind::FUNCTION, bindingIndex);
+	if (owner == nullptr)
 	{
-		if (_parent == nullptr)
-		{
-			return mcf::Object::FunctionInfo();
-		}
-		return _parent->FindFunction(name);
+		return false;
 	}
-	return infoFound->second;
+	(*owner->_functions)[owner->_bindings[bindingIndex].EntryIndex].IsUsed.store(true);
+	return true;
+}
+
+const bool mcf::Object::Scope::IsFunctionUsed(const std::string& name) const noexcept
+{
+	return IsFunctionUsed(FindSymbol(name));
 }
 
-const mcf::Object::FunctionInfo mcf::Object::Scope::FindInternalFunction(const InternalFunctionType functionType) const noexcept
+const bool mcf::Object::Scope::IsFunctionUsed(const mcf::Symbol::ID symbol) const noexcept
+{
+	size_t bindingIndex = INVALID_BINDING_INDEX;
+	const Scope* owner = FindOwnerScope(symbol, BindingKind::FUNCTION, bindingIndex);
+	return owner != nullptr && (*owner->_functions)[owner->_bindings[bindingIndex].EntryIndex].IsUsed.load();
+}
+
+const mcf::Object::FunctionInfo& mcf::Object::Scope::FindInternalFunction(const InternalFunctionType functionType) const noexcept
 {
 	return _tree->InternalFunctionInfosByTypes[mcf::ENUM_INDEX(functionType)];
 }
@@ -314,17 +535,217 @@ const mcf::Object::FunctionInfo mcf::Object::Scope::FindInternalFunction(const I
 const bool mcf::Object::Scope::MakeLocalScope(_Outptr_ mcf::Object::Scope** outScopePtr, const bool isFunctionScope) noexcept
 {
 	MCF_DEBUG_ASSERT(*outScopePtr == nullptr, u8"outScope는 null로 초기화 되어 있어야합니다.");
-	_tree->Locals.emplace_back(std::make_unique<Scope>(_tree, this, isFunctionScope));
-	if (_tree->Locals.back() == nullptr)
+
+	// 함수 본문 안이면 그 함수를 평가하는 스레드만 스코프를 추가하므로 잠금 없이 함수 스코프에 보관합니다.
+	Scope* functionScope = this;
+	while (functionScope != nullptr && functionScope->_isFunctionScope == false)
 	{
-		MCF_DEBUG_TODO(u8"구현 필요");
-		return false;
+		functionScope = functionScope->_parent;
 	}
 
-	*outScopePtr = _tree->Locals.back().get();
+	std::deque<Scope>* scopes = &_tree->Locals;
+	if (functionScope != nullptr)
+	{
+		if (functionScope->_localScopes.get() == nullptr)
+		{
+			functionScope->_localScopes = std::make_unique<std::deque<Scope>>();
+		}
+		scopes = functionScope->_localScopes.get();
+	}
+	scopes->emplace_back(_tree, this, isFunctionScope);
+	*outScopePtr = &scopes->back();
 	return true;
 }
 
+const mcf::Symbol::ID mcf::Object::Scope::FindSymbol(const std::string& name) const noexcept
+{
+	// 한번도 등록되지 않은 이름은 INVALID_ID 가 되며 어떤 바인딩도 없으므로 찾기에 실패합니다.
+	return _tree->Symbols->Find(name);
+}
+
+const mcf::Symbol::ID mcf::Object::Scope::InternSymbol(const std::string& name) noexcept
+{
+	return _tree->Symbols->Intern(name);
+}
+
+const mcf::Object::Scope* mcf::Object::Scope::FindOwnerScope(const mcf::Symbol::ID symbol, const BindingKind kind, _Out_ size_t& outBindingIndex) const noexcept
+{
+	size_t globalVisibleCount = _bindings.size();
+	if (_parent != nullptr)
+	{
+		if (_stack == nullptr)
+		{
+			MCF_DEBUG_BREAK(u8"열리지 않은 스코프에서는 이름을 찾을 수 없습니다.");
+			outBindingIndex = INVALID_BINDING_INDEX;
+			return nullptr;
+		}
+		MCF_DEBUG_ASSERT(_stack->GetInnermostScope() == this, u8"열린 스코프 중 가장 안쪽의 스코프에서만 이름을 찾을 수 있습니다.");
+
+		const Scope* owner = _stack->Find(symbol, kind, outBindingIndex);
+		if (owner != nullptr)
+		{
+			return owner;
+		}
+		globalVisibleCount = _stack->_globalVisibleCount;
+	}
+
+	outBindingIndex = _tree->Bindings.Find(symbol, kind, globalVisibleCount);
+	return outBindingIndex == INVALID_BINDING_INDEX ? nullptr : &_tree->Global;
+}
+
+const size_t mcf::Object::Scope::FindBindingIndex(const mcf::Symbol::ID symbol) const noexcept
+{
+	if (_parent == nullptr)
+	{
+		return _tree->Bindings.Find(symbol, BindingKind::INVALID, _bindings.size());
+	}
+
+	if (_stack != nullptr)
+	{
+		MCF_DEBUG_ASSERT(_stack->GetInnermostScope() == this, u8"열린 스코프 중 가장 안쪽의 스코프에만 정의할 수 있습니다.");
+		size_t bindingIndex = INVALID_BINDING_INDEX;
+		return _stack->Find(symbol, BindingKind::INVALID, bindingIndex) == this ? bindingIndex : INVALID_BINDING_INDEX;
+	}
+
+	// 열리지 않은 스코프에는 함수의 매개변수처럼 스코프를 열기 전에 정의한 바인딩만 있으므로 직접 찾습니다.
+	const size_t bindingCount = _bindings.size();
+	for (size_t i = 0; i < bindingCount; ++i)
+	{
+		if (_bindings[i].Symbol == symbol)
+		{
+			return i;
+		}
+	}
+	return INVALID_BINDING_INDEX;
+}
+
+void mcf::Object::Scope::AddBinding(const mcf::Symbol::ID symbol, const BindingKind kind, const size_t entryIndex) noexcept
+{
+	MCF_DEBUG_ASSERT(FindBindingIndex(symbol) == INVALID_BINDING_INDEX, u8"같은 스코프에 같은 이름을 다시 정의하면 안됩니다.");
+	_bindings.emplace_back(Binding{ symbol, kind, entryIndex });
+	if (_parent == nullptr)
+	{
+		_tree->Bindings.Add();
+	}
+	else if (_stack != nullptr)
+	{
+		MCF_DEBUG_ASSERT(_stack->GetInnermostScope() == this, u8"열린 스코프 중 가장 안쪽의 스코프에만 정의할 수 있습니다.");
+		_stack->PushInnermost();
+	}
+}
+
+const size_t mcf::Object::BindingTable::Find(const mcf::Symbol::ID symbol, const Scope::BindingKind kind, const size_t visibleCount) const noexcept
+{
+	const size_t bindingIndex = symbol < _bindingIndices.size() ? _bindingIndices[symbol] : Scope::INVALID_BINDING_INDEX;
+	if (bindingIndex < visibleCount && (kind == Scope::BindingKind::INVALID || _global->_bindings[bindingIndex].Kind == kind))
+	{
+		return bindingIndex;
+	}
+	return Scope::INVALID_BINDING_INDEX;
+}
+
+void mcf::Object::BindingTable::Add(void) noexcept
+{
+	const mcf::Symbol::ID symbol = _global->_bindings.back().Symbol;
+	if (_bindingIndices.size() <= symbol)
+	{
+		_bindingIndices.resize(static_cast<size_t>(symbol) + 1, Scope::INVALID_BINDING_INDEX);
+	}
+	_bindingIndices[symbol] = _global->_bindings.size() - 1;
+}
+
+void mcf::Object::BindingStack::Enter(_Notnull_ Scope* scope) noexcept
+{
+	MCF_DEBUG_ASSERT(scope->_parent != nullptr, u8"전역 스코프는 열지 않습니다.");
+	MCF_DEBUG_ASSERT(scope->_stack == nullptr, u8"이미 열린 스코프입니다.");
+
+	if (scope->_parent->_parent == nullptr)
+	{
+		MCF_DEBUG_ASSERT(_openScopes.empty(), u8"전역 스코프 바로 안쪽의 스코프는 빈 스택에 열어야 합니다.");
+		_globalVisibleCount = scope->_parentVisibleCount;
+	}
+	else
+	{
+		MCF_DEBUG_ASSERT(GetInnermostScope() == scope->_parent, u8"부모 스코프가 가장 안쪽 스코프여야 합니다.");
+		OpenScope& parent = _openScopes.back();
+		if (parent.PushedCount > scope->_parentVisibleCount)
+		{
+			Pop(parent.PushedCount - scope->_parentVisibleCount);
+			parent.PushedCount = scope->_parentVisibleCount;
+		}
+	}
+
+	_openScopes.emplace_back(OpenScope{ scope, 0 });
+	scope->_stack = this;
+	PushInnermost();
+}
+
+void mcf::Object::BindingStack::Leave(_Notnull_ Scope* scope) noexcept
+{
+	MCF_DEBUG_ASSERT(GetInnermostScope() == scope, u8"가장 안쪽 스코프만 닫을 수 있습니다.");
+
+	Pop(_openScopes.back().PushedCount);
+	_openScopes.pop_back();
+	scope->_stack = nullptr;
+
+	// 자식 스코프를 여는 동안 뺐던 부모 스코프의 바인딩을 다시 넣습니다.
+	if (_openScopes.empty() == false)
+	{
+		PushInnermost();
+	}
+}
+
+const mcf::Object::Scope* mcf::Object::BindingStack::Find(const mcf::Symbol::ID symbol, const Scope::BindingKind kind, _Out_ size_t& outBindingIndex) const noexcept
+{
+	const std::vector<size_t>& heads = _heads[mcf::ENUM_INDEX(kind)];
+	const size_t node = symbol < heads.size() ? heads[symbol] : 0;
+	if (node == 0)
+	{
+		outBindingIndex = Scope::INVALID_BINDING_INDEX;
+		return nullptr;
+	}
+	outBindingIndex = _nodes[node - 1].BindingIndex;
+	return _nodes[node - 1].Owner;
+}
+
+void mcf::Object::BindingStack::PushInnermost(void) noexcept
+{
+	OpenScope& innermost = _openScopes.back();
+	Push(innermost, innermost.Owner->_bindings.size());
+}
+
+void mcf::Object::BindingStack::Push(_Inout_ OpenScope& openScope, const size_t pushedCount) noexcept
+{
+	for (; openScope.PushedCount < pushedCount; ++openScope.PushedCount)
+	{
+		const Scope::Binding& binding = openScope.Owner->_bindings[openScope.PushedCount];
+		std::vector<size_t>& heads = _heads[mcf::ENUM_INDEX(Scope::BindingKind::INVALID)];
+		std::vector<size_t>& kindHeads = _heads[mcf::ENUM_INDEX(binding.Kind)];
+		if (heads.size() <= binding.Symbol)
+		{
+			heads.resize(static_cast<size_t>(binding.Symbol) + 1, 0);
+		}
+		if (kindHeads.size() <= binding.Symbol)
+		{
+			kindHeads.resize(static_cast<size_t>(binding.Symbol) + 1, 0);
+		}
+		_nodes.emplace_back(Node{ openScope.Owner, openScope.PushedCount, binding.Symbol, binding.Kind, heads[binding.Symbol], kindHeads[binding.Symbol] });
+		heads[binding.Symbol] = _nodes.size();
+		kindHeads[binding.Symbol] = _nodes.size();
+	}
+}
+
+void mcf::Object::BindingStack::Pop(size_t popCount) noexcept
+{
+	for (; popCount > 0; --popCount)
+	{
+		const Node& node = _nodes.back();
+		_heads[mcf::ENUM_INDEX(Scope::BindingKind::INVALID)][node.Symbol] = node.Previous;
+		_heads[mcf::ENUM_INDEX(node.Kind)][node.Symbol] = node.PreviousOfKind;
+		_nodes.pop_back();
+	}
+}
+
 const mcf::Object::TypeInfo mcf::IR::Expression::Interface::GetDataTypeFromExpression(const mcf::IR::Expression::Interface* expression) noexcept
 {
 	constexpr const size_t EXPRESSION_TYPE_COUNT_BEGIN = __COUNTER__;
@@ -347,7 +768,7 @@ const mcf::Object::TypeInfo mcf::IR::Expression::Interface::GetDataTypeFromExpre
 		break;
 
 	case mcf::IR::Expression::Type::STRING: __COUNTER__;
-		return mcf::Object::TypeInfo::MakePrimitive(true, "byte", 1, { static_cast<const mcf::IR::Expression::String*>(expression)->GetSize() });
+		return static_cast<const mcf::IR::Expression::String*>(expression)->GetInfo();
 
 	case mcf::IR::Expression::Type::INITIALIZER: __COUNTER__;
 		MCF_DEBUG_TODO(u8"구현 필요");
@@ -408,9 +829,9 @@ const std::string mcf::IR::Expression::LocalVariableIdentifier::Inspect(void) co
 }
 
 mcf::IR::Expression::FunctionIdentifier::FunctionIdentifier(const mcf::Object::FunctionInfo& info) noexcept
-	: _info(info)
+	: _info(&info)
 {
-	MCF_DEBUG_ASSERT(_info.IsValid(), u8"_info가 유효하지 않습니다.");
+	MCF_DEBUG_ASSERT(_info->IsValid(), u8"_info가 유효하지 않습니다.");
 }
 
 const std::string mcf::IR::Expression::FunctionIdentifier::Inspect(void) const noexcept
@@ -429,66 +850,66 @@ const bool mcf::IR::Expression::Integer::IsCompatible(const mcf::Object::TypeInf
 
 	switch (dataType.GetSize())
 		{
-		case sizeof(__int8):
-			MCF_DEBUG_MESSAGE_RETURN_BOOL(dataType.IsUnsigned ? IsUInt8() : IsInt8(), u8"데이터 타입과 호환되지 않는 정수 입니다. 데이터 타입[%s] 정수 값[%s]", dataType.Inspect().c_str(), std::to_string(_isUnsigned ? _unsignedValue : _signedValue).c_str());
-		case sizeof(__int16):
-			MCF_DEBUG_MESSAGE_RETURN_BOOL(dataType.IsUnsigned ? IsUInt16() : IsInt16(), u8"데이터 타입과 호환되지 않는 정수 입니다. 데이터 타입[%s] 정수 값[%s]", dataType.Inspect().c_str(), std::to_string(_isUnsigned ? _unsignedValue : _signedValue).c_str());
-		case sizeof(__int32):
-			MCF_DEBUG_MESSAGE_RETURN_BOOL(dataType.IsUnsigned ? IsUInt32() : IsInt32(), u8"데이터 타입과 호환되지 않는 정수 입니다. 데이터 타입[%s] 정수 값[%s]", dataType.Inspect().c_str(), std::to_string(_isUnsigned ? _unsignedValue : _signedValue).c_str());
-		case sizeof(__int64):
-			MCF_DEBUG_MESSAGE_RETURN_BOOL(dataType.IsUnsigned ? IsUInt64() : IsInt64(), u8"데이터 타입과 호환되지 않는 정수 입니다. 데이터 타입[%s] 정수 값[%s]", dataType.Inspect().c_str(), std::to_string(_isUnsigned ? _unsignedValue : _signedValue).c_str());
+		case sizeof(std::int8_t):
+			MCF_DEBUG_MESSAGE_RETURN_BOOL(dataType.IsUnsigned() ? IsUInt8() : IsInt8(), u8"데이터 타입과 호환되지 않는 정수 입니다. 데이터 타입[%s] 정수 값[%s]", dataType.Inspect().c_str(), std::to_string(_isUnsigned ? _unsignedValue : _signedValue).c_str());
+		case sizeof(std::int16_t):
+			MCF_DEBUG_MESSAGE_RETURN_BOOL(dataType.IsUnsigned() ? IsUInt16() : IsInt16(), u8"데이터 타입과 호환되지 않는 정수 입니다. 데이터 타입[%s] 정수 값[%s]", dataType.Inspect().c_str(), std::to_string(_isUnsigned ? _unsignedValue : _signedValue).c_str());
+		case sizeof(std::int32_t):
+			MCF_DEBUG_MESSAGE_RETURN_BOOL(dataType.IsUnsigned() ? IsUInt32() : IsInt32(), u8"데이터 타입과 호환되지 않는 정수 입니다. 데이터 타입[%s] 정수 값[%s]", dataType.Inspect().c_str(), std::to_string(_isUnsigned ? _unsignedValue : _signedValue).c_str());
+		case sizeof(std::int64_t):
+			MCF_DEBUG_MESSAGE_RETURN_BOOL(dataType.IsUnsigned() ? IsUInt64() : IsInt64(), u8"데이터 타입과 호환되지 않는 정수 입니다. 데이터 타입[%s] 정수 값[%s]", dataType.Inspect().c_str(), std::to_string(_isUnsigned ? _unsignedValue : _signedValue).c_str());
 		default:
 			MCF_DEBUG_MESSAGE(u8"타입의 크기가 호환 가능한 정수 타입의 크기와 맞지 않습니다. 타입 크기[%zu]", dataType.GetSize());
 			return false;
 	}
 }
 
-const __int64 mcf::IR::Expression::Integer::GetInt64(void) const noexcept
+const std::int64_t mcf::IR::Expression::Integer::GetInt64(void) const noexcept
 {
 	MCF_DEBUG_ASSERT(_isUnsigned == false, u8"signed가 아닌 값은 int64 타입의 값이 될 수 없습니다.");
 	return _signedValue;
 }
 
-const __int32 mcf::IR::Expression::Integer::GetInt32(void) const noexcept
+const std::int32_t mcf::IR::Expression::Integer::GetInt32(void) const noexcept
 {
 	MCF_DEBUG_ASSERT((_isUnsigned == false && INT32_MIN <= _signedValue && _signedValue <= INT32_MAX) || (_isUnsigned == true && _unsignedValue <= INT32_MAX), u8"가지고 있는 값이 int32 타입의 범위 안에 있지 않습니다.");
-	return static_cast<__int32>(_signedValue);
+	return static_cast<std::int32_t>(_signedValue);
 }
 
-const __int16 mcf::IR::Expression::Integer::GetInt16(void) const noexcept
+const std::int16_t mcf::IR::Expression::Integer::GetInt16(void) const noexcept
 {
 	MCF_DEBUG_ASSERT((_isUnsigned == false && INT16_MIN <= _signedValue && _signedValue <= INT16_MAX) || (_isUnsigned == true && _unsignedValue <= INT16_MAX), u8"가지고 있는 값이 int16 타입의 범위 안에 있지 않습니다.");
-	return static_cast<__int16>(_signedValue);
+	return static_cast<std::int16_t>(_signedValue);
 }
 
-const __int8 mcf::IR::Expression::Integer::GetInt8(void) const noexcept
+const std::int8_t mcf::IR::Expression::Integer::GetInt8(void) const noexcept
 {
 	MCF_DEBUG_ASSERT((_isUnsigned == false && INT8_MIN <= _signedValue && _signedValue <= INT8_MAX) || (_isUnsigned == true && _unsignedValue <= INT8_MAX), u8"가지고 있는 값이 int8 타입의 범위 안에 있지 않습니다.");
-	return static_cast<__int8>(_signedValue);
+	return static_cast<std::int8_t>(_signedValue);
 }
 
-const unsigned __int64 mcf::IR::Expression::Integer::GetUInt64(void) const noexcept
+const std::uint64_t mcf::IR::Expression::Integer::GetUInt64(void) const noexcept
 {
 	MCF_DEBUG_ASSERT(IsNaturalInteger(), u8"자연수가 아닌 값은 uint64 타입의 값이 될 수 없습니다.");
 	return _unsignedValue;
 }
 
-const unsigned __int32 mcf::IR::Expression::Integer::GetUInt32(void) const noexcept
+const std::uint32_t mcf::IR::Expression::Integer::GetUInt32(void) const noexcept
 {
 	MCF_DEBUG_ASSERT((_isUnsigned == false && 0 <= _signedValue && _signedValue <= UINT32_MAX) || (_isUnsigned == true && _unsignedValue <= UINT32_MAX), u8"가지고 있는 값이 uint32 타입의 범위 안에 있지 않습니다.");
-	return static_cast<unsigned __int32>(_unsignedValue);
+	return static_cast<std::uint32_t>(_unsignedValue);
 }
 
-const unsigned __int16 mcf::IR::Expression::Integer::GetUInt16(void) const noexcept
+const std::uint16_t mcf::IR::Expression::Integer::GetUInt16(void) const noexcept
 {
 	MCF_DEBUG_ASSERT((_isUnsigned == false && 0 <= _signedValue && _signedValue <= UINT16_MAX) || (_isUnsigned == true && _unsignedValue <= UINT16_MAX), u8"가지고 있는 값이 uint16 타입의 범위 안에 있지 않습니다.");
-	return static_cast<unsigned __int16>(_unsignedValue);
+	return static_cast<std::uint16_t>(_unsignedValue);
 }
 
-const unsigned __int8 mcf::IR::Expression::Integer::GetUInt8( void ) const noexcept
+const std::uint8_t mcf::IR::Expression::Integer::GetUInt8( void ) const noexcept
 {
 	MCF_DEBUG_ASSERT((_isUnsigned == false && 0 <= _signedValue && _signedValue <= UINT8_MAX) || (_isUnsigned == true && _unsignedValue <= UINT8_MAX), u8"가지고 있는 값이 uint8 타입의 범위 안에 있지 않습니다.");
-	return static_cast<unsigned __int8>(_unsignedValue);
+	return static_cast<std::uint8_t>(_unsignedValue);
 }
 
 const std::string mcf::IR::Expression::Integer::Inspect(void) const noexcept
@@ -498,11 +919,12 @@ const std::string mcf::IR::Expression::Integer::Inspect(void) const noexcept
 
 const std::string mcf::IR::Expression::String::Inspect(void) const noexcept
 {
-	return "?" + std::to_string(_index);
+	return "?" + std::to_string(GetIndex());
 }
 
-mcf::IR::Expression::Initializer::Initializer(PointerVector&& keyList) noexcept
-	: _keyList(std::move(keyList))
+mcf::IR::Expression::Initializer::Initializer(const Type type, PointerVector&& keyList) noexcept
+	: Interface(type)
+	, _keyList(std::move(keyList))
 {
 #if defined(_DEBUG)
 	const size_t size = _keyList.size();
@@ -530,7 +952,7 @@ const std::string mcf::IR::Expression::Initializer::Inspect(void) const noexcept
 }
 
 mcf::IR::Expression::MapInitializer::MapInitializer(PointerVector&& keyList, PointerVector&& valueList) noexcept
-	: Initializer(std::move(keyList))
+	: Initializer(TYPE, std::move(keyList))
 	, _valueList(std::move(valueList))
 {
 #if defined(_DEBUG)
@@ -551,19 +973,19 @@ const std::string mcf::IR::Expression::MapInitializer::Inspect(void) const noexc
 }
 
 mcf::IR::Expression::Call::Call(const mcf::Object::FunctionInfo& info, mcf::IR::Expression::PointerVector&& paramObjects) noexcept
-	: _info(info)
+	: _info(&info)
 	, _paramObjects(std::move(paramObjects))
 {
-	MCF_DEBUG_ASSERT(_info.IsValid(), u8"함수 정의가 유효하지 않습니다.");
+	MCF_DEBUG_ASSERT(_info->IsValid(), u8"함수 정의가 유효하지 않습니다.");
 #if defined(_DEBUG)
 	const size_t size = _paramObjects.size();
-	if (_info.Params.HasVariadic())
+	if (_info->Params.HasVariadic())
 	{
-		MCF_DEBUG_ASSERT(size >= _info.Params.Variables.size() - 1, u8"_paramObjects에 값은 함수 정보안에 있는 인자 갯수와 동일 해야합니다.");
+		MCF_DEBUG_ASSERT(size >= _info->Params.Variables.size() - 1, u8"_paramObjects에 값은 함수 정보안에 있는 인자 갯수와 동일 해야합니다.");
 	}
 	else
 	{
-		MCF_DEBUG_ASSERT(size == _info.Params.Variables.size(), u8"_paramObjects에 값은 함수 정보안에 있는 인자 갯수와 동일 해야합니다.");
+		MCF_DEBUG_ASSERT(size == _info->Params.Variables.size(), u8"_paramObjects에 값은 함수 정보안에 있는 인자 갯수와 동일 해야합니다.");
 	}
 
 	for (size_t i = 0; i < size; i++)
@@ -842,8 +1264,8 @@ mcf::IR::ASM::Address::Address(const mcf::Object::TypeInfo& targetType, mcf::IR:
 {
 	MCF_DEBUG_ASSERT(targetType.IsValid(), u8"유효하지 않은 타입입니다.");
 	MCF_DEBUG_ASSERT(targetType.IsArrayType() == false, u8"배열 타입은 허용되지 않습니다.");
-	MCF_DEBUG_ASSERT(targetType.IsVariadic == false, u8"variadic은 허용되지 않습니다.");
-	MCF_DEBUG_ASSERT(targetType.GetSize() == targetType.IntrinsicSize, u8"타입의 고유 사이즈와 실제사이즈가 같아야 합니다.");
+	MCF_DEBUG_ASSERT(targetType.IsVariadic() == false, u8"variadic은 허용되지 않습니다.");
+	MCF_DEBUG_ASSERT(targetType.GetSize() == targetType.GetIntrinsicSize(), u8"타입의 고유 사이즈와 실제사이즈가 같아야 합니다.");
 	MCF_DEBUG_ASSERT(targetRegister != Register::INVALID && targetRegister < Register::COUNT, u8"유효하지 않은 레지스터 값입니다.");
 }
 
@@ -933,68 +1355,68 @@ mcf::IR::ASM::Mov::Mov(const Address& target, const Register source) noexcept
 	MCF_DEBUG_ASSERT(Internal::IsSizeMatching(source, target.GetTypeInfo().GetSize()), u8"source와 target의 사이즈가 일치 하지 않습니다. Size=%zu", target.GetTypeInfo().GetSize());
 }
 
-mcf::IR::ASM::Mov::Mov(const Address& target, const __int64 source) noexcept
+mcf::IR::ASM::Mov::Mov(const Address& target, const std::int64_t source) noexcept
 	: _target(target.Inspect())
 	, _source(std::to_string(source))
 {
-	MCF_DEBUG_ASSERT(target.GetTypeInfo().GetSize() >= sizeof(__int64), u8"source와 target의 사이즈가 일치 하지 않습니다. Size=%zu", target.GetTypeInfo().GetSize());
-	MCF_DEBUG_ASSERT(target.GetTypeInfo().IsUnsigned == false, u8"source와 target의 사인 타입이 일치 하지 않습니다.");
+	MCF_DEBUG_ASSERT(target.GetTypeInfo().GetSize() >= sizeof(std::int64_t), u8"source와 target의 사이즈가 일치 하지 않습니다. Size=%zu", target.GetTypeInfo().GetSize());
+	MCF_DEBUG_ASSERT(target.GetTypeInfo().IsUnsigned() == false, u8"source와 target의 사인 타입이 일치 하지 않습니다.");
 }
 
-mcf::IR::ASM::Mov::Mov(const Address& target, const __int32 source) noexcept
+mcf::IR::ASM::Mov::Mov(const Address& target, const std::int32_t source) noexcept
 	: _target(target.Inspect())
 	, _source(std::to_string(source))
 {
-	MCF_DEBUG_ASSERT(target.GetTypeInfo().GetSize() >= sizeof(__int32), u8"source와 target의 사이즈가 일치 하지 않습니다. Size=%zu", target.GetTypeInfo().GetSize());
-	MCF_DEBUG_ASSERT(target.GetTypeInfo().IsUnsigned == false, u8"source와 target의 사인 타입이 일치 하지 않습니다.");
+	MCF_DEBUG_ASSERT(target.GetTypeInfo().GetSize() >= sizeof(std::int32_t), u8"source와 target의 사이즈가 일치 하지 않습니다. Size=%zu", target.GetTypeInfo().GetSize());
+	MCF_DEBUG_ASSERT(target.GetTypeInfo().IsUnsigned() == false, u8"source와 target의 사인 타입이 일치 하지 않습니다.");
 }
 
-mcf::IR::ASM::Mov::Mov(const Address& target, const __int16 source) noexcept
+mcf::IR::ASM::Mov::Mov(const Address& target, const std::int16_t source) noexcept
 	: _target(target.Inspect())
 	, _source(std::to_string(source))
 {
-	MCF_DEBUG_ASSERT(target.GetTypeInfo().GetSize() >= sizeof(__int16), u8"source와 target의 사이즈가 일치 하지 않습니다. Size=%zu", target.GetTypeInfo().GetSize());
-	MCF_DEBUG_ASSERT(target.GetTypeInfo().IsUnsigned == false, u8"source와 target의 사인 타입이 일치 하지 않습니다.");
+	MCF_DEBUG_ASSERT(target.GetTypeInfo().GetSize() >= sizeof(std::int16_t), u8"source와 target의 사이즈가 일치 하지 않습니다. Size=%zu", target.GetTypeInfo().GetSize());
+	MCF_DEBUG_ASSERT(target.GetTypeInfo().IsUnsigned() == false, u8"source와 target의 사인 타입이 일치 하지 않습니다.");
 }
 
-mcf::IR::ASM::Mov::Mov(const Address& target, const __int8 source) noexcept
+mcf::IR::ASM::Mov::Mov(const Address& target, const std::int8_t source) noexcept
 	: _target(target.Inspect())
 	, _source(std::to_string(source))
 {
-	MCF_DEBUG_ASSERT(target.GetTypeInfo().GetSize() >= sizeof(__int8), u8"source와 target의 사이즈가 일치 하지 않습니다. Size=%zu", target.GetTypeInfo().GetSize());
-	MCF_DEBUG_ASSERT(target.GetTypeInfo().IsUnsigned == false, u8"source와 target의 사인 타입이 일치 하지 않습니다.");
+	MCF_DEBUG_ASSERT(target.GetTypeInfo().GetSize() >= sizeof(std::int8_t), u8"source와 target의 사이즈가 일치 하지 않습니다. Size=%zu", target.GetTypeInfo().GetSize());
+	MCF_DEBUG_ASSERT(target.GetTypeInfo().IsUnsigned() == false, u8"source와 target의 사인 타입이 일치 하지 않습니다.");
 }
 
-mcf::IR::ASM::Mov::Mov(const Address& target, const unsigned __int64 source) noexcept
+mcf::IR::ASM::Mov::Mov(const Address& target, const std::uint64_t source) noexcept
 	: _target(target.Inspect())
 	, _source(std::to_string(source))
 {
-	MCF_DEBUG_ASSERT(target.GetTypeInfo().GetSize() >= sizeof(unsigned __int64), u8"source와 target의 사이즈가 일치 하지 않습니다. Size=%zu", target.GetTypeInfo().GetSize());
-	MCF_DEBUG_ASSERT(target.GetTypeInfo().IsUnsigned == true, u8"source와 target의 사인 타입이 일치 하지 않습니다.");
+	MCF_DEBUG_ASSERT(target.GetTypeInfo().GetSize() >= sizeof(std::uint64_t), u8"source와 target의 사이즈가 일치 하지 않습니다. Size=%zu", target.GetTypeInfo().GetSize());
+	MCF_DEBUG_ASSERT(target.GetTypeInfo().IsUnsigned() == true, u8"source와 target의 사인 타입이 일치 하지 않습니다.");
 }
 
-mcf::IR::ASM::Mov::Mov(const Address& target, const unsigned __int32 source) noexcept
+mcf::IR::ASM::Mov::Mov(const Address& target, const std::uint32_t source) noexcept
 	: _target(target.Inspect())
 	, _source(std::to_string(source))
 {
-	MCF_DEBUG_ASSERT(target.GetTypeInfo().GetSize() >= sizeof(unsigned __int32), u8"source와 target의 사이즈가 일치 하지 않습니다. Size=%zu", target.GetTypeInfo().GetSize());
-	MCF_DEBUG_ASSERT(target.GetTypeInfo().IsUnsigned == true, u8"source와 target의 사인 타입이 일치 하지 않습니다.");
+	MCF_DEBUG_ASSERT(target.GetTypeInfo().GetSize() >= sizeof(std::uint32_t), u8"source와 target의 사이즈가 일치 하지 않습니다. Size=%zu", target.GetTypeInfo().GetSize());
+	MCF_DEBUG_ASSERT(target.GetTypeInfo().IsUnsigned() == true, u8"source와 target의 사인 타입이 일치 하지 않습니다.");
 }
 
-mcf::IR::ASM::Mov::Mov(const Address& target, const unsigned __int16 source) noexcept
+mcf::IR::ASM::Mov::Mov(const Address& target, const std::uint16_t source) noexcept
 	: _target(target.Inspect())
 	, _source(std::to_string(source))
 {
-	MCF_DEBUG_ASSERT(target.GetTypeInfo().GetSize() >= sizeof(unsigned __int16), u8"source와 target의 사이즈가 일치 하지 않습니다. Size=%zu", target.GetTypeInfo().GetSize());
-	MCF_DEBUG_ASSERT(target.GetTypeInfo().IsUnsigned == true, u8"source와 target의 사인 타입이 일치 하지 않습니다.");
+	MCF_DEBUG_ASSERT(target.GetTypeInfo().GetSize() >= sizeof(std::uint16_t), u8"source와 target의 사이즈가 일치 하지 않습니다. Size=%zu", target.GetTypeInfo().GetSize());
+	MCF_DEBUG_ASSERT(target.GetTypeInfo().IsUnsigned() == true, u8"source와 target의 사인 타입이 일치 하지 않습니다.");
 }
 
-mcf::IR::ASM::Mov::Mov(const Address& target, const unsigned __int8 source) noexcept
+mcf::IR::ASM::Mov::Mov(const Address& target, const std::uint8_t source) noexcept
 	: _target(target.Inspect())
 	, _source(std::to_string(source))
 {
-	MCF_DEBUG_ASSERT(target.GetTypeInfo().GetSize() >= sizeof(unsigned __int8), u8"source와 target의 사이즈가 일치 하지 않습니다. Size=%zu", target.GetTypeInfo().GetSize());
-	MCF_DEBUG_ASSERT(target.GetTypeInfo().IsUnsigned == true, u8"source와 target의 사인 타입이 일치 하지 않습니다.");
+	MCF_DEBUG_ASSERT(target.GetTypeInfo().GetSize() >= sizeof(std::uint8_t), u8"source와 target의 사이즈가 일치 하지 않습니다. Size=%zu", target.GetTypeInfo().GetSize());
+	MCF_DEBUG_ASSERT(target.GetTypeInfo().IsUnsigned() == true, u8"source와 target의 사인 타입이 일치 하지 않습니다.");
 }
 
 mcf::IR::ASM::Mov::Mov(const Register target, _In_ const mcf::IR::Expression::GlobalVariableIdentifier* globalExpression) noexcept
@@ -1018,71 +1440,71 @@ mcf::IR::ASM::Mov::Mov(const Register target, const SizeOf& source) noexcept
 	, _source(source.Inspect())
 {
 	MCF_DEBUG_ASSERT(target != mcf::IR::ASM::Register::INVALID, u8"target가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(GET_REGISTER_SIZE_VALUE(target) == sizeof(__int64), u8"64비트 레지스터가 아닙니다.");
+	MCF_DEBUG_ASSERT(GET_REGISTER_SIZE_VALUE(target) == sizeof(std::int64_t), u8"64비트 레지스터가 아닙니다.");
 }
 
-mcf::IR::ASM::Mov::Mov(const Register target, const __int64 source) noexcept
+mcf::IR::ASM::Mov::Mov(const Register target, const std::int64_t source) noexcept
 	: _target(CONVERT_REGISTER_TO_STRING(target))
 	, _source(std::to_string(source))
 {
 	MCF_DEBUG_ASSERT(target != mcf::IR::ASM::Register::INVALID, u8"target가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(target) >= sizeof(__int64), u8"레지스터의 크기가 인자로 받은 64비트 정수의 값을 수용할 수 없습니다.");
+	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(target) >= sizeof(std::int64_t), u8"레지스터의 크기가 인자로 받은 64비트 정수의 값을 수용할 수 없습니다.");
 }
 
-mcf::IR::ASM::Mov::Mov(const Register target, const __int32 source) noexcept
+mcf::IR::ASM::Mov::Mov(const Register target, const std::int32_t source) noexcept
 	: _target(CONVERT_REGISTER_TO_STRING(target))
 	, _source(std::to_string(source))
 {
 	MCF_DEBUG_ASSERT(target != mcf::IR::ASM::Register::INVALID, u8"target가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(target) >= sizeof(__int32), u8"레지스터의 크기가 인자로 받은 32비트 정수의 값을 수용할 수 없습니다.");
+	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(target) >= sizeof(std::int32_t), u8"레지스터의 크기가 인자로 받은 32비트 정수의 값을 수용할 수 없습니다.");
 }
 
-mcf::IR::ASM::Mov::Mov(const Register target, const __int16 source) noexcept
+mcf::IR::ASM::Mov::Mov(const Register target, const std::int16_t source) noexcept
 	: _target(CONVERT_REGISTER_TO_STRING(target))
 	, _source(std::to_string(source))
 {
 	MCF_DEBUG_ASSERT(target != mcf::IR::ASM::Register::INVALID, u8"target가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(target) >= sizeof(__int16), u8"레지스터의 크기가 인자로 받은 16비트 정수의 값을 수용할 수 없습니다.");
+	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(target) >= sizeof(std::int16_t), u8"레지스터의 크기가 인자로 받은 16비트 정수의 값을 수용할 수 없습니다.");
 }
 
-mcf::IR::ASM::Mov::Mov(const Register target, const __int8 source) noexcept
+mcf::IR::ASM::Mov::Mov(const Register target, const std::int8_t source) noexcept
 	: _target(CONVERT_REGISTER_TO_STRING(target))
 	, _source(std::to_string(source))
 {
 	MCF_DEBUG_ASSERT(target != mcf::IR::ASM::Register::INVALID, u8"target가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(target) >= sizeof(__int8), u8"레지스터의 크기가 인자로 받은 8비트 정수의 값을 수용할 수 없습니다.");
+	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(target) >= sizeof(std::int8_t), u8"레지스터의 크기가 인자로 받은 8비트 정수의 값을 수용할 수 없습니다.");
 }
 
-mcf::IR::ASM::Mov::Mov(const Register target, const unsigned __int64 source) noexcept
+mcf::IR::ASM::Mov::Mov(const Register target, const std::uint64_t source) noexcept
 	: _target(CONVERT_REGISTER_TO_STRING(target))
 	, _source(std::to_string(source))
 {
 	MCF_DEBUG_ASSERT(target != mcf::IR::ASM::Register::INVALID, u8"target가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(target) >= sizeof(__int64), u8"레지스터의 크기가 인자로 받은 64비트 정수의 값을 수용할 수 없습니다.");
+	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(target) >= sizeof(std::int64_t), u8"레지스터의 크기가 인자로 받은 64비트 정수의 값을 수용할 수 없습니다.");
 }
 
-mcf::IR::ASM::Mov::Mov(const Register target, const unsigned __int32 source) noexcept
+mcf::IR::ASM::Mov::Mov(const Register target, const std::uint32_t source) noexcept
 	: _target(CONVERT_REGISTER_TO_STRING(target))
 	, _source(std::to_string(source))
 {
 	MCF_DEBUG_ASSERT(target != mcf::IR::ASM::Register::INVALID, u8"target가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(target) >= sizeof(__int32), u8"레지스터의 크기가 인자로 받은 32비트 정수의 값을 수용할 수 없습니다.");
+	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(target) >= sizeof(std::int32_t), u8"레지스터의 크기가 인자로 받은 32비트 정수의 값을 수용할 수 없습니다.");
 }
 
-mcf::IR::ASM::Mov::Mov(const Register target, const unsigned __int16 source) noexcept
+mcf::IR::ASM::Mov::Mov(const Register target, const std::uint16_t source) noexcept
 	: _target(CONVERT_REGISTER_TO_STRING(target))
 	, _source(std::to_string(source))
 {
 	MCF_DEBUG_ASSERT(target != mcf::IR::ASM::Register::INVALID, u8"target가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(target) >= sizeof(__int16), u8"레지스터의 크기가 인자로 받은 16비트 정수의 값을 수용할 수 없습니다.");
+	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(target) >= sizeof(std::int16_t), u8"레지스터의 크기가 인자로 받은 16비트 정수의 값을 수용할 수 없습니다.");
 }
 
-mcf::IR::ASM::Mov::Mov(const Register target, const unsigned __int8 source) noexcept
+mcf::IR::ASM::Mov::Mov(const Register target, const std::uint8_t source) noexcept
 	: _target(CONVERT_REGISTER_TO_STRING(target))
 	, _source(std::to_string(source))
 {
 	MCF_DEBUG_ASSERT(target != mcf::IR::ASM::Register::INVALID, u8"target가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(target) >= sizeof(__int8), u8"레지스터의 크기가 인자로 받은 8비트 정수의 값을 수용할 수 없습니다.");
+	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(target) >= sizeof(std::int8_t), u8"레지스터의 크기가 인자로 받은 8비트 정수의 값을 수용할 수 없습니다.");
 }
 
 const std::string mcf::IR::ASM::Mov::Inspect(void) const noexcept
@@ -1095,7 +1517,7 @@ mcf::IR::ASM::Lea::Lea(const Register target, const mcf::IR::ASM::UnsafePointerA
 	, _source(source.Inspect())
 {
 	MCF_DEBUG_ASSERT(target != mcf::IR::ASM::Register::INVALID, u8"target가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(GET_REGISTER_SIZE_VALUE(target) == sizeof(__int64), u8"64비트 레지스터가 아닙니다.");
+	MCF_DEBUG_ASSERT(GET_REGISTER_SIZE_VALUE(target) == sizeof(std::int64_t), u8"64비트 레지스터가 아닙니다.");
 }
 
 const std::string mcf::IR::ASM::Lea::Inspect(void) const noexcept
@@ -1103,68 +1525,68 @@ const std::string mcf::IR::ASM::Lea::Inspect(void) const noexcept
 	return "\tlea " + _target + ", " + _source + "\n";
 }
 
-mcf::IR::ASM::Add::Add(const Register lhs, const __int64 rhs) noexcept
+mcf::IR::ASM::Add::Add(const Register lhs, const std::int64_t rhs) noexcept
 	: _lhs(CONVERT_REGISTER_TO_STRING(lhs))
 	, _rhs(std::to_string(rhs))
 {
 	MCF_DEBUG_ASSERT(lhs != mcf::IR::ASM::Register::INVALID, u8"lhs가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(lhs) >= sizeof(__int64), u8"레지스터의 크기가 인자로 받은 64비트 정수의 값을 수용할 수 없습니다.");
+	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(lhs) >= sizeof(std::int64_t), u8"레지스터의 크기가 인자로 받은 64비트 정수의 값을 수용할 수 없습니다.");
 }
 
-mcf::IR::ASM::Add::Add(const Register lhs, const __int32 rhs) noexcept
+mcf::IR::ASM::Add::Add(const Register lhs, const std::int32_t rhs) noexcept
 	: _lhs(CONVERT_REGISTER_TO_STRING(lhs))
 	, _rhs(std::to_string(rhs))
 {
 	MCF_DEBUG_ASSERT(lhs != mcf::IR::ASM::Register::INVALID, u8"lhs가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(lhs) >= sizeof(__int32), u8"레지스터의 크기가 인자로 받은 32비트 정수의 값을 수용할 수 없습니다.");
+	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(lhs) >= sizeof(std::int32_t), u8"레지스터의 크기가 인자로 받은 32비트 정수의 값을 수용할 수 없습니다.");
 }
 
-mcf::IR::ASM::Add::Add(const Register lhs, const __int16 rhs) noexcept
+mcf::IR::ASM::Add::Add(const Register lhs, const std::int16_t rhs) noexcept
 	: _lhs(CONVERT_REGISTER_TO_STRING(lhs))
 	, _rhs(std::to_string(rhs))
 {
 	MCF_DEBUG_ASSERT(lhs != mcf::IR::ASM::Register::INVALID, u8"lhs가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(lhs) >= sizeof(__int16), u8"레지스터의 크기가 인자로 받은 16비트 정수의 값을 수용할 수 없습니다.");
+	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(lhs) >= sizeof(std::int16_t), u8"레지스터의 크기가 인자로 받은 16비트 정수의 값을 수용할 수 없습니다.");
 }
 
-mcf::IR::ASM::Add::Add(const Register lhs, const __int8 rhs) noexcept
+mcf::IR::ASM::Add::Add(const Register lhs, const std::int8_t rhs) noexcept
 	: _lhs(CONVERT_REGISTER_TO_STRING(lhs))
 	, _rhs(std::to_string(rhs))
 {
 	MCF_DEBUG_ASSERT(lhs != mcf::IR::ASM::Register::INVALID, u8"lhs가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(lhs) >= sizeof(__int8), u8"레지스터의 크기가 인자로 받은 8비트 정수의 값을 수용할 수 없습니다.");
+	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(lhs) >= sizeof(std::int8_t), u8"레지스터의 크기가 인자로 받은 8비트 정수의 값을 수용할 수 없습니다.");
 }
 
-mcf::IR::ASM::Add::Add(const Register lhs, const unsigned __int64 rhs) noexcept
+mcf::IR::ASM::Add::Add(const Register lhs, const std::uint64_t rhs) noexcept
 	: _lhs(CONVERT_REGISTER_TO_STRING(lhs))
 	, _rhs(std::to_string(rhs))
 {
 	MCF_DEBUG_ASSERT(lhs != mcf::IR::ASM::Register::INVALID, u8"lhs가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(lhs) >= sizeof(__int64), u8"레지스터의 크기가 인자로 받은 64비트 정수의 값을 수용할 수 없습니다.");
+	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(lhs) >= sizeof(std::int64_t), u8"레지스터의 크기가 인자로 받은 64비트 정수의 값을 수용할 수 없습니다.");
 }
 
-mcf::IR::ASM::Add::Add(const Register lhs, const unsigned __int32 rhs) noexcept
+mcf::IR::ASM::Add::Add(const Register lhs, const std::uint32_t rhs) noexcept
 	: _lhs(CONVERT_REGISTER_TO_STRING(lhs))
 	, _rhs(std::to_string(rhs))
 {
 	MCF_DEBUG_ASSERT(lhs != mcf::IR::ASM::Register::INVALID, u8"lhs가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(lhs) >= sizeof(__int32), u8"레지스터의 크기가 인자로 받은 32비트 정수의 값을 수용할 수 없습니다.");
+	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(lhs) >= sizeof(std::int32_t), u8"레지스터의 크기가 인자로 받은 32비트 정수의 값을 수용할 수 없습니다.");
 }
 
-mcf::IR::ASM::Add::Add(const Register lhs, const unsigned __int16 rhs) noexcept
+mcf::IR::ASM::Add::Add(const Register lhs, const std::uint16_t rhs) noexcept
 	: _lhs(CONVERT_REGISTER_TO_STRING(lhs))
 	, _rhs(std::to_string(rhs))
 {
 	MCF_DEBUG_ASSERT(lhs != mcf::IR::ASM::Register::INVALID, u8"lhs가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(lhs) >= sizeof(__int16), u8"레지스터의 크기가 인자로 받은 16비트 정수의 값을 수용할 수 없습니다.");
+	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(lhs) >= sizeof(std::int16_t), u8"레지스터의 크기가 인자로 받은 16비트 정수의 값을 수용할 수 없습니다.");
 }
 
-mcf::IR::ASM::Add::Add(const Register lhs, const unsigned __int8 rhs) noexcept
+mcf::IR::ASM::Add::Add(const Register lhs, const std::uint8_t rhs) noexcept
 	: _lhs(CONVERT_REGISTER_TO_STRING(lhs))
 	, _rhs(std::to_string(rhs))
 {
 	MCF_DEBUG_ASSERT(lhs != mcf::IR::ASM::Register::INVALID, u8"lhs가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(lhs) >= sizeof(__int8), u8"레지스터의 크기가 인자로 받은 8비트 정수의 값을 수용할 수 없습니다.");
+	MCF_DEBUG_ASSERT(mcf::IR::ASM::GET_REGISTER_SIZE_VALUE(lhs) >= sizeof(std::int8_t), u8"레지스터의 크기가 인자로 받은 8비트 정수의 값을 수용할 수 없습니다.");
 }
 
 mcf::IR::ASM::Add::Add(const Register lhs, const Address& rhs) noexcept
@@ -1183,68 +1605,68 @@ mcf::IR::ASM::Add::Add(const Address& lhs, const Register rhs) noexcept
 	MCF_DEBUG_ASSERT(Internal::IsSizeMatching(rhs, lhs.GetTypeInfo().GetSize()), u8"레지스터가 lhs의 데이터 크기와 맞지 않는 레지스터 입니다.");
 }
 
-mcf::IR::ASM::Add::Add(const Address& lhs, const __int64 rhs) noexcept
+mcf::IR::ASM::Add::Add(const Address& lhs, const std::int64_t rhs) noexcept
 	: _lhs(lhs.Inspect())
 	, _rhs(std::to_string(rhs))
 {
-	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().GetSize() >= sizeof(__int64), u8"rhs와 lhs의 사이즈가 일치 하지 않습니다. Size=%zu", lhs.GetTypeInfo().GetSize());
-	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().IsUnsigned == false, u8"rhs와 lhs의 사인 타입이 일치 하지 않습니다.");
+	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().GetSize() >= sizeof(std::int64_t), u8"rhs와 lhs의 사이즈가 일치 하지 않습니다. Size=%zu", lhs.GetTypeInfo().GetSize());
+	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().IsUnsigned() == false, u8"rhs와 lhs의 사인 타입이 일치 하지 않습니다.");
 }
 
-mcf::IR::ASM::Add::Add(const Address& lhs, const __int32 rhs) noexcept
+mcf::IR::ASM::Add::Add(const Address& lhs, const std::int32_t rhs) noexcept
 	: _lhs(lhs.Inspect())
 	, _rhs(std::to_string(rhs))
 {
-	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().GetSize() >= sizeof(__int32), u8"rhs와 lhs의 사이즈가 일치 하지 않습니다. Size=%zu", lhs.GetTypeInfo().GetSize());
-	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().IsUnsigned == false, u8"rhs와 lhs의 사인 타입이 일치 하지 않습니다.");
+	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().GetSize() >= sizeof(std::int32_t), u8"rhs와 lhs의 사이즈가 일치 하지 않습니다. Size=%zu", lhs.GetTypeInfo().GetSize());
+	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().IsUnsigned() == false, u8"rhs와 lhs의 사인 타입이 일치 하지 않습니다.");
 }
 
-mcf::IR::ASM::Add::Add(const Address& lhs, const __int16 rhs) noexcept
+mcf::IR::ASM::Add::Add(const Address& lhs, const std::int16_t rhs) noexcept
 	: _lhs(lhs.Inspect())
 	, _rhs(std::to_string(rhs))
 {
-	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().GetSize() >= sizeof(__int16), u8"rhs와 lhs의 사이즈가 일치 하지 않습니다. Size=%zu", lhs.GetTypeInfo().GetSize());
-	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().IsUnsigned == false, u8"rhs와 lhs의 사인 타입이 일치 하지 않습니다.");
+	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().GetSize() >= sizeof(std::int16_t), u8"rhs와 lhs의 사이즈가 일치 하지 않습니다. Size=%zu", lhs.GetTypeInfo().GetSize());
+	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().IsUnsigned() == false, u8"rhs와 lhs의 사인 타입이 일치 하지 않습니다.");
 }
 
-mcf::IR::ASM::Add::Add(const Address& lhs, const __int8 rhs) noexcept
+mcf::IR::ASM::Add::Add(const Address& lhs, const std::int8_t rhs) noexcept
 	: _lhs(lhs.Inspect())
 	, _rhs(std::to_string(rhs))
 {
-	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().GetSize() >= sizeof(__int8), u8"rhs와 lhs의 사이즈가 일치 하지 않습니다. Size=%zu", lhs.GetTypeInfo().GetSize());
-	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().IsUnsigned == false, u8"rhs와 lhs의 사인 타입이 일치 하지 않습니다.");
+	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().GetSize() >= sizeof(std::int8_t), u8"rhs와 lhs의 사이즈가 일치 하지 않습니다. Size=%zu", lhs.GetTypeInfo().GetSize());
+	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().IsUnsigned() == false, u8"rhs와 lhs의 사인 타입이 일치 하지 않습니다.");
 }
 
-mcf::IR::ASM::Add::Add(const Address& lhs, const unsigned __int64 rhs) noexcept
+mcf::IR::ASM::Add::Add(const Address& lhs, const std::uint64_t rhs) noexcept
 	: _lhs(lhs.Inspect())
 	, _rhs(std::to_string(rhs))
 {
-	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().GetSize() >= sizeof(unsigned __int64), u8"rhs와 lhs의 사이즈가 일치 하지 않습니다. Size=%zu", lhs.GetTypeInfo().GetSize());
-	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().IsUnsigned == true, u8"rhs와 lhs의 사인 타입이 일치 하지 않습니다.");
+	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().GetSize() >= sizeof(std::uint64_t), u8"rhs와 lhs의 사이즈가 일치 하지 않습니다. Size=%zu", lhs.GetTypeInfo().GetSize());
+	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().IsUnsigned() == true, u8"rhs와 lhs의 사인 타입이 일치 하지 않습니다.");
 }
 
-mcf::IR::ASM::Add::Add(const Address& lhs, const unsigned __int32 rhs) noexcept
+mcf::IR::ASM::Add::Add(const Address& lhs, const std::uint32_t rhs) noexcept
 	: _lhs(lhs.Inspect())
 	, _rhs(std::to_string(rhs))
 {
-	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().GetSize() >= sizeof(unsigned __int32), u8"rhs와 lhs의 사이즈가 일치 하지 않습니다. Size=%zu", lhs.GetTypeInfo().GetSize());
-	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().IsUnsigned == true, u8"rhs와 lhs의 사인 타입이 일치 하지 않습니다.");
+	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().GetSize() >= sizeof(std::uint32_t), u8"rhs와 lhs의 사이즈가 일치 하지 않습니다. Size=%zu", lhs.GetTypeInfo().GetSize());
+	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().IsUnsigned() == true, u8"rhs와 lhs의 사인 타입이 일치 하지 않습니다.");
 }
 
-mcf::IR::ASM::Add::Add(const Address& lhs, const unsigned __int16 rhs) noexcept
+mcf::IR::ASM::Add::Add(const Address& lhs, const std::uint16_t rhs) noexcept
 	: _lhs(lhs.Inspect())
 	, _rhs(std::to_string(rhs))
 {
-	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().GetSize() >= sizeof(unsigned __int16), u8"rhs와 lhs의 사이즈가 일치 하지 않습니다. Size=%zu", lhs.GetTypeInfo().GetSize());
-	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().IsUnsigned == true, u8"rhs와 lhs의 사인 타입이 일치 하지 않습니다.");
+	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().GetSize() >= sizeof(std::uint16_t), u8"rhs와 lhs의 사이즈가 일치 하지 않습니다. Size=%zu", lhs.GetTypeInfo().GetSize());
+	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().IsUnsigned() == true, u8"rhs와 lhs의 사인 타입이 일치 하지 않습니다.");
 }
 
-mcf::IR::ASM::Add::Add(const Address& lhs, const unsigned __int8 rhs) noexcept
+mcf::IR::ASM::Add::Add(const Address& lhs, const std::uint8_t rhs) noexcept
 	: _lhs(lhs.Inspect())
 	, _rhs(std::to_string(rhs))
 {
-	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().GetSize() >= sizeof(unsigned __int8), u8"rhs와 lhs의 사이즈가 일치 하지 않습니다. Size=%zu", lhs.GetTypeInfo().GetSize());
-	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().IsUnsigned == true, u8"rhs와 lhs의 사인 타입이 일치 하지 않습니다.");
+	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().GetSize() >= sizeof(std::uint8_t), u8"rhs와 lhs의 사이즈가 일치 하지 않습니다. Size=%zu", lhs.GetTypeInfo().GetSize());
+	MCF_DEBUG_ASSERT(lhs.GetTypeInfo().IsUnsigned() == true, u8"rhs와 lhs의 사인 타입이 일치 하지 않습니다.");
 }
 
 const std::string mcf::IR::ASM::Add::Inspect(void) const noexcept
@@ -1252,20 +1674,20 @@ const std::string mcf::IR::ASM::Add::Inspect(void) const noexcept
 	return "\tadd " + _lhs + ", " + _rhs + "\n";
 }
 
-mcf::IR::ASM::Sub::Sub(const Register minuend, const __int64 subtrahend) noexcept
+mcf::IR::ASM::Sub::Sub(const Register minuend, const std::int64_t subtrahend) noexcept
 	: _minuend(CONVERT_REGISTER_TO_STRING(minuend))
 	, _subtrahend(std::to_string(subtrahend))
 {
 	MCF_DEBUG_ASSERT(minuend != mcf::IR::ASM::Register::INVALID, u8"minuend가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(GET_REGISTER_SIZE_VALUE(minuend) == sizeof(__int64), u8"64비트 레지스터가 아닙니다.");
+	MCF_DEBUG_ASSERT(GET_REGISTER_SIZE_VALUE(minuend) == sizeof(std::int64_t), u8"64비트 레지스터가 아닙니다.");
 }
 
-mcf::IR::ASM::Sub::Sub(const Register minuend, const unsigned __int64 subtrahend) noexcept
+mcf::IR::ASM::Sub::Sub(const Register minuend, const std::uint64_t subtrahend) noexcept
 	: _minuend(CONVERT_REGISTER_TO_STRING(minuend))
 	, _subtrahend(std::to_string(subtrahend))
 {
 	MCF_DEBUG_ASSERT(minuend != mcf::IR::ASM::Register::INVALID, u8"minuend가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(GET_REGISTER_SIZE_VALUE(minuend) == sizeof(__int64), u8"64비트 레지스터가 아닙니다.");
+	MCF_DEBUG_ASSERT(GET_REGISTER_SIZE_VALUE(minuend) == sizeof(std::int64_t), u8"64비트 레지스터가 아닙니다.");
 }
 
 const std::string mcf::IR::ASM::Sub::Inspect(void) const noexcept
@@ -1314,36 +1736,36 @@ mcf::IR::ASM::Cmp::Cmp(const mcf::IR::ASM::Register leftRegister, const mcf::IR:
 	MCF_DEBUG_ASSERT(Internal::IsSizeMatching(leftRegister, rightRegister), u8"64비트 레지스터가 아닙니다.");
 }
 
-mcf::IR::ASM::Cmp::Cmp(const mcf::IR::ASM::Register leftRegister, const __int8 rightValue) noexcept
+mcf::IR::ASM::Cmp::Cmp(const mcf::IR::ASM::Register leftRegister, const std::int8_t rightValue) noexcept
 	: _lhs(mcf::IR::ASM::CONVERT_REGISTER_TO_STRING(leftRegister))
 	, _rhs(std::to_string(static_cast<int>(rightValue)))
 {
 	MCF_DEBUG_ASSERT(leftRegister != mcf::IR::ASM::Register::INVALID, u8"leftRegister가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(GET_REGISTER_SIZE_VALUE(leftRegister) == sizeof(__int8), u8"8비트 레지스터가 아닙니다.");
+	MCF_DEBUG_ASSERT(GET_REGISTER_SIZE_VALUE(leftRegister) == sizeof(std::int8_t), u8"8비트 레지스터가 아닙니다.");
 }
 
-mcf::IR::ASM::Cmp::Cmp(const mcf::IR::ASM::Register leftRegister, const __int16 rightValue) noexcept
+mcf::IR::ASM::Cmp::Cmp(const mcf::IR::ASM::Register leftRegister, const std::int16_t rightValue) noexcept
 	: _lhs(mcf::IR::ASM::CONVERT_REGISTER_TO_STRING(leftRegister))
 	, _rhs(std::to_string(static_cast<int>(rightValue)))
 {
 	MCF_DEBUG_ASSERT(leftRegister != mcf::IR::ASM::Register::INVALID, u8"leftRegister가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(GET_REGISTER_SIZE_VALUE(leftRegister) == sizeof(__int16), u8"16비트 레지스터가 아닙니다.");
+	MCF_DEBUG_ASSERT(GET_REGISTER_SIZE_VALUE(leftRegister) == sizeof(std::int16_t), u8"16비트 레지스터가 아닙니다.");
 }
 
-mcf::IR::ASM::Cmp::Cmp(const mcf::IR::ASM::Register leftRegister, const __int32 rightValue) noexcept
+mcf::IR::ASM::Cmp::Cmp(const mcf::IR::ASM::Register leftRegister, const std::int32_t rightValue) noexcept
 	: _lhs(mcf::IR::ASM::CONVERT_REGISTER_TO_STRING(leftRegister))
 	, _rhs(std::to_string(static_cast<int>(rightValue)))
 {
 	MCF_DEBUG_ASSERT(leftRegister != mcf::IR::ASM::Register::INVALID, u8"leftRegister가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(GET_REGISTER_SIZE_VALUE(leftRegister) == sizeof(__int32), u8"32비트 레지스터가 아닙니다.");
+	MCF_DEBUG_ASSERT(GET_REGISTER_SIZE_VALUE(leftRegister) == sizeof(std::int32_t), u8"32비트 레지스터가 아닙니다.");
 }
 
-mcf::IR::ASM::Cmp::Cmp(const mcf::IR::ASM::Register leftRegister, const __int64 rightValue) noexcept
+mcf::IR::ASM::Cmp::Cmp(const mcf::IR::ASM::Register leftRegister, const std::int64_t rightValue) noexcept
 	: _lhs(mcf::IR::ASM::CONVERT_REGISTER_TO_STRING(leftRegister))
 	, _rhs(std::to_string(static_cast<int>(rightValue)))
 {
 	MCF_DEBUG_ASSERT(leftRegister != mcf::IR::ASM::Register::INVALID, u8"leftRegister가 유효하지 않습니다.");
-	MCF_DEBUG_ASSERT(GET_REGISTER_SIZE_VALUE(leftRegister) == sizeof(__int64), u8"64비트 레지스터가 아닙니다.");
+	MCF_DEBUG_ASSERT(GET_REGISTER_SIZE_VALUE(leftRegister) == sizeof(std::int64_t), u8"64비트 레지스터가 아닙니다.");
 }
 
 const std::string mcf::IR::ASM::Cmp::Inspect(void) const noexcept
@@ -1400,7 +1822,7 @@ mcf::IR::Typedef::Typedef(const mcf::Object::TypeInfo& definedType, const mcf::O
 
 const std::string mcf::IR::Typedef::Inspect(void) const noexcept
 {
-	return _definedType.Name + " typedef " + _sourceType.Inspect();
+	return _definedType.GetName() + " typedef " + _sourceType.Inspect();
 }
 
 mcf::IR::Extern::Extern(const std::string& name, const std::vector<mcf::Object::Variable>& params) noexcept
@@ -1,13 +1,471 @@
 ﻿#include "pch.h"
 #include "internal_parser.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace mcf
+{
+	namespace Parser
+	{
+		namespace Internal
+		{
+			// 괄호의 깊이만 세어 최상위 문장이 끝나는 토큰 인덱스의 다음 위치를 outEnds 에 추가합니다.
+			// #include 는 `>` 로, 블록을 가지는 문장(func, main, while, 블록)은 깊이가 0 으로 돌아오는 `}` 로, 나머지는 `;` 로 끝납니다.
+			// 괄호가 맞지 않거나 마지막 문장이 끝나지 않으면 false 를 반환합니다. 마지막 토큰은 END_OF_FILE 이어야 합니다.
+			static const bool FIND_TOP_LEVEL_STATEMENT_ENDS(const mcf::Lexer::TokenBuffer& tokens, std::vector<size_t>& outEnds) noexcept
+			{
+				const size_t tokenCount = tokens.GetCount();
+				MCF_DEBUG_ASSERT(tokenCount > 0 && tokens.GetType(tokenCount - 1) == mcf::Token::Type::END_OF_FILE, u8"토큰 버퍼는 END_OF_FILE 로 끝나야 합니다.");
+
+				size_t depth = 0;
+				mcf::Token::Type endType = mcf::Token::Type::INVALID;
+				for (size_t i = 0; i + 1 < tokenCount; ++i)
+				{
+					const mcf::Token::Type type = tokens.GetType(i);
+					if (endType == mcf::Token::Type::INVALID)
+					{
+						const bool hasBlock = type == mcf::Token::Type::KEYWORD_FUNC || type == mcf::Token::Type::KEYWORD_MAIN || type == mcf::Token::Type::KEYWORD_WHILE || type == mcf::Token::Type::LBRACE;
+						endType = (type == mcf::Token::Type::MACRO_INCLUDE) ? mcf::Token::Type::GT : (hasBlock ? mcf::Token::Type::RBRACE : mcf::Token::Type::SEMICOLON);
+					}
+
+					switch (type)
+					{
+					case mcf::Token::Type::LPAREN: [[fallthrough]];
+					case mcf::Token::Type::LBRACE: [[fallthrough]];
+					case mcf::Token::Type::LBRACKET:
+						++depth;
+						break;
+
+					case mcf::Token::Type::RPAREN: [[fallthrough]];
+					case mcf::Token::Type::RBRACE: [[fallthrough]];
+					case mcf::Token::Type::RBRACKET:
+						if (depth == 0)
+						{
+							return false;
+						}
+						--depth;
+						break;
+
+					default:
+						break;
+					}
+
+					if (depth == 0 && type == endType)
+					{
+						outEnds.emplace_back(i + 1);
+						endType = mcf::Token::Type::INVALID;
+					}
+				}
+				return endType == mcf::Token::Type::INVALID;
+			}
+
+			// [begin, end) 범위 토큰의 종류와 문자열로 해시를 계산합니다. 위치는 섞지 않으므로 앞쪽의 수정으로 밀려난 문장도 같은 해시가 되며, Offset 은 StatementRebaser 로 옮깁니다.
+			// 긴 문자열 리터럴을 바이트 단위로 섞지 않도록 문자열은 std::hash 로 해시한 뒤 토큰 단위로 FNV-1a 방식으로 섞습니다.
+			static const std::uint64_t HASH_TOKEN_RANGE(const mcf::Lexer::TokenBuffer& tokens, const size_t begin, const size_t end) noexcept
+			{
+				constexpr const std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+				constexpr const std::uint64_t FNV_PRIME = 1099511628211ULL;
+
+				std::uint64_t hash = FNV_OFFSET_BASIS;
+				for (size_t i = begin; i < end; ++i)
+				{
+					hash = (hash ^ static_cast<std::uint64_t>(tokens.GetType(i))) * FNV_PRIME;
+					hash = (hash ^ static_cast<std::uint64_t>(std::hash<std::string_view>()(tokens.GetLiteral(i)))) * FNV_PRIME;
+				}
+				return hash;
+			}
+
+			// [begin, end) 범위 토큰이 차지하는 소스 문자열입니다. 해시가 같아도 이 문자열이 같아야 캐시한 문장을 재사용합니다.
+			// 문자열이 같으면 문장 안의 모든 토큰이 같은 거리만큼 밀려났으므로 StatementRebaser 가 하나의 delta 로 옮길 수 있습니다.
+			static const std::string_view GET_TOKEN_RANGE_TEXT(const mcf::Lexer::TokenBuffer& tokens, const std::string_view sourceView, const size_t begin, const size_t end) noexcept
+			{
+				MCF_DEBUG_ASSERT(begin < end, u8"빈 범위의 문자열은 구할 수 없습니다.");
+				const size_t beginOffset = tokens.GetOffset(begin);
+				const size_t endOffset = tokens.GetOffset(end - 1) + tokens.GetLiteral(end - 1).size();
+				MCF_DEBUG_ASSERT(beginOffset <= endOffset && endOffset <= sourceView.size(), u8"토큰의 위치가 소스를 벗어났습니다.");
+				return sourceView.substr(beginOffset, endOffset - beginOffset);
+			}
+
+			// 캐시한 문장을 새 아레나에 복사하면서 토큰의 Offset 을 delta 만큼 옮깁니다. 이전 소스를 가리키던 토큰 문자열은 새 소스의 같은 위치를 가리키도록 바꾸므로
+			// 복사한 문장은 이전 아레나와 소스 버퍼를 참조하지 않습니다. 문장의 내용이 같으면 새 소스의 해당 위치도 같은 문자열입니다.
+			class StatementRebaser final
+			{
+			public:
+				explicit StatementRebaser(void) noexcept = delete;
+				explicit StatementRebaser(mcf::AST::Arena& arena, const std::string_view oldView, const std::string_view newView, const std::int64_t delta) noexcept
+					: _arena(arena)
+					, _oldView(oldView)
+					, _newView(newView)
+					, _delta(delta)
+				{
+				}
+
+				// 복사할 수 없는 노드(INVALID 나 본문이 파싱되지 않은 함수)가 있으면 nullptr 를 반환합니다.
+				mcf::AST::Statement::Pointer Rebase(const mcf::AST::Statement::Interface* statement) noexcept
+				{
+					_isFailed = false;
+					mcf::AST::Statement::Pointer rebased = RebaseStatement(statement);
+					return _isFailed ? nullptr : rebased;
+				}
+
+			private:
+				const mcf::Token::Data RebaseToken(const mcf::Token::Data& token) const noexcept
+				{
+					mcf::Token::Data rebased = token;
+					rebased.Offset = static_cast<std::uint32_t>(static_cast<std::int64_t>(token.Offset) + _delta);
+					if (token.Offset <= _oldView.size() && token.Literal.data() == _oldView.data() + token.Offset)
+					{
+						rebased.Literal = _newView.substr(rebased.Offset, token.Literal.size());
+					}
+					return rebased;
+				}
+
+				mcf::AST::Statement::Block::Pointer RebaseBlock(const mcf::AST::Statement::Block* block) noexcept
+				{
+					mcf::AST::Statement::PointerVector statements;
+					const size_t statementCount = block->GetStatementCount();
+					for (size_t i = 0; i < statementCount; i++)
+					{
+						statements.emplace_back(RebaseStatement(block->GetUnsafeStatementPointerAt(i)));
+					}
+					return mcf::AST::Statement::Block::Make(_arena, std::move(statements));
+				}
+
+				mcf::AST::Statement::Pointer RebaseStatement(const mcf::AST::Statement::Interface* statement) noexcept
+				{
+					MCF_DEBUG_ASSERT(statement != nullptr, u8"인자로 받은 statement는 nullptr 여선 안됩니다.");
+
+					constexpr const size_t STATEMENT_TYPE_COUNT_BEGIN = __COUNTER__;
+					switch (statement->GetStatementType())
+					{
+					case mcf::AST::Statement::Type::INVALID:
+						break;
+
+					case mcf::AST::Statement::Type::INCLUDE_LIBRARY: __COUNTER__;
+						return mcf::AST::Statement::IncludeLibrary::Make(_arena, RebaseToken(static_cast<const mcf::AST::Statement::IncludeLibrary*>(statement)->GetLibPathToken()));
+
+					case mcf::AST::Statement::Type::TYPEDEF: __COUNTER__;
+						return mcf::AST::Statement::Typedef::Make(_arena, RebaseVariableSignature(static_cast<const mcf::AST::Statement::Typedef*>(statement)->GetUnsafeSignaturePointer()));
+
+					case mcf::AST::Statement::Type::EXTERN: __COUNTER__;
+						return mcf::AST::Statement::Extern::Make(_arena, RebaseFunctionSignature(static_cast<const mcf::AST::Statement::Extern*>(statement)->GetUnsafeSignaturePointer()));
+
+					case mcf::AST::Statement::Type::LET: __COUNTER__;
+					{
+						const mcf::AST::Statement::Let* let = static_cast<const mcf::AST::Statement::Let*>(statement);
+						mcf::AST::Intermediate::VariableSignature::Pointer signature = RebaseVariableSignature(let->GetUnsafeSignaturePointer());
+						mcf::AST::Expression::Pointer expression = let->GetUnsafeExpressionPointer() == nullptr ? nullptr : RebaseExpression(let->GetUnsafeExpressionPointer());
+						return mcf::AST::Statement::Let::Make(_arena, signature, expression);
+					}
+
+					case mcf::AST::Statement::Type::BLOCK: __COUNTER__;
+						return RebaseBlock(static_cast<const mcf::AST::Statement::Block*>(statement));
+
+					case mcf::AST::Statement::Type::RETURN: __COUNTER__;
+						return mcf::AST::Statement::Return::Make(_arena, RebaseExpression(static_cast<const mcf::AST::Statement::Return*>(statement)->GetUnsafeReturnValueExpressionPointer()));
+
+					case mcf::AST::Statement::Type::FUNC: __COUNTER__;
+					{
+						const mcf::AST::Statement::Func* func = static_cast<const mcf::AST::Statement::Func*>(statement);
+						if (func->IsBodyParsed() == false)
+						{
+							break;
+						}
+						mcf::AST::Intermediate::FunctionSignature::Pointer signature = RebaseFunctionSignature(func->GetUnsafeSignaturePointer());
+						mcf::AST::Statement::Block::Pointer block = RebaseBlock(func->GetUnsafeBlockPointer());
+						return mcf::AST::Statement::Func::Make(_arena, signature, block);
+					}
+
+					case mcf::AST::Statement::Type::MAIN: __COUNTER__;
+					{
+						const mcf::AST::Statement::Main* main = static_cast<const mcf::AST::Statement::Main*>(statement);
+						mcf::AST::Intermediate::FunctionParams::Pointer params = RebaseFunctionParams(main->GetUnsafeFunctionParamsPointer());
+						mcf::AST::Intermediate::TypeSignature::Pointer returnType = main->IsReturnVoid() ? nullptr : RebaseTypeSignature(main->GetUnsafeReturnTypePointer());
+						mcf::AST::Statement::Block::Pointer block = RebaseBlock(main->GetUnsafeBlockPointer());
+						return mcf::AST::Statement::Main::Make(_arena, params, returnType, block);
+					}
+
+					case mcf::AST::Statement::Type::EXPRESSION: __COUNTER__;
+						return mcf::AST::Statement::Expression::Make(_arena, RebaseExpression(static_cast<const mcf::AST::Statement::Expression*>(statement)->GetUnsafeExpression()));
+
+					case mcf::AST::Statement::Type::ASSIGN_EXPRESSION: __COUNTER__;
+					{
+						const mcf::AST::Statement::AssignExpression* assign = static_cast<const mcf::AST::Statement::AssignExpression*>(statement);
+						mcf::AST::Expression::Pointer left = RebaseExpression(assign->GetUnsafeLeftExpression());
+						mcf::AST::Expression::Pointer right = RebaseExpression(assign->GetUnsafeRightExpression());
+						return mcf::AST::Statement::AssignExpression::Make(_arena, left, right);
+					}
+
+					case mcf::AST::Statement::Type::UNUSED: __COUNTER__;
+					{
+						const mcf::AST::Statement::Unused* unused = static_cast<const mcf::AST::Statement::Unused*>(statement);
+						std::vector<mcf::AST::Expression::Identifier::Pointer> identifiers;
+						const size_t identifierCount = unused->GetIdentifiersCount();
+						for (size_t i = 0; i < identifierCount; i++)
+						{
+							identifiers.emplace_back(RebaseIdentifier(unused->GetUnsafeIdentifierPointerAt(i)));
+						}
+						return mcf::AST::Statement::Unused::Make(_arena, std::move(identifiers));
+					}
+
+					case mcf::AST::Statement::Type::WHILE: __COUNTER__;
+					{
+						const mcf::AST::Statement::While* whileStatement = static_cast<const mcf::AST::Statement::While*>(statement);
+						mcf::AST::Expression::Pointer condition = RebaseExpression(whileStatement->GetUnsafeConditionPointer());
+						mcf::AST::Statement::Block::Pointer block = RebaseBlock(whileStatement->GetUnsafeBlockPointer());
+						return mcf::AST::Statement::While::Make(_arena, condition, block);
+					}
+
+					case mcf::AST::Statement::Type::BREAK: __COUNTER__;
+						return mcf::AST::Statement::Break::Make(_arena, RebaseToken(static_cast<const mcf::AST::Statement::Break*>(statement)->GetToken()));
+
+					default:
+						MCF_DEBUG_BREAK(u8"예상치 못한 값이 들어왔습니다. StatementType=%s(%zu)", mcf::AST::Statement::CONVERT_TYPE_TO_STRING(statement->GetStatementType()), mcf::ENUM_INDEX(statement->GetStatementType()));
+						break;
+					}
+					constexpr const size_t STATEMENT_TYPE_COUNT = __COUNTER__ - STATEMENT_TYPE_COUNT_BEGIN;
+					static_assert(static_cast<size_t>(mcf::AST::Statement::Type::COUNT) == STATEMENT_TYPE_COUNT, "statement type count is changed. this SWITCH need to be changed as well.");
+					_isFailed = true;
+					return nullptr;
+				}
+
+				mcf::AST::Intermediate::TypeSignature::Pointer RebaseTypeSignature(const mcf::AST::Intermediate::TypeSignature* typeSignature) noexcept
+				{
+					return mcf::AST::Intermediate::TypeSignature::Make(_arena, typeSignature->IsUnsigned(), RebaseExpression(typeSignature->GetUnsafeSignaturePointer()));
+				}
+
+				mcf::AST::Intermediate::VariableSignature::Pointer RebaseVariableSignature(const mcf::AST::Intermediate::VariableSignature* variableSignature) noexcept
+				{
+					mcf::AST::Expression::Identifier::Pointer name = RebaseIdentifier(variableSignature->GetUnsafeNamePointer());
+					mcf::AST::Intermediate::TypeSignature::Pointer typeSignature = RebaseTypeSignature(variableSignature->GetUnsafeTypeSignaturePointer());
+					return mcf::AST::Intermediate::VariableSignature::Make(_arena, name, typeSignature);
+				}
+
+				mcf::AST::Intermediate::FunctionParams::Pointer RebaseFunctionParams(const mcf::AST::Intermediate::FunctionParams* functionParams) noexcept
+				{
+					std::vector<mcf::AST::Intermediate::VariableSignature::Pointer> params;
+					const size_t paramCount = functionParams->GetParamCount();
+					for (size_t i = 0; i < paramCount; i++)
+					{
+						params.emplace_back(RebaseVariableSignature(functionParams->GetUnsafeParamPointerAt(i)));
+					}
+					mcf::AST::Intermediate::Variadic::Pointer variadic = functionParams->HasVariadic() ? mcf::AST::Intermediate::Variadic::Make(_arena, RebaseIdentifier(functionParams->GetUnsafeVariadic()->GetUnsafeNamePointer())) : nullptr;
+					return mcf::AST::Intermediate::FunctionParams::Make(_arena, std::move(params), variadic);
+				}
+
+				mcf::AST::Intermediate::FunctionSignature::Pointer RebaseFunctionSignature(const mcf::AST::Intermediate::FunctionSignature* functionSignature) noexcept
+				{
+					mcf::AST::Expression::Identifier::Pointer name = RebaseIdentifier(functionSignature->GetUnsafeNamePointer());
+					mcf::AST::Intermediate::FunctionParams::Pointer params = RebaseFunctionParams(functionSignature->GetUnsafeFunctionParamsPointer());
+					mcf::AST::Intermediate::TypeSignature::Pointer returnType = functionSignature->IsReturnTypeVoid() ? nullptr : RebaseTypeSignature(functionSignature->GetUnsafeReturnTypePointer());
+					return mcf::AST::Intermediate::FunctionSignature::Make(_arena, name, params, returnType);
+				}
+
+				mcf::AST::Expression::Identifier::Pointer RebaseIdentifier(const mcf::AST::Expression::Identifier* identifier) noexcept
+				{
+					return mcf::AST::Expression::Identifier::Make(_arena, RebaseToken(identifier->GetToken()));
+				}
+
+				mcf::AST::Expression::Pointer RebaseExpression(const mcf::AST::Expression::Interface* expression) noexcept
+				{
+					MCF_DEBUG_ASSERT(expression != nullptr, u8"인자로 받은 expression는 nullptr 여선 안됩니다.");
+
+					constexpr const size_t EXPRESSION_TYPE_COUNT_BEGIN = __COUNTER__;
+					switch (expression->GetExpressionType())
+					{
+					case mcf::AST::Expression::Type::INVALID:
+						break;
+
+					case mcf::AST::Expression::Type::IDENTIFIER: __COUNTER__;
+						return RebaseIdentifier(static_cast<const mcf::AST::Expression::Identifier*>(expression));
+
+					case mcf::AST::Expression::Type::INTEGER: __COUNTER__;
+						return mcf::AST::Expression::Integer::Make(_arena, RebaseToken(static_cast<const mcf::AST::Expression::Integer*>(expression)->GetToken()));
+
+					case mcf::AST::Expression::Type::STRING: __COUNTER__;
+						return mcf::AST::Expression::String::Make(_arena, RebaseToken(static_cast<const mcf::AST::Expression::String*>(expression)->GetToken()));
+
+					case mcf::AST::Expression::Type::PREFIX: __COUNTER__;
+					{
+						const mcf::AST::Expression::Prefix* prefix = static_cast<const mcf::AST::Expression::Prefix*>(expression);
+						return mcf::AST::Expression::Prefix::Make(_arena, RebaseToken(prefix->GetPrefixOperator()), RebaseExpression(prefix->GetUnsafeRightExpressionPointer()));
+					}
+
+					case mcf::AST::Expression::Type::GROUP: __COUNTER__;
+						return mcf::AST::Expression::Group::Make(_arena, RebaseExpression(static_cast<const mcf::AST::Expression::Group*>(expression)->GetUnsafeExpressionPointer()));
+
+					case mcf::AST::Expression::Type::INFIX: __COUNTER__;
+					{
+						const mcf::AST::Expression::Infix* infix = static_cast<const mcf::AST::Expression::Infix*>(expression);
+						mcf::AST::Expression::Pointer left = RebaseExpression(infix->GetUnsafeLeftExpressionPointer());
+						mcf::AST::Expression::Pointer right = RebaseExpression(infix->GetUnsafeRightExpressionPointer());
+						return mcf::AST::Expression::Infix::Make(_arena, left, RebaseToken(infix->GetInfixOperator()), right);
+					}
+
+					case mcf::AST::Expression::Type::CALL: __COUNTER__;
+					{
+						const mcf::AST::Expression::Call* call = static_cast<const mcf::AST::Expression::Call*>(expression);
+						mcf::AST::Expression::Pointer left = RebaseExpression(call->GetUnsafeLeftExpressionPointer());
+						mcf::AST::Expression::PointerVector params;
+						const size_t paramCount = call->GetParamExpressionsCount();
+						for (size_t i = 0; i < paramCount; i++)
+						{
+							params.emplace_back(RebaseExpression(call->GetUnsafeParamExpressionPointerAt(i)));
+						}
+						return mcf::AST::Expression::Call::Make(_arena, left, std::move(params));
+					}
+
+					case mcf::AST::Expression::Type::AS: __COUNTER__;
+					{
+						const mcf::AST::Expression::As* as = static_cast<const mcf::AST::Expression::As*>(expression);
+						mcf::AST::Expression::Pointer left = RebaseExpression(as->GetUnsafeLeftExpressionPointer());
+						mcf::AST::Intermediate::TypeSignature::Pointer typeSignature = RebaseTypeSignature(as->GetUnsafeTypeSignatureIntermediatePointer());
+						return mcf::AST::Expression::As::Make(_arena, left, typeSignature);
+					}
+
+					case mcf::AST::Expression::Type::INDEX: __COUNTER__;
+					{
+						const mcf::AST::Expression::Index* index = static_cast<const mcf::AST::Expression::Index*>(expression);
+						mcf::AST::Expression::Pointer left = RebaseExpression(index->GetUnsafeLeftExpressionPointer());
+						mcf::AST::Expression::Pointer indexExpression = index->GetUnsafeIndexExpressionPointer() == nullptr ? nullptr : RebaseExpression(index->GetUnsafeIndexExpressionPointer());
+						return mcf::AST::Expression::Index::Make(_arena, left, indexExpression);
+					}
+
+					case mcf::AST::Expression::Type::INITIALIZER: __COUNTER__;
+					{
+						const mcf::AST::Expression::Initializer* initializer = static_cast<const mcf::AST::Expression::Initializer*>(expression);
+						mcf::AST::Expression::PointerVector keys;
+						const size_t keyCount = initializer->GetKeyExpressionCount();
+						for (size_t i = 0; i < keyCount; i++)
+						{
+							keys.emplace_back(RebaseExpression(initializer->GetUnsafeKeyExpressionPointerAt(i)));
+						}
+						return mcf::AST::Expression::Initializer::Make(_arena, std::move(keys));
+					}
+
+					case mcf::AST::Expression::Type::MAP_INITIALIZER: __COUNTER__;
+					{
+						const mcf::AST::Expression::MapInitializer* mapInitializer = static_cast<const mcf::AST::Expression::MapInitializer*>(expression);
+						mcf::AST::Expression::PointerVector keys;
+						mcf::AST::Expression::PointerVector values;
+						const size_t keyCount = mapInitializer->GetKeyExpressionCount();
+						for (size_t i = 0; i < keyCount; i++)
+						{
+							keys.emplace_back(RebaseExpression(mapInitializer->GetUnsafeKeyExpressionPointerAt(i)));
+							values.emplace_back(RebaseExpression(mapInitializer->GetUnsafeValueExpressionPointerAt(i)));
+						}
+						return mcf::AST::Expression::MapInitializer::Make(_arena, std::move(keys), std::move(values));
+					}
+
+					default:
+						MCF_DEBUG_BREAK(u8"예상치 못한 값이 들어왔습니다. ExpressionType=%s(%zu)", mcf::AST::Expression::CONVERT_TYPE_TO_STRING(expression->GetExpressionType()), mcf::ENUM_INDEX(expression->GetExpressionType()));
+						break;
+					}
+					constexpr const size_t EXPRESSION_TYPE_COUNT = __COUNTER__ - EXPRESSION_TYPE_COUNT_BEGIN;
+					static_assert(static_cast<size_t>(mcf::AST::Expression::Type::COUNT) == EXPRESSION_TYPE_COUNT, "expression type count is changed. this SWITCH need to be changed as well.");
+					_isFailed = true;
+					return nullptr;
+				}
+
+			private:
+				mcf::AST::Arena& _arena;
+				const std::string_view _oldView;
+				const std::string_view _newView;
+				const std::int64_t _delta;
+				bool _isFailed = false;
+			};
+		}
+
+		// 지연 파싱된 함수 본문을 파싱합니다. 원본 파서의 토큰 버퍼를 넘겨받아 프로그램이 살아있는 동안 보관합니다.
+		class Object::LazyBodyParser final : public mcf::AST::BodyParser
+		{
+		public:
+			explicit LazyBodyParser(void) noexcept = delete;
+			explicit LazyBodyParser(const std::string& name, const mcf::Lexer::Source& source, const std::shared_ptr<mcf::Symbol::Table>& symbols, mcf::Lexer::TokenBuffer&& tokens) noexcept
+				: _name(name)
+				, _source(source)
+				, _symbols(symbols)
+				, _tokens(std::move(tokens))
+			{
+			}
+
+			virtual mcf::AST::Statement::Block::Pointer ParseBody(mcf::AST::Arena& arena, const size_t beginTokenIndex, const size_t endTokenIndex) noexcept override final
+			{
+				mcf::Parser::Object parser(_name, _source, _symbols, &_tokens, beginTokenIndex, endTokenIndex);
+				if (parser._currentToken.Type != mcf::Token::Type::LBRACE)
+				{
+					MCF_DEBUG_BREAK(u8"함수 본문은 LBRACE('{')로 시작해야 합니다.");
+					return nullptr;
+				}
+
+				parser._arena = std::make_unique<mcf::AST::Arena>();
+				mcf::AST::Statement::Pointer block = parser.ParseBlockStatement();
+				if (block == nullptr || block->GetStatementType() != mcf::AST::Statement::Type::BLOCK || parser._nextToken.Type != mcf::Token::Type::END_OF_FILE || parser.GetErrorCount() != 0)
+				{
+					return nullptr;
+				}
+				arena.Adopt(std::move(*parser._arena));
+				return static_cast<mcf::AST::Statement::Block*>(block);
+			}
+
+		private:
+			const std::string _name;
+			const mcf::Lexer::Source _source;
+			const std::shared_ptr<mcf::Symbol::Table> _symbols;
+			const mcf::Lexer::TokenBuffer _tokens;
+		};
+	}
+}
+
 mcf::Parser::Object::Object(const std::string& input, const bool isFile) noexcept
-	: _lexer(input, isFile)
+	: Object(input, isFile, std::make_shared<mcf::Symbol::Table>())
+{
+}
+
+mcf::Parser::Object::Object(const std::string& input, const bool isFile, const std::shared_ptr<mcf::Symbol::Table>& symbols) noexcept
+	: Object(input, isFile ? mcf::Lexer::SourceBuffer::MakeFromFile(input) : mcf::Lexer::SourceBuffer::MakeFromString(input), symbols)
+{
+}
+
+mcf::Parser::Object::Object(const std::string& name, const mcf::Lexer::Source& source, const std::shared_ptr<mcf::Symbol::Table>& symbols) noexcept
+	: _lexer(name, source)
+	, _symbols(symbols)
 {
 	if (CheckErrorOnInit() == false)
 	{
 		return;
 	}
+	// 입력 전체를 한번에 토큰 버퍼로 만든 뒤 버퍼에서 토큰을 읽습니다. 파서는 주석을 사용하지 않으므로 주석 토큰은 만들지 않습니다.
+	_lexer.SetSymbolTable(_symbols.get());
+	_lexer.SetCommentSkipping(true, nullptr);
+	_lexer.TokenizeAll(_tokens);
+	MCF_DEBUG_ASSERT(_tokens.GetCount() > 0 && _tokens.GetType(_tokens.GetCount() - 1) == Token::Type::END_OF_FILE, u8"토큰 버퍼는 END_OF_FILE 로 끝나야 합니다.");
+	_tokenSource = &_tokens;
+	_tokenEnd = _tokens.GetCount() - 1;
+	_endToken = _tokens.GetToken(_tokenEnd);
+	ReadNextToken(); // _currentToken = invalid; _nextToken = valid;
+	ReadNextToken(); // _currentToken = valid; _nextToken = valid;
+}
+
+mcf::Parser::Object::Object(const Object& parent, const size_t beginTokenIndex, const size_t endTokenIndex) noexcept
+	: Object(parent._lexer.GetName(), parent._lexer.GetSource(), parent._symbols, parent._tokenSource, beginTokenIndex, endTokenIndex)
+{
+	_isLazyFunctionBody = parent._isLazyFunctionBody;
+}
+
+mcf::Parser::Object::Object(const std::string& name, const mcf::Lexer::Source& source, const std::shared_ptr<mcf::Symbol::Table>& symbols,
+	_Notnull_ const mcf::Lexer::TokenBuffer* tokens, const size_t beginTokenIndex, const size_t endTokenIndex) noexcept
+	: _lexer(name, source)
+	, _symbols(symbols)
+	, _tokenSource(tokens)
+	, _tokenEnd(endTokenIndex)
+	, _nextTokenIndex(beginTokenIndex)
+{
+	MCF_DEBUG_ASSERT(beginTokenIndex < endTokenIndex && endTokenIndex < _tokenSource->GetCount(), u8"토큰 범위가 잘못되었습니다. begin=%zu, end=%zu", beginTokenIndex, endTokenIndex);
+	// 범위 다음 토큰의 위치를 END_OF_FILE 의 위치로 사용합니다.
+	_endToken = mcf::Token::Data{ mcf::Token::Type::END_OF_FILE, "\0", _tokenSource->GetOffset(endTokenIndex) };
 	ReadNextToken(); // _currentToken = invalid; _nextToken = valid;
 	ReadNextToken(); // _currentToken = valid; _nextToken = valid;
 }
@@ -16,36 +474,147 @@ const mcf::Parser::ErrorInfo mcf::Parser::Object::PopLastError(void) noexcept
 {
 	if (_errors.empty())
 	{
-		return { ErrorID::SUCCESS, _lexer.GetName(), std::string(), 0, 0 };
+		return { ErrorID::SUCCESS, _lexer.GetName(), std::string(), 0 };
 	}
 
-	const ErrorInfo error = _errors.top();
+	// 줄 번호와 인덱스는 에러를 꺼낼 때만 오프셋으로 계산합니다.
+	ErrorInfo error = _errors.top();
 	_errors.pop();
+	const mcf::Lexer::Source& source = _lexer.GetSource();
+	if (source != nullptr)
+	{
+		error.Line = source->GetLine(error.Offset);
+		error.Index = source->GetIndex(error.Offset);
+	}
 	return error;
 }
 
 void mcf::Parser::Object::ParseProgram(mcf::AST::Program& outProgram) noexcept
 {
+	_arena = std::make_unique<mcf::AST::Arena>();
+	mcf::AST::Statement::PointerVector statements;
+	if (ParseStatements(statements) == false)
+	{
+		return;
+	}
+	MoveToProgram(outProgram, std::move(statements));
+}
+
+void mcf::Parser::Object::ParseProgramParallel(mcf::AST::Program& outProgram, const size_t threadCount, const size_t chunkTokenCount) noexcept
+{
+	const size_t actualThreadCount = (threadCount != 0) ? threadCount : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+	const size_t actualChunkTokenCount = (chunkTokenCount != 0) ? chunkTokenCount : mcf::Parser::DEFAULT_PARALLEL_CHUNK_TOKEN_COUNT;
+	std::vector<size_t> statementEnds;
+	if (actualThreadCount == 1 || _tokenSource == nullptr || _tokenEnd <= actualChunkTokenCount || Internal::FIND_TOP_LEVEL_STATEMENT_ENDS(*_tokenSource, statementEnds) == false)
+	{
+		ParseProgram(outProgram);
+		return;
+	}
+
+	// 문장 경계에서 actualChunkTokenCount 이상이 되도록 묶습니다. 청크 i 는 [chunkBegins[i], chunkBegins[i + 1]) 입니다.
+	std::vector<size_t> chunkBegins = { 0 };
+	for (const size_t statementEnd : statementEnds)
+	{
+		if (statementEnd - chunkBegins.back() >= actualChunkTokenCount || statementEnd == _tokenEnd)
+		{
+			chunkBegins.emplace_back(statementEnd);
+		}
+	}
+	const size_t chunkCount = chunkBegins.size() - 1;
+
+	std::vector<std::unique_ptr<mcf::Parser::Object>> chunkParsers(chunkCount);
+	std::vector<mcf::AST::Statement::PointerVector> chunkStatements(chunkCount);
+	std::unique_ptr<bool[]> chunkResults(new bool[chunkCount]);
+	std::atomic<size_t> nextChunkIndex(0);
+	const auto parseChunks = [&]() noexcept
+	{
+		for (size_t chunkIndex = nextChunkIndex.fetch_add(1); chunkIndex < chunkCount; chunkIndex = nextChunkIndex.fetch_add(1))
+		{
+			chunkParsers[chunkIndex].reset(new mcf::Parser::Object(*this, chunkBegins[chunkIndex], chunkBegins[chunkIndex + 1]));
+			mcf::Parser::Object& chunkParser = *chunkParsers[chunkIndex];
+			chunkParser._arena = std::make_unique<mcf::AST::Arena>();
+			chunkResults[chunkIndex] = chunkParser.ParseStatements(chunkStatements[chunkIndex]);
+		}
+	};
+
+	std::vector<std::thread> workers;
+	const size_t workerCount = std::min(actualThreadCount, chunkCount) - 1;
+	workers.reserve(workerCount);
+	for (size_t i = 0; i < workerCount; ++i)
+	{
+		workers.emplace_back(parseChunks);
+	}
+	parseChunks();
+	for (size_t i = 0; i < workerCount; ++i)
+	{
+		workers[i].join();
+	}
+
+	// 에러의 종류와 위치가 순차 파싱과 같도록 에러가 있으면 처음부터 다시 파싱합니다.
+	size_t statementCount = 0;
+	for (size_t i = 0; i < chunkCount; ++i)
+	{
+		if (chunkResults[i] == false)
+		{
+			ParseProgram(outProgram);
+			return;
+		}
+		statementCount += chunkStatements[i].size();
+	}
+
+	_arena = std::make_unique<mcf::AST::Arena>();
 	mcf::AST::Statement::PointerVector statements;
+	statements.reserve(statementCount);
+	for (size_t i = 0; i < chunkCount; ++i)
+	{
+		_arena->Adopt(std::move(*chunkParsers[i]->_arena));
+		statements.insert(statements.end(), chunkStatements[i].begin(), chunkStatements[i].end());
+	}
+	MoveToProgram(outProgram, std::move(statements));
+}
+
+const bool mcf::Parser::Object::ParseStatements(_Out_ mcf::AST::Statement::PointerVector& outStatements) noexcept
+{
 	while (_currentToken.Type != mcf::Token::Type::END_OF_FILE)
 	{
-		statements.emplace_back(ParseStatement());
-		if (statements.back().get() == nullptr || statements.back()->GetStatementType() == mcf::AST::Statement::Type::INVALID)
+		outStatements.emplace_back(ParseStatement());
+		if (outStatements.back() == nullptr || outStatements.back()->GetStatementType() == mcf::AST::Statement::Type::INVALID)
 		{
 			const std::string message = mcf::Internal::ErrorMessage(u8"파싱에 실패하였습니다.");
-			_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
-			return;
+			_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _nextToken.Offset });
+			return false;
 		}
 
 		// read next token
 		ReadNextToken();
 	}
-	outProgram = mcf::AST::Program(std::move(statements));
+	return true;
+}
+
+void mcf::Parser::Object::MoveToProgram(_Out_ mcf::AST::Program& outProgram, mcf::AST::Statement::PointerVector&& statements) noexcept
+{
+	// 건너뛴 본문이 없으면 토큰 버퍼를 넘길 필요가 없습니다.
+	const auto isLazyFunc = [](const mcf::AST::Statement::Interface* statement) noexcept
+	{
+		return statement->GetStatementType() == mcf::AST::Statement::Type::FUNC && static_cast<const mcf::AST::Statement::Func*>(statement)->IsBodyParsed() == false;
+	};
+	if (_isLazyFunctionBody == false || std::any_of(statements.begin(), statements.end(), isLazyFunc) == false)
+	{
+		outProgram = mcf::AST::Program(std::move(_arena), std::move(statements), _lexer.GetSource(), _symbols);
+		return;
+	}
+
+	// 본문의 토큰 범위는 _tokens 의 인덱스이므로 토큰 버퍼를 본문 파서에 넘깁니다. 이후 이 파서는 END_OF_FILE 만 읽습니다.
+	std::unique_ptr<mcf::AST::BodyParser> bodyParser = std::make_unique<LazyBodyParser>(_lexer.GetName(), _lexer.GetSource(), _symbols, std::move(_tokens));
+	_tokenSource = nullptr;
+	_tokenEnd = 0;
+	_nextTokenIndex = 0;
+	outProgram = mcf::AST::Program(std::move(_arena), std::move(statements), _lexer.GetSource(), _symbols, std::move(bodyParser));
 }
 
 mcf::AST::Statement::Pointer mcf::Parser::Object::ParseStatement(void) noexcept
 {
-	mcf::AST::Statement::Pointer statement;
+	mcf::AST::Statement::Pointer statement = nullptr;
 	constexpr const size_t TOKENTYPE_COUNT_BEGIN = __COUNTER__;
 	switch (_currentToken.Type)
 	{
@@ -137,8 +706,8 @@ mcf::AST::Statement::Pointer mcf::Parser::Object::ParseStatement(void) noexcept
 	default:
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"예상치 못한 값이 들어왔습니다. 확인 해 주세요. TokenType=%s(%zu) TokenLiteral=`%s`",
-			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
-		_errors.push(ErrorInfo{ ErrorID::NOT_REGISTERED_STATEMENT_TOKEN, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
+			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), std::string(_currentToken.Literal).c_str());
+		_errors.push(ErrorInfo{ ErrorID::NOT_REGISTERED_STATEMENT_TOKEN, _lexer.GetName(), message, _currentToken.Offset });
 		break;
 	}
 	}
@@ -150,38 +719,38 @@ mcf::AST::Statement::Pointer mcf::Parser::Object::ParseStatement(void) noexcept
 mcf::AST::Statement::Pointer mcf::Parser::Object::ParseIncludeLibraryStatement(void) noexcept
 {
 	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::MACRO_INCLUDE, u8"이 함수가 호출될때 현재 토큰이 `MACRO_INCLUDE`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
-		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
+		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), std::string(_currentToken.Literal).c_str());
 
 	if (ReadNextTokenIf(mcf::Token::Type::LT) == false)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `LT`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
-		return mcf::AST::Statement::Invalid::Make();
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
+		return mcf::AST::Statement::Invalid::Make(*_arena);
 	}
 
 	if (ReadNextTokenIf(mcf::Token::Type::KEYWORD_ASM) == false)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `KEYWORD_ASM`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
-		return mcf::AST::Statement::Invalid::Make();
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
+		return mcf::AST::Statement::Invalid::Make(*_arena);
 	}
 
 	if (ReadNextTokenIf(mcf::Token::Type::COMMA) == false)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `COMMA`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
-		return mcf::AST::Statement::Invalid::Make();
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
+		return mcf::AST::Statement::Invalid::Make(*_arena);
 	}
 
 	if (ReadNextTokenIf(mcf::Token::Type::STRING) == false)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `STRING`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
-		return mcf::AST::Statement::Invalid::Make();
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
+		return mcf::AST::Statement::Invalid::Make(*_arena);
 	}
 	mcf::Token::Data libPath = _currentToken;
 
@@ -189,90 +758,90 @@ mcf::AST::Statement::Pointer mcf::Parser::Object::ParseIncludeLibraryStatement(v
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `GT`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
-		return mcf::AST::Statement::Invalid::Make();
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
+		return mcf::AST::Statement::Invalid::Make(*_arena);
 	}
-	return mcf::AST::Statement::IncludeLibrary::Make(libPath);
+	return mcf::AST::Statement::IncludeLibrary::Make(*_arena, libPath);
 }
 
 mcf::AST::Statement::Pointer mcf::Parser::Object::ParseTypedefStatement(void) noexcept
 {
 	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::KEYWORD_TYPEDEF, u8"이 함수가 호출될때 현재 토큰이 `KEYWORD_TYPEDEF`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
-		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
+		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), std::string(_currentToken.Literal).c_str());
 
 	ReadNextToken();
 	mcf::AST::Statement::Typedef::SignaturePointer signature = ParseVariableSignatureIntermediate();
-	if (signature.get() == nullptr || signature->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
+	if (signature == nullptr || signature->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"Typedef 명령문 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-		return mcf::AST::Statement::Invalid::Make();
+		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Offset });
+		return mcf::AST::Statement::Invalid::Make(*_arena);
 	}
 
 	if (ReadNextTokenIf(mcf::Token::Type::SEMICOLON) == false)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `SEMICOLON`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
-		return mcf::AST::Statement::Invalid::Make();
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
+		return mcf::AST::Statement::Invalid::Make(*_arena);
 	}
 
-	return mcf::AST::Statement::Typedef::Make(std::move(signature));
+	return mcf::AST::Statement::Typedef::Make(*_arena, std::move(signature));
 }
 
 mcf::AST::Statement::Pointer mcf::Parser::Object::ParseExternStatement(void) noexcept
 {
 	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::KEYWORD_EXTERN, u8"이 함수가 호출될때 현재 토큰이 `KEYWORD_EXTERN`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
-		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
+		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), std::string(_currentToken.Literal).c_str());
 
 	ReadNextToken();
 	mcf::AST::Intermediate::FunctionSignature::Pointer signature = ParseFunctionSignatureIntermediate();
-	if (signature.get() == nullptr || signature->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
+	if (signature == nullptr || signature->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"Extern 명령문 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-		return mcf::AST::Statement::Invalid::Make();
+		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Offset });
+		return mcf::AST::Statement::Invalid::Make(*_arena);
 	}
 
 	if (ReadNextTokenIf(mcf::Token::Type::SEMICOLON) == false)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `SEMICOLON`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
-		return mcf::AST::Statement::Invalid::Make();
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
+		return mcf::AST::Statement::Invalid::Make(*_arena);
 	}
 
-	return mcf::AST::Statement::Extern::Make(std::move(signature));
+	return mcf::AST::Statement::Extern::Make(*_arena, std::move(signature));
 }
 
 mcf::AST::Statement::Pointer mcf::Parser::Object::ParseLetStatement(void) noexcept
 {
 	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::KEYWORD_LET, u8"이 함수가 호출될때 현재 토큰이 `KEYWORD_LET`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
-		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
+		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), std::string(_currentToken.Literal).c_str());
 
 	ReadNextToken();
 	mcf::AST::Intermediate::VariableSignature::Pointer signature = ParseVariableSignatureIntermediate();
-	if (signature.get() == nullptr || signature->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
+	if (signature == nullptr || signature->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"Let 명령문 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-		return mcf::AST::Statement::Invalid::Make();
+		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Offset });
+		return mcf::AST::Statement::Invalid::Make(*_arena);
 	}
 
-	mcf::AST::Expression::Pointer expression;
+	mcf::AST::Expression::Pointer expression = nullptr;
 	if (ReadNextTokenIf(mcf::Token::Type::ASSIGN) == true)
 	{
 		ReadNextToken();
 		expression = ParseExpression(Precedence::LOWEST);
-		if (expression.get() == nullptr || expression->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
+		if (expression == nullptr || expression->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
 		{
 			const std::string message = mcf::Internal::ErrorMessage(u8"Let 명령문 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 				mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-			_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-			return mcf::AST::Statement::Invalid::Make();
+			_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Offset });
+			return mcf::AST::Statement::Invalid::Make(*_arena);
 		}
 	}
 
@@ -280,17 +849,17 @@ mcf::AST::Statement::Pointer mcf::Parser::Object::ParseLetStatement(void) noexce
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `SEMICOLON`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
-		return mcf::AST::Statement::Invalid::Make();
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
+		return mcf::AST::Statement::Invalid::Make(*_arena);
 	}
 
-	return mcf::AST::Statement::Let::Make(std::move(signature), std::move(expression));
+	return mcf::AST::Statement::Let::Make(*_arena, std::move(signature), std::move(expression));
 }
 
 mcf::AST::Statement::Pointer mcf::Parser::Object::ParseBlockStatement(void) noexcept
 {
 	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::LBRACE, u8"이 함수가 호출될때 현재 토큰이 `LBRACE`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
-		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
+		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), std::string(_currentToken.Literal).c_str());
 
 	mcf::AST::Statement::PointerVector statements;
 	while (ReadNextTokenIf(mcf::Token::Type::RBRACE) == false)
@@ -299,88 +868,109 @@ mcf::AST::Statement::Pointer mcf::Parser::Object::ParseBlockStatement(void) noex
 		{
 			const std::string message = mcf::Internal::ErrorMessage(u8"Block 명령문 파싱중 파일의 끝에 도달 했습니다. Block 명령문은 반드시 RBRACE('}')로 끝나야 합니다.",
 				mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
-			return mcf::AST::Statement::Invalid::Make();
+			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
+			return mcf::AST::Statement::Invalid::Make(*_arena);
 		}
 
 		ReadNextToken();
 		statements.emplace_back(ParseStatement());
-		if (statements.back().get() == nullptr || statements.back()->GetStatementType() == mcf::AST::Statement::Type::INVALID)
+		if (statements.back() == nullptr || statements.back()->GetStatementType() == mcf::AST::Statement::Type::INVALID)
 		{
 			const std::string message = mcf::Internal::ErrorMessage(u8"Block 명령문 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 				mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-			_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-			return mcf::AST::Statement::Invalid::Make();
+			_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Offset });
+			return mcf::AST::Statement::Invalid::Make(*_arena);
 		}
 	}
 
-	return mcf::AST::Statement::Block::Make(std::move(statements));
+	return mcf::AST::Statement::Block::Make(*_arena, std::move(statements));
 }
 
 mcf::AST::Statement::Pointer mcf::Parser::Object::ParseReturnStatement(void) noexcept
 {
 	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::KEYWORD_RETURN, u8"이 함수가 호출될때 현재 토큰이 `KEYWORD_RETURN`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
-		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
+		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), std::string(_currentToken.Literal).c_str());
 
 	ReadNextToken();
 	mcf::AST::Expression::Pointer returnValue = ParseExpression(Precedence::LOWEST);
-	if (returnValue.get() == nullptr || returnValue->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
+	if (returnValue == nullptr || returnValue->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"Return 명령문 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-		return mcf::AST::Statement::Invalid::Make();
+		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Offset });
+		return mcf::AST::Statement::Invalid::Make(*_arena);
 	}
 
 	if (ReadNextTokenIf(mcf::Token::Type::SEMICOLON) == false)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `SEMICOLON`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
-		return mcf::AST::Statement::Invalid::Make();
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
+		return mcf::AST::Statement::Invalid::Make(*_arena);
 	}
 
-	return mcf::AST::Statement::Return::Make(std::move(returnValue));
+	return mcf::AST::Statement::Return::Make(*_arena, std::move(returnValue));
 }
 
 mcf::AST::Statement::Pointer mcf::Parser::Object::ParseFuncStatement(void) noexcept
 {
 	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::KEYWORD_FUNC, u8"이 함수가 호출될때 현재 토큰이 `KEYWORD_FUNC`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
-		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
+		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), std::string(_currentToken.Literal).c_str());
 
 	mcf::AST::Intermediate::FunctionSignature::Pointer signature = ParseFunctionSignatureIntermediate();
-	if (signature.get() == nullptr || signature->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
+	if (signature == nullptr || signature->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"Func 명령문 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-		return mcf::AST::Statement::Invalid::Make();
+		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Offset });
+		return mcf::AST::Statement::Invalid::Make(*_arena);
 	}
 
 	ReadNextToken();
+	// 지연 파싱은 본문의 중괄호 짝만 맞춰 건너뜁니다. 본문이 범위 안에서 끝나지 않으면 에러를 남기도록 바로 파싱합니다.
+	if (_isLazyFunctionBody && _currentToken.Type == mcf::Token::Type::LBRACE && _nextToken.Type != mcf::Token::Type::END_OF_FILE)
+	{
+		const size_t bodyBeginTokenIndex = _nextTokenIndex - 2;
+		size_t depth = 1;
+		for (size_t i = _nextTokenIndex - 1; i < _tokenEnd; ++i)
+		{
+			const mcf::Token::Type type = _tokenSource->GetType(i);
+			depth += (type == mcf::Token::Type::LBRACE) ? 1 : 0;
+			depth -= (type == mcf::Token::Type::RBRACE) ? 1 : 0;
+			if (depth == 0)
+			{
+				// 블록 파싱이 끝난 것과 같이 현재 토큰이 본문의 RBRACE('}')가 되도록 맞춥니다.
+				_nextTokenIndex = i;
+				ReadNextToken();
+				ReadNextToken();
+				return mcf::AST::Statement::Func::Make(*_arena, std::move(signature), static_cast<std::uint32_t>(bodyBeginTokenIndex), static_cast<std::uint32_t>(i + 1));
+			}
+		}
+	}
+
 	mcf::AST::Statement::Pointer statementBlock = ParseBlockStatement();
-	if (statementBlock.get() == nullptr || statementBlock->GetStatementType() != mcf::AST::Statement::Type::BLOCK)
+	if (statementBlock == nullptr || statementBlock->GetStatementType() != mcf::AST::Statement::Type::BLOCK)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"Func 명령문 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-		return mcf::AST::Statement::Invalid::Make();
+		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Offset });
+		return mcf::AST::Statement::Invalid::Make(*_arena);
 	}
-	return mcf::AST::Statement::Func::Make(std::move(signature), std::move(mcf::AST::Statement::Block::Pointer(static_cast<mcf::AST::Statement::Block*>(statementBlock.release()))));
+	return mcf::AST::Statement::Func::Make(*_arena, std::move(signature), static_cast<mcf::AST::Statement::Block*>(statementBlock));
 }
 
 mcf::AST::Statement::Pointer mcf::Parser::Object::ParseMainStatement(void) noexcept
 {
 	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::KEYWORD_MAIN, u8"이 함수가 호출될때 현재 토큰이 `KEYWORD_MAIN`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
-		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
+		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), std::string(_currentToken.Literal).c_str());
 
 	ReadNextToken();
 	mcf::AST::Intermediate::FunctionParams::Pointer params = ParseFunctionParamsIntermediate();
-	if (params.get() == nullptr || params->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
+	if (params == nullptr || params->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"Main 명령문 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
+		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Offset });
 		return nullptr;
 	}
 
@@ -388,7 +978,7 @@ mcf::AST::Statement::Pointer mcf::Parser::Object::ParseMainStatement(void) noexc
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `POINTING`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
 		return nullptr;
 	}
 
@@ -396,48 +986,48 @@ mcf::AST::Statement::Pointer mcf::Parser::Object::ParseMainStatement(void) noexc
 	{
 		ReadNextToken();
 		mcf::AST::Statement::Pointer statementBlock = ParseBlockStatement();
-		if (statementBlock.get() == nullptr || statementBlock->GetStatementType() != mcf::AST::Statement::Type::BLOCK)
+		if (statementBlock == nullptr || statementBlock->GetStatementType() != mcf::AST::Statement::Type::BLOCK)
 		{
 			const std::string message = mcf::Internal::ErrorMessage(u8"Main 명령문 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 				mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-			_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-			return mcf::AST::Statement::Invalid::Make();
+			_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Offset });
+			return mcf::AST::Statement::Invalid::Make(*_arena);
 		}
 
-		return mcf::AST::Statement::Main::Make(std::move(params), nullptr, std::move(mcf::AST::Statement::Block::Pointer(static_cast<mcf::AST::Statement::Block*>(statementBlock.release()))));
+		return mcf::AST::Statement::Main::Make(*_arena, std::move(params), nullptr, static_cast<mcf::AST::Statement::Block*>(statementBlock));
 	}
 
 	ReadNextToken();
 	mcf::AST::Intermediate::TypeSignature::Pointer returnType = ParseTypeSignatureIntermediate();
-	if (returnType.get() == nullptr || returnType->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
+	if (returnType == nullptr || returnType->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"Main 명령문 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
+		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Offset });
 		return nullptr;
 	}
 
 	ReadNextToken();
 	mcf::AST::Statement::Pointer statementBlock = ParseBlockStatement();
-	if (statementBlock.get() == nullptr || statementBlock->GetStatementType() != mcf::AST::Statement::Type::BLOCK)
+	if (statementBlock == nullptr || statementBlock->GetStatementType() != mcf::AST::Statement::Type::BLOCK)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"Main 명령문 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-		return mcf::AST::Statement::Invalid::Make();
+		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Offset });
+		return mcf::AST::Statement::Invalid::Make(*_arena);
 	}
 
-	return mcf::AST::Statement::Main::Make(std::move(params), std::move(returnType), std::move(mcf::AST::Statement::Block::Pointer(static_cast<mcf::AST::Statement::Block*>(statementBlock.release()))));
+	return mcf::AST::Statement::Main::Make(*_arena, std::move(params), std::move(returnType), static_cast<mcf::AST::Statement::Block*>(statementBlock));
 }
 
 mcf::AST::Statement::Pointer mcf::Parser::Object::ParseExpressionStatement(void) noexcept
 {
 	mcf::AST::Expression::Pointer expression = ParseExpression(Precedence::LOWEST);
-	if (expression.get() == nullptr || expression->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
+	if (expression == nullptr || expression->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"Expression 명령문 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
+		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Offset });
 		return nullptr;
 	}
 
@@ -463,7 +1053,7 @@ mcf::AST::Statement::Pointer mcf::Parser::Object::ParseExpressionStatement(void)
 		{
 			const std::string message = mcf::Internal::ErrorMessage(u8"AssignExpression 명령문 파싱중 예상치 못한 left expression 타입이 들어왔습니다. LeftExpressionType=%s(%zu)",
 				mcf::AST::Expression::CONVERT_TYPE_TO_STRING(expression->GetExpressionType()), mcf::ENUM_INDEX(expression->GetExpressionType()));
-			_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
+			_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Offset });
 			return nullptr;
 		}
 		}
@@ -472,11 +1062,11 @@ mcf::AST::Statement::Pointer mcf::Parser::Object::ParseExpressionStatement(void)
 
 		ReadNextToken();
 		mcf::AST::Expression::Pointer rightExpression = ParseExpression(Precedence::LOWEST);
-		if (rightExpression.get() == nullptr || rightExpression->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
+		if (rightExpression == nullptr || rightExpression->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
 		{
 			const std::string message = mcf::Internal::ErrorMessage(u8"AssignExpression 명령문 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 				mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-			_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
+			_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Offset });
 			return nullptr;
 		}
 
@@ -484,51 +1074,51 @@ mcf::AST::Statement::Pointer mcf::Parser::Object::ParseExpressionStatement(void)
 		{
 			const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `SEMICOLON`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 				mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
 			return nullptr;
 		}
 
-		return mcf::AST::Statement::AssignExpression::Make(std::move(expression), std::move(rightExpression));
+		return mcf::AST::Statement::AssignExpression::Make(*_arena, std::move(expression), std::move(rightExpression));
 	}
 
 	if (ReadNextTokenIf(mcf::Token::Type::SEMICOLON) == false)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `SEMICOLON`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
 		return nullptr;
 	}
 
-	return mcf::AST::Statement::Expression::Make(std::move(expression));
+	return mcf::AST::Statement::Expression::Make(*_arena, std::move(expression));
 }
 
 mcf::AST::Statement::Pointer mcf::Parser::Object::ParseUnusedStatement(void) noexcept
 {
 	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::KEYWORD_UNUSED, u8"이 함수가 호출될때 현재 토큰이 `KEYWORD_UNUSED`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
-		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
+		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), std::string(_currentToken.Literal).c_str());
 
 	if (ReadNextTokenIf(mcf::Token::Type::LPAREN) == false)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `LPAREN`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
 		return nullptr;
 	}
 
 	mcf::AST::Expression::Identifier::PointerVector identifiers;
 	if (ReadNextTokenIf(mcf::Token::Type::RPAREN) == true)
 	{
-		return mcf::AST::Statement::Unused::Make(std::move(identifiers));
+		return mcf::AST::Statement::Unused::Make(*_arena, std::move(identifiers));
 	}
 
 	if (ReadNextTokenIf(mcf::Token::Type::IDENTIFIER) == false)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `IDENTIFIER`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
 		return nullptr;
 	}
-	identifiers.emplace_back(mcf::AST::Expression::Identifier::Make(_currentToken));
+	identifiers.emplace_back(mcf::AST::Expression::Identifier::Make(*_arena, _currentToken));
 
 	while (ReadNextTokenIf(mcf::Token::Type::COMMA) == true)
 	{
@@ -536,30 +1126,30 @@ mcf::AST::Statement::Pointer mcf::Parser::Object::ParseUnusedStatement(void) noe
 		{
 			const std::string message = mcf::Internal::ErrorMessage(u8"Unused 명령문 파싱중 파일의 끝에 도달 했습니다. Unused 명령문 반드시 RPAREN(')')로 끝나야 합니다.",
 				mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
 			return nullptr;
 		}
 
 		if (ReadNextTokenIf(mcf::Token::Type::RPAREN) == true)
 		{
-			return mcf::AST::Statement::Unused::Make(std::move(identifiers));
+			return mcf::AST::Statement::Unused::Make(*_arena, std::move(identifiers));
 		}
 
 		if (ReadNextTokenIf(mcf::Token::Type::IDENTIFIER) == false)
 		{
 			const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `IDENTIFIER`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 				mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
 			return nullptr;
 		}
-		identifiers.emplace_back(mcf::AST::Expression::Identifier::Make(_currentToken));
+		identifiers.emplace_back(mcf::AST::Expression::Identifier::Make(*_arena, _currentToken));
 	}
 
 	if (ReadNextTokenIf(mcf::Token::Type::RPAREN) == false)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `RPAREN`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _nextToken.Offset });
 		return nullptr;
 	}
 
@@ -567,33 +1157,33 @@ mcf::AST::Statement::Pointer mcf::Parser::Object::ParseUnusedStatement(void) noe
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `SEMICOLON`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
 		return nullptr;
 	}
 
-	return mcf::AST::Statement::Unused::Make(std::move(identifiers));
+	return mcf::AST::Statement::Unused::Make(*_arena, std::move(identifiers));
 }
 
 mcf::AST::Statement::Pointer mcf::Parser::Object::ParseWhileStatement(void) noexcept
 {
 	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::KEYWORD_WHILE, u8"이 함수가 호출될때 현재 토큰이 `KEYWORD_WHILE`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
-		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
+		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), std::string(_currentToken.Literal).c_str());
 
 	if (ReadNextTokenIf(mcf::Token::Type::LPAREN) == false)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `LPAREN`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
 		return nullptr;
 	}
 
 	ReadNextToken();
 	mcf::AST::Expression::Pointer conditionExpression = ParseExpression(mcf::Parser::Precedence::LOWEST);
-	if (conditionExpression.get() == nullptr || conditionExpression->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
+	if (conditionExpression == nullptr || conditionExpression->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"While 명령문 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
+		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Offset });
 		return nullptr;
 	}
 
@@ -601,7 +1191,7 @@ mcf::AST::Statement::Pointer mcf::Parser::Object::ParseWhileStatement(void) noex
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `RPAREN`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
 		return nullptr;
 	}
 
@@ -609,25 +1199,25 @@ mcf::AST::Statement::Pointer mcf::Parser::Object::ParseWhileStatement(void) noex
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `LBRACE`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
 		return nullptr;
 	}
 
 	mcf::AST::Statement::Pointer statementBlock = ParseBlockStatement();
-	if (statementBlock.get() == nullptr || statementBlock->GetStatementType() != mcf::AST::Statement::Type::BLOCK)
+	if (statementBlock == nullptr || statementBlock->GetStatementType() != mcf::AST::Statement::Type::BLOCK)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"Func 명령문 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-		return mcf::AST::Statement::Invalid::Make();
+		_errors.push(ErrorInfo{ ErrorID::FAIL_STATEMENT_PARSING, _lexer.GetName(), message, _currentToken.Offset });
+		return mcf::AST::Statement::Invalid::Make(*_arena);
 	}
-	return mcf::AST::Statement::While::Make(std::move(conditionExpression), std::move(mcf::AST::Statement::Block::Pointer(static_cast<mcf::AST::Statement::Block*>(statementBlock.release()))));
+	return mcf::AST::Statement::While::Make(*_arena, std::move(conditionExpression), static_cast<mcf::AST::Statement::Block*>(statementBlock));
 }
 
 mcf::AST::Statement::Pointer mcf::Parser::Object::ParseBreakStatement(void) noexcept
 {
 	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::KEYWORD_BREAK, u8"이 함수가 호출될때 현재 토큰이 `KEYWORD_BREAK`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
-		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
+		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), std::string(_currentToken.Literal).c_str());
 
 	const mcf::Token::Data token = _currentToken;
 
@@ -635,32 +1225,32 @@ mcf::AST::Statement::Pointer mcf::Parser::Object::ParseBreakStatement(void) noex
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `SEMICOLON`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
 		return nullptr;
 	}
-	return mcf::AST::Statement::Break::Make(_currentToken);
+	return mcf::AST::Statement::Break::Make(*_arena, _currentToken);
 }
 
 mcf::AST::Intermediate::Variadic::Pointer mcf::Parser::Object::ParseVariadicIntermediate(void) noexcept
 {
 	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::VARIADIC, u8"이 함수가 호출될때 현재 토큰이 `VARIADIC`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
-		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
+		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), std::string(_currentToken.Literal).c_str());
 
 	if (ReadNextTokenIf(mcf::Token::Type::IDENTIFIER) == false)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `IDENTIFIER`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
 		return nullptr;
 	}
 
-	return mcf::AST::Intermediate::Variadic::Make(mcf::AST::Expression::Identifier::Make(_currentToken));
+	return mcf::AST::Intermediate::Variadic::Make(*_arena, mcf::AST::Expression::Identifier::Make(*_arena, _currentToken));
 }
 
 mcf::AST::Intermediate::TypeSignature::Pointer mcf::Parser::Object::ParseTypeSignatureIntermediate(void) noexcept
 {
 	MCF_DEBUG_ASSERT(IsCurrentTokenAny({ mcf::Token::Type::IDENTIFIER, mcf::Token::Type::KEYWORD_UNSIGNED }), u8"이 함수가 호출될때 현재 토큰이 `IDENTIFIER` 또는 `KEYWORD_UNSIGNED`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
-		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
+		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), std::string(_currentToken.Literal).c_str());
 
 	bool isUnsigned = false;
 	if (_currentToken.Type == mcf::Token::Type::KEYWORD_UNSIGNED)
@@ -670,11 +1260,11 @@ mcf::AST::Intermediate::TypeSignature::Pointer mcf::Parser::Object::ParseTypeSig
 		{
 			const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `IDENTIFIER`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 				mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
 			return nullptr;
 		}
 	}
-	mcf::AST::Expression::Pointer signature = mcf::AST::Expression::Identifier::Make(_currentToken);
+	mcf::AST::Expression::Pointer signature = mcf::AST::Expression::Identifier::Make(*_arena, _currentToken);
 
 	while (ReadNextTokenIf(mcf::Token::Type::LBRACKET) == true)
 	{
@@ -682,53 +1272,54 @@ mcf::AST::Intermediate::TypeSignature::Pointer mcf::Parser::Object::ParseTypeSig
 		{
 			const std::string message = mcf::Internal::ErrorMessage(u8"TypeSignature 표현식 파싱중 파일의 끝에 도달 했습니다. Index 표현식은 반드시 RBRACKET(']')로 끝나야 합니다.",
 				mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
 			return nullptr;
 		}
 
-		signature = ParseIndexExpression(std::move(signature));
-		if (signature.get() == nullptr || signature->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
+		const size_t frameCount = _expressionFrames.size();
+		signature = CompleteExpressionFrames(ParseIndexExpression(std::move(signature)), frameCount);
+		if (signature == nullptr || signature->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
 		{
 			const std::string message = mcf::Internal::ErrorMessage(u8"TypeSignature 중간 표현식 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 				mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-			_errors.push(ErrorInfo{ ErrorID::FAIL_INTERMEDIATE_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
+			_errors.push(ErrorInfo{ ErrorID::FAIL_INTERMEDIATE_PARSING, _lexer.GetName(), message, _currentToken.Offset });
 			return nullptr;
 		}
 	}
-	return mcf::AST::Intermediate::TypeSignature::Make(isUnsigned, std::move(signature));
+	return mcf::AST::Intermediate::TypeSignature::Make(*_arena, isUnsigned, std::move(signature));
 }
 
 mcf::AST::Intermediate::VariableSignature::Pointer mcf::Parser::Object::ParseVariableSignatureIntermediate(void) noexcept
 {
 	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::IDENTIFIER, u8"이 함수가 호출될때 현재 토큰이 `IDENTIFIER`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
-		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
+		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), std::string(_currentToken.Literal).c_str());
 
-	mcf::AST::Expression::Identifier::Pointer name = mcf::AST::Expression::Identifier::Make(_currentToken);
+	mcf::AST::Expression::Identifier::Pointer name = mcf::AST::Expression::Identifier::Make(*_arena, _currentToken);
 	if (ReadNextTokenIf(mcf::Token::Type::COLON) == false)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `COLON`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
 		return nullptr;
 	}
 
 	ReadNextToken();
 	mcf::AST::Intermediate::TypeSignature::Pointer typeSignature = ParseTypeSignatureIntermediate();
-	if (typeSignature.get() == nullptr || typeSignature->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
+	if (typeSignature == nullptr || typeSignature->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"VariableSignature 중간 표현식 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_INTERMEDIATE_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
+		_errors.push(ErrorInfo{ ErrorID::FAIL_INTERMEDIATE_PARSING, _lexer.GetName(), message, _currentToken.Offset });
 		return nullptr;
 	}
 
-	return mcf::AST::Intermediate::VariableSignature::Make(std::move(name), std::move(typeSignature));
+	return mcf::AST::Intermediate::VariableSignature::Make(*_arena, std::move(name), std::move(typeSignature));
 }
 
 mcf::AST::Intermediate::FunctionParams::Pointer mcf::Parser::Object::ParseFunctionParamsIntermediate(void) noexcept
 {
 	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::LPAREN, u8"이 함수가 호출될때 현재 토큰이 `LPAREN`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
-		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
+		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), std::string(_currentToken.Literal).c_str());
 
 	if (ReadNextTokenIf(mcf::Token::Type::KEYWORD_VOID) == true)
 	{
@@ -736,11 +1327,11 @@ mcf::AST::Intermediate::FunctionParams::Pointer mcf::Parser::Object::ParseFuncti
 		{
 			const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `RPAREN`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 				mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
 			return nullptr;
 		}
 
-		return mcf::AST::Intermediate::FunctionParams::Make();
+		return mcf::AST::Intermediate::FunctionParams::Make(*_arena);
 	}
 
 	if (ReadNextTokenIf(mcf::Token::Type::VARIADIC) == true)
@@ -751,28 +1342,28 @@ mcf::AST::Intermediate::FunctionParams::Pointer mcf::Parser::Object::ParseFuncti
 		{
 			const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `RPAREN`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 				mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
 			return nullptr;
 		}
 
-		return mcf::AST::Intermediate::FunctionParams::Make(std::vector<mcf::AST::Intermediate::VariableSignature::Pointer>(), std::move(variadic));
+		return mcf::AST::Intermediate::FunctionParams::Make(*_arena, std::vector<mcf::AST::Intermediate::VariableSignature::Pointer>(), std::move(variadic));
 	}
 
 	ReadNextToken();
 	mcf::AST::Intermediate::VariableSignature::PointerVector params;
 	mcf::AST::Intermediate::VariableSignature::Pointer firstParam = ParseVariableSignatureIntermediate();
-	if (firstParam.get() == nullptr || firstParam->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
+	if (firstParam == nullptr || firstParam->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"FunctionParams value 중간 표현식 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_INTERMEDIATE_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
+		_errors.push(ErrorInfo{ ErrorID::FAIL_INTERMEDIATE_PARSING, _lexer.GetName(), message, _currentToken.Offset });
 		return nullptr;
 	}
 	params.emplace_back(std::move(firstParam));
 
 	if (ReadNextTokenIf(mcf::Token::Type::RPAREN) == true)
 	{
-		return mcf::AST::Intermediate::FunctionParams::Make(std::move(params), nullptr);
+		return mcf::AST::Intermediate::FunctionParams::Make(*_arena, std::move(params), nullptr);
 	}
 
 	while (ReadNextTokenIf(mcf::Token::Type::COMMA) == true)
@@ -781,7 +1372,7 @@ mcf::AST::Intermediate::FunctionParams::Pointer mcf::Parser::Object::ParseFuncti
 		{
 			const std::string message = mcf::Internal::ErrorMessage(u8"FunctionParams 중간 표현식 파싱중 파일의 끝에 도달 했습니다. FunctionParams 중간 표현식은 반드시 RPAREN(')')로 끝나야 합니다.",
 				mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
 			return nullptr;
 		}
 
@@ -789,11 +1380,11 @@ mcf::AST::Intermediate::FunctionParams::Pointer mcf::Parser::Object::ParseFuncti
 		if (ReadNextTokenIf(mcf::Token::Type::IDENTIFIER) == true)
 		{
 			mcf::AST::Intermediate::VariableSignature::Pointer nextParam = ParseVariableSignatureIntermediate();
-			if (nextParam.get() == nullptr || nextParam->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
+			if (nextParam == nullptr || nextParam->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
 			{
 				const std::string message = mcf::Internal::ErrorMessage(u8"FunctionParams value 중간 표현식 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 					mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-				_errors.push(ErrorInfo{ ErrorID::FAIL_INTERMEDIATE_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
+				_errors.push(ErrorInfo{ ErrorID::FAIL_INTERMEDIATE_PARSING, _lexer.GetName(), message, _currentToken.Offset });
 				return nullptr;
 			}
 			params.emplace_back(std::move(nextParam));
@@ -806,11 +1397,11 @@ mcf::AST::Intermediate::FunctionParams::Pointer mcf::Parser::Object::ParseFuncti
 			{
 				const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `RPAREN`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 					mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-				_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+				_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
 				return nullptr;
 			}
 
-			return mcf::AST::Intermediate::FunctionParams::Make(std::move(params), std::move(variadic));
+			return mcf::AST::Intermediate::FunctionParams::Make(*_arena, std::move(params), std::move(variadic));
 		}
 		else
 		{
@@ -822,34 +1413,34 @@ mcf::AST::Intermediate::FunctionParams::Pointer mcf::Parser::Object::ParseFuncti
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `RPAREN`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
 		return nullptr;
 	}
 
-	return mcf::AST::Intermediate::FunctionParams::Make(std::move(params), nullptr);
+	return mcf::AST::Intermediate::FunctionParams::Make(*_arena, std::move(params), nullptr);
 }
 
 mcf::AST::Intermediate::FunctionSignature::Pointer mcf::Parser::Object::ParseFunctionSignatureIntermediate(void) noexcept
 {
 	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::KEYWORD_FUNC, u8"이 함수가 호출될때 현재 토큰이 `KEYWORD_FUNC`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
-		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
+		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), std::string(_currentToken.Literal).c_str());
 
 	if (ReadNextTokenIf(mcf::Token::Type::IDENTIFIER) == false)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `IDENTIFIER`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
 		return nullptr;
 	}
-	mcf::AST::Expression::Identifier::Pointer name = mcf::AST::Expression::Identifier::Make(_currentToken);
+	mcf::AST::Expression::Identifier::Pointer name = mcf::AST::Expression::Identifier::Make(*_arena, _currentToken);
 
 	ReadNextToken();
 	mcf::AST::Intermediate::FunctionParams::Pointer params = ParseFunctionParamsIntermediate();
-	if (params.get() == nullptr || params->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
+	if (params == nullptr || params->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"FunctionSignature value 중간 표현식 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_INTERMEDIATE_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
+		_errors.push(ErrorInfo{ ErrorID::FAIL_INTERMEDIATE_PARSING, _lexer.GetName(), message, _currentToken.Offset });
 		return nullptr;
 	}
 
@@ -857,497 +1448,712 @@ mcf::AST::Intermediate::FunctionSignature::Pointer mcf::Parser::Object::ParseFun
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `POINTING`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
 		return nullptr;
 	}
 
 	if (ReadNextTokenIf(mcf::Token::Type::KEYWORD_VOID) == true)
 	{
-		return mcf::AST::Intermediate::FunctionSignature::Make(std::move(name), std::move(params), nullptr);
+		return mcf::AST::Intermediate::FunctionSignature::Make(*_arena, std::move(name), std::move(params), nullptr);
 	}
 
 	ReadNextToken();
 	mcf::AST::Intermediate::TypeSignature::Pointer returnType = ParseTypeSignatureIntermediate();
-	if (returnType.get() == nullptr || returnType->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
+	if (returnType == nullptr || returnType->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"FunctionSignature value 중간 표현식 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_INTERMEDIATE_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
+		_errors.push(ErrorInfo{ ErrorID::FAIL_INTERMEDIATE_PARSING, _lexer.GetName(), message, _currentToken.Offset });
 		return nullptr;
 	}
 
-	return mcf::AST::Intermediate::FunctionSignature::Make(std::move(name), std::move(params), std::move(returnType));
+	return mcf::AST::Intermediate::FunctionSignature::Make(*_arena, std::move(name), std::move(params), std::move(returnType));
 }
 
+// 프랫 파서 테이블입니다. 행의 순서는 mcf::Token::Type 과 같아야 하며 ParseExpression 에서 static_assert 로 확인합니다.
+// 새 연산자는 렉서에 토큰을 추가하고 이 테이블에 우선순위와 파싱 함수를 채운 행 하나만 추가하면 됩니다.
+constexpr const mcf::Parser::Object::ExpressionRule mcf::Parser::Object::EXPRESSION_RULES[] =
+{
+	{ mcf::Token::Type::INVALID,					Precedence::LOWEST,			nullptr,								nullptr },
+	{ mcf::Token::Type::END_OF_FILE,				Precedence::LOWEST,			nullptr,								nullptr },
+
+	{ mcf::Token::Type::IDENTIFIER,					Precedence::LOWEST,			&Object::ParseIdentifierExpression,		nullptr },
+	{ mcf::Token::Type::INTEGER,					Precedence::LOWEST,			&Object::ParseIntegerExpression,		nullptr },
+	{ mcf::Token::Type::STRING,						Precedence::LOWEST,			&Object::ParseStringExpression,			nullptr },
+
+	{ mcf::Token::Type::ASSIGN,						Precedence::LOWEST,			nullptr,								nullptr },
+	{ mcf::Token::Type::PLUS,						Precedence::SUM,			nullptr,								&Object::ParseInfixExpression },
+	{ mcf::Token::Type::MINUS,						Precedence::SUM,			&Object::ParsePrefixExpression,			&Object::ParseInfixExpression },
+	{ mcf::Token::Type::ASTERISK,					Precedence::PRODUCT,		nullptr,								&Object::ParseInfixExpression },
+	{ mcf::Token::Type::SLASH,						Precedence::PRODUCT,		nullptr,								&Object::ParseInfixExpression },
+	{ mcf::Token::Type::BANG,						Precedence::LOWEST,			&Object::ParsePrefixExpression,			nullptr },
+	{ mcf::Token::Type::EQUAL,						Precedence::EQUALS,			nullptr,								&Object::ParseInfixExpression },
+	{ mcf::Token::Type::NOT_EQUAL,					Precedence::EQUALS,			nullptr,								&Object::ParseInfixExpression },
+	{ mcf::Token::Type::LT,							Precedence::LESSGREATER,	nullptr,								&Object::ParseInfixExpression },
+	{ mcf::Token::Type::GT,							Precedence::LESSGREATER,	nullptr,								&Object::ParseInfixExpression },
+	{ mcf::Token::Type::AMPERSAND,					Precedence::LOWEST,			&Object::ParsePrefixExpression,			nullptr },
+
+	{ mcf::Token::Type::LPAREN,						Precedence::CALL,			&Object::ParseGroupExpression,			&Object::ParseCallExpression },
+	{ mcf::Token::Type::RPAREN,						Precedence::LOWEST,			nullptr,								nullptr },
+	{ mcf::Token::Type::LBRACE,						Precedence::LOWEST,			&Object::ParseInitializerExpression,	nullptr },
+	{ mcf::Token::Type::RBRACE,						Precedence::LOWEST,			nullptr,								nullptr },
+	{ mcf::Token::Type::LBRACKET,					Precedence::INDEX,			nullptr,								&Object::ParseIndexExpression },
+	{ mcf::Token::Type::RBRACKET,					Precedence::LOWEST,			nullptr,								nullptr },
+
+	{ mcf::Token::Type::COLON,						Precedence::LOWEST,			nullptr,								nullptr },
+	{ mcf::Token::Type::DOUBLE_COLON,				Precedence::LOWEST,			nullptr,								nullptr },
+	{ mcf::Token::Type::SEMICOLON,					Precedence::LOWEST,			nullptr,								nullptr },
+	{ mcf::Token::Type::COMMA,						Precedence::LOWEST,			nullptr,								nullptr },
+	{ mcf::Token::Type::POINTING,					Precedence::LOWEST,			nullptr,								nullptr },
+
+	{ mcf::Token::Type::KEYWORD_IDENTIFIER_START,	Precedence::LOWEST,			nullptr,								nullptr },
+	{ mcf::Token::Type::KEYWORD_ASM,				Precedence::LOWEST,			nullptr,								nullptr },
+	{ mcf::Token::Type::KEYWORD_EXTERN,				Precedence::LOWEST,			nullptr,								nullptr },
+	{ mcf::Token::Type::KEYWORD_TYPEDEF,			Precedence::LOWEST,			nullptr,								nullptr },
+	{ mcf::Token::Type::KEYWORD_LET,				Precedence::LOWEST,			nullptr,								nullptr },
+	{ mcf::Token::Type::KEYWORD_FUNC,				Precedence::LOWEST,			nullptr,								nullptr },
+	{ mcf::Token::Type::KEYWORD_MAIN,				Precedence::LOWEST,			nullptr,								nullptr },
+	{ mcf::Token::Type::KEYWORD_VOID,				Precedence::LOWEST,			nullptr,								nullptr },
+	{ mcf::Token::Type::KEYWORD_UNSIGNED,			Precedence::LOWEST,			&Object::ParseUnsignedExpression,		nullptr },
+	{ mcf::Token::Type::KEYWORD_RETURN,				Precedence::LOWEST,			nullptr,								nullptr },
+	{ mcf::Token::Type::KEYWORD_UNUSED,				Precedence::LOWEST,			nullptr,								nullptr },
+	{ mcf::Token::Type::KEYWORD_AS,					Precedence::AS,				nullptr,								&Object::ParseAsExpression },
+	{ mcf::Token::Type::KEYWORD_WHILE,				Precedence::LOWEST,			nullptr,								nullptr },
+	{ mcf::Token::Type::KEYWORD_BREAK,				Precedence::LOWEST,			nullptr,								nullptr },
+	{ mcf::Token::Type::KEYWORD_IDENTIFIER_END,		Precedence::LOWEST,			nullptr,								nullptr },
+
+	{ mcf::Token::Type::VARIADIC,					Precedence::LOWEST,			nullptr,								nullptr },
+
+	{ mcf::Token::Type::MACRO_START,				Precedence::LOWEST,			nullptr,								nullptr },
+	{ mcf::Token::Type::MACRO_INCLUDE,				Precedence::LOWEST,			nullptr,								nullptr },
+	{ mcf::Token::Type::MACRO_END,					Precedence::LOWEST,			nullptr,								nullptr },
+
+	// 주석은 파서에서 토큰을 읽으면 안됩니다.
+	{ mcf::Token::Type::COMMENT,					Precedence::LOWEST,			nullptr,								nullptr },
+	{ mcf::Token::Type::COMMENT_BLOCK,				Precedence::LOWEST,			nullptr,								nullptr },
+};
+
 mcf::AST::Expression::Pointer mcf::Parser::Object::ParseExpression(const Precedence precedence) noexcept
 {
-	mcf::AST::Expression::Pointer expression;
-	constexpr const size_t EXPRESSION_TOKEN_COUNT_BEGIN = __COUNTER__;
-	switch (_currentToken.Type)
-	{
-	case Token::Type::IDENTIFIER: __COUNTER__;
-		expression = mcf::AST::Expression::Identifier::Make(_currentToken);
-		break;
+	static_assert(MCF_ARRAY_SIZE(EXPRESSION_RULES) == mcf::ENUM_COUNT<mcf::Token::Type>(), "Token::Type is changed. EXPRESSION_RULES need to be changed as well.");
+	static_assert([]() constexpr -> bool
+		{
+			for (size_t i = 0; i < MCF_ARRAY_SIZE(EXPRESSION_RULES); ++i)
+			{
+				if (EXPRESSION_RULES[i].TokenType != mcf::ENUM_AT<mcf::Token::Type>(i) || (EXPRESSION_RULES[i].Infix == nullptr) != (EXPRESSION_RULES[i].InfixPrecedence == Precedence::LOWEST))
+				{
+					return false;
+				}
+			}
+			return true;
+		}(), "EXPRESSION_RULES must be ordered by Token::Type and every infix rule needs a precedence higher than LOWEST.");
+
+	// 하위 식이 필요한 파싱 함수는 재귀 호출 대신 _expressionFrames 에 프레임을 쌓습니다. 이 호출은 frameBase 위의 프레임만 다루며,
+	// 프레임이 끝나면 프레임을 만든 식의 우선순위(OuterPrecedence)로 돌아가 재귀 호출에서 돌아온 것처럼 중위 연산자를 이어서 파싱합니다.
+	const size_t frameBase = _expressionFrames.size();
+	Precedence currentPrecedence = precedence;
+	mcf::AST::Expression::Pointer expression = nullptr;
+	bool isOperandExpected = true;
+	for (;;)
+	{
+		if (isOperandExpected)
+		{
+			isOperandExpected = false;
+			const PrefixParseFunction prefix = EXPRESSION_RULES[mcf::ENUM_INDEX(_currentToken.Type)].Prefix;
+			if (prefix == nullptr)
+			{
+				const std::string message = mcf::Internal::ErrorMessage(u8"예상치 못한 값이 들어왔습니다. 확인 해 주세요. TokenType=%s(%zu) TokenLiteral=`%s`",
+					mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), std::string(_currentToken.Literal).c_str());
+				_errors.push(ErrorInfo{ ErrorID::NOT_REGISTERED_EXPRESSION_TOKEN, _lexer.GetName(), message, _currentToken.Offset });
+				expression = nullptr;
+			}
+			else
+			{
+				const size_t frameCount = _expressionFrames.size();
+				expression = (this->*prefix)();
+				if (_expressionFrames.size() != frameCount)
+				{
+					_expressionFrames.back().OuterPrecedence = currentPrecedence;
+					currentPrecedence = _expressionFrames.back().OperandPrecedence;
+					isOperandExpected = true;
+					continue;
+				}
+			}
+		}
 
-	case Token::Type::INTEGER: __COUNTER__;
-		expression = mcf::AST::Expression::Integer::Make(_currentToken);
-		break;
+		// 중위 함수가 없는 토큰의 우선순위는 LOWEST 이므로 여기서는 항상 중위 함수가 있습니다.
+		if (expression != nullptr && _nextToken.Type != mcf::Token::Type::SEMICOLON && currentPrecedence < GetNextTokenPrecedence())
+		{
+			const InfixParseFunction infix = EXPRESSION_RULES[mcf::ENUM_INDEX(_nextToken.Type)].Infix;
+			ReadNextToken();
+			const size_t frameCount = _expressionFrames.size();
+			expression = (this->*infix)(std::move(expression));
+			if (_expressionFrames.size() != frameCount)
+			{
+				_expressionFrames.back().OuterPrecedence = currentPrecedence;
+				currentPrecedence = _expressionFrames.back().OperandPrecedence;
+				isOperandExpected = true;
+			}
+			continue;
+		}
 
-	case Token::Type::STRING: __COUNTER__;
-		expression = mcf::AST::Expression::String::Make(_currentToken);
-		break;
+		// 현재 우선순위의 식이 끝났습니다. 기다리던 프레임이 없으면 이 호출의 결과입니다.
+		expression = expression == nullptr ? mcf::AST::Expression::Invalid::Make(*_arena) : std::move(expression);
+		if (_expressionFrames.size() == frameBase)
+		{
+			return expression;
+		}
 
-	case Token::Type::MINUS: __COUNTER__; [[fallthrough]];
-	case Token::Type::BANG: __COUNTER__; [[fallthrough]];
-	case Token::Type::AMPERSAND: __COUNTER__;
-		expression = ParsePrefixExpression();
-		break;
+		ExpressionFrame& frame = _expressionFrames.back();
+		const mcf::AST::Expression::Pointer operand = expression;
+		if ((this->*frame.Resume)(frame, operand, expression) == false)
+		{
+			currentPrecedence = frame.OperandPrecedence;
+			isOperandExpected = true;
+			continue;
+		}
+		currentPrecedence = frame.OuterPrecedence;
+		_expressionFrames.pop_back();
+	}
+}
 
-	case Token::Type::LPAREN: __COUNTER__;
-		expression = ParseGroupExpression();
-		break;
+mcf::AST::Expression::Pointer mcf::Parser::Object::ParseIdentifierExpression(void) noexcept
+{
+	return mcf::AST::Expression::Identifier::Make(*_arena, _currentToken);
+}
 
-	case Token::Type::LBRACE: __COUNTER__;
-		expression = ParseInitializerExpression();
-		break;
+mcf::AST::Expression::Pointer mcf::Parser::Object::ParseIntegerExpression(void) noexcept
+{
+	return mcf::AST::Expression::Integer::Make(*_arena, _currentToken);
+}
 
-	case Token::Type::KEYWORD_UNSIGNED: __COUNTER__;
-		MCF_DEBUG_BREAK(u8"구현 필요");
-		break;
+mcf::AST::Expression::Pointer mcf::Parser::Object::ParseStringExpression(void) noexcept
+{
+	return mcf::AST::Expression::String::Make(*_arena, _currentToken);
+}
 
-	case Token::Type::END_OF_FILE: __COUNTER__; [[fallthrough]];
-	case Token::Type::ASSIGN: __COUNTER__; [[fallthrough]];
-	case Token::Type::PLUS: __COUNTER__; [[fallthrough]];
-	case Token::Type::ASTERISK: __COUNTER__; [[fallthrough]];
-	case Token::Type::SLASH: __COUNTER__; [[fallthrough]];
-	case Token::Type::EQUAL: __COUNTER__; [[fallthrough]];
-	case Token::Type::NOT_EQUAL: __COUNTER__; [[fallthrough]];
-	case Token::Type::LT: __COUNTER__; [[fallthrough]];
-	case Token::Type::GT: __COUNTER__; [[fallthrough]];
-	case Token::Type::RPAREN: __COUNTER__; [[fallthrough]];
-	case Token::Type::RBRACE: __COUNTER__; [[fallthrough]];
-	case Token::Type::LBRACKET: __COUNTER__; [[fallthrough]];
-	case Token::Type::RBRACKET: __COUNTER__; [[fallthrough]];
-	case Token::Type::COLON: __COUNTER__; [[fallthrough]];
-	case Token::Type::DOUBLE_COLON: __COUNTER__; [[fallthrough]];
-	case Token::Type::SEMICOLON: __COUNTER__; [[fallthrough]];
-	case Token::Type::COMMA: __COUNTER__; [[fallthrough]];
-	case Token::Type::POINTING: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_IDENTIFIER_START: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_ASM: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_EXTERN: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_TYPEDEF: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_LET: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_FUNC: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_MAIN: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_VOID: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_RETURN: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_UNUSED: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_AS: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_WHILE: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_BREAK: __COUNTER__; [[fallthrough]];
-	case Token::Type::KEYWORD_IDENTIFIER_END: __COUNTER__; [[fallthrough]];
-	case Token::Type::VARIADIC: __COUNTER__; [[fallthrough]];
-	case Token::Type::MACRO_START: __COUNTER__; [[fallthrough]];
-	case Token::Type::MACRO_INCLUDE: __COUNTER__; [[fallthrough]];
-	case Token::Type::MACRO_END: __COUNTER__; [[fallthrough]];
-	case Token::Type::COMMENT: __COUNTER__; [[fallthrough]];			// 주석은 파서에서 토큰을 읽으면 안됩니다.
-	case Token::Type::COMMENT_BLOCK: __COUNTER__; [[fallthrough]];	// 주석은 파서에서 토큰을 읽으면 안됩니다.
-	default:
+mcf::AST::Expression::Pointer mcf::Parser::Object::ParseUnsignedExpression(void) noexcept
+{
+	MCF_DEBUG_BREAK(u8"구현 필요");
+	return nullptr;
+}
+
+mcf::AST::Expression::Pointer mcf::Parser::Object::ParsePrefixExpression(void) noexcept
+{
+	const mcf::Token::Data prefixOperator = _currentToken;
+	ReadNextToken();
+	PushExpressionFrame(&Object::ResumePrefixExpression, Precedence::PREFIX, prefixOperator, nullptr);
+	return nullptr;
+}
+
+mcf::AST::Expression::Pointer mcf::Parser::Object::ParseGroupExpression(void) noexcept
+{
+	MCF_DEBUG_ASSERT( _currentToken.Type == mcf::Token::Type::LPAREN, u8"이 함수가 호출될때 현재 토큰이 `LPAREN`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
+		mcf::Token::CONVERT_TYPE_TO_STRING( _currentToken.Type ), mcf::ENUM_INDEX( _currentToken.Type ), std::string(_currentToken.Literal).c_str() );
+
+	PushExpressionFrame(&Object::ResumeGroupExpression, Precedence::LOWEST, _currentToken, nullptr);
+	ReadNextToken();
+	return nullptr;
+}
+
+mcf::AST::Expression::Pointer mcf::Parser::Object::ParseInfixExpression(mcf::AST::Expression::Pointer&& left) noexcept
+{
+	const mcf::Token::Data infixOperator = _currentToken;
+	const Precedence precedence = GetCurrentTokenPrecedence();
+	ReadNextToken();
+	PushExpressionFrame(&Object::ResumeInfixExpression, precedence, infixOperator, std::move(left));
+	return nullptr;
+}
+
+mcf::AST::Expression::Pointer mcf::Parser::Object::ParseCallExpression(mcf::AST::Expression::Pointer&& left) noexcept
+{
+	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::LPAREN, u8"이 함수가 호출될때 현재 토큰이 `LPAREN`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
+		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), std::string(_currentToken.Literal).c_str());
+
+	if (ReadNextTokenIf(mcf::Token::Type::RPAREN) == true)
 	{
-		const std::string message = mcf::Internal::ErrorMessage(u8"예상치 못한 값이 들어왔습니다. 확인 해 주세요. TokenType=%s(%zu) TokenLiteral=`%s`",
-			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
-		_errors.push(ErrorInfo{ ErrorID::NOT_REGISTERED_EXPRESSION_TOKEN, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-		break;
+		return mcf::AST::Expression::Call::Make(*_arena, std::move(left), mcf::AST::Expression::PointerVector());
 	}
+
+	PushExpressionFrame(&Object::ResumeCallExpression, Precedence::LOWEST, _currentToken, std::move(left));
+	ReadNextToken();
+	return nullptr;
+}
+
+mcf::AST::Expression::Pointer mcf::Parser::Object::ParseIndexExpression(mcf::AST::Expression::Pointer&& left) noexcept
+{
+	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::LBRACKET, u8"이 함수가 호출될때 현재 토큰이 `LBRACKET`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
+		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), std::string(_currentToken.Literal).c_str());
+
+	if (ReadNextTokenIf(mcf::Token::Type::RBRACKET) == true)
+	{
+		return mcf::AST::Expression::Index::Make(*_arena, std::move(left), nullptr);
 	}
-	constexpr const size_t EXPRESSION_TOKEN_COUNT = __COUNTER__ - EXPRESSION_TOKEN_COUNT_BEGIN;
-	static_assert(static_cast<size_t>(mcf::Token::Type::COUNT) == EXPRESSION_TOKEN_COUNT, "parsing expression by token type.");
 
-	while (expression.get() != nullptr && _nextToken.Type != mcf::Token::Type::SEMICOLON && precedence < GetNextTokenPrecedence())
+	PushExpressionFrame(&Object::ResumeIndexExpression, Precedence::LOWEST, _currentToken, std::move(left));
+	ReadNextToken();
+	return nullptr;
+}
+
+mcf::AST::Expression::Pointer mcf::Parser::Object::ParseAsExpression(mcf::AST::Expression::Pointer&& left) noexcept
+{
+	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::KEYWORD_AS, u8"이 함수가 호출될때 현재 토큰이 `KEYWORD_AS`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
+		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), std::string(_currentToken.Literal).c_str());
+
+	ReadNextToken();
+	mcf::AST::Intermediate::TypeSignature::Pointer typeCastedAs = ParseTypeSignatureIntermediate();
+	if (typeCastedAs == nullptr || typeCastedAs->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
 	{
-		constexpr const size_t INFIX_COUNT_BEGIN = __COUNTER__;
-		switch (_nextToken.Type)
-		{
-		case Token::Type::PLUS: __COUNTER__; [[fallthrough]];
-		case Token::Type::MINUS: __COUNTER__; [[fallthrough]];
-		case Token::Type::ASTERISK: __COUNTER__; [[fallthrough]];
-		case Token::Type::SLASH: __COUNTER__; [[fallthrough]];
-		case Token::Type::EQUAL: __COUNTER__; [[fallthrough]];
-		case Token::Type::NOT_EQUAL: __COUNTER__; [[fallthrough]];
-		case Token::Type::LT: __COUNTER__; [[fallthrough]];
-		case Token::Type::GT: __COUNTER__; 
-			ReadNextToken();
-			expression = ParseInfixExpression(std::move(expression));
-			break;
+		const std::string message = mcf::Internal::ErrorMessage(u8"As 표현식 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
+			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
+		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _currentToken.Offset });
+		return nullptr;
+	}
 
-		case Token::Type::LPAREN: __COUNTER__;
-			ReadNextToken();
-			expression = ParseCallExpression(std::move(expression));
-			break;
+	return mcf::AST::Expression::As::Make(*_arena, std::move(left), std::move(typeCastedAs));
+}
 
-		case Token::Type::LBRACKET: __COUNTER__;
-			ReadNextToken();
-			expression = ParseIndexExpression(std::move(expression));
-			break;
-		
-		case Token::Type::KEYWORD_AS: __COUNTER__;
-			ReadNextToken();
-			expression = ParseAsExpression(std::move(expression));
-			break;
+mcf::AST::Expression::Pointer mcf::Parser::Object::ParseInitializerExpression(void) noexcept
+{
+	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::LBRACE, u8"이 함수가 호출될때 현재 토큰이 `LBRACE`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
+		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), std::string(_currentToken.Literal).c_str());
 
-		case Token::Type::END_OF_FILE: __COUNTER__; [[fallthrough]];
-		case Token::Type::IDENTIFIER: __COUNTER__; [[fallthrough]];
-		case Token::Type::INTEGER: __COUNTER__; [[fallthrough]];
-		case Token::Type::STRING: __COUNTER__; [[fallthrough]];
-		case Token::Type::ASSIGN: __COUNTER__; [[fallthrough]];
-		case Token::Type::BANG: __COUNTER__; [[fallthrough]];
-		case Token::Type::AMPERSAND: __COUNTER__; [[fallthrough]];
-		case Token::Type::RPAREN: __COUNTER__; [[fallthrough]];
-		case Token::Type::LBRACE: __COUNTER__; [[fallthrough]];
-		case Token::Type::RBRACE: __COUNTER__; [[fallthrough]];
-		case Token::Type::RBRACKET: __COUNTER__; [[fallthrough]];
-		case Token::Type::COLON: __COUNTER__; [[fallthrough]];
-		case Token::Type::DOUBLE_COLON: __COUNTER__; [[fallthrough]];
-		case Token::Type::SEMICOLON: __COUNTER__; [[fallthrough]];
-		case Token::Type::COMMA: __COUNTER__; [[fallthrough]];
-		case Token::Type::POINTING: __COUNTER__; [[fallthrough]];
-		case Token::Type::KEYWORD_IDENTIFIER_START: __COUNTER__; [[fallthrough]];
-		case Token::Type::KEYWORD_ASM: __COUNTER__; [[fallthrough]];
-		case Token::Type::KEYWORD_EXTERN: __COUNTER__; [[fallthrough]];
-		case Token::Type::KEYWORD_TYPEDEF: __COUNTER__; [[fallthrough]];
-		case Token::Type::KEYWORD_LET: __COUNTER__; [[fallthrough]];
-		case Token::Type::KEYWORD_FUNC: __COUNTER__; [[fallthrough]];
-		case Token::Type::KEYWORD_MAIN: __COUNTER__; [[fallthrough]];
-		case Token::Type::KEYWORD_VOID: __COUNTER__; [[fallthrough]];
-		case Token::Type::KEYWORD_UNSIGNED: __COUNTER__; [[fallthrough]];
-		case Token::Type::KEYWORD_RETURN: __COUNTER__; [[fallthrough]];
-		case Token::Type::KEYWORD_UNUSED: __COUNTER__; [[fallthrough]];
-		case Token::Type::KEYWORD_WHILE: __COUNTER__; [[fallthrough]];
-		case Token::Type::KEYWORD_BREAK: __COUNTER__; [[fallthrough]];
-		case Token::Type::KEYWORD_IDENTIFIER_END: __COUNTER__; [[fallthrough]];
-		case Token::Type::VARIADIC: __COUNTER__; [[fallthrough]];
-		case Token::Type::MACRO_START: __COUNTER__; [[fallthrough]];
-		case Token::Type::MACRO_INCLUDE: __COUNTER__; [[fallthrough]];
-		case Token::Type::MACRO_END: __COUNTER__; [[fallthrough]];
-		case Token::Type::COMMENT: __COUNTER__; [[fallthrough]];			// 주석은 파서에서 토큰을 읽으면 안됩니다.
-		case Token::Type::COMMENT_BLOCK: __COUNTER__; [[fallthrough]];	// 주석은 파서에서 토큰을 읽으면 안됩니다.
-		default:
+	PushExpressionFrame(&Object::ResumeInitializerExpression, Precedence::LOWEST, _currentToken, nullptr);
+	ReadNextToken();
+	return nullptr;
+}
+
+void mcf::Parser::Object::PushExpressionFrame(const ResumeParseFunction resume, const mcf::Parser::Precedence operandPrecedence, const mcf::Token::Data& token, mcf::AST::Expression::Pointer left) noexcept
+{
+	// OuterPrecedence 는 프레임을 만든 식의 우선순위를 알고 있는 ParseExpression 이 채웁니다.
+	_expressionFrames.emplace_back(ExpressionFrame{ resume, Precedence::INVALID, operandPrecedence, token, left, mcf::AST::Expression::PointerVector(), mcf::AST::Expression::PointerVector() });
+}
+
+mcf::AST::Expression::Pointer mcf::Parser::Object::CompleteExpressionFrames(mcf::AST::Expression::Pointer expression, const size_t frameCount) noexcept
+{
+	while (_expressionFrames.size() != frameCount)
+	{
+		const mcf::AST::Expression::Pointer operand = ParseExpression(_expressionFrames.back().OperandPrecedence);
+		ExpressionFrame& frame = _expressionFrames.back();
+		if ((this->*frame.Resume)(frame, operand, expression) == true)
 		{
-			const std::string message = mcf::Internal::ErrorMessage(u8"예상치 못한 값이 들어왔습니다. 확인 해 주세요. TokenType=%s(%zu) TokenLiteral=`%s`",
-				mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
-			_errors.push(ErrorInfo{ ErrorID::NOT_REGISTERED_EXPRESSION_TOKEN, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-			break;
-		}
+			_expressionFrames.pop_back();
 		}
-		constexpr const size_t INFIX_COUNT = __COUNTER__ - INFIX_COUNT_BEGIN;
-		static_assert(static_cast<size_t>(mcf::Token::Type::COUNT) == INFIX_COUNT, "parsing infix expression by token type.");
 	}
-	return expression.get() == nullptr ? mcf::AST::Expression::Invalid::Make() : std::move(expression);
+	return expression;
 }
 
-mcf::AST::Expression::Prefix::Pointer mcf::Parser::Object::ParsePrefixExpression(void) noexcept
+const bool mcf::Parser::Object::ResumePrefixExpression(ExpressionFrame& frame, mcf::AST::Expression::Pointer operand, _Out_ mcf::AST::Expression::Pointer& outExpression) noexcept
 {
-	const mcf::Token::Data prefixOperator = _currentToken;
-	ReadNextToken();
-	mcf::AST::Expression::Pointer right = ParseExpression(Precedence::PREFIX);
-	if (right.get() == nullptr || right->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
+	if (operand == nullptr || operand->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"Prefix 표현식 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-		return nullptr;
+		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _currentToken.Offset });
+		outExpression = nullptr;
+		return true;
 	}
-	return mcf::AST::Expression::Prefix::Make(prefixOperator, std::move(right));
+	outExpression = mcf::AST::Expression::Prefix::Make(*_arena, frame.Token, std::move(operand));
+	return true;
 }
 
-mcf::AST::Expression::Group::Pointer mcf::Parser::Object::ParseGroupExpression(void) noexcept
+const bool mcf::Parser::Object::ResumeGroupExpression(ExpressionFrame& frame, mcf::AST::Expression::Pointer operand, _Out_ mcf::AST::Expression::Pointer& outExpression) noexcept
 {
-	MCF_DEBUG_ASSERT( _currentToken.Type == mcf::Token::Type::LPAREN, u8"이 함수가 호출될때 현재 토큰이 `LPAREN`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
-		mcf::Token::CONVERT_TYPE_TO_STRING( _currentToken.Type ), mcf::ENUM_INDEX( _currentToken.Type ), _currentToken.Literal.c_str() );
-
-	ReadNextToken();
-	mcf::AST::Expression::Pointer expreesion = ParseExpression(Precedence::LOWEST);
-	if ( expreesion.get() == nullptr || expreesion->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
+	MCF_UNUSED(frame);
+	outExpression = nullptr;
+	if (operand == nullptr || operand->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"Group 표현식 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-		return nullptr;
+		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _currentToken.Offset });
+		return true;
 	}
 
 	if (ReadNextTokenIf(mcf::Token::Type::RPAREN) == false)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `RPAREN`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
-		return nullptr;
+		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _nextToken.Offset });
+		return true;
 	}
 
-	return mcf::AST::Expression::Group::Make(std::move(expreesion));
+	outExpression = mcf::AST::Expression::Group::Make(*_arena, std::move(operand));
+	return true;
 }
 
-mcf::AST::Expression::Infix::Pointer mcf::Parser::Object::ParseInfixExpression(mcf::AST::Expression::Pointer&& left) noexcept
+const bool mcf::Parser::Object::ResumeInfixExpression(ExpressionFrame& frame, mcf::AST::Expression::Pointer operand, _Out_ mcf::AST::Expression::Pointer& outExpression) noexcept
 {
-	const mcf::Token::Data infixOperator = _currentToken;
-	const Precedence precedence = GetCurrentTokenPrecedence();
-	ReadNextToken();
-	mcf::AST::Expression::Pointer right = ParseExpression(precedence);
-	if (right.get() == nullptr || right->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
+	if (operand == nullptr || operand->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"Index 표현식 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-		return nullptr;
+		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _currentToken.Offset });
+		outExpression = nullptr;
+		return true;
 	}
-	return mcf::AST::Expression::Infix::Make(std::move(left), infixOperator, std::move(right));
+	outExpression = mcf::AST::Expression::Infix::Make(*_arena, std::move(frame.Left), frame.Token, std::move(operand));
+	return true;
 }
 
-mcf::AST::Expression::Call::Pointer mcf::Parser::Object::ParseCallExpression(mcf::AST::Expression::Pointer&& left) noexcept
+const bool mcf::Parser::Object::ResumeCallExpression(ExpressionFrame& frame, mcf::AST::Expression::Pointer operand, _Out_ mcf::AST::Expression::Pointer& outExpression) noexcept
 {
-	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::LPAREN, u8"이 함수가 호출될때 현재 토큰이 `LPAREN`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
-		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
-
-	mcf::AST::Expression::PointerVector params;
-	if (ReadNextTokenIf(mcf::Token::Type::RPAREN) == true)
-	{
-		return mcf::AST::Expression::Call::Make(std::move(left), std::move(params));
-	}
-
-	ReadNextToken();
-	params.emplace_back(ParseExpression(Precedence::LOWEST));
-	if (params.back().get() == nullptr || params.back()->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
+	outExpression = nullptr;
+	frame.Keys.emplace_back(operand);
+	if (operand == nullptr || operand->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"Call 표현식 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-		return nullptr;
+		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _currentToken.Offset });
+		return true;
 	}
 
-	while (ReadNextTokenIf(mcf::Token::Type::COMMA) == true)
+	if (ReadNextTokenIf(mcf::Token::Type::COMMA) == true)
 	{
 		if (ReadNextTokenIf(mcf::Token::Type::END_OF_FILE) == true)
 		{
 			const std::string message = mcf::Internal::ErrorMessage(u8"Call 표현식 파싱중 파일의 끝에 도달 했습니다. Call 표현식은 반드시 RPAREN(')')로 끝나야 합니다.",
 				mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
-			return nullptr;
+			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
+			return true;
 		}
 
 		if (ReadNextTokenIf(mcf::Token::Type::RPAREN) == true)
 		{
-			return mcf::AST::Expression::Call::Make(std::move(left), std::move(params));
+			outExpression = mcf::AST::Expression::Call::Make(*_arena, std::move(frame.Left), std::move(frame.Keys));
+			return true;
 		}
 
 		ReadNextToken();
-		params.emplace_back(ParseExpression(Precedence::LOWEST));
-		if (params.back().get() == nullptr || params.back()->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
-		{
-			const std::string message = mcf::Internal::ErrorMessage(u8"Call 표현식 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
-				mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-			_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-			return nullptr;
-		}
+		return false;
 	}
 
 	if (ReadNextTokenIf(mcf::Token::Type::RPAREN) == false)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `RPAREN`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
-		return nullptr;
+		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _nextToken.Offset });
+		return true;
 	}
 
-	return mcf::AST::Expression::Call::Make(std::move(left), std::move(params));
+	outExpression = mcf::AST::Expression::Call::Make(*_arena, std::move(frame.Left), std::move(frame.Keys));
+	return true;
 }
 
-mcf::AST::Expression::Index::Pointer mcf::Parser::Object::ParseIndexExpression(mcf::AST::Expression::Pointer&& left) noexcept
+const bool mcf::Parser::Object::ResumeIndexExpression(ExpressionFrame& frame, mcf::AST::Expression::Pointer operand, _Out_ mcf::AST::Expression::Pointer& outExpression) noexcept
 {
-	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::LBRACKET, u8"이 함수가 호출될때 현재 토큰이 `LBRACKET`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
-		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
-
-	if (ReadNextTokenIf(mcf::Token::Type::RBRACKET) == true)
-	{
-		return mcf::AST::Expression::Index::Make(std::move(left), nullptr);
-	}
-
-	ReadNextToken();
-	mcf::AST::Expression::Pointer index = ParseExpression(Precedence::LOWEST);
-	if (index.get() == nullptr || index->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
+	outExpression = nullptr;
+	if (operand == nullptr || operand->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"Index 표현식 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-		return nullptr;
+		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _currentToken.Offset });
+		return true;
 	}
 
 	if (ReadNextTokenIf(mcf::Token::Type::RBRACKET) == false)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `RBRACE`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
-		return nullptr;
+		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _nextToken.Offset });
+		return true;
 	}
 
-	return mcf::AST::Expression::Index::Make(std::move(left), std::move(index));
+	outExpression = mcf::AST::Expression::Index::Make(*_arena, std::move(frame.Left), std::move(operand));
+	return true;
 }
 
-mcf::AST::Expression::As::Pointer mcf::Parser::Object::ParseAsExpression(mcf::AST::Expression::Pointer&& left) noexcept
+const bool mcf::Parser::Object::ResumeInitializerExpression(ExpressionFrame& frame, mcf::AST::Expression::Pointer operand, _Out_ mcf::AST::Expression::Pointer& outExpression) noexcept
 {
-	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::KEYWORD_AS, u8"이 함수가 호출될때 현재 토큰이 `KEYWORD_AS`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
-		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
-
-	ReadNextToken();
-	mcf::AST::Intermediate::TypeSignature::Pointer typeCastedAs = ParseTypeSignatureIntermediate();
-	if (typeCastedAs.get() == nullptr || typeCastedAs->GetIntermediateType() == mcf::AST::Intermediate::Type::INVALID)
+	outExpression = nullptr;
+	frame.Keys.emplace_back(operand);
+	const bool isFirstKey = frame.Keys.size() == 1;
+	if (operand == nullptr || operand->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
 	{
-		const std::string message = mcf::Internal::ErrorMessage(u8"As 표현식 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
+		const std::string message = mcf::Internal::ErrorMessage(isFirstKey ? u8"Initializer key 표현식 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다." : u8"MapInitializer key 표현식 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-		return nullptr;
+		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _currentToken.Offset });
+		return true;
 	}
 
-	return mcf::AST::Expression::As::Make(std::move(left), std::move(typeCastedAs));
+	// 첫번째 키 다음에 ASSIGN 이 오면 MapInitializer 입니다.
+	if (isFirstKey && ReadNextTokenIf(mcf::Token::Type::ASSIGN) == true)
+	{
+		ReadNextToken();
+		frame.Resume = &Object::ResumeMapInitializerValueExpression;
+		return false;
+	}
+
+	if (ReadNextTokenIf(mcf::Token::Type::COMMA) == true)
+	{
+		if (ReadNextTokenIf(mcf::Token::Type::END_OF_FILE) == true)
+		{
+			const std::string message = mcf::Internal::ErrorMessage(u8"Initializer 표현식 파싱중 파일의 끝에 도달 했습니다. Initializer 표현식은 반드시 RBRACE('}')로 끝나야 합니다.",
+				mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
+			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
+			return true;
+		}
+
+		if (ReadNextTokenIf(mcf::Token::Type::RBRACE) == true)
+		{
+			outExpression = mcf::AST::Expression::Initializer::Make(*_arena, std::move(frame.Keys));
+			return true;
+		}
+
+		ReadNextToken();
+		return false;
+	}
+
+	if (ReadNextTokenIf(mcf::Token::Type::RBRACE) == false)
+	{
+		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `RBRACE`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
+			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
+		return true;
+	}
+
+	outExpression = mcf::AST::Expression::Initializer::Make(*_arena, std::move(frame.Keys));
+	return true;
 }
 
-mcf::AST::Expression::Initializer::Pointer mcf::Parser::Object::ParseInitializerExpression(void) noexcept
+const bool mcf::Parser::Object::ResumeMapInitializerKeyExpression(ExpressionFrame& frame, mcf::AST::Expression::Pointer operand, _Out_ mcf::AST::Expression::Pointer& outExpression) noexcept
 {
-	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::LBRACE, u8"이 함수가 호출될때 현재 토큰이 `LBRACE`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
-		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
-
-	ReadNextToken();
-	mcf::AST::Expression::PointerVector keyList;
-	keyList.emplace_back(ParseExpression(Precedence::LOWEST));
-	if (keyList.back().get() == nullptr || keyList.back()->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
+	outExpression = nullptr;
+	frame.Keys.emplace_back(operand);
+	if (operand == nullptr || operand->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
 	{
-		const std::string message = mcf::Internal::ErrorMessage(u8"Initializer key 표현식 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
+		const std::string message = mcf::Internal::ErrorMessage(u8"MapInitializer key 표현식 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-		return nullptr;
+		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _currentToken.Offset });
+		return true;
 	}
 
-	if (ReadNextTokenIf(mcf::Token::Type::RBRACE) == true)
+	if (ReadNextTokenIf(mcf::Token::Type::ASSIGN) == false)
 	{
-		return mcf::AST::Expression::Initializer::Make(std::move(keyList));
+		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `ASSIGN`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
+			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
+		return true;
 	}
 
-	if (ReadNextTokenIf(mcf::Token::Type::ASSIGN) == true)
+	ReadNextToken();
+	frame.Resume = &Object::ResumeMapInitializerValueExpression;
+	return false;
+}
+
+const bool mcf::Parser::Object::ResumeMapInitializerValueExpression(ExpressionFrame& frame, mcf::AST::Expression::Pointer operand, _Out_ mcf::AST::Expression::Pointer& outExpression) noexcept
+{
+	outExpression = nullptr;
+	frame.Values.emplace_back(operand);
+	if (operand == nullptr || operand->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
 	{
-		return ParseMapInitializerExpression(std::move(keyList));
+		const std::string message = mcf::Internal::ErrorMessage(u8"MapInitializer value 표현식 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
+			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
+		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _currentToken.Offset });
+		return true;
 	}
 
-	while (ReadNextTokenIf(mcf::Token::Type::COMMA) == true)
+	if (ReadNextTokenIf(mcf::Token::Type::COMMA) == true)
 	{
 		if (ReadNextTokenIf(mcf::Token::Type::END_OF_FILE) == true)
 		{
-			const std::string message = mcf::Internal::ErrorMessage(u8"Initializer 표현식 파싱중 파일의 끝에 도달 했습니다. Initializer 표현식은 반드시 RBRACE('}')로 끝나야 합니다.",
+			const std::string message = mcf::Internal::ErrorMessage(u8"MapInitializer 표현식 파싱중 파일의 끝에 도달 했습니다. MapInitializer 표현식은 반드시 RBRACE('}')로 끝나야 합니다.",
 				mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
-			return nullptr;
+			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
+			return true;
 		}
 
 		if (ReadNextTokenIf(mcf::Token::Type::RBRACE) == true)
 		{
-			return mcf::AST::Expression::Initializer::Make(std::move(keyList));
+			outExpression = mcf::AST::Expression::MapInitializer::Make(*_arena, std::move(frame.Keys), std::move(frame.Values));
+			return true;
 		}
 
 		ReadNextToken();
-		keyList.emplace_back(ParseExpression(Precedence::LOWEST));
-		if (keyList.back().get() == nullptr || keyList.back()->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
-		{
-			const std::string message = mcf::Internal::ErrorMessage(u8"MapInitializer key 표현식 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
-				mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-			_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-			return nullptr;
-		}
+		frame.Resume = &Object::ResumeMapInitializerKeyExpression;
+		return false;
 	}
 
 	if (ReadNextTokenIf(mcf::Token::Type::RBRACE) == false)
 	{
 		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `RBRACE`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
 			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
-		return nullptr;
+		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Offset });
+		return true;
 	}
 
-	return mcf::AST::Expression::Initializer::Make(std::move(keyList));
+	outExpression = mcf::AST::Expression::MapInitializer::Make(*_arena, std::move(frame.Keys), std::move(frame.Values));
+	return true;
 }
 
-// 이 함수를 호출 하려면 첫번째 키까지 사전에 파싱을 하여야 합니다 (ParseInitializerExpression 참고)
-mcf::AST::Expression::MapInitializer::Pointer mcf::Parser::Object::ParseMapInitializerExpression(mcf::AST::Expression::PointerVector&& keyList) noexcept
+mcf::Parser::Session::Session(void) noexcept
+	: Session(std::make_shared<mcf::Symbol::Table>())
 {
-	MCF_DEBUG_ASSERT(keyList.size() == 1, u8"인자로 받은 keyList는 한개의 키를 들고 있어야 합니다.");
-	MCF_DEBUG_ASSERT(keyList[0].get() != nullptr, u8"keyList[0]는 nullptr 여선 안됩니다.");
-	MCF_DEBUG_ASSERT(_currentToken.Type == mcf::Token::Type::ASSIGN, u8"이 함수가 호출될때 현재 토큰이 `ASSIGN`여야만 합니다! 현재 TokenType=%s(%zu) TokenLiteral=`%s`",
-		mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type), mcf::ENUM_INDEX(_currentToken.Type), _currentToken.Literal.c_str());
+}
 
-	ReadNextToken();
-	mcf::AST::Expression::PointerVector valueList;
-	valueList.emplace_back(ParseExpression(Precedence::LOWEST));
-	if (valueList.back().get() == nullptr || valueList.back()->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
+mcf::Parser::Session::Session(const std::shared_ptr<mcf::Symbol::Table>& symbols) noexcept
+	: _symbols(symbols)
+{
+}
+
+void mcf::Parser::Session::Parse(const std::string& input, const bool isFile, _Out_ mcf::AST::Program& outProgram) noexcept
+{
+	_reusedStatementCount = 0;
+	_reparsedStatementCount = 0;
+	_parser = std::make_unique<mcf::Parser::Object>(input, isFile, _symbols);
+	if (_parser->GetErrorCount() != 0)
 	{
-		const std::string message = mcf::Internal::ErrorMessage(u8"MapInitializer value 표현식 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
-			mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-		return nullptr;
+		// 렉서 에러 뒤에 파서가 남기는 에러까지 ParseProgram 과 같도록 ParseProgram 으로 파싱합니다.
+		_parser->ParseProgram(outProgram);
+		return;
 	}
 
-	if (ReadNextTokenIf(mcf::Token::Type::RBRACE) == true)
+	// 문장의 경계를 찾지 못하면 캐시를 사용하지 않고 ParseProgram 과 같이 파싱합니다.
+	std::vector<size_t> statementEnds;
+	if (Internal::FIND_TOP_LEVEL_STATEMENT_ENDS(_parser->_tokens, statementEnds) == false || statementEnds.empty())
 	{
-		return mcf::AST::Expression::MapInitializer::Make(std::move(keyList), std::move(valueList));
+		_parser->ParseProgram(outProgram);
+		return;
 	}
 
-	while (ReadNextTokenIf(mcf::Token::Type::COMMA) == true)
-	{
-		if (ReadNextTokenIf(mcf::Token::Type::END_OF_FILE) == true)
+	// 위치가 같은 문장은 캐시의 노드를 그대로 쓰고, 앞쪽의 수정으로 밀려난 문장은 이번 파싱의 아레나에 Offset 을 옮겨 복사합니다.
+	const mcf::Lexer::Source& source = _parser->_lexer.GetSource();
+	const std::shared_ptr<mcf::AST::Arena> arena = std::make_shared<mcf::AST::Arena>();
+	const size_t statementCount = statementEnds.size();
+	std::vector<std::uint64_t> hashes(statementCount);
+	std::vector<std::string_view> texts(statementCount);
+	std::vector<const CachedStatement*> sharedCaches(statementCount, nullptr);
+	mcf::AST::Statement::PointerVector statements(statementCount, nullptr);
+	for (size_t i = 0; i < statementCount; ++i)
+	{
+		const size_t beginTokenIndex = (i == 0) ? 0 : statementEnds[i - 1];
+		hashes[i] = Internal::HASH_TOKEN_RANGE(_parser->_tokens, beginTokenIndex, statementEnds[i]);
+		texts[i] = Internal::GET_TOKEN_RANGE_TEXT(_parser->_tokens, source->GetView(), beginTokenIndex, statementEnds[i]);
+		const auto cacheFound = _cache.find(hashes[i]);
+		// 해시가 충돌한 다른 문장을 재사용하지 않도록 소스 문자열을 비교합니다.
+		if (cacheFound == _cache.end() || cacheFound->second.Text != texts[i])
 		{
-			const std::string message = mcf::Internal::ErrorMessage(u8"MapInitializer 표현식 파싱중 파일의 끝에 도달 했습니다. MapInitializer 표현식은 반드시 RBRACE('}')로 끝나야 합니다.",
-				mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
-			return nullptr;
+			continue;
 		}
 
-		if (ReadNextTokenIf(mcf::Token::Type::RBRACE) == true)
+		const CachedStatement& cached = cacheFound->second;
+		const std::uint32_t offset = _parser->_tokens.GetOffset(beginTokenIndex);
+		if (offset == cached.Offset)
+		{
+			statements[i] = cached.Statement;
+			sharedCaches[i] = &cached;
+		}
+		else
 		{
-			return mcf::AST::Expression::MapInitializer::Make(std::move(keyList), std::move(valueList));
+			Internal::StatementRebaser rebaser(*arena, cached.Source->GetView(), source->GetView(), static_cast<std::int64_t>(offset) - static_cast<std::int64_t>(cached.Offset));
+			statements[i] = rebaser.Rebase(cached.Statement);
 		}
+		_reusedStatementCount += (statements[i] != nullptr) ? 1 : 0;
+	}
 
-		ReadNextToken();
-		keyList.emplace_back(ParseExpression(Precedence::LOWEST));
-		if (keyList.back().get() == nullptr || keyList.back()->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
+	// 캐시에 없는 연속된 문장들을 한 범위 파서로 파싱합니다. 새로 파싱한 노드는 모두 이번 파싱의 아레나로 옮깁니다.
+	for (size_t i = 0; i < statementCount;)
+	{
+		if (statements[i] != nullptr)
 		{
-			const std::string message = mcf::Internal::ErrorMessage(u8"MapInitializer key 표현식 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
-				mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-			_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-			return nullptr;
+			++i;
+			continue;
 		}
 
-		if (ReadNextTokenIf(mcf::Token::Type::ASSIGN) == false)
+		size_t runEnd = i + 1;
+		while (runEnd < statementCount && statements[runEnd] == nullptr)
 		{
-			const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `ASSIGN`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
-				mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-			_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
-			return nullptr;
+			++runEnd;
 		}
 
-		ReadNextToken();
-		valueList.emplace_back(ParseExpression(Precedence::LOWEST));
-		if (valueList.back().get() == nullptr || valueList.back()->GetExpressionType() == mcf::AST::Expression::Type::INVALID)
+		mcf::Parser::Object rangeParser(*_parser, (i == 0) ? 0 : statementEnds[i - 1], statementEnds[runEnd - 1]);
+		rangeParser._arena = std::make_unique<mcf::AST::Arena>();
+		mcf::AST::Statement::PointerVector parsedStatements;
+		if (rangeParser.ParseStatements(parsedStatements) == false || parsedStatements.size() != runEnd - i)
 		{
-			const std::string message = mcf::Internal::ErrorMessage(u8"MapInitializer value 표현식 파싱에 실패하였습니다. 파싱 실패 값으로 %s를 받았습니다.",
-				mcf::Token::CONVERT_TYPE_TO_STRING(_currentToken.Type));
-			_errors.push(ErrorInfo{ ErrorID::FAIL_EXPRESSION_PARSING, _lexer.GetName(), message, _currentToken.Line, _currentToken.Index });
-			return nullptr;
+			// 에러의 종류와 위치가 ParseProgram 과 같도록 처음부터 다시 파싱합니다. 캐시는 그대로 둡니다.
+			_reusedStatementCount = 0;
+			_reparsedStatementCount = 0;
+			_parser->ParseProgram(outProgram);
+			return;
+		}
+		arena->Adopt(std::move(*rangeParser._arena));
+		std::copy(parsedStatements.begin(), parsedStatements.end(), statements.begin() + i);
+		_reparsedStatementCount += parsedStatements.size();
+		i = runEnd;
+	}
+
+	// 이번 입력에 남아있는 문장만 캐시에 남깁니다. 프로그램은 문장들이 할당된 아레나와 소스 버퍼를 함께 소유하므로
+	// 캐시에서 빠지거나 세션이 소멸되어도 프로그램이 살아있는 동안 해제되지 않습니다.
+	std::unordered_map<std::uint64_t, CachedStatement> cache;
+	cache.reserve(statementCount);
+	std::vector<std::shared_ptr<const mcf::AST::Arena>> sharedArenas = { arena };
+	std::vector<mcf::Lexer::Source> sharedSources;
+	for (size_t i = 0; i < statementCount; ++i)
+	{
+		const std::uint32_t offset = _parser->_tokens.GetOffset((i == 0) ? 0 : statementEnds[i - 1]);
+		const CachedStatement& cached = cache.emplace(hashes[i], (sharedCaches[i] != nullptr) ? *sharedCaches[i] : CachedStatement{ statements[i], arena, source, offset, texts[i] }).first->second;
+		if (std::find(sharedArenas.begin(), sharedArenas.end(), cached.Arena) == sharedArenas.end())
+		{
+			sharedArenas.emplace_back(cached.Arena);
+		}
+		if (cached.Source != source && std::find(sharedSources.begin(), sharedSources.end(), cached.Source) == sharedSources.end())
+		{
+			sharedSources.emplace_back(cached.Source);
 		}
 	}
+	_cache = std::move(cache);
 
-	if (ReadNextTokenIf(mcf::Token::Type::RBRACE) == false)
+	outProgram = mcf::AST::Program(std::move(sharedArenas), std::move(sharedSources), std::move(statements), source, _symbols);
+}
+
+const size_t mcf::Parser::Session::GetErrorCount(void) const noexcept
+{
+	return (_parser == nullptr) ? 0 : _parser->GetErrorCount();
+}
+
+const mcf::Parser::ErrorInfo mcf::Parser::Session::PopLastError(void) noexcept
+{
+	if (_parser == nullptr)
 	{
-		const std::string message = mcf::Internal::ErrorMessage(u8"다음 토큰은 `RBRACE`타입여야만 합니다. 실제 값으로 %s를 받았습니다.",
-			mcf::Token::CONVERT_TYPE_TO_STRING(_nextToken.Type));
-		_errors.push(ErrorInfo{ ErrorID::UNEXPECTED_NEXT_TOKEN, _lexer.GetName(), message, _nextToken.Line, _nextToken.Index });
-		return nullptr;
+		return { ErrorID::SUCCESS, std::string(), std::string(), 0 };
+	}
+	return _parser->PopLastError();
+}
+
+const bool mcf::Parser::ParseFileWithCache(_Out_ mcf::AST::Flat::Program& outProgram, const std::string& path, const std::string& cacheDirectory, const std::shared_ptr<mcf::Symbol::Table>& symbols,
+	_Out_opt_ bool* optionalOutIsCacheHit) noexcept
+{
+	if (optionalOutIsCacheHit != nullptr)
+	{
+		*optionalOutIsCacheHit = false;
+	}
+
+	const mcf::Lexer::Source source = mcf::Lexer::SourceBuffer::MakeFromFile(path);
+	if (source == nullptr)
+	{
+		return false;
+	}
+
+	if (mcf::AST::Cache::Load(outProgram, cacheDirectory, source, symbols))
+	{
+		if (optionalOutIsCacheHit != nullptr)
+		{
+			*optionalOutIsCacheHit = true;
+		}
+		return true;
+	}
+
+	// 캐시를 찾을 때 읽은 소스 버퍼를 그대로 파싱하므로 파일은 한번만 읽습니다.
+	mcf::Parser::Object parser(path, source, symbols);
+	mcf::AST::Program program;
+	parser.ParseProgram(program);
+	if (parser.GetErrorCount() != 0)
+	{
+		return false;
 	}
 
-	return mcf::AST::Expression::MapInitializer::Make(std::move(keyList), std::move(valueList));
+	outProgram = mcf::AST::Flat::Program(program);
+	// 캐시를 쓰지 못하여도 파싱한 결과는 사용할 수 있습니다.
+	mcf::AST::Cache::Store(outProgram, cacheDirectory);
+	return true;
 }
\ No newline at end of file
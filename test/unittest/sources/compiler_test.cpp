@@ -148,16 +148,16 @@ UnitTest::CompilerTest::CompilerTest(void) noexcept
 				parser.ParseProgram(program);
 				FATAL_ASSERT(CheckParserErrors(parser), u8"파싱에 실패 하였습니다.");
 
-				mcf::Object::TypeInfo byteType = mcf::Object::TypeInfo::MakePrimitive(false, "byte", 1);
-				mcf::Object::TypeInfo wordType = mcf::Object::TypeInfo::MakePrimitive(false, "word", 2);
-				mcf::Object::TypeInfo dwordType = mcf::Object::TypeInfo::MakePrimitive(false, "dword", 4);
-				mcf::Object::TypeInfo qwordType = mcf::Object::TypeInfo::MakePrimitive(false, "qword", 8);
-
 				mcf::Object::ScopeTree scopeTree;
-				scopeTree.Global.DefineType(byteType.Name, byteType);
-				scopeTree.Global.DefineType(wordType.Name, wordType);
-				scopeTree.Global.DefineType(dwordType.Name, dwordType);
-				scopeTree.Global.DefineType(qwordType.Name, qwordType);
+				mcf::Object::TypeInfo byteType = scopeTree.Types.MakePrimitive(false, "byte", 1);
+				mcf::Object::TypeInfo wordType = scopeTree.Types.MakePrimitive(false, "word", 2);
+				mcf::Object::TypeInfo dwordType = scopeTree.Types.MakePrimitive(false, "dword", 4);
+				mcf::Object::TypeInfo qwordType = scopeTree.Types.MakePrimitive(false, "qword", 8);
+
+				scopeTree.Global.DefineType(byteType.GetName(), byteType);
+				scopeTree.Global.DefineType(wordType.GetName(), wordType);
+				scopeTree.Global.DefineType(dwordType.GetName(), dwordType);
+				scopeTree.Global.DefineType(qwordType.GetName(), qwordType);
 
 				mcf::Evaluator::Object evaluator;
 				mcf::IR::Program::Pointer irProgram = evaluator.EvalProgram(&program, &scopeTree.Global);
@@ -254,16 +254,16 @@ UnitTest::CompilerTest::CompilerTest(void) noexcept
 				parser.ParseProgram(program);
 				FATAL_ASSERT(CheckParserErrors(parser), u8"파싱에 실패 하였습니다.");
 
-				mcf::Object::TypeInfo byteType = mcf::Object::TypeInfo::MakePrimitive(false, "byte", 1);
-				mcf::Object::TypeInfo wordType = mcf::Object::TypeInfo::MakePrimitive(false, "word", 2);
-				mcf::Object::TypeInfo dwordType = mcf::Object::TypeInfo::MakePrimitive(false, "dword", 4);
-				mcf::Object::TypeInfo qwordType = mcf::Object::TypeInfo::MakePrimitive(false, "qword", 8);
-
 				mcf::Object::ScopeTree scopeTree;
-				scopeTree.Global.DefineType(byteType.Name, byteType);
-				scopeTree.Global.DefineType(wordType.Name, wordType);
-				scopeTree.Global.DefineType(dwordType.Name, dwordType);
-				scopeTree.Global.DefineType(qwordType.Name, qwordType);
+				mcf::Object::TypeInfo byteType = scopeTree.Types.MakePrimitive(false, "byte", 1);
+				mcf::Object::TypeInfo wordType = scopeTree.Types.MakePrimitive(false, "word", 2);
+				mcf::Object::TypeInfo dwordType = scopeTree.Types.MakePrimitive(false, "dword", 4);
+				mcf::Object::TypeInfo qwordType = scopeTree.Types.MakePrimitive(false, "qword", 8);
+
+				scopeTree.Global.DefineType(byteType.GetName(), byteType);
+				scopeTree.Global.DefineType(wordType.GetName(), wordType);
+				scopeTree.Global.DefineType(dwordType.GetName(), dwordType);
+				scopeTree.Global.DefineType(qwordType.GetName(), qwordType);
 
 				mcf::Evaluator::Object evaluator;
 				mcf::IR::Program::Pointer irProgram = evaluator.EvalProgram(&program, &scopeTree.Global);
@@ -562,16 +562,16 @@ UnitTest::CompilerTest::CompilerTest(void) noexcept
 				parser.ParseProgram(program);
 				FATAL_ASSERT(CheckParserErrors(parser), u8"파싱에 실패 하였습니다.");
 
-				mcf::Object::TypeInfo byteType = mcf::Object::TypeInfo::MakePrimitive(false, "byte", 1);
-				mcf::Object::TypeInfo wordType = mcf::Object::TypeInfo::MakePrimitive(false, "word", 2);
-				mcf::Object::TypeInfo dwordType = mcf::Object::TypeInfo::MakePrimitive(false, "dword", 4);
-				mcf::Object::TypeInfo qwordType = mcf::Object::TypeInfo::MakePrimitive(false, "qword", 8);
-
 				mcf::Object::ScopeTree scopeTree;
-				scopeTree.Global.DefineType(byteType.Name, byteType);
-				scopeTree.Global.DefineType(wordType.Name, wordType);
-				scopeTree.Global.DefineType(dwordType.Name, dwordType);
-				scopeTree.Global.DefineType(qwordType.Name, qwordType);
+				mcf::Object::TypeInfo byteType = scopeTree.Types.MakePrimitive(false, "byte", 1);
+				mcf::Object::TypeInfo wordType = scopeTree.Types.MakePrimitive(false, "word", 2);
+				mcf::Object::TypeInfo dwordType = scopeTree.Types.MakePrimitive(false, "dword", 4);
+				mcf::Object::TypeInfo qwordType = scopeTree.Types.MakePrimitive(false, "qword", 8);
+
+				scopeTree.Global.DefineType(byteType.GetName(), byteType);
+				scopeTree.Global.DefineType(wordType.GetName(), wordType);
+				scopeTree.Global.DefineType(dwordType.GetName(), dwordType);
+				scopeTree.Global.DefineType(qwordType.GetName(), qwordType);
 
 				mcf::Evaluator::Object evaluator;
 				mcf::IR::Program::Pointer irProgram = evaluator.EvalProgram(&program, &scopeTree.Global);
@@ -605,16 +605,16 @@ UnitTest::CompilerTest::CompilerTest(void) noexcept
 			parser.ParseProgram(program);
 			FATAL_ASSERT(CheckParserErrors(parser), u8"파싱에 실패 하였습니다.");
 
-			mcf::Object::TypeInfo byteType = mcf::Object::TypeInfo::MakePrimitive(false, "byte", 1);
-			mcf::Object::TypeInfo wordType = mcf::Object::TypeInfo::MakePrimitive(false, "word", 2);
-			mcf::Object::TypeInfo dwordType = mcf::Object::TypeInfo::MakePrimitive(false, "dword", 4);
-			mcf::Object::TypeInfo qwordType = mcf::Object::TypeInfo::MakePrimitive(false, "qword", 8);
-
 			mcf::Object::ScopeTree scopeTree;
-			scopeTree.Global.DefineType(byteType.Name, byteType);
-			scopeTree.Global.DefineType(wordType.Name, wordType);
-			scopeTree.Global.DefineType(dwordType.Name, dwordType);
-			scopeTree.Global.DefineType(qwordType.Name, qwordType);
+			mcf::Object::TypeInfo byteType = scopeTree.Types.MakePrimitive(false, "byte", 1);
+			mcf::Object::TypeInfo wordType = scopeTree.Types.MakePrimitive(false, "word", 2);
+			mcf::Object::TypeInfo dwordType = scopeTree.Types.MakePrimitive(false, "dword", 4);
+			mcf::Object::TypeInfo qwordType = scopeTree.Types.MakePrimitive(false, "qword", 8);
+
+			scopeTree.Global.DefineType(byteType.GetName(), byteType);
+			scopeTree.Global.DefineType(wordType.GetName(), wordType);
+			scopeTree.Global.DefineType(dwordType.GetName(), dwordType);
+			scopeTree.Global.DefineType(qwordType.GetName(), qwordType);
 
 			mcf::Evaluator::Object evaluator;
 			mcf::IR::Program::Pointer irProgram = evaluator.EvalProgram(&program, &scopeTree.Global);
@@ -655,16 +655,16 @@ UnitTest::CompilerTest::CompilerTest(void) noexcept
 			parser.ParseProgram(program);
 			FATAL_ASSERT(CheckParserErrors(parser), u8"파싱에 실패 하였습니다.");
 
-			mcf::Object::TypeInfo byteType = mcf::Object::TypeInfo::MakePrimitive(false, "byte", 1);
-			mcf::Object::TypeInfo wordType = mcf::Object::TypeInfo::MakePrimitive(false, "word", 2);
-			mcf::Object::TypeInfo dwordType = mcf::Object::TypeInfo::MakePrimitive(false, "dword", 4);
-			mcf::Object::TypeInfo qwordType = mcf::Object::TypeInfo::MakePrimitive(false, "qword", 8);
-
 			mcf::Object::ScopeTree scopeTree;
-			scopeTree.Global.DefineType(byteType.Name, byteType);
-			scopeTree.Global.DefineType(wordType.Name, wordType);
-			scopeTree.Global.DefineType(dwordType.Name, dwordType);
-			scopeTree.Global.DefineType(qwordType.Name, qwordType);
+			mcf::Object::TypeInfo byteType = scopeTree.Types.MakePrimitive(false, "byte", 1);
+			mcf::Object::TypeInfo wordType = scopeTree.Types.MakePrimitive(false, "word", 2);
+			mcf::Object::TypeInfo dwordType = scopeTree.Types.MakePrimitive(false, "dword", 4);
+			mcf::Object::TypeInfo qwordType = scopeTree.Types.MakePrimitive(false, "qword", 8);
+
+			scopeTree.Global.DefineType(byteType.GetName(), byteType);
+			scopeTree.Global.DefineType(wordType.GetName(), wordType);
+			scopeTree.Global.DefineType(dwordType.GetName(), dwordType);
+			scopeTree.Global.DefineType(qwordType.GetName(), qwordType);
 
 			mcf::Evaluator::Object evaluator;
 			mcf::IR::Program::Pointer irProgram = evaluator.EvalProgram(&program, &scopeTree.Global);
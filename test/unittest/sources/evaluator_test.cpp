@@ -1,4 +1,7 @@
-﻿#include <iostream>
+﻿#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
 #include "../unittest.h"
 
 UnitTest::EvaluatorTest::EvaluatorTest(void) noexcept
@@ -27,10 +30,10 @@ UnitTest::EvaluatorTest::EvaluatorTest(void) noexcept
 				FATAL_ASSERT(CheckParserErrors(parser), u8"파싱에 실패 하였습니다.");
 				mcf::Evaluator::Object evaluator;
 				mcf::Object::ScopeTree scopeTree;
-				scopeTree.Global.DefineType("byte", mcf::Object::TypeInfo::MakePrimitive(false, "byte", 1));
-				scopeTree.Global.DefineType("word", mcf::Object::TypeInfo::MakePrimitive(false, "word", 2));
-				scopeTree.Global.DefineType("dword", mcf::Object::TypeInfo::MakePrimitive(false, "dword", 4));
-				scopeTree.Global.DefineType("qword", mcf::Object::TypeInfo::MakePrimitive(false, "qword", 8));
+				scopeTree.Global.DefineType("byte", scopeTree.Types.MakePrimitive(false, "byte", 1));
+				scopeTree.Global.DefineType("word", scopeTree.Types.MakePrimitive(false, "word", 2));
+				scopeTree.Global.DefineType("dword", scopeTree.Types.MakePrimitive(false, "dword", 4));
+				scopeTree.Global.DefineType("qword", scopeTree.Types.MakePrimitive(false, "qword", 8));
 				mcf::IR::Pointer object = evaluator.EvalProgram(&program, &scopeTree.Global);
 
 				FATAL_ASSERT(object.get() != nullptr, u8"object가 nullptr이면 안됩니다.");
@@ -69,10 +72,10 @@ UnitTest::EvaluatorTest::EvaluatorTest(void) noexcept
 				FATAL_ASSERT(CheckParserErrors(parser), u8"파싱에 실패 하였습니다.");
 				mcf::Evaluator::Object evaluator;
 				mcf::Object::ScopeTree scopeTree;
-				scopeTree.Global.DefineType("byte", mcf::Object::TypeInfo::MakePrimitive(false, "byte", 1));
-				scopeTree.Global.DefineType("word", mcf::Object::TypeInfo::MakePrimitive(false, "word", 2));
-				scopeTree.Global.DefineType("dword", mcf::Object::TypeInfo::MakePrimitive(false, "dword", 4));
-				scopeTree.Global.DefineType("qword", mcf::Object::TypeInfo::MakePrimitive(false, "qword", 8));
+				scopeTree.Global.DefineType("byte", scopeTree.Types.MakePrimitive(false, "byte", 1));
+				scopeTree.Global.DefineType("word", scopeTree.Types.MakePrimitive(false, "word", 2));
+				scopeTree.Global.DefineType("dword", scopeTree.Types.MakePrimitive(false, "dword", 4));
+				scopeTree.Global.DefineType("qword", scopeTree.Types.MakePrimitive(false, "qword", 8));
 				mcf::IR::Pointer object = evaluator.EvalProgram(&program, &scopeTree.Global);
 
 				FATAL_ASSERT(object.get() != nullptr, u8"object가 nullptr이면 안됩니다.");
@@ -141,16 +144,16 @@ UnitTest::EvaluatorTest::EvaluatorTest(void) noexcept
 				parser.ParseProgram(program);
 				FATAL_ASSERT(CheckParserErrors(parser), u8"파싱에 실패 하였습니다.");
 
-				mcf::Object::TypeInfo byteType = mcf::Object::TypeInfo::MakePrimitive(false, "byte", 1);
-				mcf::Object::TypeInfo wordType = mcf::Object::TypeInfo::MakePrimitive(false, "word", 2);
-				mcf::Object::TypeInfo dwordType = mcf::Object::TypeInfo::MakePrimitive(false, "dword", 4);
-				mcf::Object::TypeInfo qwordType = mcf::Object::TypeInfo::MakePrimitive(false, "qword", 8);
-
 				mcf::Object::ScopeTree scopeTree;
-				scopeTree.Global.DefineType(byteType.Name, byteType);
-				scopeTree.Global.DefineType(wordType.Name, wordType);
-				scopeTree.Global.DefineType(dwordType.Name, dwordType);
-				scopeTree.Global.DefineType(qwordType.Name, qwordType);
+				mcf::Object::TypeInfo byteType = scopeTree.Types.MakePrimitive(false, "byte", 1);
+				mcf::Object::TypeInfo wordType = scopeTree.Types.MakePrimitive(false, "word", 2);
+				mcf::Object::TypeInfo dwordType = scopeTree.Types.MakePrimitive(false, "dword", 4);
+				mcf::Object::TypeInfo qwordType = scopeTree.Types.MakePrimitive(false, "qword", 8);
+
+				scopeTree.Global.DefineType(byteType.GetName(), byteType);
+				scopeTree.Global.DefineType(wordType.GetName(), wordType);
+				scopeTree.Global.DefineType(dwordType.GetName(), dwordType);
+				scopeTree.Global.DefineType(qwordType.GetName(), qwordType);
 
 				mcf::Evaluator::Object evaluator;
 				mcf::IR::Pointer object = evaluator.EvalProgram(&program, &scopeTree.Global);
@@ -308,16 +311,16 @@ UnitTest::EvaluatorTest::EvaluatorTest(void) noexcept
 				parser.ParseProgram(program);
 				FATAL_ASSERT(CheckParserErrors(parser), u8"파싱에 실패 하였습니다.");
 
-				mcf::Object::TypeInfo byteType = mcf::Object::TypeInfo::MakePrimitive(false, "byte", 1);
-				mcf::Object::TypeInfo wordType = mcf::Object::TypeInfo::MakePrimitive(false, "word", 2);
-				mcf::Object::TypeInfo dwordType = mcf::Object::TypeInfo::MakePrimitive(false, "dword", 4);
-				mcf::Object::TypeInfo qwordType = mcf::Object::TypeInfo::MakePrimitive(false, "qword", 8);
-
 				mcf::Object::ScopeTree scopeTree;
-				scopeTree.Global.DefineType(byteType.Name, byteType);
-				scopeTree.Global.DefineType(wordType.Name, wordType);
-				scopeTree.Global.DefineType(dwordType.Name, dwordType);
-				scopeTree.Global.DefineType(qwordType.Name, qwordType);
+				mcf::Object::TypeInfo byteType = scopeTree.Types.MakePrimitive(false, "byte", 1);
+				mcf::Object::TypeInfo wordType = scopeTree.Types.MakePrimitive(false, "word", 2);
+				mcf::Object::TypeInfo dwordType = scopeTree.Types.MakePrimitive(false, "dword", 4);
+				mcf::Object::TypeInfo qwordType = scopeTree.Types.MakePrimitive(false, "qword", 8);
+
+				scopeTree.Global.DefineType(byteType.GetName(), byteType);
+				scopeTree.Global.DefineType(wordType.GetName(), wordType);
+				scopeTree.Global.DefineType(dwordType.GetName(), dwordType);
+				scopeTree.Global.DefineType(qwordType.GetName(), qwordType);
 
 				mcf::Evaluator::Object evaluator;
 				mcf::IR::Pointer object = evaluator.EvalProgram(&program, &scopeTree.Global);
@@ -508,16 +511,16 @@ UnitTest::EvaluatorTest::EvaluatorTest(void) noexcept
 				parser.ParseProgram(program);
 				FATAL_ASSERT(CheckParserErrors(parser), u8"파싱에 실패 하였습니다.");
 				
-				mcf::Object::TypeInfo byteType = mcf::Object::TypeInfo::MakePrimitive(false, "byte", 1);
-				mcf::Object::TypeInfo wordType = mcf::Object::TypeInfo::MakePrimitive(false, "word", 2);
-				mcf::Object::TypeInfo dwordType = mcf::Object::TypeInfo::MakePrimitive(false, "dword", 4);
-				mcf::Object::TypeInfo qwordType = mcf::Object::TypeInfo::MakePrimitive(false, "qword", 8);
-
 				mcf::Object::ScopeTree scopeTree;
-				scopeTree.Global.DefineType(byteType.Name, byteType);
-				scopeTree.Global.DefineType(wordType.Name, wordType);
-				scopeTree.Global.DefineType(dwordType.Name, dwordType);
-				scopeTree.Global.DefineType(qwordType.Name, qwordType);
+				mcf::Object::TypeInfo byteType = scopeTree.Types.MakePrimitive(false, "byte", 1);
+				mcf::Object::TypeInfo wordType = scopeTree.Types.MakePrimitive(false, "word", 2);
+				mcf::Object::TypeInfo dwordType = scopeTree.Types.MakePrimitive(false, "dword", 4);
+				mcf::Object::TypeInfo qwordType = scopeTree.Types.MakePrimitive(false, "qword", 8);
+
+				scopeTree.Global.DefineType(byteType.GetName(), byteType);
+				scopeTree.Global.DefineType(wordType.GetName(), wordType);
+				scopeTree.Global.DefineType(dwordType.GetName(), dwordType);
+				scopeTree.Global.DefineType(qwordType.GetName(), qwordType);
 
 				mcf::Evaluator::Object evaluator;
 				mcf::IR::Pointer object = evaluator.EvalProgram(&program, &scopeTree.Global);
@@ -585,16 +588,16 @@ UnitTest::EvaluatorTest::EvaluatorTest(void) noexcept
 				parser.ParseProgram(program);
 				FATAL_ASSERT(CheckParserErrors(parser), u8"파싱에 실패 하였습니다.");
 
-				mcf::Object::TypeInfo byteType = mcf::Object::TypeInfo::MakePrimitive(false, "byte", 1);
-				mcf::Object::TypeInfo wordType = mcf::Object::TypeInfo::MakePrimitive(false, "word", 2);
-				mcf::Object::TypeInfo dwordType = mcf::Object::TypeInfo::MakePrimitive(false, "dword", 4);
-				mcf::Object::TypeInfo qwordType = mcf::Object::TypeInfo::MakePrimitive(false, "qword", 8);
-
 				mcf::Object::ScopeTree scopeTree;
-				scopeTree.Global.DefineType(byteType.Name, byteType);
-				scopeTree.Global.DefineType(wordType.Name, wordType);
-				scopeTree.Global.DefineType(dwordType.Name, dwordType);
-				scopeTree.Global.DefineType(qwordType.Name, qwordType);
+				mcf::Object::TypeInfo byteType = scopeTree.Types.MakePrimitive(false, "byte", 1);
+				mcf::Object::TypeInfo wordType = scopeTree.Types.MakePrimitive(false, "word", 2);
+				mcf::Object::TypeInfo dwordType = scopeTree.Types.MakePrimitive(false, "dword", 4);
+				mcf::Object::TypeInfo qwordType = scopeTree.Types.MakePrimitive(false, "qword", 8);
+
+				scopeTree.Global.DefineType(byteType.GetName(), byteType);
+				scopeTree.Global.DefineType(wordType.GetName(), wordType);
+				scopeTree.Global.DefineType(dwordType.GetName(), dwordType);
+				scopeTree.Global.DefineType(qwordType.GetName(), qwordType);
 
 				mcf::Evaluator::Object evaluator;
 				mcf::IR::Pointer object = evaluator.EvalProgram(&program, &scopeTree.Global);
@@ -630,16 +633,16 @@ UnitTest::EvaluatorTest::EvaluatorTest(void) noexcept
 			parser.ParseProgram(program);
 			FATAL_ASSERT(CheckParserErrors(parser), u8"파싱에 실패 하였습니다.");
 
-			mcf::Object::TypeInfo byteType = mcf::Object::TypeInfo::MakePrimitive(false, "byte", 1);
-			mcf::Object::TypeInfo wordType = mcf::Object::TypeInfo::MakePrimitive(false, "word", 2);
-			mcf::Object::TypeInfo dwordType = mcf::Object::TypeInfo::MakePrimitive(false, "dword", 4);
-			mcf::Object::TypeInfo qwordType = mcf::Object::TypeInfo::MakePrimitive(false, "qword", 8);
-
 			mcf::Object::ScopeTree scopeTree;
-			scopeTree.Global.DefineType(byteType.Name, byteType);
-			scopeTree.Global.DefineType(wordType.Name, wordType);
-			scopeTree.Global.DefineType(dwordType.Name, dwordType);
-			scopeTree.Global.DefineType(qwordType.Name, qwordType);
+			mcf::Object::TypeInfo byteType = scopeTree.Types.MakePrimitive(false, "byte", 1);
+			mcf::Object::TypeInfo wordType = scopeTree.Types.MakePrimitive(false, "word", 2);
+			mcf::Object::TypeInfo dwordType = scopeTree.Types.MakePrimitive(false, "dword", 4);
+			mcf::Object::TypeInfo qwordType = scopeTree.Types.MakePrimitive(false, "qword", 8);
+
+			scopeTree.Global.DefineType(byteType.GetName(), byteType);
+			scopeTree.Global.DefineType(wordType.GetName(), wordType);
+			scopeTree.Global.DefineType(dwordType.GetName(), dwordType);
+			scopeTree.Global.DefineType(qwordType.GetName(), qwordType);
 
 			mcf::Evaluator::Object evaluator;
 			mcf::IR::Pointer object = evaluator.EvalProgram(&program, &scopeTree.Global);
@@ -659,6 +662,548 @@ UnitTest::EvaluatorTest::EvaluatorTest(void) noexcept
 			return true;
 		}
 	);
+	_names.emplace_back(u8"심볼 테이블을 공유하는 파일 평가 테스트");
+	_tests.emplace_back
+	(
+		[&]() -> bool
+		{
+			// 스코프 트리의 심볼 테이블로 파싱하면 평가 단계는 렉서가 만든 심볼 ID 를 그대로 사용합니다.
+			mcf::Object::ScopeTree scopeTree;
+			mcf::Parser::Object parser(FILE_READ_INPUT_PATH, true, scopeTree.Symbols);
+			mcf::AST::Program program;
+			parser.ParseProgram(program);
+			FATAL_ASSERT(CheckParserErrors(parser), u8"파싱에 실패 하였습니다.");
+			FATAL_ASSERT(program.GetSymbolTable() == scopeTree.Symbols.get(), u8"프로그램은 파서에 넘긴 심볼 테이블을 가지고 있어야 합니다.");
+
+			const size_t parsedSymbolCount = scopeTree.Symbols->GetCount();
+			FATAL_ASSERT(parsedSymbolCount > 0, u8"파싱한 식별자가 심볼 테이블에 등록되어야 합니다.");
+
+			FATAL_ASSERT(CheckFileReadEvaluation(scopeTree, [&](mcf::Evaluator::Object& evaluator, mcf::Object::Scope* scope) { return evaluator.EvalProgram(&program, scope); }), u8"평가 결과가 다릅니다.");
+
+			// 같은 이름은 같은 ID 를 받으므로 스코프에 이름을 정의하여도 이미 등록된 식별자는 새로 추가되지 않습니다.
+			const mcf::Symbol::ID dwordSymbol = scopeTree.Symbols->Find("dword");
+			FATAL_ASSERT(dwordSymbol != mcf::Symbol::INVALID_ID && scopeTree.Symbols->GetName(dwordSymbol) == "dword", u8"dword 심볼을 찾을 수 없습니다.");
+			FATAL_ASSERT(scopeTree.Global.FindTypeInfo(dwordSymbol) == scopeTree.Types.MakePrimitive(false, "dword", 4), u8"심볼 ID 로 찾은 타입이 틀렸습니다.");
+			FATAL_ASSERT(scopeTree.Symbols->Find("not_registered_name") == mcf::Symbol::INVALID_ID, u8"등록되지 않은 이름은 INVALID_ID 여야 합니다.");
+			FATAL_ASSERT(scopeTree.Global.FindVariableInfo("not_registered_name").IsValid() == false, u8"등록되지 않은 이름으로 변수를 찾으면 안됩니다.");
+			return true;
+		}
+	);
+	_names.emplace_back(u8"평면 AST 파일 평가 테스트");
+	_tests.emplace_back
+	(
+		[&]() -> bool
+		{
+			mcf::Parser::Object parser(FILE_READ_INPUT_PATH, true);
+			mcf::AST::Program program;
+			parser.ParseProgram(program);
+			FATAL_ASSERT(CheckParserErrors(parser), u8"파싱에 실패 하였습니다.");
+
+			// 포인터 AST 를 평면 AST 로 바꾸어도 최상위 문장의 순서와 갯수는 같아야 합니다.
+			const mcf::AST::Flat::Program flatProgram(program);
+			FATAL_ASSERT(flatProgram.GetStatementCount() == program.GetStatementCount(), u8"최상위 문장의 갯수가 다릅니다. 실제값[%zu] 예상값[%zu]", flatProgram.GetStatementCount(), program.GetStatementCount());
+			for (size_t i = 0; i < flatProgram.GetStatementCount(); i++)
+			{
+				const mcf::AST::Flat::Kind kind = flatProgram.GetKind(flatProgram.GetStatementAt(i));
+				FATAL_ASSERT(mcf::AST::Flat::CONVERT_KIND_TO_STRING(kind) == std::string(mcf::AST::Statement::CONVERT_TYPE_TO_STRING(program.GetUnsafeStatementPointerAt(i)->GetStatementType())),
+					u8"최상위 문장의 종류가 다릅니다. 인덱스[%zu] 실제값[%s]", i, mcf::AST::Flat::CONVERT_KIND_TO_STRING(kind));
+			}
+
+			mcf::Object::ScopeTree scopeTree;
+			FATAL_ASSERT(CheckFileReadEvaluation(scopeTree, [&](mcf::Evaluator::Object& evaluator, mcf::Object::Scope* scope) { return evaluator.EvalProgram(&flatProgram, scope); }), u8"평면 AST 의 평가 결과가 다릅니다.");
+			return true;
+		}
+	);
+
+	_names.emplace_back(u8"함수 본문 지연 파싱 평가 테스트");
+	_tests.emplace_back
+	(
+		[&]() -> bool
+		{
+			// 지연 파싱한 본문을 모두 파싱하면 처음부터 전부 파싱한 결과와 같아야 합니다.
+			const std::string fileToParse = "./test/unittest/texts/test_file_read.txt";
+			mcf::Parser::Object eagerParser(fileToParse, true);
+			mcf::AST::Program eagerProgram;
+			eagerParser.ParseProgram(eagerProgram);
+			FATAL_ASSERT(CheckParserErrors(eagerParser), u8"파싱에 실패 하였습니다.");
+
+			mcf::Parser::Object lazyParser(fileToParse, true);
+			lazyParser.SetLazyFunctionBody(true);
+			mcf::AST::Program lazyProgram;
+			lazyParser.ParseProgram(lazyProgram);
+			FATAL_ASSERT(CheckParserErrors(lazyParser), u8"지연 파싱에 실패 하였습니다.");
+			FATAL_ASSERT(lazyProgram.GetStatementCount() == eagerProgram.GetStatementCount(), u8"최상위 문장의 갯수가 다릅니다. 실제값[%zu] 예상값[%zu]", lazyProgram.GetStatementCount(), eagerProgram.GetStatementCount());
+
+			size_t lazyFunctionCount = 0;
+			for (size_t i = 0; i < lazyProgram.GetStatementCount(); i++)
+			{
+				const mcf::AST::Statement::Interface* statement = lazyProgram.GetUnsafeStatementPointerAt(i);
+				if (statement->GetStatementType() != mcf::AST::Statement::Type::FUNC)
+				{
+					continue;
+				}
+				const mcf::AST::Statement::Func* func = static_cast<const mcf::AST::Statement::Func*>(statement);
+				FATAL_ASSERT(func->IsBodyParsed() == false, u8"지연 파싱된 함수의 본문이 파싱되어 있으면 안됩니다. 인덱스[%zu]", i);
+				FATAL_ASSERT(lazyProgram.MaterializeFunctionBody(func), u8"함수 본문 파싱에 실패 하였습니다. 인덱스[%zu]", i);
+				++lazyFunctionCount;
+			}
+			FATAL_ASSERT(lazyFunctionCount > 0, u8"지연 파싱된 함수가 없습니다.");
+
+			const std::string expected = eagerProgram.ConvertToString();
+			const std::string actual = lazyProgram.ConvertToString();
+			FATAL_ASSERT(actual == expected, u8"지연 파싱 결과가 다릅니다.\nExpected:\n%s\nActual:\n%s", expected.c_str(), actual.c_str());
+
+			// 병렬 파싱에서도 본문의 토큰 범위는 전체 토큰 버퍼 기준이어야 합니다.
+			mcf::Parser::Object parallelParser(fileToParse, true);
+			parallelParser.SetLazyFunctionBody(true);
+			mcf::AST::Program parallelProgram;
+			parallelParser.ParseProgramParallel(parallelProgram, 4, 1);
+			FATAL_ASSERT(CheckParserErrors(parallelParser), u8"병렬 지연 파싱에 실패 하였습니다.");
+			for (size_t i = 0; i < parallelProgram.GetStatementCount(); i++)
+			{
+				const mcf::AST::Statement::Interface* statement = parallelProgram.GetUnsafeStatementPointerAt(i);
+				if (statement->GetStatementType() == mcf::AST::Statement::Type::FUNC)
+				{
+					FATAL_ASSERT(parallelProgram.MaterializeFunctionBody(static_cast<const mcf::AST::Statement::Func*>(statement)), u8"함수 본문 파싱에 실패 하였습니다. 인덱스[%zu]", i);
+				}
+			}
+			const std::string parallelActual = parallelProgram.ConvertToString();
+			FATAL_ASSERT(parallelActual == expected, u8"병렬 지연 파싱 결과가 다릅니다.\nExpected:\n%s\nActual:\n%s", expected.c_str(), parallelActual.c_str());
+
+			// 참조되지 않은 함수는 평가 결과에서 빠지고, 참조된 함수는 다른 함수에서 참조된 경우도 평가되어야 합니다.
+			const std::string usedFunctions =
+				"func Callee(void) -> void { }\n"
+				"func Caller(void) -> void { Callee(); }\n";
+			const std::string mainFunction = "main(void) -> void { Caller(); }\n";
+			const std::string lazyInput = usedFunctions + "func NotUsed(void) -> void { Callee(); }\n" + mainFunction;
+			const std::string eagerInput = usedFunctions + mainFunction;
+
+			std::string evaluated[2];
+			for (size_t i = 0; i < 2; i++)
+			{
+				const bool isLazy = (i == 1);
+				mcf::Parser::Object parser(isLazy ? lazyInput : eagerInput, false);
+				parser.SetLazyFunctionBody(isLazy);
+				mcf::AST::Program program;
+				parser.ParseProgram(program);
+				FATAL_ASSERT(CheckParserErrors(parser), u8"파싱에 실패 하였습니다.");
+
+				mcf::Object::ScopeTree scopeTree;
+				mcf::Evaluator::Object evaluator;
+				mcf::IR::Pointer object = evaluator.EvalProgram(&program, &scopeTree.Global);
+				FATAL_ASSERT(object.get() != nullptr, u8"object가 nullptr이면 안됩니다.");
+				evaluated[i] = object->Inspect();
+
+				if (isLazy)
+				{
+					FATAL_ASSERT(static_cast<const mcf::AST::Statement::Func*>(program.GetUnsafeStatementPointerAt(2))->IsBodyParsed() == false, u8"참조되지 않은 함수의 본문은 파싱되면 안됩니다.");
+				}
+			}
+			const std::string expectedEvaluation =
+				"Callee proc\n\tpush rbp\n\tpop rbp\n\tret\nCallee endp\n"
+				"Caller proc\n\tpush rbp\n\tsub rsp, 32\n\tcall Callee\n\tadd rsp, 32\n\tpop rbp\n\tret\nCaller endp\n"
+				"main proc\n\tpush rbp\n\tsub rsp, 32\n\tcall Caller\n\tadd rsp, 32\n\tpop rbp\n\tret\nmain endp";
+			FATAL_ASSERT(evaluated[0] == expectedEvaluation, u8"평가 결과가 다릅니다.\nexpected:\n%s\nactual:\n%s", expectedEvaluation.c_str(), evaluated[0].c_str());
+			FATAL_ASSERT(evaluated[1] == evaluated[0], u8"지연 파싱한 프로그램의 평가 결과가 다릅니다.\nexpected:\n%s\nactual:\n%s", evaluated[0].c_str(), evaluated[1].c_str());
+			FATAL_ASSERT(evaluated[1].find("Invalid") == std::string::npos && evaluated[1].find("NotUsed") == std::string::npos, u8"참조되지 않은 함수는 평가 결과에 포함되면 안됩니다.\nactual:\n%s", evaluated[1].c_str());
+			return true;
+		}
+	);
+
+	_names.emplace_back(u8"평면 AST 캐시 파일 평가 테스트");
+	_tests.emplace_back
+	(
+		[&]() -> bool
+		{
+			const std::string fileToEvaluate = FILE_READ_INPUT_PATH;
+			const std::string cacheDirectory = (std::filesystem::temp_directory_path() / "mcf_unittest_ast_cache").string();
+			std::error_code error;
+			std::filesystem::remove_all(cacheDirectory, error);
+
+			// 처음에는 파싱하여 캐시 파일을 쓰고, 다음부터는 캐시 파일에서 읽어야 합니다.
+			for (size_t i = 0; i < 2; i++)
+			{
+				const bool isCacheHitExpected = (i == 1);
+				mcf::Object::ScopeTree scopeTree;
+				mcf::AST::Flat::Program flatProgram;
+				bool isCacheHit = false;
+				FATAL_ASSERT(mcf::Parser::ParseFileWithCache(flatProgram, fileToEvaluate, cacheDirectory, scopeTree.Symbols, &isCacheHit), u8"캐시를 사용한 파싱에 실패 하였습니다.");
+				FATAL_ASSERT(isCacheHit == isCacheHitExpected, u8"캐시 사용 여부가 틀렸습니다. 실제값[%d] 예상값[%d]", isCacheHit, isCacheHitExpected);
+
+				FATAL_ASSERT(CheckFileReadEvaluation(scopeTree, [&](mcf::Evaluator::Object& evaluator, mcf::Object::Scope* scope) { return evaluator.EvalProgram(&flatProgram, scope); }), u8"캐시 사용 여부[%d]의 평가 결과가 다릅니다.", isCacheHit);
+			}
+
+			// 내용이 다른 소스로는 캐시를 읽으면 안됩니다.
+			mcf::Parser::Object parser(fileToEvaluate, true);
+			mcf::AST::Program program;
+			parser.ParseProgram(program);
+			FATAL_ASSERT(CheckParserErrors(parser), u8"파싱에 실패 하였습니다.");
+			std::string binary;
+			const mcf::AST::Flat::Program flatProgram(program);
+			FATAL_ASSERT(flatProgram.Serialize(binary, mcf::AST::Cache::HashSource(flatProgram.GetSource()->GetView())), u8"직렬화에 실패 하였습니다.");
+
+			const std::string changedInput = std::string(flatProgram.GetSource()->GetView()) + " ";
+			const mcf::Lexer::Source changedSource = mcf::Lexer::SourceBuffer::MakeFromString(changedInput);
+			mcf::AST::Flat::Program loadedProgram;
+			FATAL_ASSERT(loadedProgram.Deserialize(binary, changedSource, mcf::AST::Cache::HashSource(changedSource->GetView()), nullptr) == false, u8"내용이 다른 소스로 캐시를 읽으면 안됩니다.");
+			FATAL_ASSERT(loadedProgram.Deserialize(binary.substr(0, binary.size() - 1), flatProgram.GetSource(), mcf::AST::Cache::HashSource(flatProgram.GetSource()->GetView()), nullptr) == false, u8"잘린 캐시를 읽으면 안됩니다.");
+			FATAL_ASSERT(loadedProgram.Deserialize(binary, flatProgram.GetSource(), mcf::AST::Cache::HashSource(flatProgram.GetSource()->GetView()), nullptr), u8"캐시를 읽지 못하였습니다.");
+			FATAL_ASSERT(loadedProgram.GetNodeCount() == flatProgram.GetNodeCount() && loadedProgram.GetStatementCount() == flatProgram.GetStatementCount(), u8"읽은 캐시의 노드 갯수가 다릅니다.");
+
+			// 내용이 손상된 캐시와, 해시는 맞지만 범위를 벗어난 자식 인덱스를 가진 캐시는 읽으면 안됩니다.
+			constexpr const size_t HEADER_SIZE = 40;
+			constexpr const size_t PAYLOAD_HASH_OFFSET = 36;
+			std::string corrupted = binary;
+			corrupted[HEADER_SIZE + 4] ^= 0x01;
+			FATAL_ASSERT(loadedProgram.Deserialize(corrupted, flatProgram.GetSource(), mcf::AST::Cache::HashSource(flatProgram.GetSource()->GetView()), nullptr) == false, u8"손상된 캐시를 읽으면 안됩니다.");
+			const mcf::AST::Flat::Index lastStatement = flatProgram.GetStatementAt(flatProgram.GetStatementCount() - 1);
+			const mcf::AST::Flat::Index outOfRange = mcf::AST::Flat::INVALID_INDEX - 1;
+			corrupted = binary;
+			memcpy(corrupted.data() + HEADER_SIZE + sizeof(mcf::AST::Flat::Node) * lastStatement + sizeof(mcf::AST::Flat::Index), &outOfRange, sizeof(outOfRange));
+			const std::uint32_t payloadHash = static_cast<std::uint32_t>(mcf::AST::Cache::HashSource(std::string_view(corrupted).substr(HEADER_SIZE)));
+			memcpy(corrupted.data() + PAYLOAD_HASH_OFFSET, &payloadHash, sizeof(payloadHash));
+			FATAL_ASSERT(loadedProgram.Deserialize(corrupted, flatProgram.GetSource(), mcf::AST::Cache::HashSource(flatProgram.GetSource()->GetView()), nullptr) == false, u8"범위를 벗어난 인덱스를 가진 캐시를 읽으면 안됩니다.");
+
+			// 인덱스의 범위는 맞지만 본문이 BLOCK 이 아닌 FUNC 를 가진 캐시도 읽으면 안됩니다.
+			mcf::AST::Flat::Index func = mcf::AST::Flat::INVALID_INDEX;
+			for (size_t i = 0; i < flatProgram.GetStatementCount() && func == mcf::AST::Flat::INVALID_INDEX; i++)
+			{
+				func = (flatProgram.GetKind(flatProgram.GetStatementAt(i)) == mcf::AST::Flat::Kind::FUNC) ? flatProgram.GetStatementAt(i) : mcf::AST::Flat::INVALID_INDEX;
+			}
+			FATAL_ASSERT(func != mcf::AST::Flat::INVALID_INDEX, u8"함수 정의를 찾을 수 없습니다.");
+			const mcf::AST::Flat::Index funcSignature = flatProgram.GetNode(func).Left;
+			corrupted = binary;
+			memcpy(corrupted.data() + HEADER_SIZE + sizeof(mcf::AST::Flat::Node) * func + sizeof(mcf::AST::Flat::Index) * 2, &funcSignature, sizeof(funcSignature));
+			const std::uint32_t kindPayloadHash = static_cast<std::uint32_t>(mcf::AST::Cache::HashSource(std::string_view(corrupted).substr(HEADER_SIZE)));
+			memcpy(corrupted.data() + PAYLOAD_HASH_OFFSET, &kindPayloadHash, sizeof(kindPayloadHash));
+			FATAL_ASSERT(loadedProgram.Deserialize(corrupted, flatProgram.GetSource(), mcf::AST::Cache::HashSource(flatProgram.GetSource()->GetView()), nullptr) == false, u8"자식의 종류가 틀린 캐시를 읽으면 안됩니다.");
+
+			// 손상된 캐시 파일은 캐시가 없는 것과 같이 다시 파싱하여 덮어쓰고, 임시 파일은 남지 않아야 합니다.
+			const std::string cacheFilePath = mcf::AST::Cache::MakeFilePath(cacheDirectory, mcf::AST::Cache::HashSource(flatProgram.GetSource()->GetView()));
+			{
+				std::ofstream cacheFile(cacheFilePath, std::ios::binary | std::ios::trunc);
+				cacheFile.write(corrupted.data(), corrupted.size());
+			}
+			for (size_t i = 0; i < 2; i++)
+			{
+				const bool isCacheHitExpected = (i == 1);
+				mcf::AST::Flat::Program cachedProgram;
+				bool isCacheHit = false;
+				FATAL_ASSERT(mcf::Parser::ParseFileWithCache(cachedProgram, fileToEvaluate, cacheDirectory, nullptr, &isCacheHit), u8"캐시를 사용한 파싱에 실패 하였습니다.");
+				FATAL_ASSERT(isCacheHit == isCacheHitExpected && cachedProgram.GetNodeCount() == flatProgram.GetNodeCount(), u8"캐시 사용 여부가 틀렸습니다. 실제값[%d] 예상값[%d]", isCacheHit, isCacheHitExpected);
+			}
+			size_t cacheFileCount = 0;
+			for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(cacheDirectory))
+			{
+				FATAL_ASSERT(entry.path().extension() == mcf::AST::Cache::FILE_EXTENSION, u8"캐시 디렉토리에 다른 파일이 남아있습니다. %s", entry.path().string().c_str());
+				++cacheFileCount;
+			}
+			FATAL_ASSERT(cacheFileCount == 1, u8"캐시 파일의 갯수가 틀렸습니다. 실제값[%zu]", cacheFileCount);
+
+			std::filesystem::remove_all(cacheDirectory, error);
+			return true;
+		}
+	);
+
+	_names.emplace_back(u8"스코프 바인딩 섀도잉 테스트");
+	_tests.emplace_back
+	(
+		[&]() -> bool
+		{
+			mcf::Object::ScopeTree scopeTree;
+			const mcf::Object::TypeInfo byteType = scopeTree.Types.MakePrimitive(false, "byte", 1);
+			const mcf::Object::TypeInfo dwordType = scopeTree.Types.MakePrimitive(false, "dword", 4);
+			scopeTree.Global.DefineType(byteType.GetName(), byteType);
+			scopeTree.Global.DefineType(dwordType.GetName(), dwordType);
+			scopeTree.Global.DefineVariable("g", mcf::Object::Variable{ "g", dwordType });
+
+			// 함수 a 와 b 는 같은 이름의 지역 변수를 가지고, a 의 블록은 a 의 변수와 전역 타입의 이름을 가립니다.
+			mcf::Object::Scope* scopeA = nullptr;
+			mcf::Object::Scope* scopeB = nullptr;
+			mcf::Object::Scope* blockA = nullptr;
+			FATAL_ASSERT(scopeTree.Global.MakeLocalScope(&scopeA, true) && scopeTree.Global.MakeLocalScope(&scopeB, true), u8"함수 스코프 생성에 실패 하였습니다.");
+			FATAL_ASSERT(scopeA->MakeLocalScope(&blockA, false), u8"블록 스코프 생성에 실패 하였습니다.");
+			scopeA->DefineVariable("x", mcf::Object::Variable{ "x", dwordType });
+			scopeB->DefineVariable("x", mcf::Object::Variable{ "x", byteType });
+			blockA->DefineVariable("x", mcf::Object::Variable{ "x", byteType });
+			blockA->DefineVariable("dword", mcf::Object::Variable{ "dword", byteType });
+
+			// 스코프를 여는 순서와 상관없이 각 스코프는 자신과 조상의 바인딩만 보아야 합니다.
+			mcf::Object::BindingStack& stack = scopeTree.Stack;
+			for (size_t i = 0; i < 2; i++)
+			{
+				stack.Enter(scopeA);
+				stack.Enter(blockA);
+				FATAL_ASSERT(blockA->FindVariableInfo("x").Variable.DataType == byteType, u8"블록의 변수가 함수의 변수를 가려야 합니다.");
+				FATAL_ASSERT(blockA->FindTypeInfo("dword") == dwordType, u8"같은 이름의 변수가 있어도 바깥쪽 타입을 찾아야 합니다.");
+				FATAL_ASSERT(blockA->FindVariableInfo("dword").IsValid(), u8"블록의 변수를 찾지 못하였습니다.");
+				const mcf::Object::VariableInfo global = blockA->FindVariableInfo("g");
+				FATAL_ASSERT(global.IsValid() && global.IsGlobal, u8"블록에서 전역 변수를 찾아야 합니다.");
+				FATAL_ASSERT(blockA->FindVariableInfo("x").IsGlobal == false, u8"지역 변수는 전역 변수가 아니어야 합니다.");
+				stack.Leave(blockA);
+
+				FATAL_ASSERT(scopeA->FindVariableInfo("x").Variable.DataType == dwordType, u8"함수 a 의 변수를 찾아야 합니다.");
+				stack.Leave(scopeA);
+
+				stack.Enter(scopeB);
+				FATAL_ASSERT(scopeB->FindVariableInfo("x").Variable.DataType == byteType, u8"함수 b 의 변수를 찾아야 합니다.");
+				FATAL_ASSERT(scopeB->IsIdentifierRegistered("dword") && scopeB->FindVariableInfo("dword").IsValid() == false, u8"블록의 변수는 블록 안에서만 보여야 합니다.");
+				stack.Leave(scopeB);
+
+				FATAL_ASSERT(stack.IsEmpty(), u8"모든 스코프를 닫아야 합니다.");
+				FATAL_ASSERT(scopeTree.Global.FindVariableInfo("x").IsValid() == false, u8"전역 스코프에서 지역 변수를 찾으면 안됩니다.");
+			}
+
+			// 사용 표시는 가장 안쪽 바인딩에만 되어야 합니다.
+			stack.Enter(scopeA);
+			stack.Enter(blockA);
+			FATAL_ASSERT(blockA->UseVariableInfo("x") && blockA->UseVariableInfo("dword"), u8"블록의 변수를 사용하지 못하였습니다.");
+			FATAL_ASSERT(blockA->IsAllVariablesUsed() && scopeA->IsAllVariablesUsed() == false, u8"블록의 변수만 사용되어야 합니다.");
+			stack.Leave(blockA);
+			FATAL_ASSERT(scopeA->UseVariableInfo("x") && scopeA->IsAllVariablesUsed(), u8"함수 a 의 변수를 사용하지 못하였습니다.");
+			stack.Leave(scopeA);
+			stack.Enter(scopeB);
+			FATAL_ASSERT(scopeB->UseVariableInfo("dword") == false, u8"타입 이름은 변수로 사용할 수 없습니다.");
+			stack.Leave(scopeB);
+
+			// 열린 스코프에 정의한 바인딩은 바로 스택에 들어가며 자식 스코프를 닫으면 부모 스코프의 바인딩이 다시 보여야 합니다.
+			stack.Enter(scopeA);
+			stack.Enter(blockA);
+			mcf::Object::Scope* largeBlock = nullptr;
+			FATAL_ASSERT(blockA->MakeLocalScope(&largeBlock, false), u8"블록 스코프 생성에 실패 하였습니다.");
+			stack.Enter(largeBlock);
+			constexpr const size_t LARGE_VARIABLE_COUNT = 32;
+			for (size_t i = 0; i < LARGE_VARIABLE_COUNT; i++)
+			{
+				const std::string name = "v" + std::to_string(i);
+				FATAL_ASSERT(largeBlock->DefineVariable(name, mcf::Object::Variable{ name, (i % 2 == 0) ? byteType : dwordType }).IsValid(), u8"변수 정의에 실패 하였습니다. 이름[%s]", name.c_str());
+			}
+			FATAL_ASSERT(largeBlock->DefineVariable("v3", mcf::Object::Variable{ "v3", byteType }).IsValid() == false, u8"같은 스코프에 같은 이름을 다시 정의하면 안됩니다.");
+			for (size_t i = 0; i < LARGE_VARIABLE_COUNT; i++)
+			{
+				const std::string name = "v" + std::to_string(i);
+				FATAL_ASSERT(largeBlock->FindVariableInfo(name).Variable.DataType == ((i % 2 == 0) ? byteType : dwordType), u8"변수를 찾지 못하였습니다. 이름[%s]", name.c_str());
+			}
+			FATAL_ASSERT(largeBlock->FindVariableInfo("x").Variable.DataType == byteType && largeBlock->IsLocalVariable("x") && largeBlock->IsLocalVariable("g") == false, u8"부모 스코프의 변수를 찾아야 합니다.");
+			stack.Leave(largeBlock);
+			FATAL_ASSERT(blockA->FindVariableInfo("v0").IsValid() == false, u8"자식 스코프의 변수가 부모 스코프에서 보이면 안됩니다.");
+
+			// 자식 스코프를 만든 뒤 부모 스코프에 정의한 이름은 자식 스코프를 여는 동안 보이면 안됩니다.
+			mcf::Object::Scope* earlyBlock = nullptr;
+			FATAL_ASSERT(blockA->MakeLocalScope(&earlyBlock, false), u8"블록 스코프 생성에 실패 하였습니다.");
+			FATAL_ASSERT(blockA->DefineVariable("late", mcf::Object::Variable{ "late", byteType }).IsValid(), u8"변수 정의에 실패 하였습니다.");
+			stack.Enter(earlyBlock);
+			FATAL_ASSERT(earlyBlock->FindVariableInfo("late").IsValid() == false && earlyBlock->FindVariableInfo("x").Variable.DataType == byteType, u8"자식 스코프를 만든 뒤 정의된 이름이 보이면 안됩니다.");
+			stack.Leave(earlyBlock);
+			FATAL_ASSERT(blockA->FindVariableInfo("late").IsValid(), u8"자식 스코프를 닫은 뒤에는 부모 스코프의 이름이 다시 보여야 합니다.");
+			stack.Leave(blockA);
+			stack.Leave(scopeA);
+			return true;
+		}
+	);
+	_names.emplace_back(u8"함수 테이블 참조 테스트");
+	_tests.emplace_back
+	(
+		[&]() -> bool
+		{
+			mcf::Object::ScopeTree scopeTree;
+			const mcf::Object::TypeInfo dwordType = scopeTree.Types.MakePrimitive(false, "dword", 4);
+			scopeTree.Global.DefineType(dwordType.GetName(), dwordType);
+
+			mcf::Object::FunctionInfo info;
+			info.Name = "foo";
+			info.ReturnType = dwordType;
+			FATAL_ASSERT(scopeTree.Global.MakeLocalScopeToFunctionInfo(info) && scopeTree.Global.DefineFunction(info.Name, info), u8"함수 정의에 실패 하였습니다.");
+
+			// 함수 정보는 스코프의 함수 테이블 항목을 가리키므로 찾을 때마다 같은 주소여야 합니다.
+			const mcf::Object::FunctionInfo& found = scopeTree.Global.FindFunction("foo");
+			FATAL_ASSERT(found.IsValid() && &found == &scopeTree.Global.FindFunction("foo") && found.ReturnType == dwordType, u8"함수 테이블 항목을 찾지 못하였습니다.");
+			FATAL_ASSERT(&scopeTree.Global.FindFunction("bar") == &mcf::Object::FunctionInfo::GetInvalidFunctionInfo(), u8"정의되지 않은 함수는 유효하지 않은 함수 정보를 반환해야 합니다.");
+			FATAL_ASSERT(&scopeTree.Global.FindInternalFunction(mcf::Object::InternalFunctionType::COPY_MEMORY) == &scopeTree.InternalFunctionInfosByTypes[mcf::ENUM_INDEX(mcf::Object::InternalFunctionType::COPY_MEMORY)], u8"내부 함수 정보를 복사하면 안됩니다.");
+
+			// IR 노드도 함수 정보를 복사하지 않고 테이블 항목을 참조합니다.
+			const mcf::IR::Expression::FunctionIdentifier identifier(found);
+			const mcf::IR::Expression::Call call(found, mcf::IR::Expression::PointerVector());
+			FATAL_ASSERT(&identifier.GetInfo() == &found && &call.GetInfo() == &found, u8"IR 노드가 함수 테이블 항목을 참조해야 합니다.");
+			return true;
+		}
+	);
+	_names.emplace_back(u8"함수 본문 병렬 평가 테스트");
+	_tests.emplace_back
+	(
+		[&]() -> bool
+		{
+			mcf::Parser::Object parser(FILE_READ_INPUT_PATH, true);
+			mcf::AST::Program program;
+			parser.ParseProgram(program);
+			FATAL_ASSERT(CheckParserErrors(parser), u8"파싱에 실패 하였습니다.");
+			const mcf::AST::Flat::Program flatProgram(program);
+
+			// 본문을 나누는 스레드 수와 상관없이 결과는 순차 평가와 같아야 합니다. 0 은 하드웨어 스레드 수를 사용합니다.
+			const size_t threadCounts[] = { 1, 2, 4, 0 };
+			for (size_t i = 0; i < MCF_ARRAY_SIZE(threadCounts); i++)
+			{
+				mcf::Object::ScopeTree scopeTree;
+				FATAL_ASSERT(CheckFileReadEvaluation(scopeTree, [&](mcf::Evaluator::Object& evaluator, mcf::Object::Scope* scope) { return evaluator.EvalProgramParallel(&program, scope, threadCounts[i]); }), u8"평가 결과가 다릅니다. threadCount[%zu]", threadCounts[i]);
+				mcf::Object::ScopeTree flatScopeTree;
+				FATAL_ASSERT(CheckFileReadEvaluation(flatScopeTree, [&](mcf::Evaluator::Object& evaluator, mcf::Object::Scope* scope) { return evaluator.EvalProgramParallel(&flatProgram, scope, threadCounts[i]); }), u8"평면 AST 의 평가 결과가 다릅니다. threadCount[%zu]", threadCounts[i]);
+			}
+
+			// 본문이 많고 본문마다 리터럴을 등록하는 프로그램도 스레드 수와 상관없이 같은 코드와 같은 리터럴 인덱스를 만들어야 합니다.
+			// 모든 본문이 함께 쓰는 리터럴은 처음 나온 본문에서, 본문마다 다른 리터럴은 본문의 순서대로 인덱스를 받고 전역 문장의 리터럴은 본문보다 먼저 인덱스를 받습니다.
+			constexpr const size_t FUNCTION_COUNT = 64;
+			std::string input = "typedef int32: dword;\nextern func printf(format: unsigned qword, ...args) -> int32;\n";
+			std::string mainBody;
+			for (size_t i = 0; i < FUNCTION_COUNT; i++)
+			{
+				const std::string index = std::to_string(i);
+				input += "let value" + index + ": int32 = " + index + ";\n";
+				input += "func f" + index + "(void) -> void\n{\n";
+				input += "\tlet shared: byte[] = \"shared %d\\n\";\n";
+				input += "\tlet own: byte[] = \"own " + index + "\\n\";\n";
+				input += "\tlet i: dword = 0;\n";
+				input += "\twhile(i < " + std::to_string(i % 4 + 1) + ")\n\t{\n\t\tprintf(shared as unsigned qword, value" + index + ");\n\t\ti = i + 1;\n\t}\n";
+				input += "\tprintf(own as unsigned qword, value" + index + ");\n}\n";
+				mainBody += "\tf" + index + "();\n";
+			}
+			input += "let banner: byte[] = \"banner\";\n";
+			input += "main(void) -> void\n{\n" + mainBody + "}\n";
+
+			mcf::Parser::Object manyParser(input, false);
+			mcf::AST::Program manyProgram;
+			manyParser.ParseProgram(manyProgram);
+			FATAL_ASSERT(CheckParserErrors(manyParser), u8"파싱에 실패 하였습니다.");
+
+			std::string sequentialEvaluated;
+			const size_t manyThreadCounts[] = { 1, 2, 3, 8 };
+			for (size_t i = 0; i < MCF_ARRAY_SIZE(manyThreadCounts); i++)
+			{
+				mcf::Object::ScopeTree scopeTree;
+				scopeTree.Global.DefineType("byte", scopeTree.Types.MakePrimitive(false, "byte", 1));
+				scopeTree.Global.DefineType("dword", scopeTree.Types.MakePrimitive(false, "dword", 4));
+				scopeTree.Global.DefineType("qword", scopeTree.Types.MakePrimitive(false, "qword", 8));
+
+				mcf::Evaluator::Object evaluator;
+				mcf::IR::Pointer object = evaluator.EvalProgramParallel(&manyProgram, &scopeTree.Global, manyThreadCounts[i]);
+				FATAL_ASSERT(object.get() != nullptr, u8"object가 nullptr이면 안됩니다.");
+				const std::string evaluated = object->Inspect();
+				FATAL_ASSERT(evaluated.find("Invalid") == std::string::npos, u8"평가에 실패한 문장이 있습니다. threadCount[%zu]\nactual:\n%s", manyThreadCounts[i], evaluated.c_str());
+				if (i == 0)
+				{
+					sequentialEvaluated = evaluated;
+				}
+				FATAL_ASSERT(evaluated == sequentialEvaluated, u8"스레드 수에 따라 평가 결과가 다릅니다. threadCount[%zu]\nexpected:\n%s\nactual:\n%s", manyThreadCounts[i], sequentialEvaluated.c_str(), evaluated.c_str());
+
+				FATAL_ASSERT(scopeTree.LiteralIndexMap.size() == FUNCTION_COUNT + 2, u8"리터럴의 갯수가 틀렸습니다. 실제값[%zu]", scopeTree.LiteralIndexMap.size());
+				FATAL_ASSERT(scopeTree.LiteralIndexMap.at("\"banner\"").first == 0 && scopeTree.LiteralIndexMap.at("\"shared %d\\n\"").first == 1, u8"리터럴의 인덱스가 틀렸습니다. threadCount[%zu]", manyThreadCounts[i]);
+				for (size_t j = 0; j < FUNCTION_COUNT; j++)
+				{
+					const size_t literalIndex = scopeTree.LiteralIndexMap.at("\"own " + std::to_string(j) + "\\n\"").first;
+					FATAL_ASSERT(literalIndex == j + 2, u8"본문의 리터럴은 본문의 순서대로 인덱스를 받아야 합니다. threadCount[%zu] 함수[f%zu] 실제값[%zu]", manyThreadCounts[i], j, literalIndex);
+				}
+			}
+			return true;
+		}
+	);
+	_names.emplace_back(u8"선언 순서 가시성 테스트");
+	_tests.emplace_back
+	(
+		[&]() -> bool
+		{
+			// 자식 스코프는 자신을 만들 때까지 부모 스코프에 정의된 이름만 봅니다. 함수 스코프는 재귀 호출을 위해 함수 자신까지 봅니다.
+			mcf::Object::ScopeTree scopeTree;
+			const mcf::Object::TypeInfo dwordType = scopeTree.Types.MakePrimitive(false, "dword", 4);
+			scopeTree.Global.DefineType(dwordType.GetName(), dwordType);
+			scopeTree.Global.DefineVariable("before", mcf::Object::Variable{ "before", dwordType });
+
+			mcf::Object::FunctionInfo info;
+			info.Name = "foo";
+			FATAL_ASSERT(scopeTree.Global.MakeLocalScopeToFunctionInfo(info) && scopeTree.Global.DefineFunction(info.Name, info), u8"함수 정의에 실패 하였습니다.");
+			scopeTree.Global.DefineVariable("after", mcf::Object::Variable{ "after", dwordType });
+
+			mcf::Object::Scope* block = nullptr;
+			FATAL_ASSERT(info.LocalScope->MakeLocalScope(&block, false), u8"블록 스코프 생성에 실패 하였습니다.");
+			FATAL_ASSERT(block->GetUnsafeParentScopePointer() == info.LocalScope, u8"블록 스코프의 부모는 함수 스코프여야 합니다.");
+			const auto checkVisibleNames = [&](const mcf::Object::Scope* scope) -> bool
+			{
+				FATAL_ASSERT(scope->FindVariableInfo("before").IsValid() && scope->FindTypeInfo("dword") == dwordType, u8"함수보다 앞에 정의된 이름은 보여야 합니다.");
+				FATAL_ASSERT(scope->FindFunction("foo").IsValid(), u8"함수 본문에서 함수 자신이 보여야 합니다.");
+				FATAL_ASSERT(scope->FindVariableInfo("after").IsValid() == false && scope->IsIdentifierRegistered("after") == false, u8"함수보다 뒤에 정의된 이름은 보이면 안됩니다.");
+				return true;
+			};
+			scopeTree.Stack.Enter(info.LocalScope);
+			FATAL_ASSERT(checkVisibleNames(info.LocalScope), u8"함수 스코프에서 보이는 이름이 틀렸습니다.");
+			scopeTree.Stack.Enter(block);
+			FATAL_ASSERT(checkVisibleNames(block), u8"블록 스코프에서 보이는 이름이 틀렸습니다.");
+			scopeTree.Stack.Leave(block);
+			scopeTree.Stack.Leave(info.LocalScope);
+			FATAL_ASSERT(scopeTree.Global.FindVariableInfo("after").IsValid(), u8"전역 스코프에서는 모든 전역 변수가 보여야 합니다.");
+
+			// 함수 본문을 나중에 평가하여도 본문은 함수보다 앞에 선언된 전역 이름만 사용할 수 있습니다.
+			mcf::Parser::Object recursiveParser("func countdown(void) -> void { countdown(); }", false);
+			mcf::AST::Program recursiveProgram;
+			recursiveParser.ParseProgram(recursiveProgram);
+			FATAL_ASSERT(CheckParserErrors(recursiveParser), u8"파싱에 실패 하였습니다.");
+			mcf::Object::ScopeTree recursiveScopeTree;
+			mcf::Evaluator::Object evaluator;
+			const std::string recursiveExpected = "countdown proc\n\tpush rbp\n\tsub rsp, 32\n\tcall countdown\n\tadd rsp, 32\n\tpop rbp\n\tret\ncountdown endp";
+			const std::string recursiveEvaluated = evaluator.EvalProgramParallel(&recursiveProgram, &recursiveScopeTree.Global, 2)->Inspect();
+			FATAL_ASSERT(recursiveEvaluated == recursiveExpected, "\nexpected:\n%s\nactual:\n%s", recursiveExpected.c_str(), recursiveEvaluated.c_str());
+
+			// 뒤에 선언된 이름은 에러로 보고되어 평가 결과가 Invalid 가 되어야 합니다.
+			const std::string laterDeclaredInputs[] =
+			{
+				"func first(void) -> void { second(); }\nfunc second(void) -> void { }",
+				"func first(void) -> void { unused(later); }\nlet later: byte = 0;",
+			};
+			for (size_t i = 0; i < MCF_ARRAY_SIZE(laterDeclaredInputs); i++)
+			{
+				mcf::Parser::Object parser(laterDeclaredInputs[i], false);
+				mcf::AST::Program program;
+				parser.ParseProgram(program);
+				FATAL_ASSERT(CheckParserErrors(parser), u8"파싱에 실패 하였습니다. 인덱스[%zu]", i);
+
+				mcf::Object::ScopeTree laterScopeTree;
+				laterScopeTree.Global.DefineType("byte", laterScopeTree.Types.MakePrimitive(false, "byte", 1));
+				mcf::Evaluator::Object laterEvaluator;
+				const std::string evaluated = laterEvaluator.EvalProgramParallel(&program, &laterScopeTree.Global, 2)->Inspect();
+				FATAL_ASSERT(evaluated.find("first proc") == std::string::npos, u8"뒤에 선언된 이름을 사용하는 함수는 평가에 실패해야 합니다. 인덱스[%zu]\nactual:\n%s", i, evaluated.c_str());
+			}
+			return true;
+		}
+	);
+	_names.emplace_back(u8"타입 테이블 인터닝 테스트");
+	_tests.emplace_back
+	(
+		[&]() -> bool
+		{
+			mcf::Object::ScopeTree scopeTree;
+			const mcf::Object::TypeInfo dwordType = scopeTree.Types.MakePrimitive(false, "dword", 4);
+			const mcf::Object::TypeInfo unsignedDwordType = scopeTree.Types.MakePrimitive(true, "dword", 4);
+			FATAL_ASSERT(scopeTree.Types.MakePrimitive(false, "dword", 4).GetID() == dwordType.GetID(), u8"같은 구성의 타입은 같은 ID 를 받아야 합니다.");
+			FATAL_ASSERT(unsignedDwordType != dwordType && dwordType.MakeUnsignedType() == unsignedDwordType, u8"부호가 다른 타입은 다른 ID 를 받아야 합니다.");
+			FATAL_ASSERT(mcf::Object::TypeInfo().GetID() == mcf::Object::VOID_TYPE_ID && mcf::Object::TypeInfo::GetVoidTypeInfo().IsValid() == false, u8"기본 타입은 void 여야 합니다.");
+
+			// 배열 타입도 같은 구성이면 같은 타입이고 크기는 등록할 때 계산됩니다.
+			const mcf::Object::TypeInfo arrayType = dwordType.MakeArrayType(3).MakeArrayType(2);
+			FATAL_ASSERT(arrayType == scopeTree.Types.MakePrimitive(false, "dword", 4, { 3, 2 }), u8"같은 배열 타입은 같은 ID 를 받아야 합니다.");
+			FATAL_ASSERT(arrayType.GetSize() == 24 && dwordType.GetSize() == 4, u8"타입 크기가 틀렸습니다. Size=%zu", arrayType.GetSize());
+			FATAL_ASSERT(arrayType.MakeArrayItemType().MakeArrayItemType() == dwordType, u8"배열의 원소 타입이 틀렸습니다.");
+			FATAL_ASSERT(dwordType.MakeArrayType(0).MakeResizedArrayType({ 5 }).GetSize() == 20, u8"배열 크기를 바꾼 타입의 크기가 틀렸습니다.");
+			FATAL_ASSERT(dwordType.MakeNamedType("int").GetName() == "int" && dwordType.GetName() == "dword", u8"이름을 바꾸어도 원래 타입은 바뀌면 안됩니다.");
+
+			// 타입 테이블은 스코프 트리마다 따로 있으므로 다른 컴파일의 타입이 쌓이지 않습니다. void 와 variadic 은 모든 테이블이 함께 씁니다.
+			const size_t typeCount = scopeTree.Types.GetCount();
+			FATAL_ASSERT(scopeTree.Types.MakePrimitive(false, "dword", 4, { 3, 2 }) == arrayType && scopeTree.Types.GetCount() == typeCount, u8"이미 등록된 타입을 다시 등록하면 안됩니다.");
+			mcf::Object::ScopeTree otherScopeTree;
+			const size_t otherTypeCount = otherScopeTree.Types.GetCount();
+			const mcf::Object::TypeInfo otherDwordType = otherScopeTree.Types.MakePrimitive(false, "dword", 4);
+			FATAL_ASSERT(otherDwordType.GetTable() == &otherScopeTree.Types && dwordType.GetTable() == &scopeTree.Types, u8"타입은 자신을 만든 스코프 트리의 테이블에 등록되어야 합니다.");
+			FATAL_ASSERT(otherScopeTree.Types.GetCount() == otherTypeCount + 1 && scopeTree.Types.GetCount() == typeCount, u8"다른 스코프 트리의 테이블에 타입이 등록되면 안됩니다.");
+			FATAL_ASSERT(mcf::Object::TypeInfo::GetVariadicTypeInfo().GetID() == mcf::Object::VARIADIC_TYPE_ID && mcf::Object::TypeInfo::GetVariadicTypeInfo().GetTable() == nullptr, u8"variadic 타입은 모든 테이블이 함께 써야 합니다.");
+			return true;
+		}
+	);
 }
 
 bool UnitTest::EvaluatorTest::CheckParserErrors(mcf::Parser::Object& parser) noexcept
@@ -674,4 +1219,21 @@ bool UnitTest::EvaluatorTest::CheckParserErrors(mcf::Parser::Object& parser) noe
 		printf("%s(%zu,%zu): error P%zu: %s\n", curr.Name.c_str(), curr.Line, curr.Index, mcf::ENUM_INDEX(curr.ID), curr.Message.c_str());
 	}
 	return false;
+}
+
+bool UnitTest::EvaluatorTest::CheckFileReadEvaluation(mcf::Object::ScopeTree& scopeTree, const std::function<mcf::IR::Pointer(mcf::Evaluator::Object& evaluator, mcf::Object::Scope* scope)>& evaluate) noexcept
+{
+	scopeTree.Global.DefineType("byte", scopeTree.Types.MakePrimitive(false, "byte", 1));
+	scopeTree.Global.DefineType("word", scopeTree.Types.MakePrimitive(false, "word", 2));
+	scopeTree.Global.DefineType("dword", scopeTree.Types.MakePrimitive(false, "dword", 4));
+	scopeTree.Global.DefineType("qword", scopeTree.Types.MakePrimitive(false, "qword", 8));
+
+	mcf::Evaluator::Object evaluator;
+	mcf::IR::Pointer object = evaluate(evaluator, &scopeTree.Global);
+	FATAL_ASSERT(object.get() != nullptr, u8"object가 nullptr이면 안됩니다.");
+
+	const std::string exepctedResult = mcf::Lexer::ReadFile(FILE_READ_EXPECTED_PATH);
+	const std::string evaluated = object->Inspect();
+	FATAL_ASSERT(evaluated == exepctedResult, "FileName: %s\nexpected:\n%s\nactual:\n%s", FILE_READ_INPUT_PATH, exepctedResult.c_str(), evaluated.c_str());
+	return true;
 }
\ No newline at end of file
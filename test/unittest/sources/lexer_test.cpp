@@ -1,4 +1,6 @@
-﻿#include <iostream>
+﻿#include <cstring>
+#include <iostream>
+#include <sstream>
 #include <vector>
 #include <string>
 
@@ -304,7 +306,7 @@ namespace UnitTest
 						i, j, mcf::Token::CONVERT_TYPE_TO_STRING(testCases[i].ExpectedResults[j].Type), mcf::Token::CONVERT_TYPE_TO_STRING(actualTokens[j].Type));
 
 					FATAL_ASSERT(actualTokens[j].Literal == testCases[i].ExpectedResults[j].Literal, u8"tests[%zu-%zu] - 토큰 리터럴이 틀렸습니다. 예상값=%s, 실제값=%s",
-						i, j, testCases[i].ExpectedResults[j].Literal.c_str(), actualTokens[j].Literal.c_str());
+						i, j, std::string(testCases[i].ExpectedResults[j].Literal).c_str(), std::string(actualTokens[j].Literal).c_str());
 				}
 			}
 
@@ -571,13 +573,531 @@ namespace UnitTest
 			for (size_t i = 0; i < actualTokenCount; i++)
 			{
 				FATAL_ASSERT(actualTokens[i].Type == expectedResults[i].Type, u8"tests[line: %zu, index: %zu] - 토큰 타입이 틀렸습니다. 예상값=%s, 실제값=%s",
-					actualTokens[i].Line, actualTokens[i].Index, mcf::Token::CONVERT_TYPE_TO_STRING(expectedResults[i].Type), mcf::Token::CONVERT_TYPE_TO_STRING(actualTokens[i].Type));
+					lexer.GetSource()->GetLine(actualTokens[i].Offset), lexer.GetSource()->GetIndex(actualTokens[i].Offset), mcf::Token::CONVERT_TYPE_TO_STRING(expectedResults[i].Type), mcf::Token::CONVERT_TYPE_TO_STRING(actualTokens[i].Type));
 
 				FATAL_ASSERT(actualTokens[i].Literal == expectedResults[i].Literal, u8"tests[line: %zu, index: %zu] - 토큰 리터럴이 틀렸습니다. 예상값=%s, 실제값=%s",
-					actualTokens[i].Line, actualTokens[i].Index, expectedResults[i].Literal.c_str(), actualTokens[i].Literal.c_str());
+					lexer.GetSource()->GetLine(actualTokens[i].Offset), lexer.GetSource()->GetIndex(actualTokens[i].Offset), std::string(expectedResults[i].Literal).c_str(), std::string(actualTokens[i].Literal).c_str());
 			}
 
 			return true;
 			});
+
+		_names.emplace_back(u8"토큰 버퍼(TokenizeAll) 생성 테스트");
+		_tests.emplace_back([&]() {
+			const char* const filePaths[] =
+			{
+				"./test/unittest/texts/test_file_read.txt",
+				"./test/unittest/texts/simple_game_project.mcf",
+				"./test/unittest/texts/enum_header.hmcf",
+			};
+			const size_t fileCount = MCF_ARRAY_SIZE(filePaths);
+
+			for (size_t i = 0; i < fileCount; i++)
+			{
+				mcf::Lexer::TokenBuffer tokenBuffer;
+				const mcf::Lexer::Error error = mcf::Lexer::TokenizeAll(filePaths[i], true, tokenBuffer);
+				FATAL_ASSERT(error == mcf::Lexer::Error::SUCCESS, u8"tests[%zu] - TokenizeAll 이 실패하였습니다. file=%s", i, filePaths[i]);
+
+				mcf::Lexer::Object lexer(filePaths[i], true);
+				const size_t tokenCount = tokenBuffer.GetCount();
+				for (size_t j = 0; j < tokenCount; j++)
+				{
+					const mcf::Token::Data expected = lexer.ReadNextToken();
+					const mcf::Token::Data actual = tokenBuffer.GetToken(j);
+					FATAL_ASSERT(actual.Type == expected.Type, u8"tests[%zu-%zu] - 토큰 타입이 틀렸습니다. 예상값=%s, 실제값=%s",
+						i, j, mcf::Token::CONVERT_TYPE_TO_STRING(expected.Type), mcf::Token::CONVERT_TYPE_TO_STRING(actual.Type));
+
+					FATAL_ASSERT(actual.Literal == expected.Literal, u8"tests[%zu-%zu] - 토큰 리터럴이 틀렸습니다. 예상값=%s, 실제값=%s",
+						i, j, std::string(expected.Literal).c_str(), std::string(actual.Literal).c_str());
+
+					FATAL_ASSERT(actual.Offset == expected.Offset, u8"tests[%zu-%zu] - 토큰의 위치가 틀렸습니다. 예상값=%u, 실제값=%u", i, j, expected.Offset, actual.Offset);
+					FATAL_ASSERT(tokenBuffer.GetLine(j) == lexer.GetSource()->GetLine(expected.Offset), u8"tests[%zu-%zu] - 줄 번호가 틀렸습니다. 예상값=%zu, 실제값=%zu",
+						i, j, lexer.GetSource()->GetLine(expected.Offset), tokenBuffer.GetLine(j));
+				}
+				FATAL_ASSERT(tokenBuffer.GetType(tokenCount - 1) == mcf::Token::Type::END_OF_FILE, u8"tests[%zu] - 토큰 버퍼는 END_OF_FILE 로 끝나야 합니다.", i);
+			}
+
+			return true;
+			});
+
+		_names.emplace_back(u8"병렬 토큰 생성(TokenizeAllParallel) 테스트");
+		_tests.emplace_back([&]() {
+			struct TestCase
+			{
+				const std::string Input;
+				const bool IsFile;
+			};
+			const TestCase testCases[] =
+			{
+				{ "./test/unittest/texts/test_file_read.txt", true },
+				{ "./test/unittest/texts/simple_game_project.mcf", true },
+				{ "./test/unittest/texts/enum_header.hmcf", true },
+				{ "let a = \"// not comment\";\nlet b = \"/* not block\";\nlet c = 1;\n", false },
+				{ "/* 여러 줄\n 블록 주석\n */ let a = 1;\n// 한줄 주석 /* 블록 아님\nlet b = 2; /* \"\n\" */\nlet c = 3;\n", false },
+				{ "let c = \"\";\r\nlet d = 4;\r\n/*/ still comment\n**/ let e = 5;\n", false },
+				// 렉서는 '\0' 을 입력의 끝으로 처리하므로 그 뒤의 끝나지 않은 문자열과 주석은 읽지 않고 순차 렉싱으로 처리합니다.
+				{ std::string("let a = 1;\nlet b = 2;\n") + '\0' + "let c = \"/* unterminated\n", false },
+#if defined(MCF_RELEASE_ONLY_TEST)
+				{ "let a = \"\n\";\nlet b = \"unterminated\nlet c = \"\";\r\nlet d = 4;\r\n/*/ still comment\n**/ let e = 5;\n", false },
+				{ "let a = 1;\n/* unterminated\nlet b = 2;\nlet c = 3;\n", false },
+#endif
+			};
+			const size_t testCaseCount = MCF_ARRAY_SIZE(testCases);
+			const size_t chunkSizes[] = { 1, 7, 64, 4096 };
+			const size_t chunkSizeCount = MCF_ARRAY_SIZE(chunkSizes);
+
+			for (size_t i = 0; i < testCaseCount; i++)
+			{
+				for (size_t j = 0; j < chunkSizeCount; j++)
+				{
+					mcf::Lexer::TokenBuffer tokenBuffer;
+					const mcf::Lexer::Error error = mcf::Lexer::TokenizeAllParallel(testCases[i].Input, testCases[i].IsFile, 4, chunkSizes[j], tokenBuffer);
+					FATAL_ASSERT(error == mcf::Lexer::Error::SUCCESS, u8"tests[%zu-%zu] - TokenizeAllParallel 이 실패하였습니다.", i, j);
+
+					// 토큰은 순차적으로 읽은 ReadNextToken 결과와, 토큰의 위치는 순차적으로 만든 토큰 버퍼와 같아야 합니다.
+					mcf::Lexer::TokenBuffer sequentialBuffer;
+					mcf::Lexer::TokenizeAll(testCases[i].Input, testCases[i].IsFile, sequentialBuffer);
+					mcf::Lexer::Object lexer(testCases[i].Input, testCases[i].IsFile);
+					const size_t tokenCount = tokenBuffer.GetCount();
+					FATAL_ASSERT(tokenCount == sequentialBuffer.GetCount(), u8"tests[%zu-%zu] - 토큰의 갯수가 틀렸습니다. 예상값=%zu, 실제값=%zu", i, j, sequentialBuffer.GetCount(), tokenCount);
+					for (size_t k = 0; k < tokenCount; k++)
+					{
+						const mcf::Token::Data expected = lexer.ReadNextToken();
+						const mcf::Token::Data actual = tokenBuffer.GetToken(k);
+						FATAL_ASSERT(actual.Type == expected.Type, u8"tests[%zu-%zu-%zu] - 토큰 타입이 틀렸습니다. 예상값=%s, 실제값=%s",
+							i, j, k, mcf::Token::CONVERT_TYPE_TO_STRING(expected.Type), mcf::Token::CONVERT_TYPE_TO_STRING(actual.Type));
+
+						FATAL_ASSERT(actual.Literal == expected.Literal, u8"tests[%zu-%zu-%zu] - 토큰 리터럴이 틀렸습니다. 예상값=%s, 실제값=%s",
+							i, j, k, std::string(expected.Literal).c_str(), std::string(actual.Literal).c_str());
+
+						FATAL_ASSERT(tokenBuffer.GetOffset(k) == sequentialBuffer.GetOffset(k) && tokenBuffer.GetLine(k) == sequentialBuffer.GetLine(k) && tokenBuffer.GetIndex(k) == sequentialBuffer.GetIndex(k),
+							u8"tests[%zu-%zu-%zu] - 토큰의 위치가 틀렸습니다. 예상값=%zu(%zu, %zu), 실제값=%zu(%zu, %zu)", i, j, k,
+							static_cast<size_t>(sequentialBuffer.GetOffset(k)), sequentialBuffer.GetLine(k), sequentialBuffer.GetIndex(k),
+							static_cast<size_t>(tokenBuffer.GetOffset(k)), tokenBuffer.GetLine(k), tokenBuffer.GetIndex(k));
+					}
+					FATAL_ASSERT(tokenBuffer.GetType(tokenCount - 1) == mcf::Token::Type::END_OF_FILE, u8"tests[%zu-%zu] - 토큰 버퍼는 END_OF_FILE 로 끝나야 합니다.", i, j);
+				}
+			}
+
+			return true;
+			});
+
+		_names.emplace_back(u8"증분 렉싱(TokenBuffer::ApplyEdit) 테스트");
+		_tests.emplace_back([&]() {
+			struct TestCase
+			{
+				const std::string Input;
+				const bool IsFile;
+				const mcf::Lexer::Edit Edit;
+				const size_t MaxRelexedCount; // 0 이면 검사하지 않습니다.
+			};
+			const TestCase testCases[] =
+			{
+				{ "./test/unittest/texts/simple_game_project.mcf", true, { 520, 0, "x" }, 3 },
+				{ "./test/unittest/texts/simple_game_project.mcf", true, { 700, 0, "\nlet added: int32 = 10;\n" }, 10 },
+				{ "./test/unittest/texts/test_file_read.txt", true, { 100, 50, "// 주석으로 바꿈\n" }, 0 },
+				{ "let abc = 1;\nlet d = 2;", false, { 7, 0, "def" }, 2 },
+				{ "let abc = 1;\nlet d = 2;", false, { 4, 3, "" }, 0 },
+				{ "let a = 1;\nlet b = 2;", false, { 6, 1, "==" }, 0 },
+				{ "let a = 1; /* 주석 */\nlet b = 2;", false, { 19, 2, "" }, 0 },
+				{ "let a = 1;\r\nlet b = 2;\r\n", false, { 12, 0, "\n\n\n" }, 2 },
+				{ "let a = 1;\nlet b = 2;", false, { 20, 0, " let c = 3;" }, 0 },
+				{ "let a = 1;\nlet b = 2;", false, { 10, 11, "" }, 0 },
+				// '\0' 이 있는 입력은 전체를 다시 렉싱하며, '\0' 뒤의 끝나지 않은 문자열과 주석은 읽지 않습니다.
+				{ "let a = 1;\nlet b = 2;", false, { 10, 0, std::string_view("\0\"/*", 4) }, 0 },
+				{ std::string("let a = 1;\n") + '\0' + "let b = \"/* unterminated", false, { 4, 1, "b" }, 0 },
+#if defined(MCF_RELEASE_ONLY_TEST)
+				// 끝나지 않은 문자열, 주석과 파일 중간의 BOM 을 만드는 편집입니다.
+				{ "./test/unittest/texts/simple_game_project.mcf", true, { 300, 12, "" }, 0 },
+				{ "./test/unittest/texts/simple_game_project.mcf", true, { 0, 0, "/*" }, 0 },
+				{ "let a = \"abc\";\nlet b = 2;", false, { 8, 1, "" }, 0 },
+				{ "let a = 1;\nlet b = 2;", false, { 0, 0, "\xEF\xBB\xBF" }, 0 },
+#endif
+			};
+			const size_t testCaseCount = MCF_ARRAY_SIZE(testCases);
+
+			for (size_t i = 0; i < testCaseCount; i++)
+			{
+				mcf::Lexer::TokenBuffer tokenBuffer;
+				mcf::Lexer::Error error = mcf::Lexer::TokenizeAll(testCases[i].Input, testCases[i].IsFile, tokenBuffer);
+				FATAL_ASSERT(error == mcf::Lexer::Error::SUCCESS, u8"tests[%zu] - TokenizeAll 이 실패하였습니다.", i);
+
+				const mcf::Lexer::Edit& edit = testCases[i].Edit;
+				std::string editedInput(tokenBuffer.GetSource()->GetView());
+				editedInput.replace(edit.Offset, edit.RemovedLength, edit.InsertedText);
+
+				size_t relexedCount = 0;
+				error = tokenBuffer.ApplyEdit(edit, &relexedCount);
+				FATAL_ASSERT(error == mcf::Lexer::Error::SUCCESS, u8"tests[%zu] - ApplyEdit 이 실패하였습니다.", i);
+				FATAL_ASSERT(tokenBuffer.GetSource()->GetView() == editedInput, u8"tests[%zu] - 편집된 소스가 틀렸습니다.", i);
+				FATAL_ASSERT(testCases[i].MaxRelexedCount == 0 || relexedCount <= testCases[i].MaxRelexedCount,
+					u8"tests[%zu] - 너무 많은 토큰을 다시 렉싱하였습니다. 최대값=%zu, 실제값=%zu", i, testCases[i].MaxRelexedCount, relexedCount);
+
+				// 편집된 소스를 처음부터 렉싱한 결과와 같아야 합니다.
+				mcf::Lexer::TokenBuffer expectedBuffer;
+				error = mcf::Lexer::TokenizeAll(editedInput, false, expectedBuffer);
+				FATAL_ASSERT(error == mcf::Lexer::Error::SUCCESS, u8"tests[%zu] - TokenizeAll 이 실패하였습니다.", i);
+
+				const size_t tokenCount = tokenBuffer.GetCount();
+				FATAL_ASSERT(tokenCount == expectedBuffer.GetCount(), u8"tests[%zu] - 토큰의 갯수가 틀렸습니다. 예상값=%zu, 실제값=%zu", i, expectedBuffer.GetCount(), tokenCount);
+				for (size_t j = 0; j < tokenCount; j++)
+				{
+					FATAL_ASSERT(tokenBuffer.GetType(j) == expectedBuffer.GetType(j), u8"tests[%zu-%zu] - 토큰 타입이 틀렸습니다. 예상값=%s, 실제값=%s",
+						i, j, mcf::Token::CONVERT_TYPE_TO_STRING(expectedBuffer.GetType(j)), mcf::Token::CONVERT_TYPE_TO_STRING(tokenBuffer.GetType(j)));
+
+					FATAL_ASSERT(tokenBuffer.GetOffset(j) == expectedBuffer.GetOffset(j) && tokenBuffer.GetLength(j) == expectedBuffer.GetLength(j),
+						u8"tests[%zu-%zu] - 토큰의 범위가 틀렸습니다. 예상값=(%zu, %zu), 실제값=(%zu, %zu)", i, j,
+						static_cast<size_t>(expectedBuffer.GetOffset(j)), static_cast<size_t>(expectedBuffer.GetLength(j)),
+						static_cast<size_t>(tokenBuffer.GetOffset(j)), static_cast<size_t>(tokenBuffer.GetLength(j)));
+
+					FATAL_ASSERT(tokenBuffer.GetLine(j) == expectedBuffer.GetLine(j) && tokenBuffer.GetIndex(j) == expectedBuffer.GetIndex(j),
+						u8"tests[%zu-%zu] - 토큰의 줄 번호와 인덱스가 틀렸습니다. 예상값=(%zu, %zu), 실제값=(%zu, %zu)", i, j,
+						expectedBuffer.GetLine(j), expectedBuffer.GetIndex(j), tokenBuffer.GetLine(j), tokenBuffer.GetIndex(j));
+				}
+			}
+
+			// 한 글자씩 입력하는 편집을 연속으로 적용하여도 처음부터 렉싱한 결과와 같아야 합니다.
+			{
+				// 문자열과 블록 주석은 입력하는 동안 끝나지 않은 상태가 됩니다.
+#if defined(MCF_RELEASE_ONLY_TEST)
+				const std::string typedText = "let typed: int32 = \"a\" + 12; /* b */ // c\n";
+#else
+				const std::string typedText = "let typed: int32 = a + 12; // c\n";
+#endif
+				mcf::Lexer::TokenBuffer tokenBuffer;
+				mcf::Lexer::Error error = mcf::Lexer::TokenizeAll("./test/unittest/texts/simple_game_project.mcf", true, tokenBuffer);
+				FATAL_ASSERT(error == mcf::Lexer::Error::SUCCESS, u8"typing - TokenizeAll 이 실패하였습니다.");
+
+				constexpr const size_t EDIT_OFFSET = 400;
+				for (size_t i = 0; i < typedText.length(); i++)
+				{
+					error = tokenBuffer.ApplyEdit(mcf::Lexer::Edit{ EDIT_OFFSET + i, 0, std::string_view(typedText).substr(i, 1) }, nullptr);
+					FATAL_ASSERT(error == mcf::Lexer::Error::SUCCESS, u8"typing[%zu] - ApplyEdit 이 실패하였습니다.", i);
+
+					mcf::Lexer::TokenBuffer expectedBuffer;
+					mcf::Lexer::TokenizeAll(std::string(tokenBuffer.GetSource()->GetView()), false, expectedBuffer);
+					const size_t tokenCount = tokenBuffer.GetCount();
+					FATAL_ASSERT(tokenCount == expectedBuffer.GetCount(), u8"typing[%zu] - 토큰의 갯수가 틀렸습니다. 예상값=%zu, 실제값=%zu", i, expectedBuffer.GetCount(), tokenCount);
+					for (size_t j = 0; j < tokenCount; j++)
+					{
+						FATAL_ASSERT(tokenBuffer.GetType(j) == expectedBuffer.GetType(j) && tokenBuffer.GetOffset(j) == expectedBuffer.GetOffset(j) && tokenBuffer.GetLength(j) == expectedBuffer.GetLength(j)
+							&& tokenBuffer.GetLine(j) == expectedBuffer.GetLine(j), u8"typing[%zu-%zu] - 토큰이 틀렸습니다. 예상값=%s, 실제값=%s",
+							i, j, std::string(expectedBuffer.GetLiteral(j)).c_str(), std::string(tokenBuffer.GetLiteral(j)).c_str());
+					}
+				}
+			}
+
+			// 잘못된 편집은 버퍼를 바꾸지 않습니다.
+			{
+				mcf::Lexer::TokenBuffer tokenBuffer;
+				mcf::Lexer::TokenizeAll("let a = 1;", false, tokenBuffer);
+				const size_t tokenCount = tokenBuffer.GetCount();
+				FATAL_ASSERT(tokenBuffer.ApplyEdit(mcf::Lexer::Edit{ 5, 100, "" }, nullptr) == mcf::Lexer::Error::INVALID_EDIT_RANGE, u8"범위를 벗어난 편집은 실패하여야 합니다.");
+				FATAL_ASSERT(tokenBuffer.ApplyEdit(mcf::Lexer::Edit{ 0, 10, "" }, nullptr) == mcf::Lexer::Error::INVALID_INPUT_LENGTH, u8"입력을 모두 지우는 편집은 실패하여야 합니다.");
+				FATAL_ASSERT(tokenBuffer.GetCount() == tokenCount && tokenBuffer.GetSource()->GetView() == "let a = 1;", u8"실패한 편집이 버퍼를 바꾸었습니다.");
+			}
+
+			return true;
+			});
+
+		_names.emplace_back(u8"심볼 테이블(식별자 인터닝) 테스트");
+		_tests.emplace_back([&]() {
+			mcf::Symbol::Table symbols;
+			const mcf::Symbol::ID first = symbols.Intern("value");
+			const mcf::Symbol::ID second = symbols.Intern(std::string("other"));
+			FATAL_ASSERT(first != mcf::Symbol::INVALID_ID && second != mcf::Symbol::INVALID_ID && first != second, u8"서로 다른 이름은 서로 다른 유효한 ID 를 받아야 합니다.");
+			FATAL_ASSERT(symbols.Intern(std::string("val") + "ue") == first, u8"같은 이름은 같은 ID 를 받아야 합니다.");
+			FATAL_ASSERT(symbols.Find("other") == second && symbols.Find("missing") == mcf::Symbol::INVALID_ID, u8"Find 의 결과가 틀렸습니다.");
+			FATAL_ASSERT(symbols.GetName(first) == "value" && symbols.GetCount() == 2, u8"GetName 또는 GetCount 의 결과가 틀렸습니다.");
+
+			// 렉서는 IDENTIFIER 토큰에만 심볼을 지정하며 같은 식별자는 같은 심볼을 받습니다.
+			const std::string input = "let value: dword = other + value;\nfunc other() -> void {}";
+			mcf::Lexer::Object lexer(input, false);
+			lexer.SetSymbolTable(&symbols);
+			mcf::Lexer::TokenBuffer tokenBuffer;
+			lexer.TokenizeAll(tokenBuffer);
+			const size_t tokenCount = tokenBuffer.GetCount();
+			for (size_t i = 0; i < tokenCount; i++)
+			{
+				const mcf::Token::Data token = tokenBuffer.GetToken(i);
+				if (token.Type != mcf::Token::Type::IDENTIFIER)
+				{
+					FATAL_ASSERT(token.Symbol == mcf::Symbol::INVALID_ID, u8"tests[%zu] - IDENTIFIER 가 아닌 토큰은 심볼이 없어야 합니다. 토큰=%s", i, std::string(token.Literal).c_str());
+					continue;
+				}
+				FATAL_ASSERT(token.Symbol == symbols.Find(token.Literal) && symbols.GetName(token.Symbol) == token.Literal,
+					u8"tests[%zu] - 토큰의 심볼이 틀렸습니다. 토큰=%s", i, std::string(token.Literal).c_str());
+			}
+			FATAL_ASSERT(symbols.GetCount() == 3, u8"새로 등록된 식별자는 dword 하나여야 합니다. 실제값=%zu", symbols.GetCount());
+
+			// 증분 렉싱으로 다시 읽은 식별자도 같은 테이블에 등록됩니다.
+			FATAL_ASSERT(tokenBuffer.ApplyEdit(mcf::Lexer::Edit{ 19, 5, "renamed" }, nullptr) == mcf::Lexer::Error::SUCCESS, u8"ApplyEdit 이 실패하였습니다.");
+			const mcf::Symbol::ID renamed = symbols.Find("renamed");
+			FATAL_ASSERT(renamed != mcf::Symbol::INVALID_ID && tokenBuffer.GetSymbol(5) == renamed, u8"다시 렉싱한 식별자의 심볼이 틀렸습니다. 토큰=%s", std::string(tokenBuffer.GetLiteral(5)).c_str());
+			return true;
+			});
+
+		_names.emplace_back(u8"스트림 렉서(StreamObject) 테스트");
+		_tests.emplace_back([&]() {
+			struct TestCase
+			{
+				const std::string Input;
+				const bool IsFile;
+			};
+			const TestCase testCases[] =
+			{
+				{ "./test/unittest/texts/test_file_read.txt", true },
+				{ "./test/unittest/texts/simple_game_project.mcf", true },
+				{ "./test/unittest/texts/enum_header.hmcf", true },
+				{ "let a = \"// not comment\";\nlet b = \"/* not block\";\nlet c = 1;\n", false },
+				{ "/* 여러 줄\n 블록 주석\n */ let a = 1;\n// 한줄 주석 /* 블록 아님\nlet b = 2; /* \"\n\" */\nlet c = 3;\n", false },
+				{ "let c = \"\";\r\nlet d = 4;\r\n/*/ still comment\n**/ let e = 5;\n", false },
+				{ "let a: byte[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 }; let b = a / 2; let c = \"a b c\"; // end", false },
+				// 나눌 위치가 없는 긴 블록 주석과 식별자는 조금씩 읽더라도 같은 입력을 반복해서 검사하지 않아야 합니다.
+				{ "let a = 1;\n/*" + std::string(64 * 1024, 'x') + "*/\nlet " + std::string(64 * 1024, 'b') + " = 2;\n", false },
+				// 채운 입력에서 '\0' 을 만나면 그 뒤의 끝나지 않은 문자열과 주석은 읽지 않고 스트림을 끝냅니다.
+				{ std::string("let a = 1;\nlet b = 2;\n") + '\0' + "let c = \"/* unterminated\n", false },
+#if defined(MCF_RELEASE_ONLY_TEST)
+				{ "let a = \"\n\";\nlet b = \"unterminated\nlet c = \"\";\r\nlet d = 4;\r\n/*/ still comment\n**/ let e = 5;\n", false },
+				{ "let a = 1;\n/* unterminated\nlet b = 2;\nlet c = 3;\n", false },
+#endif
+			};
+			const size_t testCaseCount = MCF_ARRAY_SIZE(testCases);
+			// 한번에 읽을 수 있는 최대 바이트 수입니다. 작을수록 토큰이 읽기 경계에 걸치는 경우가 많아집니다.
+			const size_t readSizes[] = { 1, 3, 16, 4096 };
+			const size_t readSizeCount = MCF_ARRAY_SIZE(readSizes);
+
+			for (size_t i = 0; i < testCaseCount; i++)
+			{
+				const mcf::Lexer::Source source = testCases[i].IsFile ? mcf::Lexer::SourceBuffer::MakeFromFile(testCases[i].Input) : mcf::Lexer::SourceBuffer::MakeFromString(testCases[i].Input);
+				FATAL_ASSERT(source != nullptr, u8"tests[%zu] - 입력을 읽지 못했습니다.", i);
+				// 파일의 BOM 은 스트림 렉서가 직접 건너뛰어야 하므로 BOM 을 붙여 넘깁니다.
+				const std::string input = testCases[i].IsFile ? std::string("\xEF\xBB\xBF") + std::string(source->GetView()) : testCases[i].Input;
+
+				for (size_t j = 0; j < readSizeCount; j++)
+				{
+					size_t readPosition = 0;
+					const mcf::Lexer::StreamReader reader = [&](char* const buffer, const size_t size) -> size_t
+					{
+						const size_t readSize = std::min({ size, readSizes[j], input.length() - readPosition });
+						memcpy(buffer, input.data() + readPosition, readSize);
+						readPosition += readSize;
+						return readSize;
+					};
+					mcf::Lexer::StreamObject streamLexer(testCases[i].Input, reader, readSizes[j]);
+					mcf::Lexer::Object lexer(testCases[i].Input, testCases[i].IsFile);
+
+					for (size_t k = 0; ; k++)
+					{
+						const mcf::Token::Data expected = lexer.ReadNextToken();
+						const mcf::Token::Data actual = streamLexer.ReadNextToken();
+						FATAL_ASSERT(actual.Type == expected.Type, u8"tests[%zu-%zu-%zu] - 토큰 타입이 틀렸습니다. 예상값=%s, 실제값=%s",
+							i, j, k, mcf::Token::CONVERT_TYPE_TO_STRING(expected.Type), mcf::Token::CONVERT_TYPE_TO_STRING(actual.Type));
+
+						FATAL_ASSERT(actual.Literal == expected.Literal, u8"tests[%zu-%zu-%zu] - 토큰 리터럴이 틀렸습니다. 예상값=%s, 실제값=%s",
+							i, j, k, std::string(expected.Literal).c_str(), std::string(actual.Literal).c_str());
+
+						FATAL_ASSERT(actual.Offset == expected.Offset, u8"tests[%zu-%zu-%zu] - 토큰의 위치가 틀렸습니다. 예상값=%u, 실제값=%u", i, j, k, expected.Offset, actual.Offset);
+
+						const size_t expectedLine = lexer.GetSource()->GetLine(expected.Offset);
+						const size_t expectedIndex = lexer.GetSource()->GetIndex(expected.Offset);
+						FATAL_ASSERT(streamLexer.GetLine(actual.Offset) == expectedLine && streamLexer.GetIndex(actual.Offset) == expectedIndex,
+							u8"tests[%zu-%zu-%zu] - 줄 번호와 인덱스가 틀렸습니다. 예상값=(%zu, %zu), 실제값=(%zu, %zu)",
+							i, j, k, expectedLine, expectedIndex, streamLexer.GetLine(actual.Offset), streamLexer.GetIndex(actual.Offset));
+
+						if (expected.Type == mcf::Token::Type::END_OF_FILE)
+						{
+							break;
+						}
+					}
+					FATAL_ASSERT(streamLexer.GetLastErrorToken() == mcf::Lexer::Error::SUCCESS, u8"tests[%zu-%zu] - 스트림 렉서에 에러가 있으면 안됩니다.", i, j);
+				}
+			}
+
+			// 렉서가 보관하는 입력은 파일 크기가 아니라 한번에 읽는 크기와 가장 긴 토큰에 비례하여야 합니다.
+			{
+				std::string input;
+				for (size_t i = 0; i < 2048; i++)
+				{
+					input += "func Generated" + std::to_string(i) + "(value: dword) -> dword { return value; } /* 블록\n주석 */ let s = \"문자열\";\n";
+				}
+				mcf::Lexer::TokenBuffer tokenBuffer;
+				mcf::Lexer::TokenizeAll(input, false, tokenBuffer);
+
+				std::istringstream stream(input);
+				constexpr const size_t CHUNK_SIZE = 256;
+				mcf::Lexer::StreamObject streamLexer("stream", mcf::Lexer::MakeStreamReader(stream), CHUNK_SIZE);
+				size_t tokenCount = 0;
+				size_t maxBufferedSize = 0;
+				for (mcf::Token::Data token = streamLexer.ReadNextToken(); token.Type != mcf::Token::Type::END_OF_FILE; token = streamLexer.ReadNextToken())
+				{
+					maxBufferedSize = std::max(maxBufferedSize, streamLexer.GetBufferedSize());
+					// 지나간 세그먼트의 줄바꿈을 버려도 줄 번호와 인덱스는 입력 전체를 렉싱한 결과와 같아야 합니다.
+					FATAL_ASSERT(tokenCount < tokenBuffer.GetCount() && streamLexer.GetLine(token.Offset) == tokenBuffer.GetLine(tokenCount) && streamLexer.GetIndex(token.Offset) == tokenBuffer.GetIndex(tokenCount),
+						u8"[%zu] - 줄 번호와 인덱스가 틀렸습니다. 예상값=(%zu, %zu), 실제값=(%zu, %zu)", tokenCount,
+						tokenBuffer.GetLine(tokenCount), tokenBuffer.GetIndex(tokenCount), streamLexer.GetLine(token.Offset), streamLexer.GetIndex(token.Offset));
+					++tokenCount;
+				}
+
+				FATAL_ASSERT(tokenCount + 1 == tokenBuffer.GetCount(), u8"토큰의 갯수가 틀렸습니다. 예상값=%zu, 실제값=%zu", tokenBuffer.GetCount(), tokenCount + 1);
+				FATAL_ASSERT(maxBufferedSize <= CHUNK_SIZE * 4, u8"보관하는 입력이 너무 큽니다. 입력 크기=%zu, 최대 보관 크기=%zu", input.length(), maxBufferedSize);
+			}
+
+			// 빈 입력은 Object 와 같이 INVALID_INPUT_LENGTH 로 처리합니다.
+			{
+				mcf::Lexer::StreamObject streamLexer("empty", [](char* const, const size_t) -> size_t { return 0; });
+				FATAL_ASSERT(streamLexer.ReadNextToken().Type == mcf::Token::Type::END_OF_FILE, u8"빈 입력은 END_OF_FILE 을 반환하여야 합니다.");
+				FATAL_ASSERT(streamLexer.GetLastErrorToken() == mcf::Lexer::Error::INVALID_INPUT_LENGTH, u8"빈 입력은 INVALID_INPUT_LENGTH 에러가 있어야 합니다.");
+			}
+
+			// 입력을 채우는 중에 읽기에 실패하면 그때까지 읽은 입력만 렉싱하고 FAIL_READ_FILE 에러를 남깁니다. 읽지 못한 끝나지 않은 문자열은 렉싱하지 않습니다.
+			{
+				const std::string input = "let a = 1;\nlet b = 2;\nlet c = \"unterminated";
+				constexpr const size_t READ_SIZE = 3;
+				const size_t failedPosition = input.find("let c");
+				size_t readPosition = 0;
+				const mcf::Lexer::StreamReader reader = [&](char* const buffer, const size_t size) -> size_t
+				{
+					if (readPosition == failedPosition)
+					{
+						return mcf::Lexer::STREAM_READ_ERROR;
+					}
+					const size_t readSize = std::min({ size, READ_SIZE, failedPosition - readPosition });
+					memcpy(buffer, input.data() + readPosition, readSize);
+					readPosition += readSize;
+					return readSize;
+				};
+				mcf::Lexer::StreamObject streamLexer("read error", reader, READ_SIZE);
+				mcf::Lexer::Object lexer(input.substr(0, failedPosition), false);
+				for (size_t k = 0; ; k++)
+				{
+					const mcf::Token::Data expected = lexer.ReadNextToken();
+					const mcf::Token::Data actual = streamLexer.ReadNextToken();
+					FATAL_ASSERT(actual.Type == expected.Type && actual.Literal == expected.Literal && actual.Offset == expected.Offset, u8"read error[%zu] - 토큰이 틀렸습니다. 예상값=%s(%s, %u), 실제값=%s(%s, %u)", k,
+						mcf::Token::CONVERT_TYPE_TO_STRING(expected.Type), std::string(expected.Literal).c_str(), expected.Offset,
+						mcf::Token::CONVERT_TYPE_TO_STRING(actual.Type), std::string(actual.Literal).c_str(), actual.Offset);
+					if (expected.Type == mcf::Token::Type::END_OF_FILE)
+					{
+						break;
+					}
+				}
+				FATAL_ASSERT(streamLexer.GetLastErrorToken() == mcf::Lexer::Error::FAIL_READ_FILE, u8"읽기에 실패하면 FAIL_READ_FILE 에러가 있어야 합니다.");
+			}
+
+			return true;
+			});
+
+		_names.emplace_back(u8"주석 건너뛰기(SetCommentSkipping) 테스트");
+		_tests.emplace_back([&]() {
+			const std::string testCases[] =
+			{
+				"./test/unittest/texts/simple_game_project.mcf",
+				"./test/unittest/texts/enum_header.hmcf",
+				"// 한줄\n/* 블록\n 주석 */let a = 1; // 끝\n/**/ /* 연속 */ // 주석\nlet b = a / 2; /* 중간 */ let c = \"// 문자열\";",
+				// '\0' 뒤의 끝나지 않은 주석은 읽지 않으므로 건너뛴 주석의 범위에도 들어가지 않습니다.
+				std::string("let a = 1; /* 주석 */ // 끝\n") + '\0' + "/* 끝나지 않은 주석\nlet b = 2;",
+#if defined(MCF_RELEASE_ONLY_TEST)
+				"let a = 1;\n/* 끝나지 않은 주석\nlet b = 2;",
+#endif
+			};
+			const size_t testCaseCount = MCF_ARRAY_SIZE(testCases);
+			for (size_t i = 0; i < testCaseCount; i++)
+			{
+				const bool isFile = (testCases[i].rfind("./", 0) == 0);
+				mcf::Lexer::Object lexer(testCases[i], isFile);
+				mcf::Lexer::Object skippingLexer(testCases[i], isFile);
+				std::vector<mcf::Lexer::CommentRange> commentRanges;
+				skippingLexer.SetCommentSkipping(true, &commentRanges);
+
+				// 주석 토큰을 제외한 토큰은 위치까지 같아야 하고, 주석 토큰은 범위로만 기록되어야 합니다.
+				const char* const sourceBegin = skippingLexer.GetSource()->GetView().data();
+				size_t commentCount = 0;
+				for (size_t j = 0; ; j++)
+				{
+					mcf::Token::Data expected = lexer.ReadNextToken();
+					while (expected.Type == mcf::Token::Type::COMMENT || expected.Type == mcf::Token::Type::COMMENT_BLOCK)
+					{
+						++commentCount;
+						expected = lexer.ReadNextToken();
+					}
+
+					const size_t previousCommentCount = commentRanges.size();
+					const mcf::Token::Data actual = skippingLexer.ReadNextToken();
+					FATAL_ASSERT(actual.Type == expected.Type && actual.Literal == expected.Literal && actual.Offset == expected.Offset,
+						u8"tests[%zu-%zu] - 토큰이 틀렸습니다. 예상값=%s(%s, %u), 실제값=%s(%s, %u)", i, j,
+						mcf::Token::CONVERT_TYPE_TO_STRING(expected.Type), std::string(expected.Literal).c_str(), expected.Offset,
+						mcf::Token::CONVERT_TYPE_TO_STRING(actual.Type), std::string(actual.Literal).c_str(), actual.Offset);
+					FATAL_ASSERT(commentRanges.size() == commentCount, u8"tests[%zu-%zu] - 주석 범위의 갯수가 틀렸습니다. 예상값=%zu, 실제값=%zu", i, j, commentCount, commentRanges.size());
+					for (size_t k = previousCommentCount; k < commentRanges.size(); k++)
+					{
+						const std::string_view comment(sourceBegin + commentRanges[k].Offset, commentRanges[k].Length);
+						FATAL_ASSERT(comment.rfind("//", 0) == 0 || (comment.rfind("/*", 0) == 0 && comment.length() >= 4 && comment.substr(comment.length() - 2) == "*/"),
+							u8"tests[%zu-%zu-%zu] - 주석 범위가 주석을 가리키지 않습니다. 범위=%s", i, j, k, std::string(comment).c_str());
+					}
+
+					if (expected.Type == mcf::Token::Type::END_OF_FILE)
+					{
+						break;
+					}
+				}
+			}
+
+			// 파서가 만드는 토큰 버퍼에는 주석 토큰이 없어야 하며 ApplyEdit 후에도 마찬가지입니다.
+			mcf::Lexer::Object lexer("let a = 1; // 주석\nlet b = 2;", false);
+			lexer.SetCommentSkipping(true, nullptr);
+			mcf::Lexer::TokenBuffer tokenBuffer;
+			lexer.TokenizeAll(tokenBuffer);
+			FATAL_ASSERT(tokenBuffer.ApplyEdit(mcf::Lexer::Edit{ 10, 0, " /* 추가된 주석 */" }, nullptr) == mcf::Lexer::Error::SUCCESS, u8"ApplyEdit 이 실패하였습니다.");
+			for (size_t i = 0; i < tokenBuffer.GetCount(); i++)
+			{
+				FATAL_ASSERT(tokenBuffer.GetType(i) != mcf::Token::Type::COMMENT && tokenBuffer.GetType(i) != mcf::Token::Type::COMMENT_BLOCK, u8"tests[%zu] - 주석 토큰이 있으면 안됩니다.", i);
+			}
+			FATAL_ASSERT(tokenBuffer.GetCount() == 11, u8"토큰의 갯수가 틀렸습니다. 예상값=11, 실제값=%zu", tokenBuffer.GetCount());
+			return true;
+			});
+
+		_names.emplace_back(u8"줄 번호 계산(SourceBuffer::GetLine) 테스트");
+		_tests.emplace_back([&]() {
+			const std::string inputs[] =
+			{
+				"a",
+				"\n",
+				"\n\n\n",
+				"let a: int32 = 1;\r\nlet b: int32 = 2;\r\n",
+				std::string(100, ' ') + "\n" + std::string(31, 'x') + "\n\n" + std::string(64, '\n') + "func main() -> void\n{\n}",
+			};
+			const size_t inputCount = MCF_ARRAY_SIZE(inputs);
+
+			// 스캐너마다 SIMD 청크의 경계가 다르므로 지원하는 모든 스캐너로 비교합니다.
+			const mcf::Lexer::Scanner detectedScanner = mcf::Lexer::GetScanner();
+			for (size_t scannerIndex = mcf::ENUM_INDEX(mcf::Lexer::Scanner::SCALAR); scannerIndex < mcf::ENUM_COUNT<mcf::Lexer::Scanner>(); scannerIndex++)
+			{
+				if (mcf::Lexer::SetScanner(mcf::ENUM_AT<mcf::Lexer::Scanner>(scannerIndex)) == false)
+				{
+					continue;
+				}
+
+				for (size_t i = 0; i < inputCount; i++)
+				{
+					const mcf::Lexer::Source source = mcf::Lexer::SourceBuffer::MakeFromString(inputs[i]);
+					size_t expectedLine = 1;
+					size_t expectedIndex = 0;
+					for (size_t offset = 0; offset <= inputs[i].length(); offset++)
+					{
+						const size_t actualLine = source->GetLine(static_cast<std::uint32_t>(offset));
+						const size_t actualIndex = source->GetIndex(static_cast<std::uint32_t>(offset));
+						FATAL_ASSERT(actualLine == expectedLine && actualIndex == expectedIndex, u8"tests[%zu-%zu-%zu] - 줄 번호와 인덱스가 틀렸습니다. 예상값=(%zu, %zu), 실제값=(%zu, %zu)",
+							scannerIndex, i, offset, expectedLine, expectedIndex, actualLine, actualIndex);
+
+						// 줄바꿈 다음 바이트의 인덱스는 1 입니다.
+						const bool isNewLine = offset < inputs[i].length() && inputs[i][offset] == '\n';
+						expectedLine += isNewLine ? 1 : 0;
+						expectedIndex = isNewLine ? 1 : expectedIndex + 1;
+					}
+				}
+			}
+			mcf::Lexer::SetScanner(detectedScanner);
+			return true;
+			});
 	}
 }
\ No newline at end of file
@@ -544,6 +544,329 @@ UnitTest::ParserTest::ParserTest(void) noexcept
 			return true;
 		}
 	);
+
+	_names.emplace_back(u8"AST 아레나 할당 테스트");
+	_tests.emplace_back
+	(
+		[&]() -> bool
+		{
+			mcf::AST::Arena arena;
+			FATAL_ASSERT(arena.GetBlockCount() == 0 && arena.GetAllocatedBytes() == 0, u8"빈 아레나는 블록을 가지고 있으면 안됩니다.");
+			for (size_t alignment = 1; alignment <= 64; alignment <<= 1)
+			{
+				const void* const memory = arena.Allocate(3, alignment);
+				FATAL_ASSERT((reinterpret_cast<size_t>(memory) & (alignment - 1)) == 0, u8"아레나가 반환한 메모리가 정렬되지 않았습니다. alignment=%zu", alignment);
+			}
+			// 블록보다 큰 요청은 전용 블록을 만들어야 합니다.
+			const size_t blockCount = arena.GetBlockCount();
+			arena.Allocate(mcf::AST::Arena::BLOCK_SIZE * 2, 8);
+			FATAL_ASSERT(arena.GetBlockCount() == blockCount + 1, u8"큰 요청에 대한 블록 갯수가 예상과 다릅니다. expected=%zu, actual=%zu", blockCount + 1, arena.GetBlockCount());
+
+			const std::vector<int> values = { 1, 2, 3, 4 };
+			const mcf::AST::NodeArray<int> copied = arena.MakeArray(values);
+			FATAL_ASSERT(copied.GetSize() == values.size(), u8"아레나에 복사된 배열의 크기가 다릅니다.");
+			for (size_t i = 0; i < values.size(); ++i)
+			{
+				FATAL_ASSERT(copied[i] == values[i], u8"아레나에 복사된 배열의 값이 다릅니다. index=%zu", i);
+			}
+
+			// 파서가 소멸되어도 프로그램이 아레나를 소유하므로 노드는 유효해야 합니다.
+			mcf::AST::Program program;
+			FATAL_ASSERT(program.GetArena() == nullptr, u8"기본 생성된 프로그램은 아레나를 가지고 있으면 안됩니다.");
+			{
+				mcf::Parser::Object parser("let foo: int32 = 5 + 3; func bar(value: dword) -> dword { return value; }", false);
+				parser.ParseProgram(program);
+				FATAL_ASSERT(CheckParserErrors(parser), u8"파싱에 실패 하였습니다.");
+			}
+			FATAL_ASSERT(program.GetArena() != nullptr && program.GetArena()->GetAllocatedBytes() != 0, u8"프로그램이 노드를 할당한 아레나를 소유하지 않습니다.");
+
+			const std::string expected =
+				"[Let: <VariableSignature: <Identifier: foo> COLON <TypeSignature: <Identifier: int32>>> ASSIGN <Infix: <Integer: 5> PLUS <Integer: 3>> SEMICOLON]\n"
+				"[Func: <FunctionSignature: <Identifier: bar> <FunctionParams: LPAREN <VariableSignature: <Identifier: value> COLON <TypeSignature: <Identifier: dword>>> COMMA RPAREN> POINTING <TypeSignature: <Identifier: dword>>> "
+				"[Block: LBRACE [Return: <Identifier: value> SEMICOLON] RBRACE]]";
+			const mcf::AST::Program moved = std::move(program);
+			const std::string actual = moved.ConvertToString();
+			FATAL_ASSERT(actual == expected, u8"이동된 프로그램의 결과가 다릅니다.\nExpected:\n%s\nActual:\n%s", expected.c_str(), actual.c_str());
+			return true;
+		}
+	);
+
+	_names.emplace_back(u8"최상위 문장 병렬 파싱 테스트");
+	_tests.emplace_back
+	(
+		[&]() -> bool
+		{
+			// 청크 크기를 1 토큰으로 두어 모든 최상위 문장이 각각 다른 청크에서 파싱되도록 합니다.
+			const std::string files[] =
+			{
+				"./test/unittest/texts/test_file_read.txt",
+				"./test/unittest/texts/simple_game_project.mcf",
+			};
+			for (const std::string& file : files)
+			{
+				mcf::Parser::Object sequentialParser(file, true);
+				mcf::AST::Program sequentialProgram;
+				sequentialParser.ParseProgram(sequentialProgram);
+				FATAL_ASSERT(CheckParserErrors(sequentialParser), u8"파싱에 실패 하였습니다. FileName: %s", file.c_str());
+
+				mcf::Parser::Object parallelParser(file, true);
+				mcf::AST::Program parallelProgram;
+				parallelParser.ParseProgramParallel(parallelProgram, 4, 1);
+				FATAL_ASSERT(CheckParserErrors(parallelParser), u8"병렬 파싱에 실패 하였습니다. FileName: %s", file.c_str());
+
+				FATAL_ASSERT(parallelProgram.GetStatementCount() == sequentialProgram.GetStatementCount(), u8"최상위 문장의 갯수가 다릅니다. FileName: %s", file.c_str());
+				const std::string expected = sequentialProgram.ConvertToString();
+				const std::string actual = parallelProgram.ConvertToString();
+				FATAL_ASSERT(actual == expected, u8"병렬 파싱 결과가 순차 파싱 결과와 다릅니다. FileName: %s\nExpected:\n%s\nActual:\n%s", file.c_str(), expected.c_str(), actual.c_str());
+			}
+
+			// 에러가 있으면 순차 파싱과 같은 에러를 남겨야 합니다.
+			const std::string invalidInput = "let foo: int32 = 1; let bar: int32 = ; func boo(void) -> void { return; }";
+			mcf::Parser::Object sequentialParser(invalidInput, false);
+			mcf::AST::Program sequentialProgram;
+			sequentialParser.ParseProgram(sequentialProgram);
+
+			mcf::Parser::Object parallelParser(invalidInput, false);
+			mcf::AST::Program parallelProgram;
+			parallelParser.ParseProgramParallel(parallelProgram, 4, 1);
+			FATAL_ASSERT(sequentialParser.GetErrorCount() != 0 && parallelParser.GetErrorCount() == sequentialParser.GetErrorCount(), u8"에러의 갯수가 다릅니다. expected=%zu, actual=%zu", sequentialParser.GetErrorCount(), parallelParser.GetErrorCount());
+			for (mcf::Parser::ErrorInfo expectedError = sequentialParser.PopLastError(); expectedError.ID != mcf::Parser::ErrorID::SUCCESS; expectedError = sequentialParser.PopLastError())
+			{
+				const mcf::Parser::ErrorInfo actualError = parallelParser.PopLastError();
+				FATAL_ASSERT(actualError.ID == expectedError.ID && actualError.Offset == expectedError.Offset, u8"에러가 다릅니다. expected=%zu(%u), actual=%zu(%u)",
+					mcf::ENUM_INDEX(expectedError.ID), expectedError.Offset, mcf::ENUM_INDEX(actualError.ID), actualError.Offset);
+			}
+			return true;
+		}
+	);
+
+	_names.emplace_back(u8"파서 세션 증분 파싱 테스트");
+	_tests.emplace_back
+	(
+		[&]() -> bool
+		{
+			const std::string original = mcf::Lexer::ReadFile("./test/unittest/texts/test_file_read.txt");
+			const std::string changedStatement = "let intVal: int32 = 10;";
+			const size_t changedPosition = original.find(changedStatement);
+			FATAL_ASSERT(changedPosition != std::string::npos, u8"수정할 문장을 찾을 수 없습니다.");
+
+			// 한 문장의 값을 같은 길이로 바꾸고 맨 뒤에 문장을 추가하여, 나머지 문장들의 위치는 그대로 둡니다.
+			std::string edited = original;
+			edited.replace(changedPosition, changedStatement.size(), "let intVal: int32 = 11;");
+			edited += "\nlet added: byte = 0;\n";
+
+			std::unique_ptr<mcf::Parser::Session> sessionPointer = std::make_unique<mcf::Parser::Session>();
+			mcf::Parser::Session& session = *sessionPointer;
+			mcf::AST::Program originalProgram;
+			session.Parse(original, false, originalProgram);
+			FATAL_ASSERT(session.GetErrorCount() == 0, u8"세션 파싱에 실패 하였습니다.");
+			const size_t statementCount = originalProgram.GetStatementCount();
+			FATAL_ASSERT(session.GetReusedStatementCount() == 0 && session.GetReparsedStatementCount() == statementCount, u8"처음 파싱은 모든 문장을 파싱해야 합니다. reused=%zu, reparsed=%zu",
+				session.GetReusedStatementCount(), session.GetReparsedStatementCount());
+			const std::string originalExpected = originalProgram.ConvertToString();
+
+			mcf::AST::Program program;
+			session.Parse(edited, false, program);
+			FATAL_ASSERT(session.GetErrorCount() == 0, u8"세션 파싱에 실패 하였습니다.");
+			FATAL_ASSERT(program.GetStatementCount() == statementCount + 1, u8"최상위 문장의 갯수가 틀렸습니다. 실제값[%zu] 예상값[%zu]", program.GetStatementCount(), statementCount + 1);
+			FATAL_ASSERT(session.GetReusedStatementCount() == statementCount - 1 && session.GetReparsedStatementCount() == 2, u8"수정된 문장만 파싱해야 합니다. reused=%zu, reparsed=%zu",
+				session.GetReusedStatementCount(), session.GetReparsedStatementCount());
+
+			mcf::Parser::Object parser(edited, false);
+			mcf::AST::Program expectedProgram;
+			parser.ParseProgram(expectedProgram);
+			FATAL_ASSERT(CheckParserErrors(parser), u8"파싱에 실패 하였습니다.");
+			const std::string expected = expectedProgram.ConvertToString();
+			const std::string actual = program.ConvertToString();
+			FATAL_ASSERT(actual == expected, u8"세션 파싱 결과가 다릅니다.\nExpected:\n%s\nActual:\n%s", expected.c_str(), actual.c_str());
+
+			// 맨 앞에 문장을 추가하면 뒤의 문장들은 위치만 바뀌었으므로 다시 파싱하지 않고 재사용하며, 토큰의 Offset 과 문자열은 새 입력 기준이어야 합니다.
+			const std::string shifted = "let first: byte = 0;\n" + edited;
+			mcf::AST::Program shiftedProgram;
+			session.Parse(shifted, false, shiftedProgram);
+			FATAL_ASSERT(session.GetErrorCount() == 0, u8"세션 파싱에 실패 하였습니다.");
+			FATAL_ASSERT(session.GetReusedStatementCount() == statementCount + 1 && session.GetReparsedStatementCount() == 1, u8"위치만 바뀐 문장은 재사용해야 합니다. reused=%zu, reparsed=%zu",
+				session.GetReusedStatementCount(), session.GetReparsedStatementCount());
+			mcf::Parser::Object shiftedParser(shifted, false);
+			mcf::AST::Program shiftedExpectedProgram;
+			shiftedParser.ParseProgram(shiftedExpectedProgram);
+			FATAL_ASSERT(CheckParserErrors(shiftedParser), u8"파싱에 실패 하였습니다.");
+			FATAL_ASSERT(shiftedProgram.ConvertToString() == shiftedExpectedProgram.ConvertToString(), u8"세션 파싱 결과가 다릅니다.\nExpected:\n%s\nActual:\n%s",
+				shiftedExpectedProgram.ConvertToString().c_str(), shiftedProgram.ConvertToString().c_str());
+			// 직렬화는 모든 토큰의 문자열이 새 소스 버퍼의 Offset 위치를 가리킬 때만 성공합니다.
+			std::string shiftedBinary;
+			FATAL_ASSERT(mcf::AST::Flat::Program(shiftedProgram).Serialize(shiftedBinary, 0), u8"재사용한 문장의 토큰이 새 입력을 가리키지 않습니다.");
+			const mcf::AST::Statement::Interface* lastStatement = shiftedProgram.GetUnsafeStatementPointerAt(statementCount + 1);
+			FATAL_ASSERT(lastStatement->GetStatementType() == mcf::AST::Statement::Type::LET, u8"마지막 문장은 let 이어야 합니다.");
+			const mcf::Token::Data& lastName = static_cast<const mcf::AST::Statement::Let*>(lastStatement)->GetUnsafeSignaturePointer()->GetUnsafeNamePointer()->GetToken();
+			FATAL_ASSERT(lastName.Offset == shifted.rfind("added") && lastName.Literal == "added", u8"토큰의 위치가 틀렸습니다. 실제값[%u] 예상값[%zu]", lastName.Offset, shifted.rfind("added"));
+
+			// 토큰의 해시가 같아도 소스 문자열이 다르면 재사용하지 않고 다시 파싱합니다.
+			std::string spaced = shifted;
+			spaced.replace(spaced.rfind("added: byte"), sizeof("added: byte") - 1, "added:  byte");
+			mcf::AST::Program spacedProgram;
+			session.Parse(spaced, false, spacedProgram);
+			FATAL_ASSERT(session.GetErrorCount() == 0, u8"세션 파싱에 실패 하였습니다.");
+			FATAL_ASSERT(session.GetReusedStatementCount() == statementCount + 1 && session.GetReparsedStatementCount() == 1, u8"소스 문자열이 바뀐 문장만 파싱해야 합니다. reused=%zu, reparsed=%zu",
+				session.GetReusedStatementCount(), session.GetReparsedStatementCount());
+			mcf::Parser::Object spacedParser(spaced, false);
+			mcf::AST::Program spacedExpectedProgram;
+			spacedParser.ParseProgram(spacedExpectedProgram);
+			FATAL_ASSERT(CheckParserErrors(spacedParser), u8"파싱에 실패 하였습니다.");
+			FATAL_ASSERT(spacedProgram.ConvertToString() == spacedExpectedProgram.ConvertToString(), u8"세션 파싱 결과가 다릅니다.\nExpected:\n%s\nActual:\n%s",
+				spacedExpectedProgram.ConvertToString().c_str(), spacedProgram.ConvertToString().c_str());
+			const mcf::AST::Statement::Let* spacedLet = static_cast<const mcf::AST::Statement::Let*>(spacedProgram.GetUnsafeStatementPointerAt(statementCount + 1));
+			const mcf::AST::Expression::Interface* spacedType = spacedLet->GetUnsafeSignaturePointer()->GetUnsafeTypeSignaturePointer()->GetUnsafeSignaturePointer();
+			FATAL_ASSERT(spacedType->GetExpressionType() == mcf::AST::Expression::Type::IDENTIFIER, u8"타입은 식별자여야 합니다.");
+			const mcf::Token::Data& spacedTypeToken = static_cast<const mcf::AST::Expression::Identifier*>(spacedType)->GetToken();
+			FATAL_ASSERT(spacedTypeToken.Offset == spaced.rfind("byte"), u8"토큰의 위치가 틀렸습니다. 실제값[%u] 예상값[%zu]", spacedTypeToken.Offset, spaced.rfind("byte"));
+
+			// 이전 Parse 로 만든 프로그램은 다음 Parse 이후에도, 세션이 소멸된 뒤에도 유효해야 합니다.
+			sessionPointer.reset();
+			FATAL_ASSERT(originalProgram.ConvertToString() == originalExpected, u8"이전에 만든 프로그램의 내용이 바뀌었습니다.");
+			FATAL_ASSERT(program.ConvertToString() == expected, u8"이전에 만든 프로그램의 내용이 바뀌었습니다.");
+
+			// 에러가 있으면 ParseProgram 과 같은 에러를 남기고 재사용, 재파싱 횟수는 0 이 됩니다. 캐시는 그대로 남아 다음 파싱에서 재사용됩니다.
+			mcf::Parser::Session errorSession;
+			errorSession.Parse(edited, false, program);
+			const std::string invalidInput = edited + "\nlet foo: int32 = ;";
+			mcf::Parser::Object invalidParser(invalidInput, false);
+			mcf::AST::Program invalidProgram;
+			invalidParser.ParseProgram(invalidProgram);
+			errorSession.Parse(invalidInput, false, invalidProgram);
+			FATAL_ASSERT(invalidParser.GetErrorCount() != 0 && errorSession.GetErrorCount() == invalidParser.GetErrorCount(), u8"에러의 갯수가 ParseProgram 과 다릅니다. 실제값[%zu] 예상값[%zu]",
+				errorSession.GetErrorCount(), invalidParser.GetErrorCount());
+			FATAL_ASSERT(errorSession.GetReusedStatementCount() == 0 && errorSession.GetReparsedStatementCount() == 0, u8"에러가 있으면 재사용, 재파싱 횟수는 0 이어야 합니다. reused=%zu, reparsed=%zu",
+				errorSession.GetReusedStatementCount(), errorSession.GetReparsedStatementCount());
+			for (mcf::Parser::ErrorInfo expectedError = invalidParser.PopLastError(); expectedError.ID != mcf::Parser::ErrorID::SUCCESS; expectedError = invalidParser.PopLastError())
+			{
+				const mcf::Parser::ErrorInfo actualError = errorSession.PopLastError();
+				FATAL_ASSERT(actualError.ID == expectedError.ID && actualError.Offset == expectedError.Offset, u8"에러가 ParseProgram 과 다릅니다. expected=%zu(%u), actual=%zu(%u)",
+					mcf::ENUM_INDEX(expectedError.ID), expectedError.Offset, mcf::ENUM_INDEX(actualError.ID), actualError.Offset);
+			}
+
+			errorSession.Parse(edited, false, program);
+			FATAL_ASSERT(errorSession.GetErrorCount() == 0 && errorSession.GetReusedStatementCount() == statementCount + 1 && errorSession.GetReparsedStatementCount() == 0, u8"모든 문장을 재사용해야 합니다. reused=%zu, reparsed=%zu",
+				errorSession.GetReusedStatementCount(), errorSession.GetReparsedStatementCount());
+			FATAL_ASSERT(program.ConvertToString() == expected, u8"재사용한 파싱 결과가 다릅니다.");
+
+			// 렉서 에러가 있는 입력도 ParseProgram 과 같은 갯수의 에러를 남겨야 합니다.
+			mcf::Parser::Object emptyParser("", false);
+			mcf::AST::Program emptyProgram;
+			emptyParser.ParseProgram(emptyProgram);
+			errorSession.Parse("", false, emptyProgram);
+			FATAL_ASSERT(errorSession.GetErrorCount() == emptyParser.GetErrorCount(), u8"에러의 갯수가 ParseProgram 과 다릅니다. 실제값[%zu] 예상값[%zu]", errorSession.GetErrorCount(), emptyParser.GetErrorCount());
+			return true;
+		}
+	);
+
+	_names.emplace_back(u8"긴 연산자 체인과 깊은 중첩 식 파싱 테스트");
+	_tests.emplace_back
+	(
+		[&]() -> bool
+		{
+			// 명시적 스택으로 파싱해도 재귀 파싱과 같은 트리가 나와야 합니다.
+			{
+				mcf::Parser::Object parser("let x: dword = -a + b * (c - d) == f(1, g[2], !e) as byte < h;", false);
+				mcf::AST::Program program;
+				parser.ParseProgram(program);
+				FATAL_ASSERT(CheckParserErrors(parser), u8"파싱에 실패 하였습니다.");
+				const std::string expected = "[Let: <VariableSignature: <Identifier: x> COLON <TypeSignature: <Identifier: dword>>> ASSIGN "
+					"<Infix: <Infix: <Prefix: MINUS <Identifier: a>> PLUS <Infix: <Identifier: b> ASTERISK <Group: <Infix: <Identifier: c> MINUS <Identifier: d>>>>> EQUAL "
+					"<Infix: <As: <Call: <Identifier: f> LPAREN <Integer: 1> COMMA <Index: <Identifier: g> LBRACKET <Integer: 2> RBRACKET> COMMA <Prefix: BANG <Identifier: e>> COMMA RPAREN> "
+					"KEYWORD_AS <TypeSignature: <Identifier: byte>>> LT <Identifier: h>>> SEMICOLON]";
+				const std::string actual = program.ConvertToString();
+				FATAL_ASSERT(actual == expected, u8"파싱 결과가 다릅니다.\nExpected:\n%s\nActual:\n%s", expected.c_str(), actual.c_str());
+			}
+
+			// 기본 스레드 스택(1MB)에서 재귀 파싱이라면 넘칠 깊이입니다.
+			constexpr const size_t DEPTH = 200000;
+			std::string chain;
+			std::string call;
+			for (size_t i = 0; i < DEPTH; ++i)
+			{
+				chain += (i == 0) ? "a" : ((i % 2 == 0) ? " + a" : " * a");
+				call += "f(";
+			}
+			call += "a" + std::string(DEPTH, ')');
+
+			const std::string sources[] =
+			{
+				"let chain: dword = " + chain + ";",
+				"let group: dword = " + std::string(DEPTH, '(') + "a" + std::string(DEPTH, ')') + ";",
+				"let prefix: dword = " + std::string(DEPTH, '-') + "a;",
+				"let initializer: dword[] = " + std::string(DEPTH, '{') + "1" + std::string(DEPTH, '}') + ";",
+				"let call: dword = " + call + ";",
+			};
+			for (size_t i = 0; i < MCF_ARRAY_SIZE(sources); ++i)
+			{
+				mcf::Parser::Object parser(sources[i], false);
+				mcf::AST::Program program;
+				parser.ParseProgram(program);
+				FATAL_ASSERT(CheckParserErrors(parser), u8"파싱에 실패 하였습니다. index=%zu", i);
+				FATAL_ASSERT(program.GetStatementCount() == 1, u8"최상위 문장의 갯수가 틀렸습니다. index=%zu", i);
+			}
+
+			// 중첩된 식의 에러는 재귀 파싱처럼 중첩된 식마다 하나씩 쌓입니다. 에러마다 입력 이름이 복사되므로 깊이를 줄여서 확인합니다.
+			constexpr const size_t ERROR_DEPTH = 1000;
+			mcf::Parser::Object parser("let group: dword = " + std::string(ERROR_DEPTH, '(') + "a + " + std::string(ERROR_DEPTH, ')') + ";", false);
+			mcf::AST::Program program;
+			parser.ParseProgram(program);
+			FATAL_ASSERT(parser.GetErrorCount() > ERROR_DEPTH, u8"중첩된 식마다 에러가 있어야 합니다. 실제값[%zu]", parser.GetErrorCount());
+			return true;
+		}
+	);
+
+	_names.emplace_back(u8"노드 타입 visitor 디스패치 테스트");
+	_tests.emplace_back
+	(
+		[&]() -> bool
+		{
+			mcf::Parser::Object parser("let a: dword = { 1, 2 }; let b: dword = { x = 1, y = 2 }; let c: dword = 1 + f(2); unused(a, b, c);", false);
+			mcf::AST::Program program;
+			parser.ParseProgram(program);
+			FATAL_ASSERT(CheckParserErrors(parser), u8"파싱에 실패 하였습니다.");
+
+			const mcf::AST::Expression::Type expectedTypes[] =
+			{
+				mcf::AST::Expression::Type::INITIALIZER,
+				mcf::AST::Expression::Type::MAP_INITIALIZER,
+				mcf::AST::Expression::Type::INFIX,
+			};
+			const size_t statementCount = program.GetStatementCount();
+			FATAL_ASSERT(statementCount == MCF_ARRAY_SIZE(expectedTypes) + 1, u8"최상위 문장의 갯수가 틀렸습니다. 실제값[%zu]", statementCount);
+			for (size_t i = 0; i < statementCount; ++i)
+			{
+				// 저장된 타입과 디스패치된 클래스의 TYPE 이 같아야 합니다.
+				const mcf::AST::Statement::Interface* statement = program.GetUnsafeStatementPointerAt(i);
+				const mcf::AST::Statement::Type visitedType = mcf::AST::Statement::VISIT(statement, [](const auto* node) { return std::remove_pointer_t<decltype(node)>::TYPE; });
+				FATAL_ASSERT(visitedType == statement->GetStatementType(), u8"디스패치된 문장 타입이 다릅니다. index=%zu, 실제값[%s]", i, mcf::AST::Statement::CONVERT_TYPE_TO_STRING(visitedType));
+				if (i == statementCount - 1)
+				{
+					FATAL_ASSERT(visitedType == mcf::AST::Statement::Type::UNUSED, u8"마지막 문장은 unused 여야 합니다. 실제값[%s]", mcf::AST::Statement::CONVERT_TYPE_TO_STRING(visitedType));
+					continue;
+				}
+
+				// MapInitializer 는 Initializer 를 상속하지만 자신의 오버로드로 디스패치 되어야 합니다.
+				const mcf::AST::Expression::Interface* expression = static_cast<const mcf::AST::Statement::Let*>(statement)->GetUnsafeExpressionPointer();
+				const mcf::AST::Expression::Type visitedExpressionType = mcf::AST::Expression::VISIT(expression, mcf::Visitor
+				{
+					[](const mcf::AST::Expression::Initializer*) { return mcf::AST::Expression::Type::INITIALIZER; },
+					[](const mcf::AST::Expression::MapInitializer*) { return mcf::AST::Expression::Type::MAP_INITIALIZER; },
+					[](const mcf::AST::Expression::Interface* node) { return node->GetExpressionType(); },
+				});
+				FATAL_ASSERT(visitedExpressionType == expectedTypes[i], u8"디스패치된 식 타입이 다릅니다. index=%zu, 실제값[%s]", i, mcf::AST::Expression::CONVERT_TYPE_TO_STRING(visitedExpressionType));
+			}
+
+			// 범위를 벗어난 타입은 어떤 오버로드도 호출하지 않고 기본값을 반환해야 합니다.
+			// 테스트는 framework.h 를 포함하지 않으므로 디버그 빌드에서도 MCF_DEBUG_BREAK 를 호출하지 않습니다.
+			const mcf::AST::Statement::Type outOfRangeType = static_cast<mcf::AST::Statement::Type>(mcf::ENUM_COUNT<mcf::AST::Statement::Type>() + 1);
+			bool isVisited = false;
+			const bool visitedOutOfRange = mcf::AST::Statement::NodeList::Visit(outOfRangeType, program.GetUnsafeStatementPointerAt(0), [&](const auto*) { isVisited = true; return true; });
+			FATAL_ASSERT(visitedOutOfRange == false && isVisited == false, u8"범위를 벗어난 타입으로 visitor 를 호출하면 안됩니다.");
+			return true;
+		}
+	);
 }
 
 bool UnitTest::ParserTest::CheckParserErrors(mcf::Parser::Object& parser) noexcept
@@ -19,6 +19,12 @@
 #define FATAL_ERROR(FORMAT, ...) { printf("[Fatal Error]: %s(Line: %d)\n[Description]: ", ##__FILE__, ##__LINE__); printf(FORMAT, __VA_ARGS__); printf("\n"); return false; } ((void)0)
 #endif
 
+// 렉서는 일부 잘못된 입력(끝나지 않은 문자열과 주석 등)을 만나면 디버그 빌드에서 __debugbreak 를 호출합니다.
+// 그런 입력으로 에러 경로를 확인하는 테스트는 MCF_RELEASE_ONLY_TEST 안에 두며, 디버그 빌드의 테스트는 그 에러 경로를 확인하지 않습니다.
+#if !defined(_DEBUG)
+#define MCF_RELEASE_ONLY_TEST
+#endif
+
 namespace UnitTest
 {
 	const mcf::Token::Data TokenInvalid = { mcf::Token::Type::INVALID, "invalid" };
@@ -97,7 +103,12 @@ namespace UnitTest
 		explicit EvaluatorTest(void) noexcept;
 
 	private:
+		static constexpr const char* const FILE_READ_INPUT_PATH = "./test/unittest/texts/test_file_read.txt";
+		static constexpr const char* const FILE_READ_EXPECTED_PATH = "./test/unittest/texts/test_file_read_eval.txt";
+
 		static bool CheckParserErrors(mcf::Parser::Object& parser) noexcept;
+		// 기본 타입(byte, word, dword, qword)을 정의한 scopeTree 로 evaluate 가 평가한 test_file_read.txt 의 결과가 test_file_read_eval.txt 와 같은지 확인합니다.
+		static bool CheckFileReadEvaluation(mcf::Object::ScopeTree& scopeTree, const std::function<mcf::IR::Pointer(mcf::Evaluator::Object& evaluator, mcf::Object::Scope* scope)>& evaluate) noexcept;
 	};
 
 	class CompilerTest final : public BaseTest